@@ -0,0 +1,835 @@
+#include "AnimatedImage.h"
+#include "TextureManager.h"
+
+#include "SFML/Graphics/Image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <fstream>
+
+static uint32_t ReadU32BE(const std::vector<uint8_t>& d, size_t at)
+{
+	return ((uint32_t)d[at] << 24) | ((uint32_t)d[at + 1] << 16) | ((uint32_t)d[at + 2] << 8) | (uint32_t)d[at + 3];
+}
+
+static int ReadU16LE(const std::vector<uint8_t>& d, size_t at)
+{
+	return d[at] | (d[at + 1] << 8);
+}
+
+static uint32_t PngCrc(const uint8_t* data, size_t len, uint32_t crc = 0xFFFFFFFF)
+{
+	static const std::array<uint32_t, 256> table = []()
+	{
+		std::array<uint32_t, 256> t = {};
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+			t[n] = c;
+		}
+		return t;
+	}();
+
+	for (size_t i = 0; i < len; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return crc;
+}
+
+static void WritePngChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t len)
+{
+	for (int s = 24; s >= 0; s -= 8)
+		png.push_back((uint8_t)(len >> s));
+
+	size_t typeStart = png.size();
+	png.insert(png.end(), type, type + 4);
+	if (len > 0)
+		png.insert(png.end(), data, data + len);
+
+	uint32_t crc = PngCrc(png.data() + typeStart, len + 4) ^ 0xFFFFFFFF;
+	for (int s = 24; s >= 0; s -= 8)
+		png.push_back((uint8_t)(crc >> s));
+}
+
+bool AnimationDecoder::IsAnimatedFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	uint8_t sig[8] = {};
+	if (!file.read((char*)sig, 8))
+		return false;
+
+	// a single frame GIF is caught by Open
+	if (std::memcmp(sig, "GIF8", 4) == 0)
+		return true;
+
+	const uint8_t pngSig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	if (std::memcmp(sig, pngSig, 8) != 0)
+		return false;
+
+	// APNGs declare themselves with an acTL chunk before the image data
+	uint8_t header[8] = {};
+	while (file.read((char*)header, 8))
+	{
+		uint32_t len = ((uint32_t)header[0] << 24) | ((uint32_t)header[1] << 16) | ((uint32_t)header[2] << 8) | header[3];
+		if (std::memcmp(header + 4, "acTL", 4) == 0)
+			return true;
+		if (std::memcmp(header + 4, "IDAT", 4) == 0 || std::memcmp(header + 4, "IEND", 4) == 0)
+			return false;
+
+		file.seekg((std::streamoff)len + 4, std::ios::cur);
+	}
+
+	return false;
+}
+
+bool AnimationDecoder::Open(std::vector<uint8_t>&& fileData, std::string& error, unsigned int maxSize)
+{
+	_file = std::make_shared<const std::vector<uint8_t>>(std::move(fileData));
+	_maxSize = maxSize;
+	_frames.clear();
+	_pngIHDR.clear();
+	_pngHeaderChunks.clear();
+	_canvas.clear();
+	_previous.clear();
+	_next = 0;
+	_format = FMT_NONE;
+
+	const uint8_t pngSig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	bool ok = false;
+	if (Data().size() >= 13 && std::memcmp(Data().data(), "GIF8", 4) == 0)
+	{
+		_format = FMT_GIF;
+		ok = ParseGif(error);
+	}
+	else if (Data().size() >= 8 && std::memcmp(Data().data(), pngSig, 8) == 0)
+	{
+		_format = FMT_APNG;
+		ok = ParseApng(error);
+	}
+	else
+	{
+		error = "Not a GIF or PNG";
+	}
+
+	if (ok && (_size.x == 0 || _size.y == 0 || _frames.empty()))
+	{
+		error = "No frames";
+		ok = false;
+	}
+
+	if (ok && (_size.x > _maxSize || _size.y > _maxSize))
+	{
+		error = "Larger than the maximum texture size (" + std::to_string(_size.x) + "x" + std::to_string(_size.y) + ")";
+		ok = false;
+	}
+
+	if (!ok)
+		_frames.clear();
+
+	return ok;
+}
+
+bool AnimationDecoder::ParseGif(std::string& error)
+{
+	const auto& d = Data();
+
+	_size = sf::Vector2u(ReadU16LE(d, 6), ReadU16LE(d, 8));
+
+	size_t pos = 13;
+	const uint8_t packed = d[10];
+	if (packed & 0x80)
+	{
+		_gifPaletteOffset = pos;
+		_gifPaletteSize = 1 << ((packed & 7) + 1);
+		pos += 3 * _gifPaletteSize;
+	}
+
+	auto skipSubBlocks = [&](size_t& p)
+	{
+		while (p < d.size())
+		{
+			uint8_t len = d[p++];
+			if (len == 0)
+				return true;
+			p += len;
+		}
+		return false;
+	};
+
+	// the graphic control extension applies to the next image
+	Frame pending;
+
+	while (pos < d.size())
+	{
+		const uint8_t block = d[pos++];
+
+		if (block == 0x3B)
+			break;
+
+		if (block == 0x21 && pos < d.size())
+		{
+			const uint8_t label = d[pos++];
+			if (label == 0xF9 && pos + 5 < d.size() && d[pos] == 4)
+			{
+				const uint8_t gce = d[pos + 1];
+				const int disposal = (gce >> 2) & 7;
+				pending.dispose = disposal == 2 ? DISPOSE_BACKGROUND : disposal == 3 ? DISPOSE_PREVIOUS : DISPOSE_NONE;
+
+				// browsers play tiny delays at 10fps, and so do we
+				const int delay = ReadU16LE(d, pos + 2) * 10;
+				pending.delayMs = delay <= 10 ? 100 : delay;
+				pending.transparent = (gce & 1) ? d[pos + 4] : -1;
+			}
+
+			if (!skipSubBlocks(pos))
+				break;
+		}
+		else if (block == 0x2C && pos + 9 <= d.size())
+		{
+			Frame frame = pending;
+			pending = Frame();
+
+			frame.rect = sf::IntRect(ReadU16LE(d, pos), ReadU16LE(d, pos + 2), ReadU16LE(d, pos + 4), ReadU16LE(d, pos + 6));
+			const uint8_t imagePacked = d[pos + 8];
+			pos += 9;
+
+			frame.interlaced = imagePacked & 0x40;
+			if (imagePacked & 0x80)
+			{
+				frame.paletteOffset = pos;
+				frame.paletteSize = 1 << ((imagePacked & 7) + 1);
+				pos += 3 * frame.paletteSize;
+			}
+			else
+			{
+				frame.paletteOffset = _gifPaletteOffset;
+				frame.paletteSize = _gifPaletteSize;
+			}
+
+			frame.dataOffset = pos;
+			pos++;
+			if (pos > d.size() || frame.paletteOffset + 3 * frame.paletteSize > d.size())
+				break;
+
+			// a truncated file still shows whatever there is of its last frame
+			const bool complete = skipSubBlocks(pos);
+			_frames.push_back(frame);
+			if (!complete)
+				break;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (_frames.empty())
+	{
+		error = "No images in GIF";
+		return false;
+	}
+
+	return true;
+}
+
+bool AnimationDecoder::ParseApng(std::string& error)
+{
+	const auto& d = Data();
+
+	bool animated = false;
+	bool seenImageData = false;
+	int current = -1;
+
+	size_t pos = 8;
+	while (pos + 12 <= d.size())
+	{
+		const uint32_t len = ReadU32BE(d, pos);
+		const std::string type((const char*)&d[pos + 4], 4);
+		const size_t data = pos + 8;
+		if (data + len + 4 > d.size())
+			break;
+
+		if (type == "IHDR" && len == 13)
+		{
+			_pngIHDR.assign(d.begin() + data, d.begin() + data + len);
+			_size = sf::Vector2u(ReadU32BE(d, data), ReadU32BE(d, data + 4));
+		}
+		else if (type == "acTL")
+		{
+			animated = true;
+		}
+		else if (type == "fcTL" && len >= 26)
+		{
+			Frame frame;
+			frame.rect = sf::IntRect(ReadU32BE(d, data + 12), ReadU32BE(d, data + 16), ReadU32BE(d, data + 4), ReadU32BE(d, data + 8));
+
+			const int num = (d[data + 20] << 8) | d[data + 21];
+			const int den = (d[data + 22] << 8) | d[data + 23];
+			frame.delayMs = std::max(10, num * 1000 / (den == 0 ? 100 : den));
+
+			const uint8_t dispose = d[data + 24];
+			frame.dispose = dispose == 1 ? DISPOSE_BACKGROUND : dispose == 2 ? DISPOSE_PREVIOUS : DISPOSE_NONE;
+			frame.blendOver = d[data + 25] == 1;
+
+			// nothing to go back to before the first frame
+			if (_frames.empty() && frame.dispose == DISPOSE_PREVIOUS)
+				frame.dispose = DISPOSE_BACKGROUND;
+
+			_frames.push_back(frame);
+			current = (int)_frames.size() - 1;
+		}
+		else if (type == "IDAT")
+		{
+			// the default image is only part of the animation if an fcTL came before it
+			seenImageData = true;
+			if (current >= 0)
+				_frames[current].chunks.push_back({ data, len });
+		}
+		else if (type == "fdAT" && len > 4)
+		{
+			if (current >= 0)
+				_frames[current].chunks.push_back({ data + 4, len - 4 });
+		}
+		else if (type == "IEND")
+		{
+			break;
+		}
+		else if (!seenImageData)
+		{
+			// PLTE, tRNS and the like, needed to decode any frame
+			_pngHeaderChunks.push_back({ pos, len + 12 });
+		}
+
+		pos = data + len + 4;
+	}
+
+	if (!animated || _pngIHDR.empty())
+	{
+		error = "Not an animated PNG";
+		return false;
+	}
+
+	_frames.erase(std::remove_if(_frames.begin(), _frames.end(), [](const Frame& f) { return f.chunks.empty(); }), _frames.end());
+	return true;
+}
+
+bool AnimationDecoder::DecodeGifFrame(const Frame& frame, std::vector<uint8_t>& pixels)
+{
+	const int width = frame.rect.width;
+	const int height = frame.rect.height;
+	if (width <= 0 || height <= 0 || frame.paletteSize == 0)
+		return false;
+
+	size_t pos = frame.dataOffset;
+	const std::vector<uint8_t>& data = Data();
+	const int minCodeSize = data[pos++];
+	if (minCodeSize < 2 || minCodeSize > 11)
+		return false;
+
+	std::vector<uint8_t> stream;
+	while (pos < data.size())
+	{
+		const uint8_t len = data[pos++];
+		if (len == 0)
+			break;
+		const size_t end = std::min(pos + len, data.size());
+		stream.insert(stream.end(), data.begin() + pos, data.begin() + end);
+		pos = end;
+	}
+
+	// LZW, codes packed least significant bit first
+	const size_t pixelCount = (size_t)width * height;
+	std::vector<uint8_t> indices;
+	indices.reserve(pixelCount);
+
+	const int clearCode = 1 << minCodeSize;
+	const int endCode = clearCode + 1;
+
+	static thread_local uint16_t prefix[4096];
+	static thread_local uint8_t suffix[4096];
+	static thread_local uint8_t firstChar[4096];
+	static thread_local uint8_t stack[4097];
+
+	for (int c = 0; c < clearCode; c++)
+	{
+		suffix[c] = (uint8_t)c;
+		firstChar[c] = (uint8_t)c;
+	}
+
+	int codeSize = minCodeSize + 1;
+	int nextCode = endCode + 1;
+	int prev = -1;
+	uint32_t bits = 0;
+	int bitCount = 0;
+	size_t sp = 0;
+
+	while (indices.size() < pixelCount)
+	{
+		while (bitCount < codeSize && sp < stream.size())
+		{
+			bits |= (uint32_t)stream[sp++] << bitCount;
+			bitCount += 8;
+		}
+		if (bitCount < codeSize)
+			break;
+
+		int code = bits & ((1 << codeSize) - 1);
+		bits >>= codeSize;
+		bitCount -= codeSize;
+
+		if (code == clearCode)
+		{
+			codeSize = minCodeSize + 1;
+			nextCode = endCode + 1;
+			prev = -1;
+			continue;
+		}
+		if (code == endCode)
+			break;
+
+		if (prev < 0)
+		{
+			if (code >= clearCode)
+				break;
+			indices.push_back((uint8_t)code);
+			prev = code;
+			continue;
+		}
+
+		const int inCode = code;
+		int top = 0;
+
+		// the code being defined right now: the previous string plus its own first character
+		if (code >= nextCode)
+		{
+			if (code > nextCode)
+				break;
+			stack[top++] = firstChar[prev];
+			code = prev;
+		}
+
+		while (code > endCode)
+		{
+			stack[top++] = suffix[code];
+			code = prefix[code];
+		}
+		stack[top++] = (uint8_t)code;
+		const uint8_t first = (uint8_t)code;
+
+		while (top > 0)
+			indices.push_back(stack[--top]);
+
+		if (nextCode < 4096)
+		{
+			prefix[nextCode] = (uint16_t)prev;
+			suffix[nextCode] = first;
+			firstChar[nextCode] = firstChar[prev];
+			nextCode++;
+			if (nextCode == (1 << codeSize) && codeSize < 12)
+				codeSize++;
+		}
+
+		prev = inCode;
+	}
+
+	// interlaced images store every 8th row, then the 4th, 2nd and the rest
+	std::vector<int> rowOrder;
+	rowOrder.reserve(height);
+	if (frame.interlaced)
+	{
+		const int starts[4] = { 0, 4, 2, 1 };
+		const int steps[4] = { 8, 8, 4, 2 };
+		for (int p = 0; p < 4; p++)
+		{
+			for (int y = starts[p]; y < height; y += steps[p])
+				rowOrder.push_back(y);
+		}
+	}
+	else
+	{
+		for (int y = 0; y < height; y++)
+			rowOrder.push_back(y);
+	}
+
+	const uint8_t* palette = Data().data() + frame.paletteOffset;
+	pixels.assign(pixelCount * 4, 0);
+
+	// missing data at the end of a broken file stays transparent
+	const size_t decoded = std::min(indices.size(), pixelCount);
+	for (size_t i = 0; i < decoded; i++)
+	{
+		const int idx = indices[i];
+		if (idx == frame.transparent || idx >= frame.paletteSize)
+			continue;
+
+		const size_t y = rowOrder[i / width];
+		uint8_t* out = &pixels[(y * width + i % width) * 4];
+		out[0] = palette[idx * 3];
+		out[1] = palette[idx * 3 + 1];
+		out[2] = palette[idx * 3 + 2];
+		out[3] = 255;
+	}
+
+	return true;
+}
+
+bool AnimationDecoder::DecodeApngFrame(const Frame& frame, std::vector<uint8_t>& pixels)
+{
+	if (frame.rect.width <= 0 || frame.rect.height <= 0)
+		return false;
+
+	// each frame is repackaged as a plain PNG of its own size and decoded like any other image
+	std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	std::vector<uint8_t> ihdr = _pngIHDR;
+	for (int b = 0; b < 4; b++)
+	{
+		ihdr[b] = (uint8_t)(frame.rect.width >> (24 - b * 8));
+		ihdr[4 + b] = (uint8_t)(frame.rect.height >> (24 - b * 8));
+	}
+	WritePngChunk(png, "IHDR", ihdr.data(), ihdr.size());
+
+	for (auto& chunk : _pngHeaderChunks)
+		png.insert(png.end(), Data().begin() + chunk.first, Data().begin() + chunk.first + chunk.second);
+
+	std::vector<uint8_t> imageData;
+	for (auto& chunk : frame.chunks)
+		imageData.insert(imageData.end(), Data().begin() + chunk.first, Data().begin() + chunk.first + chunk.second);
+	WritePngChunk(png, "IDAT", imageData.data(), imageData.size());
+	WritePngChunk(png, "IEND", nullptr, 0);
+
+	sf::Image img;
+	if (!img.loadFromMemory(png.data(), png.size()))
+		return false;
+
+	if (img.getSize() != sf::Vector2u(frame.rect.width, frame.rect.height))
+		return false;
+
+	pixels.assign(img.getPixelsPtr(), img.getPixelsPtr() + (size_t)frame.rect.width * frame.rect.height * 4);
+	return true;
+}
+
+bool AnimationDecoder::NextFrame(std::vector<uint8_t>* rgba)
+{
+	if (_frames.empty())
+		return false;
+
+	const int width = (int)_size.x;
+	const int height = (int)_size.y;
+	const size_t canvasBytes = (size_t)width * height * 4;
+
+	auto clampRect = [&](const sf::IntRect& rect)
+	{
+		int left = std::clamp(rect.left, 0, width);
+		int top = std::clamp(rect.top, 0, height);
+		int right = std::clamp(rect.left + rect.width, 0, width);
+		int bottom = std::clamp(rect.top + rect.height, 0, height);
+		return sf::IntRect(left, top, right - left, bottom - top);
+	};
+
+	// every loop starts from a clear canvas, otherwise the last frame is disposed of first
+	if (_next == 0 || _canvas.size() != canvasBytes)
+	{
+		_canvas.assign(canvasBytes, 0);
+	}
+	else
+	{
+		const Frame& last = _frames[_next - 1];
+		if (last.dispose == DISPOSE_BACKGROUND)
+		{
+			const sf::IntRect rect = clampRect(last.rect);
+			for (int y = rect.top; y < rect.top + rect.height; y++)
+				std::memset(&_canvas[((size_t)y * width + rect.left) * 4], 0, (size_t)rect.width * 4);
+		}
+		else if (last.dispose == DISPOSE_PREVIOUS && _previous.size() == canvasBytes)
+		{
+			_canvas = _previous;
+		}
+	}
+
+	const Frame& frame = _frames[_next];
+	if (frame.dispose == DISPOSE_PREVIOUS)
+		_previous = _canvas;
+
+	// the header says how big a frame is, and a broken or hostile one can say anything
+	const bool fits = frame.rect.width <= (int)_maxSize && frame.rect.height <= (int)_maxSize;
+
+	const bool decoded = fits && (_format == FMT_GIF ? DecodeGifFrame(frame, _framePixels) : DecodeApngFrame(frame, _framePixels));
+
+	// a broken frame leaves the canvas as it was, and playback carries on
+	if (decoded)
+	{
+		const sf::IntRect rect = clampRect(frame.rect);
+		for (int y = rect.top; y < rect.top + rect.height; y++)
+		{
+			const uint8_t* src = &_framePixels[((size_t)(y - frame.rect.top) * frame.rect.width + (rect.left - frame.rect.left)) * 4];
+			uint8_t* dst = &_canvas[((size_t)y * width + rect.left) * 4];
+
+			if (!frame.blendOver)
+			{
+				std::memcpy(dst, src, (size_t)rect.width * 4);
+				continue;
+			}
+
+			for (int x = 0; x < rect.width; x++, src += 4, dst += 4)
+			{
+				const int srcA = src[3];
+				if (srcA == 255)
+				{
+					std::memcpy(dst, src, 4);
+				}
+				else if (srcA > 0)
+				{
+					// straight alpha "over"
+					const int dstA = dst[3] * (255 - srcA) / 255;
+					const int outA = srcA + dstA;
+					for (int c = 0; c < 3; c++)
+						dst[c] = (uint8_t)((src[c] * srcA + dst[c] * dstA) / outA);
+					dst[3] = (uint8_t)outA;
+				}
+			}
+		}
+	}
+
+	_next = (_next + 1) % (int)_frames.size();
+
+	if (rgba != nullptr)
+	{
+		rgba->resize(canvasBytes);
+		TextureManager::Premultiply(_canvas.data(), rgba->data(), canvasBytes / 4);
+	}
+
+	return decoded;
+}
+
+std::shared_ptr<const AnimationDecoder> AnimationStream::Load(const std::string& path, std::string& error)
+{
+	std::vector<uint8_t> fileData;
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			error = "Failed to open " + path;
+			return nullptr;
+		}
+
+		fileData.resize((size_t)file.tellg());
+		file.seekg(0);
+		file.read((char*)fileData.data(), fileData.size());
+	}
+
+	auto decoder = std::make_shared<AnimationDecoder>();
+	if (!decoder->Open(std::move(fileData), error, sf::Texture::getMaximumSize()))
+		return nullptr;
+
+	if (decoder->FrameCount() < 2)
+	{
+		error = "Not animated";
+		return nullptr;
+	}
+
+	return decoder;
+}
+
+bool AnimationStream::Open(const std::string& path, std::string& error)
+{
+	Close();
+
+	auto source = Load(path, error);
+	if (source == nullptr)
+		return false;
+
+	Open(source);
+	return true;
+}
+
+void AnimationStream::Open(std::shared_ptr<const AnimationDecoder> source)
+{
+	Close();
+
+	// shares the file bytes, the canvas is our own
+	_decoder = *source;
+	_decoder.Rewind();
+
+	_stopping = false;
+	_failed = false;
+	_wanted = 0;
+	_lastWanted = -1;
+	_thread = std::thread([this]() { DecodeLoop(); });
+}
+
+void AnimationStream::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_wake.notify_all();
+
+	if (_thread.joinable())
+		_thread.join();
+
+	for (int i = 0; i < RingSize; i++)
+	{
+		_slots[i] = Slot();
+		_textureFrames[i] = -1;
+		_textures[i] = sf::Texture();
+	}
+
+	_decoder = AnimationDecoder();
+}
+
+bool AnimationStream::IsHeld(int frame) const
+{
+	for (int i = 0; i < RingSize; i++)
+	{
+		if (_slots[i].frame == frame || _textureFrames[i] == frame)
+			return true;
+	}
+	return false;
+}
+
+void AnimationStream::DecodeLoop()
+{
+	const int frameCount = _decoder.FrameCount();
+	const int window = std::min(frameCount, RingSize);
+
+	auto inWindow = [&](int frame) { return (frame - _wanted + frameCount) % frameCount < window; };
+
+	std::vector<uint8_t> pixels;
+
+	while (true)
+	{
+		int target = -1;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wake.wait(lock, [&]()
+				{
+					if (_stopping)
+						return true;
+
+					// the first frame from the one being shown that isn't decoded yet
+					target = -1;
+					for (int k = 0; k < window && target < 0; k++)
+					{
+						int frame = (_wanted + k) % frameCount;
+						if (!IsHeld(frame))
+							target = frame;
+					}
+					return target >= 0;
+				});
+
+			if (_stopping)
+				return;
+		}
+
+		try
+		{
+			// the decoder only goes forwards, going back means starting from the first frame again
+			if (target < _decoder.NextIndex())
+				_decoder.Rewind();
+			while (_decoder.NextIndex() != target)
+				_decoder.NextFrame(nullptr);
+
+			_decoder.NextFrame(&pixels);
+		}
+		catch (const std::exception&)
+		{
+			// out of memory for the canvas or a frame, it won't go better next time
+			_failed = true;
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// playback may have moved on while this frame was decoding
+		if (!inWindow(target) || IsHeld(target))
+			continue;
+
+		for (int i = 0; i < RingSize; i++)
+		{
+			if (_slots[i].frame < 0 || !inWindow(_slots[i].frame))
+			{
+				_slots[i].frame = target;
+				_slots[i].pixels.swap(pixels);
+				break;
+			}
+		}
+	}
+}
+
+sf::Texture* AnimationStream::GetFrame(int frame)
+{
+	if (!IsOpen() || frame < 0 || frame >= FrameCount())
+		return nullptr;
+
+	if (frame != _lastWanted)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_wanted = frame;
+		}
+		_lastWanted = frame;
+		_wake.notify_one();
+	}
+
+	for (int i = 0; i < RingSize; i++)
+	{
+		if (_textureFrames[i] == frame)
+			return &_textures[i];
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	int slot = -1;
+	for (int i = 0; i < RingSize && slot < 0; i++)
+	{
+		if (_slots[i].frame == frame)
+			slot = i;
+	}
+	if (slot < 0)
+		return nullptr;
+
+	// reuse the texture shown longest ago
+	const int frameCount = FrameCount();
+	int reuse = 0;
+	int reuseAge = -1;
+	for (int i = 0; i < RingSize; i++)
+	{
+		int age = _textureFrames[i] < 0 ? frameCount + 1 : (frame - _textureFrames[i] + frameCount) % frameCount;
+		if (age > reuseAge)
+		{
+			reuse = i;
+			reuseAge = age;
+		}
+	}
+
+	sf::Texture& tex = _textures[reuse];
+	if (tex.getSize() != Size())
+	{
+		if (!tex.create(Size().x, Size().y))
+			return nullptr;
+		tex.setSmooth(_smooth);
+	}
+
+	tex.update(_slots[slot].pixels.data());
+	_textureFrames[reuse] = frame;
+	_slots[slot].frame = -1;
+	_uploads++;
+
+	lock.unlock();
+	_wake.notify_one();
+
+	return &tex;
+}
+
+void AnimationStream::SetSmooth(bool smooth)
+{
+	_smooth = smooth;
+	for (int i = 0; i < RingSize; i++)
+		_textures[i].setSmooth(smooth);
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "SFML/Graphics/Rect.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Reads the frames of an animated GIF or APNG one at a time, each composited onto the full canvas.
+// Only the compressed file and the canvas are kept in memory, however long the animation is.
+// Copies share the file bytes and frame table and each keep their own canvas and position.
+class AnimationDecoder
+{
+public:
+
+	// The largest canvas or frame decoded when the caller doesn't know what the GPU takes
+	static constexpr unsigned int DefaultMaxSize = 16384;
+
+	// Cheap check for an animated GIF or PNG, without reading the whole file
+	static bool IsAnimatedFile(const std::string& path);
+
+	// Fails for a canvas wider or taller than maxSize. Frames larger than that are skipped when played.
+	bool Open(std::vector<uint8_t>&& fileData, std::string& error, unsigned int maxSize = DefaultMaxSize);
+
+	inline int FrameCount() const { return (int)_frames.size(); }
+	inline sf::Vector2u Size() const { return _size; }
+	inline int FrameDelayMs(int frame) const { return _frames[frame].delayMs; }
+
+	// The frame that NextFrame will produce. Wraps back to 0 after the last one.
+	inline int NextIndex() const { return _next; }
+
+	// Composites the next frame and copies the canvas into rgba, premultiplied, if it's given
+	bool NextFrame(std::vector<uint8_t>* rgba);
+
+	inline void Rewind() { _next = 0; }
+
+	inline const std::vector<uint8_t>& Data() const { return *_file; }
+
+private:
+
+	enum Format
+	{
+		FMT_NONE,
+		FMT_GIF,
+		FMT_APNG
+	};
+
+	enum Dispose
+	{
+		DISPOSE_NONE,
+		DISPOSE_BACKGROUND,
+		DISPOSE_PREVIOUS
+	};
+
+	struct Frame
+	{
+		sf::IntRect rect = sf::IntRect(0, 0, 0, 0);
+		int delayMs = 100;
+		Dispose dispose = DISPOSE_NONE;
+		bool blendOver = true;
+
+		// GIF
+		int transparent = -1;
+		bool interlaced = false;
+		size_t paletteOffset = 0;
+		int paletteSize = 0;
+		size_t dataOffset = 0;
+
+		// APNG, offset and length of each IDAT / fdAT payload
+		std::vector<std::pair<size_t, size_t>> chunks;
+	};
+
+	bool ParseGif(std::string& error);
+	bool ParseApng(std::string& error);
+
+	// RGBA of the frame's own rect, straight alpha
+	bool DecodeGifFrame(const Frame& frame, std::vector<uint8_t>& pixels);
+	bool DecodeApngFrame(const Frame& frame, std::vector<uint8_t>& pixels);
+
+	Format _format = FMT_NONE;
+	unsigned int _maxSize = DefaultMaxSize;
+	std::shared_ptr<const std::vector<uint8_t>> _file = std::make_shared<const std::vector<uint8_t>>();
+	std::vector<Frame> _frames;
+	sf::Vector2u _size = {};
+
+	size_t _gifPaletteOffset = 0;
+	int _gifPaletteSize = 0;
+
+	// IHDR and the chunks between it and the image data, copied into every frame's PNG
+	std::vector<uint8_t> _pngIHDR;
+	std::vector<std::pair<size_t, size_t>> _pngHeaderChunks;
+
+	int _next = 0;
+	std::vector<uint8_t> _canvas;
+	std::vector<uint8_t> _previous;
+	std::vector<uint8_t> _framePixels;
+};
+
+// Plays an animated image from a small ring of textures. A worker thread decodes the frames just
+// ahead of the one being shown, and they're uploaded into whichever texture was shown longest ago,
+// so memory stays constant however many frames there are.
+// Each sprite has its own, so sprites on different frames don't seek each other's cursor or draw
+// over each other's textures. Only the parsed file is shared, see TextureManager::GetStream.
+class AnimationStream
+{
+public:
+
+	static constexpr int RingSize = 4;
+
+	~AnimationStream() { Close(); }
+
+	// Reads and parses an animated file, ready to be played by any number of streams
+	static std::shared_ptr<const AnimationDecoder> Load(const std::string& path, std::string& error);
+
+	bool Open(const std::string& path, std::string& error);
+	void Open(std::shared_ptr<const AnimationDecoder> source);
+	void Close();
+
+	inline bool IsOpen() const { return _thread.joinable(); }
+
+	// The worker hit an error it can't carry on from, eg. out of memory. No new frames will come.
+	inline bool Failed() const { return _failed; }
+	inline int FrameCount() const { return _decoder.FrameCount(); }
+	inline sf::Vector2u Size() const { return _decoder.Size(); }
+	inline float FrameDelay(int frame) const { return _decoder.FrameDelayMs(frame) / 1000.f; }
+
+	// Render thread only. The texture showing frame, or nullptr if it hasn't been decoded yet.
+	sf::Texture* GetFrame(int frame);
+
+	void SetSmooth(bool smooth);
+
+	inline int Uploads() const { return _uploads; }
+
+private:
+
+	struct Slot
+	{
+		int frame = -1;
+		std::vector<uint8_t> pixels;
+	};
+
+	void DecodeLoop();
+	bool IsHeld(int frame) const;
+
+	AnimationDecoder _decoder;
+
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	bool _stopping = false;
+	std::atomic<bool> _failed = false;
+
+	// guarded by _mutex
+	Slot _slots[RingSize];
+	int _textureFrames[RingSize] = { -1, -1, -1, -1 };
+	int _wanted = 0;
+
+	sf::Texture _textures[RingSize];
+	int _lastWanted = -1;
+	bool _smooth = false;
+	int _uploads = 0;
+};
@@ -0,0 +1,192 @@
+#include "AsyncReadback.h"
+
+#include <SFML/Window/Context.hpp>
+#include "GL/glext.h"
+
+#include <cstring>
+
+// buffer and sync entry points are past GL 1.1, so they're looked up through SFML's context
+static PFNGLGENBUFFERSPROC s_glGenBuffers = nullptr;
+static PFNGLDELETEBUFFERSPROC s_glDeleteBuffers = nullptr;
+static PFNGLBINDBUFFERPROC s_glBindBuffer = nullptr;
+static PFNGLBUFFERDATAPROC s_glBufferData = nullptr;
+static PFNGLMAPBUFFERRANGEPROC s_glMapBufferRange = nullptr;
+static PFNGLUNMAPBUFFERPROC s_glUnmapBuffer = nullptr;
+static PFNGLFENCESYNCPROC s_glFenceSync = nullptr;
+static PFNGLCLIENTWAITSYNCPROC s_glClientWaitSync = nullptr;
+static PFNGLDELETESYNCPROC s_glDeleteSync = nullptr;
+
+template<typename T>
+static bool LoadGLFunction(T& func, const char* name)
+{
+	func = (T)sf::Context::getFunction(name);
+	return func != nullptr;
+}
+
+bool AsyncReadback::LoadGLFunctions()
+{
+	if (_glLoaded)
+		return true;
+
+	_glLoaded = LoadGLFunction(s_glGenBuffers, "glGenBuffers")
+		&& LoadGLFunction(s_glDeleteBuffers, "glDeleteBuffers")
+		&& LoadGLFunction(s_glBindBuffer, "glBindBuffer")
+		&& LoadGLFunction(s_glBufferData, "glBufferData")
+		&& LoadGLFunction(s_glMapBufferRange, "glMapBufferRange")
+		&& LoadGLFunction(s_glUnmapBuffer, "glUnmapBuffer")
+		&& LoadGLFunction(s_glFenceSync, "glFenceSync")
+		&& LoadGLFunction(s_glClientWaitSync, "glClientWaitSync")
+		&& LoadGLFunction(s_glDeleteSync, "glDeleteSync");
+
+	if (!_glLoaded)
+		_error = "Frame readback needs OpenGL 3.2 (pixel buffers and fences)";
+
+	return _glLoaded;
+}
+
+bool AsyncReadback::Start(sf::RenderTexture& source, unsigned long long frame, uint64_t time)
+{
+	if (!LoadGLFunctions())
+		return false;
+
+	auto size = source.getSize();
+	if (size.x != _width || size.y != _height)
+		Resize(size.x, size.y);
+
+	int next = _oldest;
+	while (_buffers[next].pending)
+	{
+		next = (next + 1) % NumBuffers;
+		if (next == _oldest)
+			return false; // the GPU is behind, skip this frame rather than wait
+	}
+
+	Buffer& buf = _buffers[next];
+	buf.frame = frame;
+	buf.time = time;
+
+	s_glBindBuffer(GL_PIXEL_PACK_BUFFER, buf.buffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	s_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	buf.fence = s_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	buf.pending = true;
+
+	return true;
+}
+
+void AsyncReadback::Collect(const std::function<void(const Frame&)>& onFrame)
+{
+	Drain(onFrame, 0, false);
+}
+
+int AsyncReadback::Flush(const std::function<void(const Frame&)>& onFrame, unsigned int timeoutMs)
+{
+	if (!_glLoaded)
+		return Pending();
+
+	return Drain(onFrame, (uint64_t)timeoutMs * 1000000, true);
+}
+
+int AsyncReadback::Pending() const
+{
+	int pending = 0;
+	for (auto& buf : _buffers)
+		pending += buf.pending;
+	return pending;
+}
+
+int AsyncReadback::Drain(const std::function<void(const Frame&)>& onFrame, uint64_t timeoutNs, bool all)
+{
+	if (!_glLoaded)
+		return 0;
+
+	int failed = 0;
+	for (int b = 0; b < NumBuffers; b++)
+	{
+		Buffer& buf = _buffers[_oldest];
+		if (!buf.pending)
+			break;
+
+		GLenum status = s_glClientWaitSync((GLsync)buf.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+		if (status == GL_TIMEOUT_EXPIRED && !all)
+			break;
+
+		s_glDeleteSync((GLsync)buf.fence);
+		buf.fence = nullptr;
+		buf.pending = false;
+		_oldest = (_oldest + 1) % NumBuffers;
+
+		if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)
+		{
+			failed++;
+			continue;
+		}
+
+		s_glBindBuffer(GL_PIXEL_PACK_BUFFER, buf.buffer);
+		const uint8_t* pixels = (const uint8_t*)s_glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (size_t)_width * _height * 4, GL_MAP_READ_BIT);
+		if (pixels != nullptr)
+		{
+			Frame frame;
+			frame.pixels = pixels;
+			frame.width = _width;
+			frame.height = _height;
+			frame.frame = buf.frame;
+			frame.time = buf.time;
+			onFrame(frame);
+
+			s_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		else
+		{
+			failed++;
+		}
+		s_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+
+	return failed;
+}
+
+void AsyncReadback::Resize(unsigned int width, unsigned int height)
+{
+	Release();
+
+	_width = width;
+	_height = height;
+
+	size_t bytes = (size_t)width * height * 4;
+	for (auto& buf : _buffers)
+	{
+		s_glGenBuffers(1, &buf.buffer);
+		s_glBindBuffer(GL_PIXEL_PACK_BUFFER, buf.buffer);
+		s_glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+	}
+	s_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void AsyncReadback::Release()
+{
+	if (_glLoaded)
+	{
+		for (auto& buf : _buffers)
+		{
+			if (buf.fence != nullptr)
+				s_glDeleteSync((GLsync)buf.fence);
+			if (buf.buffer != 0)
+				s_glDeleteBuffers(1, &buf.buffer);
+		}
+	}
+
+	_buffers = {};
+	_oldest = 0;
+	_width = 0;
+	_height = 0;
+}
+
+void AsyncReadback::CopyFlipped(const uint8_t* src, uint8_t* dst, unsigned int width, unsigned int height)
+{
+	size_t stride = (size_t)width * 4;
+	for (unsigned int y = 0; y < height; y++)
+		memcpy(dst + stride * y, src + stride * (height - 1 - y), stride);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Reads a render texture back to the CPU without stalling the render thread.
+// Each Start() copies into one of a small ring of pixel buffer objects and drops a fence behind it,
+// Collect() hands over the readbacks whose fence has signalled, oldest first.
+// All calls must come from the thread that owns the GL context.
+class AsyncReadback
+{
+public:
+
+	static const int NumBuffers = 3;
+
+	struct Frame
+	{
+		const uint8_t* pixels = nullptr;	// straight RGBA8, bottom row first (GL order)
+		unsigned int width = 0;
+		unsigned int height = 0;
+		unsigned long long frame = 0;
+		uint64_t time = 0;
+	};
+
+	~AsyncReadback() { Release(); }
+
+	// Starts reading back source, which must be active. Returns false if every buffer is still
+	// in flight or the GL functions are missing, in which case the frame is skipped.
+	bool Start(sf::RenderTexture& source, unsigned long long frame, uint64_t time);
+
+	// Calls onFrame for each readback that has finished. The pixels are only valid during the call.
+	void Collect(const std::function<void(const Frame&)>& onFrame);
+
+	// Waits up to timeoutMs for each readback still in flight and hands it to onFrame, oldest first.
+	// Returns how many never finished or failed to map; they're thrown away either way.
+	int Flush(const std::function<void(const Frame&)>& onFrame, unsigned int timeoutMs);
+
+	int Pending() const;
+
+	void Release();
+
+	// Copies a readback, bottom row first, into top-row-first order
+	static void CopyFlipped(const uint8_t* src, uint8_t* dst, unsigned int width, unsigned int height);
+
+	inline const std::string& GetError() const { return _error; }
+
+private:
+
+	struct Buffer
+	{
+		GLuint buffer = 0;
+		void* fence = nullptr;
+		unsigned long long frame = 0;
+		uint64_t time = 0;
+		bool pending = false;
+	};
+
+	bool LoadGLFunctions();
+	int Drain(const std::function<void(const Frame&)>& onFrame, uint64_t timeoutNs, bool all);
+	void Resize(unsigned int width, unsigned int height);
+
+	std::array<Buffer, NumBuffers> _buffers;
+	int _oldest = 0;
+
+	unsigned int _width = 0;
+	unsigned int _height = 0;
+
+	bool _glLoaded = false;
+	std::string _error = "";
+};
@@ -0,0 +1,356 @@
+#include "AudioSupervisor.h"
+
+#include <algorithm>
+#include <chrono>
+
+bool PortAudioBackend::Initialize(std::string& error)
+{
+	PaError err = Pa_Initialize();
+	if (err != paNoError)
+	{
+		error = Pa_GetErrorText(err);
+		return false;
+	}
+	return true;
+}
+
+void PortAudioBackend::Terminate()
+{
+	Pa_Terminate();
+}
+
+void PortAudioBackend::ListInputs(std::vector<AudioDevice>& devices, int& defaultDevice)
+{
+	devices.clear();
+
+	int count = Pa_GetDeviceCount();
+	for (int dI = 0; dI < count; dI++)
+	{
+		auto info = Pa_GetDeviceInfo(dI);
+		if (info == nullptr || info->hostApi != 0 || info->maxInputChannels <= 0)
+			continue;
+
+		AudioDevice device;
+		device.name = info->name;
+		device.index = dI;
+		device.maxChannels = info->maxInputChannels;
+		device.sampleRate = (float)info->defaultSampleRate;
+		device.latency = info->defaultLowInputLatency;
+		devices.push_back(device);
+	}
+
+	defaultDevice = Pa_GetDefaultInputDevice();
+}
+
+void* PortAudioBackend::OpenStream(const AudioDevice& device, const AudioStreamFormat* format, std::string& error)
+{
+	PaStreamParameters params = {};
+	params.device = device.index;
+	params.channelCount = format->channels;
+	params.sampleFormat = _sampleFormat;
+	params.suggestedLatency = device.latency;
+	params.hostApiSpecificStreamInfo = nullptr;
+
+	PaStream* stream = nullptr;
+	PaError err = Pa_OpenStream(&stream, &params, nullptr, format->sampleRate, _framesPerBuffer, paClipOff, _callback, (void*)format);
+	if (err != paNoError)
+	{
+		error = std::string("Error opening stream: ") + Pa_GetErrorText(err);
+		return nullptr;
+	}
+
+	err = Pa_StartStream(stream);
+	if (err != paNoError)
+	{
+		error = std::string("Error starting stream: ") + Pa_GetErrorText(err);
+		Pa_CloseStream(stream);
+		return nullptr;
+	}
+
+	return stream;
+}
+
+void PortAudioBackend::CloseStream(void* stream)
+{
+	Pa_StopStream((PaStream*)stream);
+	Pa_CloseStream((PaStream*)stream);
+}
+
+double AudioSupervisor::SteadyClock()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool AudioSupervisor::Initialize(std::string& error)
+{
+	if (_initialized)
+		return true;
+
+	_initialized = _backend->Initialize(error);
+	if (_initialized)
+		ListDevices();
+
+	return _initialized;
+}
+
+void AudioSupervisor::Start(const std::string& deviceName)
+{
+	if (_thread.joinable())
+		return;
+
+	_deviceName = deviceName;
+	_stopping = false;
+	_thread = std::thread(&AudioSupervisor::Supervise, this);
+}
+
+void AudioSupervisor::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_wake.notify_all();
+
+	if (_thread.joinable())
+		_thread.join();
+
+	CloseStream();
+	if (_initialized)
+		_backend->Terminate();
+	_initialized = false;
+}
+
+void AudioSupervisor::PushRequest(Request request, const std::string& name)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_requests.push_back({ request, name });
+	}
+	_wake.notify_all();
+}
+
+void AudioSupervisor::SelectDevice(const std::string& name)
+{
+	PushRequest(REQUEST_SELECT, name);
+}
+
+void AudioSupervisor::SelectDefaultDevice()
+{
+	PushRequest(REQUEST_SELECT_DEFAULT);
+}
+
+void AudioSupervisor::RefreshDevices()
+{
+	PushRequest(REQUEST_REFRESH);
+}
+
+bool AudioSupervisor::TakeStreamChange(AudioStreamChange& change)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_changes.empty())
+		return false;
+
+	change = _changes.front();
+	_changes.erase(_changes.begin());
+	return true;
+}
+
+std::vector<AudioDevice> AudioSupervisor::GetDevices() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _devices;
+}
+
+void AudioSupervisor::Supervise()
+{
+	if (_deviceName != "")
+		OpenDevice(_deviceName, true);
+
+	double retryDelay = FirstRetryDelay;
+	double nextRetry = _clock();
+	bool wasSilent = false;
+
+	while (true)
+	{
+		std::pair<Request, std::string> request;
+		bool hasRequest = false;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wake.wait_for(lock, std::chrono::milliseconds(100), [&] { return _stopping || !_requests.empty(); });
+			if (_stopping)
+				break;
+
+			_polls++;
+
+			if (!_requests.empty())
+			{
+				request = _requests.front();
+				_requests.pop_front();
+				hasRequest = true;
+			}
+		}
+
+		if (hasRequest)
+		{
+			if (request.first == REQUEST_SELECT)
+			{
+				OpenDevice(request.second, true);
+			}
+			else if (request.first == REQUEST_SELECT_DEFAULT)
+			{
+				std::string name;
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					for (auto& dev : _devices)
+						if (dev.index == _defaultDevice)
+							name = dev.name;
+				}
+				if (name != "")
+					OpenDevice(name, true);
+			}
+			else if (request.first == REQUEST_REFRESH)
+			{
+				Restart(true);
+			}
+
+			// whatever was asked for starts the waiting over
+			retryDelay = FirstRetryDelay;
+			nextRetry = _clock() + retryDelay;
+			continue;
+		}
+
+		if (!_silent)
+		{
+			retryDelay = FirstRetryDelay;
+			wasSilent = false;
+			continue;
+		}
+
+		// the first attempt is straight away, the render thread already waited a moment for audio
+		if (!wasSilent)
+		{
+			wasSilent = true;
+			nextRetry = _clock();
+		}
+
+		if (_deviceName != "" && _clock() >= nextRetry)
+		{
+			_reconnectAttempts++;
+			Restart(false);
+
+			nextRetry = _clock() + retryDelay;
+			retryDelay = std::min(retryDelay * 2, MaxRetryDelay);
+		}
+	}
+}
+
+void AudioSupervisor::ListDevices()
+{
+	std::vector<AudioDevice> devices;
+	int defaultDevice = -1;
+	_backend->ListInputs(devices, defaultDevice);
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_devices = devices;
+	}
+	_defaultDevice = defaultDevice;
+	_devicesVersion++;
+}
+
+void AudioSupervisor::Restart(bool reportLost)
+{
+	// the host only finds devices that were plugged in or removed when it starts up
+	CloseStream();
+	if (_initialized)
+		_backend->Terminate();
+
+	std::string error;
+	_initialized = _backend->Initialize(error);
+	if (!_initialized)
+	{
+		AudioStreamChange change;
+		change.device.name = _deviceName;
+		change.message = "Audio host failed to start: " + error;
+		Publish(change);
+		return;
+	}
+
+	ListDevices();
+
+	if (_deviceName != "")
+		OpenDevice(_deviceName, reportLost);
+}
+
+bool AudioSupervisor::OpenDevice(const std::string& name, bool reportLost)
+{
+	CloseStream();
+
+	// kept even if it's missing, so it's opened again once it comes back
+	_deviceName = name;
+
+	AudioStreamChange change;
+	bool found = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto& dev : _devices)
+		{
+			if (dev.name == name)
+			{
+				change.device = dev;
+				found = true;
+				break;
+			}
+		}
+	}
+
+	if (!found)
+	{
+		if (reportLost)
+		{
+			change.device.name = name;
+			change.lost = true;
+			change.message = "Audio device not found: " + name;
+			Publish(change);
+		}
+		return false;
+	}
+
+	_format = std::make_unique<AudioStreamFormat>();
+	_format->channels = std::max(1, std::min((int)_maxChannels, change.device.maxChannels));
+	_format->sampleRate = change.device.sampleRate;
+
+	std::string error;
+	_stream = _backend->OpenStream(change.device, _format.get(), error);
+	if (_stream == nullptr)
+	{
+		_format.reset();
+		change.message = "Couldn't open audio device " + name + ": " + error;
+		Publish(change);
+		return false;
+	}
+
+	_streaming = true;
+	change.connected = true;
+	change.channels = _format->channels;
+	change.message = "Audio stream started on device " + std::to_string(change.device.index) + ": " + name;
+	Publish(change);
+	return true;
+}
+
+void AudioSupervisor::CloseStream()
+{
+	if (_stream != nullptr)
+		_backend->CloseStream(_stream);
+
+	// the callback has stopped, so its format can go
+	_stream = nullptr;
+	_format.reset();
+	_streaming = false;
+}
+
+void AudioSupervisor::Publish(const AudioStreamChange& change)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_changes.push_back(change);
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "portaudio.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct AudioDevice
+{
+	std::string name;
+	int index = -1;
+	int maxChannels = 0;
+	float sampleRate = 44100;
+	double latency = 0;
+};
+
+// Handed to the stream callback as its userData, valid for as long as the stream is open
+struct AudioStreamFormat
+{
+	int channels = 1;
+	float sampleRate = 44100;
+};
+
+// The parts of PortAudio the supervisor uses, so a test can stand in for the host
+class AudioBackend
+{
+public:
+	virtual ~AudioBackend() {}
+
+	// Initialize again after Terminate picks up devices plugged in or removed since
+	virtual bool Initialize(std::string& error) = 0;
+	virtual void Terminate() = 0;
+
+	virtual void ListInputs(std::vector<AudioDevice>& devices, int& defaultDevice) = 0;
+
+	// Opens and starts capturing, nullptr on failure
+	virtual void* OpenStream(const AudioDevice& device, const AudioStreamFormat* format, std::string& error) = 0;
+	virtual void CloseStream(void* stream) = 0;
+};
+
+class PortAudioBackend : public AudioBackend
+{
+public:
+	PortAudioBackend(PaStreamCallback* callback, PaSampleFormat sampleFormat, unsigned long framesPerBuffer)
+		: _callback(callback), _sampleFormat(sampleFormat), _framesPerBuffer(framesPerBuffer) {}
+
+	bool Initialize(std::string& error) override;
+	void Terminate() override;
+	void ListInputs(std::vector<AudioDevice>& devices, int& defaultDevice) override;
+	void* OpenStream(const AudioDevice& device, const AudioStreamFormat* format, std::string& error) override;
+	void CloseStream(void* stream) override;
+
+private:
+	PaStreamCallback* _callback = nullptr;
+	PaSampleFormat _sampleFormat = paFloat32;
+	unsigned long _framesPerBuffer = 512;
+};
+
+// What the render thread sees of the audio input after the supervisor changed it
+struct AudioStreamChange
+{
+	bool connected = false;
+	bool lost = false;		// the device isn't listed any more
+	AudioDevice device;		// the device now capturing, or the one that failed
+	int channels = 1;		// channels the stream captures
+	std::string message;	// for the log
+};
+
+// Owns the audio host on a thread of its own. Listing devices, re-initialising the host to find
+// new ones, and opening or reopening streams all happen there, so none of it can hold up a frame.
+// When the input goes silent the stream is reopened, waiting twice as long after every attempt
+// that doesn't bring the audio back. The render thread reads the cached device list and is told
+// once a new stream is already capturing.
+class AudioSupervisor
+{
+public:
+
+	static constexpr double FirstRetryDelay = 1.0;
+	static constexpr double MaxRetryDelay = 30.0;
+
+	// Seconds on a steady clock, which the retry delays are counted on. A test can run them on its own.
+	using Clock = std::function<double()>;
+	static double SteadyClock();
+
+	explicit AudioSupervisor(std::unique_ptr<AudioBackend> backend, Clock clock = SteadyClock) : _backend(std::move(backend)), _clock(clock) {}
+	~AudioSupervisor() { Stop(); }
+
+	// Initialises the host and lists the devices on the calling thread
+	bool Initialize(std::string& error);
+
+	// Starts the supervisor thread, which opens deviceName if it's given
+	void Start(const std::string& deviceName);
+
+	// Closes the stream and the host
+	void Stop();
+
+	// Requests, all carried out on the supervisor thread
+	void SelectDevice(const std::string& name);
+	void SelectDefaultDevice();
+	void RefreshDevices();
+
+	// Channels asked of the next stream opened, as many as the device has up to this. Stereo by default.
+	inline void SetMaxChannels(int channels) { _maxChannels = channels; }
+
+	// The render thread tells the supervisor whether audio is arriving
+	inline void ReportSilence() { _silent = true; }
+	inline void ReportAudio() { _silent = false; }
+
+	// Render thread. True once for every stream opened or lost since the last call.
+	bool TakeStreamChange(AudioStreamChange& change);
+
+	// A copy of the last device list, and a number that changes every time it's listed again
+	std::vector<AudioDevice> GetDevices() const;
+	inline unsigned int DevicesVersion() const { return _devicesVersion; }
+	inline int DefaultDevice() const { return _defaultDevice; }
+
+	inline int ReconnectAttempts() const { return _reconnectAttempts; }
+
+	// Times the supervisor thread has woken to look at the requests and the silence
+	inline unsigned int Polls() const { return _polls; }
+	inline bool IsStreaming() const { return _streaming; }
+
+private:
+
+	enum Request
+	{
+		REQUEST_SELECT,
+		REQUEST_SELECT_DEFAULT,
+		REQUEST_REFRESH
+	};
+
+	void Supervise();
+	void PushRequest(Request request, const std::string& name = "");
+
+	// Supervisor thread
+	void ListDevices();
+	void Restart(bool reportLost);
+	bool OpenDevice(const std::string& name, bool reportLost);
+	void CloseStream();
+	void Publish(const AudioStreamChange& change);
+
+	std::unique_ptr<AudioBackend> _backend;
+	Clock _clock;
+
+	std::thread _thread;
+	mutable std::mutex _mutex;
+	std::condition_variable _wake;
+	bool _stopping = false;
+
+	// guarded by _mutex
+	std::deque<std::pair<Request, std::string>> _requests;
+	std::vector<AudioDevice> _devices;
+	std::vector<AudioStreamChange> _changes;
+
+	std::atomic<unsigned int> _devicesVersion = 0;
+	std::atomic<int> _defaultDevice = -1;
+	std::atomic<bool> _silent = false;
+	std::atomic<int> _reconnectAttempts = 0;
+	std::atomic<unsigned int> _polls = 0;
+	std::atomic<bool> _streaming = false;
+	std::atomic<int> _maxChannels = 2;
+
+	// supervisor thread only
+	std::string _deviceName;
+	void* _stream = nullptr;
+	std::unique_ptr<AudioStreamFormat> _format;
+	bool _initialized = false;
+};
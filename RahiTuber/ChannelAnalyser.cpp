@@ -0,0 +1,394 @@
+#include "ChannelAnalyser.h"
+
+#include "simple_fft/fft.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <xmmintrin.h>
+#define CHANNELS_SSE 1
+#else
+#define CHANNELS_SSE 0
+#endif
+
+ChannelAnalyser::ChannelAnalyser()
+{
+	_channelData.resize(MaxChannels);
+	for (auto& channel : _channelData)
+		channel.ring.resize(RingSize, 0.f);
+}
+
+ChannelAnalyser::~ChannelAnalyser()
+{
+	{
+		std::lock_guard<std::mutex> lock(_poolMutex);
+		_stopping = true;
+	}
+	_poolWake.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		if (worker.joinable())
+			worker.join();
+	}
+}
+
+void ChannelAnalyser::Push(const float* interleaved, unsigned long frames, int channels, float sampleRate)
+{
+	channels = std::clamp(channels, 1, MaxChannels);
+
+	std::lock_guard<std::mutex> lock(_ringMutex);
+
+	if (channels != _channels)
+	{
+		_channels = channels;
+		_written = 0;
+		_analysedWritten = 0;
+	}
+
+	// at most two runs, either side of the end of the rings
+	float sumSquares[MaxChannels] = {};
+	unsigned long done = 0;
+	while (done < frames)
+	{
+		size_t start = (_written + done) & (RingSize - 1);
+		size_t count = std::min((size_t)(frames - done), (size_t)RingSize - start);
+
+		float* out[MaxChannels];
+		for (int c = 0; c < channels; c++)
+			out[c] = _channelData[c].ring.data() + start;
+
+		Deinterleave(interleaved + (size_t)done * channels, count, channels, out);
+		for (int c = 0; c < channels; c++)
+			for (size_t s = 0; s < count; s++)
+				sumSquares[c] += out[c][s] * out[c][s];
+
+		done += (unsigned long)count;
+	}
+
+	_written += frames;
+
+	if (frames > 0)
+	{
+		for (int c = 0; c < channels; c++)
+			_gates[c].Process(std::sqrt(sumSquares[c] / frames), frames / sampleRate);
+	}
+}
+
+void ChannelAnalyser::Analyse(const Settings& settings)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	int channels = 0;
+	bool newAudio = false;
+	{
+		std::lock_guard<std::mutex> lock(_ringMutex);
+		channels = _channels;
+
+		newAudio = _written != _analysedWritten && _written >= WindowSize;
+		if (newAudio)
+		{
+			_analysedWritten = _written;
+
+			// the mix is measured from squared samples, and so is each channel
+			size_t first = (_written - WindowSize) & (RingSize - 1);
+			for (int c = 0; c < channels; c++)
+			{
+				Channel& channel = _channelData[c];
+				channel.window.resize(WindowSize);
+				for (int s = 0; s < WindowSize; s++)
+				{
+					float spl = channel.ring[(first + s) & (RingSize - 1)];
+					channel.window[s] = spl * spl;
+				}
+			}
+		}
+
+		for (int c = 0; c < channels; c++)
+		{
+			_channelData[c].newAudio = newAudio;
+			_channelData[c].audioTime = _written / (double)settings.sampleRate;
+		}
+	}
+
+	if (channels == 0)
+		return;
+
+	_settings = settings;
+
+	int threadCount = std::min(channels - 1, (int)std::thread::hardware_concurrency() - 1);
+	while ((int)_workers.size() < threadCount)
+		_workers.emplace_back(&ChannelAnalyser::WorkerLoop, this);
+
+	{
+		std::lock_guard<std::mutex> lock(_poolMutex);
+		_jobCount = channels;
+		_jobsDone = 0;
+		_nextJob = 0;
+		_generation++;
+	}
+	_poolWake.notify_all();
+
+	RunJobs();
+
+	// every worker has to be back waiting before the jobs can be handed out again
+	{
+		std::unique_lock<std::mutex> lock(_poolMutex);
+		_poolDone.wait(lock, [&]() { return _jobsDone == _jobCount && _activeWorkers == 0; });
+	}
+
+	_analyseMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void ChannelAnalyser::Silence()
+{
+	for (auto& channel : _channelData)
+		channel.bands = Bands();
+}
+
+void ChannelAnalyser::Reset()
+{
+	std::lock_guard<std::mutex> lock(_ringMutex);
+	_channels = 0;
+	_written = 0;
+	_analysedWritten = 0;
+
+	for (auto& channel : _channelData)
+	{
+		channel.bands = Bands();
+		channel.softFall = 0;
+		channel.max = 1;
+		channel.votes.Clear();
+		channel.lastSwitched = 0;
+		channel.phoneme = 0;
+		channel.levels = Levels();
+	}
+
+	for (auto& gate : _gates)
+		gate.Reset();
+}
+
+ChannelAnalyser::Levels ChannelAnalyser::GetLevels(int channel) const
+{
+	if (channel < 0 || channel >= _channels)
+		return Levels();
+
+	return _channelData[channel].levels;
+}
+
+bool ChannelAnalyser::VoiceActive(int channel) const
+{
+	if (channel < 0 || channel >= _channels)
+		return false;
+
+	return _gates[channel].IsOpen();
+}
+
+void ChannelAnalyser::SetGate(float marginDb, float hangover)
+{
+	for (auto& gate : _gates)
+	{
+		gate.SetMarginDb(marginDb);
+		gate.SetHangover(hangover);
+	}
+}
+
+void ChannelAnalyser::WorkerLoop()
+{
+	unsigned int seen = 0;
+
+	std::unique_lock<std::mutex> lock(_poolMutex);
+	while (true)
+	{
+		_poolWake.wait(lock, [&]() { return _stopping || _generation != seen; });
+		if (_stopping)
+			return;
+
+		seen = _generation;
+		_activeWorkers++;
+		lock.unlock();
+
+		RunJobs();
+
+		lock.lock();
+		_activeWorkers--;
+		_poolDone.notify_all();
+	}
+}
+
+void ChannelAnalyser::RunJobs()
+{
+	int job = 0;
+	while ((job = _nextJob++) < _jobCount)
+	{
+		AnalyseChannel(_channelData[job]);
+
+		if (++_jobsDone == _jobCount)
+		{
+			std::lock_guard<std::mutex> lock(_poolMutex);
+			_poolDone.notify_all();
+		}
+	}
+}
+
+void ChannelAnalyser::AnalyseChannel(Channel& channel)
+{
+	const Settings& settings = _settings;
+
+	if (channel.newAudio)
+	{
+		MeasureBands(channel.window, settings.splits, channel.bands, channel.frequencyData, channel.powerSpectrum);
+
+		int detected = 0;
+		if (settings.classifier != nullptr && channel.powerSpectrum.empty() == false)
+		{
+			channel.classifier = *settings.classifier;
+			detected = channel.classifier.Process(channel.powerSpectrum.data(), (int)channel.powerSpectrum.size(), settings.sampleRate);
+		}
+		VotePhoneme(channel, detected);
+	}
+
+	// the same smoothing as the mix's mid band, which drives the talk level
+	float midHi = std::abs(channel.bands.mid);
+	if (settings.filtering)
+		midHi = std::max(0.f, midHi - (channel.bands.treble + 0.2f * channel.bands.bass));
+
+	channel.softFall -= channel.softFall / settings.softFallAmount;
+	channel.softFall += midHi / settings.softFallAmount;
+	if (midHi > channel.softFall)
+		channel.softFall = midHi;
+
+	if (midHi > settings.fixedMax && settings.softMaximum)
+		channel.max = midHi;
+	else
+		channel.max = settings.fixedMax;
+
+	channel.levels.bands = channel.bands;
+	channel.levels.talk = settings.compression ? Compress(channel.softFall) : channel.softFall;
+	channel.levels.max = channel.max;
+	channel.levels.phoneme = channel.phoneme;
+}
+
+void ChannelAnalyser::VotePhoneme(Channel& channel, int detected)
+{
+	double audioTime = channel.audioTime;
+	if (audioTime < channel.lastSwitched)
+	{
+		channel.votes.Clear();
+		channel.lastSwitched = audioTime;
+	}
+
+	channel.votes.Expire(audioTime - _settings.voteWindow);
+	channel.votes.Push(audioTime, detected);
+
+	if (audioTime - channel.lastSwitched <= _settings.switchDelay)
+		return;
+
+	channel.lastSwitched = audioTime;
+
+	// in the same order as the mix, so the later phonemes win a tie
+	int numVotes = channel.votes.Size();
+	for (int p = 0; p < 5; p++)
+	{
+		int phoneme = PhonemeClassifier::ClassPhoneme(p + 1);
+		if (_settings.confidenceBoost[p] * channel.votes.Count(phoneme) > numVotes)
+			channel.phoneme = phoneme;
+	}
+}
+
+void ChannelAnalyser::Deinterleave(const float* interleaved, size_t frames, int channels, float* const* out)
+{
+	size_t f = 0;
+
+#if CHANNELS_SSE
+	if (channels == 2)
+	{
+		for (; f + 4 <= frames; f += 4)
+		{
+			__m128 a = _mm_loadu_ps(interleaved + f * 2);
+			__m128 b = _mm_loadu_ps(interleaved + f * 2 + 4);
+			_mm_storeu_ps(out[0] + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out[1] + f, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+	}
+	else if (channels == 4)
+	{
+		for (; f + 4 <= frames; f += 4)
+		{
+			__m128 r0 = _mm_loadu_ps(interleaved + f * 4);
+			__m128 r1 = _mm_loadu_ps(interleaved + f * 4 + 4);
+			__m128 r2 = _mm_loadu_ps(interleaved + f * 4 + 8);
+			__m128 r3 = _mm_loadu_ps(interleaved + f * 4 + 12);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(out[0] + f, r0);
+			_mm_storeu_ps(out[1] + f, r1);
+			_mm_storeu_ps(out[2] + f, r2);
+			_mm_storeu_ps(out[3] + f, r3);
+		}
+	}
+#endif
+
+	for (; f < frames; f++)
+	{
+		const float* frame = interleaved + f * channels;
+		for (int c = 0; c < channels; c++)
+			out[c][f] = frame[c];
+	}
+}
+
+void ChannelAnalyser::MeasureBands(const std::vector<real_type>& samples, const BandSplits& splits, Bands& bands,
+	std::vector<complex_type>& frequencyData, std::vector<float>& powerSpectrum)
+{
+	bands = Bands();
+
+	auto FFTsize = samples.size();
+
+	frequencyData.clear();
+	frequencyData.resize(FFTsize);
+	powerSpectrum.resize(FFTsize);
+
+	if (FFTsize == 0)
+		return;
+
+	const char* error_description = 0;
+	simple_fft::FFT(samples, frequencyData, FFTsize, error_description);
+
+	for (unsigned int it = 0; it < frequencyData.size(); it++)
+	{
+		auto re = frequencyData[it].real();
+		auto im = frequencyData[it].imag();
+		powerSpectrum[it] = re * re + im * im;
+		auto magnitude = std::sqrt(re * re + im * im);
+
+		// flatten the FFT graph
+		float point = it / 20 + 0.3f;
+		magnitude = magnitude * pow(atan(point), 2);
+		if (it == 0) magnitude *= 0.7f;
+
+		if (it > 1 && it < FFTsize / splits.sub && magnitude > bands.sub)
+			bands.sub = magnitude;
+
+		if (it > FFTsize / splits.sub && it < FFTsize / splits.bass && magnitude > bands.bass)
+			bands.bass = magnitude;
+
+		if (it > FFTsize / splits.bass && it < FFTsize / splits.mid && magnitude > bands.mid)
+			bands.mid = magnitude;
+
+		if (it > FFTsize / splits.mid && it < FFTsize / splits.treble && magnitude > bands.treble)
+			bands.treble = magnitude;
+
+		if (magnitude > bands.overall && it < FFTsize / splits.treble)
+			bands.overall = magnitude;
+	}
+}
+
+float ChannelAnalyser::Compress(float level)
+{
+	const float halfPi = 1.57079632679f;
+
+	level = std::clamp(level, 0.f, 1.f);
+	level = (1.f - level) * std::sin(halfPi * level) + level * std::sin(halfPi * std::pow(level, 0.5f));
+	return std::clamp(level, 0.f, 1.f);
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "NoiseGate.h"
+#include "PhonemeClassifier.h"
+#include "PhonemeVoter.h"
+
+#include "simple_fft/fft_settings.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Splits a multi-channel capture into one stream per input channel, and measures each of them the way
+// the mix is measured: band levels from an FFT, a smoothed talk level, and a phoneme once the spectral
+// classifier is calibrated. The channels are analysed in parallel on a few worker threads. Layers and
+// co-hosts bound to a channel read its levels instead of the mix's, and each channel has a voice gate of its own.
+class ChannelAnalyser
+{
+public:
+
+	static constexpr int MaxChannels = 8;
+	static constexpr int RingSize = 8192;		// samples kept per channel, a power of two
+	static constexpr int WindowSize = 1024;		// samples per FFT, the same as the mix
+
+	// Peak magnitude in each band
+	struct Bands
+	{
+		float sub = 0;
+		float bass = 0;
+		float mid = 0;
+		float treble = 0;
+		float overall = 0;
+	};
+
+	// Band edges as fractions of the FFT size, see AudioConfig
+	struct BandSplits
+	{
+		float sub = 58.82f;
+		float bass = 23.25f;
+		float mid = 6.09f;
+		float treble = 2.f;
+	};
+
+	struct Settings
+	{
+		BandSplits splits;
+		float softFallAmount = 10.f;
+		float fixedMax = 1.f;
+		bool softMaximum = false;
+		bool filtering = false;
+		bool compression = false;
+		float sampleRate = 44100;
+
+		// the calibrated spectral classifier, copied for each channel. Without it channels have no phonemes.
+		const PhonemeClassifier* classifier = nullptr;
+		float switchDelay = 0.1f;
+		float voteWindow = 0.2f;
+		float confidenceBoost[5] = { 3, 3, 6, 40, 6 };	// A, E, S, P, W
+	};
+
+	struct Levels
+	{
+		Bands bands;
+		float talk = 0;		// the smoothed mid level, what layers see as the talk level
+		float max = 1;
+		int phoneme = 0;
+	};
+
+	ChannelAnalyser();
+	~ChannelAnalyser();
+
+	// Audio callback. Copies each channel of an interleaved buffer into a ring of its own, and feeds the block's RMS to the channel's gate.
+	void Push(const float* interleaved, unsigned long frames, int channels, float sampleRate);
+
+	// Render thread, every frame. Measures any channel with new audio and updates the levels of all of them.
+	void Analyse(const Settings& settings);
+
+	// Clears the levels when the input goes quiet, like the mix's
+	void Silence();
+
+	// Forgets the captured audio, for a new stream
+	void Reset();
+
+	// Channels in the stream, 0 until audio arrives
+	inline int Channels() const { return _channels; }
+
+	// Levels of a channel as of the last Analyse
+	Levels GetLevels(int channel) const;
+
+	// Whether the channel's gate hears a voice, for layers that talk on voice. Set up like the mix's gate.
+	bool VoiceActive(int channel) const;
+	void SetGate(float marginDb, float hangover);
+
+	// Time the last Analyse took, with every channel spread over the worker threads
+	inline float AnalyseMs() const { return _analyseMs; }
+
+	// Splits interleaved samples into one array per channel. Stereo and 4-channel input are shuffled 4 frames at a time.
+	static void Deinterleave(const float* interleaved, size_t frames, int channels, float* const* out);
+
+	// FFT of one window, and the peak magnitude in each band. The mix is measured this way too.
+	static void MeasureBands(const std::vector<real_type>& samples, const BandSplits& splits, Bands& bands,
+		std::vector<complex_type>& frequencyData, std::vector<float>& powerSpectrum);
+
+	// The compression curve: differences in level count for less as the level nears the maximum
+	static float Compress(float level);
+
+private:
+
+	struct Channel
+	{
+		std::vector<float> ring;
+
+		std::vector<real_type> window;
+		std::vector<complex_type> frequencyData;
+		std::vector<float> powerSpectrum;
+		bool newAudio = false;
+		double audioTime = 0;
+
+		Bands bands;
+		float softFall = 0;
+		float max = 1;
+
+		PhonemeClassifier classifier;
+		PhonemeVoter votes;
+		double lastSwitched = 0;
+		int phoneme = 0;
+
+		Levels levels;
+	};
+
+	void AnalyseChannel(Channel& channel);
+	void VotePhoneme(Channel& channel, int detected);
+
+	void WorkerLoop();
+	void RunJobs();
+
+	std::vector<Channel> _channelData;
+	std::array<NoiseGate, MaxChannels> _gates;
+
+	// the rings and how much has been written to them, shared with the audio callback
+	std::mutex _ringMutex;
+	std::atomic<int> _channels = 0;
+	unsigned long long _written = 0;
+	unsigned long long _analysedWritten = 0;
+
+	Settings _settings;
+	float _analyseMs = 0;
+
+	// workers take channels until there are none left, the render thread takes them too
+	std::vector<std::thread> _workers;
+	std::mutex _poolMutex;
+	std::condition_variable _poolWake;
+	std::condition_variable _poolDone;
+	unsigned int _generation = 0;
+	int _activeWorkers = 0;
+	bool _stopping = false;
+	std::atomic<int> _nextJob = 0;
+	std::atomic<int> _jobsDone = 0;
+	int _jobCount = 0;
+};
@@ -0,0 +1,156 @@
+#include "CoHostAvatar.h"
+
+#ifdef _WIN32
+#include "SpoutGL/SpoutSender.h"
+#endif
+
+#include "SFML/OpenGL.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+CoHostAvatar::CoHostAvatar(AppConfig* appConfig, UIConfig* uiConfig) : _appConfig(appConfig), _uiConfig(uiConfig)
+{
+	_layerMan = new LayerManager();
+	_layerMan->SetPrimary(false);
+	_layerMan->Init(_appConfig, _uiConfig);
+}
+
+CoHostAvatar::~CoHostAvatar()
+{
+	CloseOutput();
+	delete _layerMan;
+}
+
+void CoHostAvatar::Apply(const CoHostSettings& settings)
+{
+	int maxSize = (int)sf::Texture::getMaximumSize();
+	unsigned int width = std::clamp(settings.width, 16, maxSize);
+	unsigned int height = std::clamp(settings.height, 16, maxSize);
+
+	if (!_applied || _rt.getSize() != sf::Vector2u(width, height))
+	{
+		if (!_rt.create(width, height))
+		{
+			_error = "Couldn't create a " + std::to_string(width) + "x" + std::to_string(height) + " render texture";
+			logToFile(_appConfig, settings.name + ": " + _error);
+		}
+	}
+
+	if (!_applied || settings.layerSet != _settings.layerSet)
+		_pendingLayerSet = settings.layerSet;
+
+	if (!_applied || settings.name != _settings.name)
+	{
+		CloseOutput();
+		_outputFailed = false;
+	}
+
+	_settings = settings;
+	_applied = true;
+}
+
+void CoHostAvatar::Draw(const FrameTime& frame, float talkLevel, float talkMax, PhonemeMask phMask)
+{
+	sf::Clock drawTimer;
+
+	// a set can't be loaded over one that's still loading, so it waits for it
+	if (_pendingLayerSet.empty() == false && _layerMan->IsLoading() == false)
+	{
+		_layerMan->LoadLayers(_pendingLayerSet);
+		_pendingLayerSet = "";
+	}
+
+	_layerMan->CheckHotkeys();
+
+	_rt.clear(sf::Color(0, 0, 0, 0));
+	_layerMan->Draw(frame, &_rt, _rt.getSize().y, _rt.getSize().x, talkLevel, talkMax, phMask);
+	_rt.display();
+
+	SendOutput();
+
+	_drawMs = drawTimer.getElapsedTime().asMicroseconds() * 0.001f;
+}
+
+std::string CoHostAvatar::OutputName() const
+{
+#ifdef _WIN32
+	return "RahiTuber - " + _settings.name;
+#else
+	// shared memory names can't have slashes after the first, and spaces make them awkward to pass around
+	std::string suffix = _settings.name;
+	for (auto& c : suffix)
+	{
+		if (!std::isalnum((unsigned char)c))
+			c = '_';
+	}
+	return _appConfig->_sharedMemoryName + "_" + suffix;
+#endif
+}
+
+void CoHostAvatar::SendOutput()
+{
+	if (_outputFailed)
+		return;
+
+#ifdef _WIN32
+	if (_appConfig->_useSpout2Sender == false)
+	{
+		CloseOutput();
+		return;
+	}
+
+	if (_spout == nullptr)
+	{
+		_openOutputName = OutputName();
+		_spout = new Spout();
+		_spout->SetSenderName(_openOutputName.c_str());
+		_spout->SetAutoShare(true);
+		if (_appConfig->_spoutNeedsCPU)
+			_spout->SetCPUshare(true);
+		_spout->OpenSpout();
+	}
+
+	if (_rt.setActive(true) == false || _spout->SendTexture(_rt.getTexture().getNativeHandle(), GL_TEXTURE_2D, _rt.getSize().x, _rt.getSize().y) == false)
+	{
+		_error = "Spout2: failed sending " + _openOutputName;
+		logToFile(_appConfig, _error);
+		_outputFailed = true;
+	}
+	_rt.setActive(false);
+#else
+	if (_appConfig->_useSharedMemorySender == false)
+	{
+		CloseOutput();
+		return;
+	}
+
+	if (_sink == nullptr)
+	{
+		_sink = new SharedFrameSink();
+		_sink->_name = OutputName();
+	}
+
+	if (_sink->Submit(_rt) == false)
+	{
+		_error = "Shared memory output: " + _sink->GetError();
+		logToFile(_appConfig, _settings.name + ": " + _error);
+		_outputFailed = true;
+	}
+#endif
+}
+
+void CoHostAvatar::CloseOutput()
+{
+#ifdef _WIN32
+	if (_spout != nullptr)
+	{
+		_spout->ReleaseSender();
+		delete _spout;
+		_spout = nullptr;
+	}
+#else
+	delete _sink;
+	_sink = nullptr;
+#endif
+}
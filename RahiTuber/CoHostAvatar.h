@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Config.h"
+#include "LayerManager.h"
+
+#ifdef _WIN32
+class Spout;
+#else
+#include "SharedFrameSink.h"
+#endif
+
+#include <string>
+
+// An avatar drawn alongside the main one, in the same process: a co-host, a pet. It has its own layer
+// set, audio channel and output, and shares the rest - images come from the TextureManager in AppConfig,
+// so a file used by several avatars is decoded and uploaded once, and levels come from the one audio
+// capture. It's drawn off-screen and sent out through Spout2 or shared memory, whichever the main
+// avatar is using, under a name of its own.
+// There's no shared worker pool. Each co-host's LayerManager keeps its own loading, saving and image
+// watching threads, which sleep until its layer set is loaded, saved or edited. Each animated sprite
+// decodes on its own AnimationStream's thread over the one shared copy of the file, and the audio
+// analysis runs on the one shared ChannelAnalyser.
+class CoHostAvatar
+{
+public:
+
+	CoHostAvatar(AppConfig* appConfig, UIConfig* uiConfig);
+	~CoHostAvatar();
+
+	// Loads the layer set and resizes the output, if they've changed
+	void Apply(const CoHostSettings& settings);
+
+	// Draws a frame and sends it out. Call after the main avatar has drawn.
+	void Draw(const FrameTime& frame, float talkLevel, float talkMax, PhonemeMask phMask);
+
+	inline LayerManager* GetLayerManager() { return _layerMan; }
+	inline const CoHostSettings& GetSettings() const { return _settings; }
+	inline const sf::RenderTexture& GetRenderTexture() const { return _rt; }
+	inline const std::string& GetError() const { return _error; }
+
+	// Time spent drawing and sending the last frame
+	inline float DrawMs() const { return _drawMs; }
+
+	// The Spout2 sender or shared memory segment the frames go to
+	std::string OutputName() const;
+
+private:
+
+	void SendOutput();
+	void CloseOutput();
+
+	AppConfig* _appConfig = nullptr;
+	UIConfig* _uiConfig = nullptr;
+
+	LayerManager* _layerMan = nullptr;
+	CoHostSettings _settings;
+	bool _applied = false;
+	std::string _pendingLayerSet = "";
+
+	sf::RenderTexture _rt;
+
+#ifdef _WIN32
+	Spout* _spout = nullptr;
+#else
+	SharedFrameSink* _sink = nullptr;
+#endif
+	std::string _openOutputName = "";
+	bool _outputFailed = false;
+
+	float _drawMs = 0;
+	std::string _error = "";
+};
@@ -8,14 +8,21 @@
 #include "SFML/System.hpp"
 
 #include "ffwdClock.h"
+#include "FrameClock.h"
 
 #include <memory>
 #include <deque>
 #include <mutex>
+#include <atomic>
 
 #include "defines.h"
 
 #include "TextureManager.h"
+#include "PhonemeVoter.h"
+#include "PhonemeClassifier.h"
+#include "ChannelAnalyser.h"
+#include "NoiseGate.h"
+#include "LatencyTracker.h"
 
 #include <fstream>
 #include <thread>
@@ -48,6 +55,16 @@ typedef float SAMPLE;
 class xmlConfigLoader;
 class WebSocket;
 
+// Another avatar run alongside the main one, see CoHostAvatar.h
+struct CoHostSettings
+{
+	std::string name = "Co-host";
+	std::string layerSet = "";
+	int audioChannel = -1;		// -1 for the mix of every channel
+	int width = 800;
+	int height = 800;
+};
+
 struct AppConfig
 {
 	xmlConfigLoader* _loader = nullptr;
@@ -62,6 +79,9 @@ struct AppConfig
 	int _httpPort = 8000;
 	WebSocket* _webSocket;
 
+	// input-to-photon latency of audio, hotkeys and HTTP requests
+	LatencyTracker _latency;
+
 	bool _transparent = false;
 	float _alphaClip = 0.001;
 	bool _sharpEdge = true;
@@ -109,9 +129,17 @@ struct AppConfig
 
 	float _fps = 0;
 	int _fpsLimit = 60;
+	int _idleFpsLimit = 30;
+	bool _precisePacing = true;
+
+	// fixed physics steps per 1/60s
+	int _physicsSubsteps = 1;
 
 	sf::Clock _timer;
 
+	// drives all layer motion, animation and states; advanced once per rendered frame
+	FrameClock _frameClock;
+
 	ffwdClock _hoverTimer;
 
 	sf::Clock _runTime;
@@ -137,10 +165,18 @@ struct AppConfig
 
 	std::string _logFileLocation = "";
 	std::fstream _logStream = {};
+	std::mutex _logMutex;		// startup phases log from several threads
 
 	bool _useSpout2Sender = false;
 	bool _spoutNeedsCPU = false;
 
+	bool _useSharedMemorySender = false;
+	std::string _sharedMemoryName = "/rahituber";
+
+	std::vector<CoHostSettings> _coHosts;
+
+	int _recordFormat = 0;
+
 	bool _createMinimalLayers = false;
 	bool _undoRotationEffectFix = false;
 
@@ -158,6 +194,11 @@ struct AppConfig
 	int _unloadTimeoutSetting = 10;
 	int _unloadTimeout = 0;
 	bool _unloadTimeoutEnabled = false;
+	bool _layerSetCache = true;
+	int _autosaveInterval = 60;
+	bool _hotReloadImages = true;
+	bool _textureVariants = true;			// images drawn small stored smaller, under the old name so saved settings still load
+	bool _menuRedrawOnChange = true;
 
 	int _gamepadAPI = 0;
 	int _gamepadModel = 0;
@@ -166,12 +207,6 @@ struct AppConfig
 	bool _gpuCompatibility = false;
 };
 
-typedef struct
-{
-
-}
-paTestData;
-
 struct AudioConfig
 {
 	float _cutoff = 0.0006f;
@@ -234,26 +269,43 @@ struct AudioConfig
 	float PConfidenceBoost = 40;
 	float WConfidenceBoost = 6;
 
-	sf::Clock phSinceChanged;
+	// phoneme voting runs on the audio timeline (seconds of captured audio),
+	// so it behaves the same regardless of the render framerate
+	double phLastSwitched = 0;
 	float phSwitchDelay = 0.1;
+	float phVoteWindow = 0.2;
+
+	PhonemeVoter _phonemeVotes;
+
+	// MFCC/formant based detection, used instead of the band balance rules once calibrated
+	bool _spectralPhonemes = false;
+	PhonemeClassifier _phonemeClassifier;
+	std::vector<float> _powerSpectrum;
+	int _spectralPhoneme = 0;
+	int _prevPhoneme = 0;
+	std::atomic<unsigned long long> _capturedFrames = 0;
+	std::atomic<double> _lastAdcTime = 0;		// when the newest block hit the ADC, on LatencyTracker::Now()'s clock
 
-	std::vector<int> _lastPhonemes;
-	int _prevPhoneme;
+	// the latency test silences the input, and swaps an impulse in for the next few blocks when asked
+	std::atomic<bool> _latencyTest = false;
+	std::atomic<int> _impulseBlocks = 0;
+	std::atomic<double> _impulseTime = -1;		// the ADC time of the impulse's first block
 
 	float _softFallAmount = 10.0f;
 	float _smoothFactor = 24.0f;
 
 	SAMPLE _overallHi = 0.0f;
-	PaStreamParameters _params = {};
 	PaDeviceIndex _devIdx = -1;
 	std::string _lastDeviceName = "";
 	bool _missingDeviceShown = false;
 	int _nDevices = 0;
 	std::vector<std::pair<std::string, int>> _deviceList;
-	paTestData* _streamData = nullptr;
-	PaStream* _audioStr = nullptr;
 	bool _leftChannel = true;
 	int _numChannels = 2;
+
+	// capture every channel the device has and measure each one, for layers bound to a single channel
+	bool _separateChannels = false;
+	ChannelAnalyser _channels;
 	float _currentSampleRate = 44100;
 
 	SAMPLE _fixedMax = 1.0;
@@ -271,6 +323,17 @@ struct AudioConfig
 
 	bool _processedNew = false;
 
+	// the gate runs on every block, and layers can talk when it's open. With _voiceGate on,
+	// the spectral analysis is skipped while it's closed. See NoiseGate.h
+	bool _voiceGate = false;
+	float _gateMarginDb = 9.f;
+	float _gateHangover = 0.3f;
+	NoiseGate _gate;
+
+	// time doAudioAnalysis takes for a new block, smoothed, with the voice and without
+	float _analysisMsVoice = 0.f;
+	float _analysisMsGated = 0.f;
+
 	inline int GetAudioDeviceIdx(const std::string& name)
 	{
 		for (auto& dev : _deviceList)
@@ -331,8 +394,6 @@ struct UIConfig
 
 
 	sf::Image _ico;
-	sf::Texture _moveIcon;
-	sf::Sprite _moveIconSprite;
 	sf::Vector2f _moveTabSize = { 80,32 };
 
 	sf::Vector2f _helpBtnPosition = { 0,0 };
@@ -441,6 +502,8 @@ static void logToFile(AppConfig* appCfg, const std::string& msg, bool clear = fa
 {
 	if (appCfg != nullptr)
 	{
+		std::lock_guard<std::mutex> lock(appCfg->_logMutex);
+
 		if(appCfg->_logFileLocation == "")
 			appCfg->_logFileLocation = appCfg->_appLocation + "RahiTuber_Log.txt";
 
@@ -0,0 +1,211 @@
+#include "ExportPipeline.h"
+#include "TextureManager.h"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+void ExportPipeline::Add(const fs::path& source, const fs::path& target, bool crop)
+{
+	std::string key = target.lexically_normal().string();
+
+	auto found = _jobByTarget.find(key);
+	if (found != _jobByTarget.end())
+	{
+		Job& job = _jobs[found->second];
+		job.source = source;
+		job.crop |= crop;
+		return;
+	}
+
+	_jobByTarget[key] = _jobs.size();
+
+	Job job;
+	job.source = source;
+	job.target = target;
+	job.crop = crop;
+	_jobs.push_back(job);
+}
+
+void ExportPipeline::Start(int workers)
+{
+	_next = 0;
+	_done = 0;
+	_failed = 0;
+
+	workers = std::max(1, std::min(workers, (int)_jobs.size()));
+	for (int w = 0; w < workers; w++)
+		_workers.emplace_back([this]() { WorkerLoop(); });
+}
+
+void ExportPipeline::Wait()
+{
+	for (auto& w : _workers)
+	{
+		if (w.joinable())
+			w.join();
+	}
+}
+
+void ExportPipeline::Clear()
+{
+	Wait();
+	_workers.clear();
+	_jobs.clear();
+	_jobByTarget.clear();
+	_next = 0;
+	_done = 0;
+	_failed = 0;
+	_currentItem = "";
+}
+
+std::string ExportPipeline::CurrentItem()
+{
+	std::lock_guard<std::mutex> lock(_currentMutex);
+	return _currentItem;
+}
+
+std::vector<std::string> ExportPipeline::GetErrors() const
+{
+	std::vector<std::string> errors;
+	for (auto& job : _jobs)
+	{
+		if (job.result.error != "")
+			errors.push_back(job.result.error);
+	}
+	return errors;
+}
+
+ExportPipeline::Result* ExportPipeline::GetResult(const std::string& target)
+{
+	if (!IsFinished())
+		return nullptr;
+
+	auto found = _jobByTarget.find(fs::path(target).lexically_normal().string());
+	if (found == _jobByTarget.end())
+		return nullptr;
+
+	return &_jobs[found->second].result;
+}
+
+void ExportPipeline::WorkerLoop()
+{
+	while (true)
+	{
+		int idx = _next++;
+		if (idx >= (int)_jobs.size())
+			return;
+
+		Job& job = _jobs[idx];
+		{
+			std::lock_guard<std::mutex> lock(_currentMutex);
+			_currentItem = job.target.filename().string();
+		}
+
+		Process(job);
+
+		if (job.result.error != "")
+			_failed++;
+
+		job.result.done = true;
+		_done++;
+	}
+}
+
+void ExportPipeline::Process(Job& job)
+{
+	std::error_code ec;
+
+	if (!job.crop)
+	{
+		if (!fs::equivalent(job.source, job.target, ec))
+			fs::copy_file(job.source, job.target, fs::copy_options::overwrite_existing, ec);
+
+		if (ec)
+			job.result.error = "Failed to copy " + job.source.string() + ": " + ec.message();
+		return;
+	}
+
+	// read the source once, it might be the target itself
+	std::vector<uint8_t> fileData;
+	{
+		std::ifstream file(job.source, std::ios::binary | std::ios::ate);
+		if (file)
+		{
+			fileData.resize((size_t)file.tellg());
+			file.seekg(0);
+			file.read((char*)fileData.data(), fileData.size());
+		}
+		if (!file || fileData.empty())
+		{
+			job.result.error = "Failed to read " + job.source.string();
+			return;
+		}
+	}
+
+	CropImage(fileData, job.target, job.result);
+}
+
+bool ExportPipeline::CropImage(const std::vector<uint8_t>& fileData, const fs::path& target, Result& result)
+{
+	sf::Image srcImg;
+	if (!srcImg.loadFromMemory(fileData.data(), fileData.size()))
+	{
+		result.error = "Failed to decode " + target.filename().string();
+		return false;
+	}
+
+	const uint8_t* pxPtr = srcImg.getPixelsPtr();
+	sf::Vector2u srcSize = srcImg.getSize();
+
+	sf::Vector2u maxContent = { 0,0 };
+	sf::Vector2u minContent = srcSize;
+
+	for (unsigned int y = 0; y < srcSize.y; y++)
+	{
+		const uint8_t* row = pxPtr + (size_t)y * srcSize.x * 4;
+		for (unsigned int x = 0; x < srcSize.x; x++)
+		{
+			if (row[x * 4 + 3] != 0)
+			{
+				maxContent.x = std::max(x, maxContent.x);
+				maxContent.y = std::max(y, maxContent.y);
+
+				minContent.x = std::min(x, minContent.x);
+				minContent.y = std::min(y, minContent.y);
+			}
+		}
+	}
+
+	maxContent.x = std::clamp(maxContent.x, minContent.x, srcSize.x);
+	maxContent.y = std::clamp(maxContent.y, minContent.y, srcSize.y);
+
+	sf::IntRect cropLocation(minContent.x, minContent.y, maxContent.x - minContent.x, maxContent.y - minContent.y);
+	const auto cropSize = cropLocation.getSize();
+
+	sf::Image croppedImg;
+	croppedImg.create(cropSize.x, cropSize.y, sf::Color(0, 0, 0, 0));
+	croppedImg.copy(srcImg, 0, 0, cropLocation);
+
+	result.origSize = srcSize;
+	result.cropRect = cropLocation;
+
+	std::error_code ec;
+	fs::remove(target, ec);
+
+	if (!croppedImg.saveToFile(target.string()))
+	{
+		result.error = "Failed to save " + target.string();
+		return false;
+	}
+
+	// premultiplied copy, ready to upload
+	result.premultiplied.resize((size_t)cropSize.x * cropSize.y * 4);
+	TextureManager::Premultiply(croppedImg.getPixelsPtr(), result.premultiplied.data(), (size_t)cropSize.x * cropSize.y);
+
+	result.cropped = true;
+	return true;
+}
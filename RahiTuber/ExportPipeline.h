@@ -0,0 +1,87 @@
+#pragma once
+
+#include "SFML/Graphics/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Copies a layer set's images into a portable folder on worker threads, optionally cropping
+// away transparent borders. Each source file is read and decoded once, and every target file is
+// written at most once however many sprites use it. Cropped results keep their premultiplied
+// pixels so the render thread can upload them without touching the disk again.
+class ExportPipeline
+{
+public:
+
+	struct Result
+	{
+		bool done = false;
+		bool cropped = false;
+		sf::Vector2u origSize = {};
+		sf::IntRect cropRect = sf::IntRect(0, 0, 0, 0);
+		std::vector<uint8_t> premultiplied;
+		std::string error = "";
+	};
+
+	~ExportPipeline() { Clear(); }
+
+	// Queues an image. If several sprites share a target, the last source wins, like overwriting copies would,
+	// and it's cropped if any of them asked for it.
+	void Add(const std::filesystem::path& source, const std::filesystem::path& target, bool crop);
+
+	void Start(int workers);
+
+	// Blocks until every queued image is done
+	void Wait();
+
+	// Waits for the workers and forgets all jobs and results
+	void Clear();
+
+	inline bool IsStarted() const { return !_workers.empty(); }
+	inline bool IsFinished() const { return _done == (int)_jobs.size(); }
+	inline int JobCount() const { return (int)_jobs.size(); }
+	inline int JobsDone() const { return _done; }
+	inline int Failures() const { return _failed; }
+	inline float Progress() const { return _jobs.empty() ? 1.f : (float)_done / _jobs.size(); }
+
+	// The file currently being worked on, for progress messages
+	std::string CurrentItem();
+
+	std::vector<std::string> GetErrors() const;
+
+	// Only valid once the pipeline has finished
+	Result* GetResult(const std::string& target);
+
+	// Decodes a PNG (or anything sf::Image reads) from memory, crops off the transparent border and re-encodes it to target
+	static bool CropImage(const std::vector<uint8_t>& fileData, const std::filesystem::path& target, Result& result);
+
+private:
+
+	struct Job
+	{
+		std::filesystem::path source;
+		std::filesystem::path target;
+		bool crop = false;
+		Result result;
+	};
+
+	void WorkerLoop();
+	void Process(Job& job);
+
+	std::vector<Job> _jobs;
+	std::unordered_map<std::string, size_t> _jobByTarget;
+
+	std::vector<std::thread> _workers;
+	std::atomic<int> _next = 0;
+	std::atomic<int> _done = 0;
+	std::atomic<int> _failed = 0;
+
+	std::mutex _currentMutex;
+	std::string _currentItem = "";
+};
@@ -0,0 +1,289 @@
+#include "FileWatcher.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static const int PollIntervalMs = 250;
+
+// a file that disappeared mid-save and never came back
+static const int MissingTimeoutMs = 5000;
+
+void FileWatcher::Start(int debounceMs, bool forcePolling)
+{
+	if (_thread.joinable())
+		return;
+
+	_debounceMs = debounceMs;
+	_stopping = false;
+	_polling = true;
+
+#ifdef __linux__
+	if (!forcePolling)
+	{
+		_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		_polling = _inotifyFd < 0;
+	}
+#endif
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_filesDirty = true;
+	}
+
+	_thread = std::thread([this]() { ThreadLoop(); });
+}
+
+void FileWatcher::Stop()
+{
+	_stopping = true;
+	if (_thread.joinable())
+		_thread.join();
+
+#ifdef __linux__
+	if (_inotifyFd >= 0)
+		close(_inotifyFd);
+#endif
+	_inotifyFd = -1;
+	_watchDirs.clear();
+	_dirWatches.clear();
+
+	_watchedFiles.clear();
+	_unwatchedFiles.clear();
+	_known.clear();
+	_pending.clear();
+}
+
+void FileWatcher::SetFiles(const std::set<std::string>& paths)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (paths == _files)
+		return;
+
+	_files = paths;
+	_filesDirty = true;
+}
+
+std::vector<std::string> FileWatcher::TakeChanged()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<std::string> out;
+	out.swap(_changed);
+	return out;
+}
+
+FileWatcher::FileState FileWatcher::Stat(const std::string& path)
+{
+	FileState state;
+	std::error_code ec;
+	state.exists = fs::is_regular_file(path, ec);
+	if (state.exists)
+	{
+		state.size = fs::file_size(path, ec);
+		state.mtime = fs::last_write_time(path, ec);
+	}
+	return state;
+}
+
+void FileWatcher::ThreadLoop()
+{
+	while (!_stopping)
+	{
+		UpdateFiles();
+
+		if (_inotifyFd >= 0)
+			ReadEvents(50);
+		else
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		auto now = std::chrono::steady_clock::now();
+		if (now - _lastPoll >= std::chrono::milliseconds(PollIntervalMs))
+		{
+			_lastPoll = now;
+			PollFiles(_polling ? _watchedFiles : _unwatchedFiles);
+		}
+
+		CheckSettled();
+	}
+}
+
+void FileWatcher::UpdateFiles()
+{
+	std::set<std::string> files;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_filesDirty)
+			return;
+
+		files = _files;
+		_filesDirty = false;
+	}
+
+	// new files start from whatever is on disk now, so only later edits are reported
+	for (auto& path : files)
+	{
+		if (_watchedFiles.count(path) == 0)
+			_known[path] = Stat(path);
+	}
+	for (auto& path : _watchedFiles)
+	{
+		if (files.count(path) == 0)
+		{
+			_known.erase(path);
+			_pending.erase(path);
+		}
+	}
+	_watchedFiles = files;
+
+#ifdef __linux__
+	if (_inotifyFd < 0)
+		return;
+
+	std::map<std::string, std::vector<std::string>> filesByDir;
+	for (auto& path : files)
+		filesByDir[fs::path(path).parent_path().string()].push_back(path);
+
+	for (auto it = _dirWatches.begin(); it != _dirWatches.end();)
+	{
+		if (filesByDir.count(it->first) == 0)
+		{
+			inotify_rm_watch(_inotifyFd, it->second);
+			_watchDirs.erase(it->second);
+			it = _dirWatches.erase(it);
+		}
+		else
+		{
+			it++;
+		}
+	}
+
+	// watching the folder rather than the file sees editors that save by renaming a new file over the old one
+	_unwatchedFiles.clear();
+	for (auto& dir : filesByDir)
+	{
+		if (_dirWatches.count(dir.first))
+			continue;
+
+		int wd = inotify_add_watch(_inotifyFd, dir.first.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_ATTRIB);
+		if (wd < 0)
+		{
+			_unwatchedFiles.insert(dir.second.begin(), dir.second.end());
+			continue;
+		}
+
+		_dirWatches[dir.first] = wd;
+		_watchDirs[wd] = dir.first;
+	}
+#endif
+}
+
+void FileWatcher::ReadEvents(int timeoutMs)
+{
+#ifdef __linux__
+	pollfd pfd = { _inotifyFd, POLLIN, 0 };
+	if (poll(&pfd, 1, timeoutMs) <= 0)
+		return;
+
+	alignas(inotify_event) char buffer[4096];
+	while (true)
+	{
+		ssize_t len = read(_inotifyFd, buffer, sizeof(buffer));
+		if (len <= 0)
+			return;
+
+		for (char* ptr = buffer; ptr < buffer + len;)
+		{
+			const inotify_event* evt = (const inotify_event*)ptr;
+			ptr += sizeof(inotify_event) + evt->len;
+
+			// events were lost, check everything
+			if (evt->mask & IN_Q_OVERFLOW)
+			{
+				PollFiles(_watchedFiles);
+				continue;
+			}
+
+			auto dir = _watchDirs.find(evt->wd);
+			if (evt->len == 0 || dir == _watchDirs.end())
+				continue;
+
+			std::string path = (fs::path(dir->second) / evt->name).string();
+			if (_watchedFiles.count(path))
+				MarkChanged(path);
+		}
+	}
+#endif
+}
+
+void FileWatcher::PollFiles(const std::set<std::string>& files)
+{
+	for (auto& path : files)
+	{
+		if (_pending.count(path) == 0 && Stat(path) != _known[path])
+			MarkChanged(path);
+	}
+}
+
+void FileWatcher::MarkChanged(const std::string& path)
+{
+	Pending& pending = _pending[path];
+	pending.lastEvent = std::chrono::steady_clock::now();
+	pending.state = Stat(path);
+}
+
+void FileWatcher::CheckSettled()
+{
+	auto now = std::chrono::steady_clock::now();
+
+	for (auto it = _pending.begin(); it != _pending.end();)
+	{
+		const std::string& path = it->first;
+		Pending& pending = it->second;
+
+		auto quiet = std::chrono::duration_cast<std::chrono::milliseconds>(now - pending.lastEvent).count();
+		if (quiet < _debounceMs)
+		{
+			it++;
+			continue;
+		}
+
+		FileState state = Stat(path);
+
+		if (!state.exists)
+		{
+			// probably replaced by a rename that hasn't happened yet
+			if (quiet > MissingTimeoutMs)
+			{
+				_known[path] = state;
+				it = _pending.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+			continue;
+		}
+
+		// still being written without telling us, eg. when polling
+		if (state != pending.state)
+		{
+			pending.state = state;
+			pending.lastEvent = now;
+			it++;
+			continue;
+		}
+
+		if (state != _known[path])
+		{
+			_known[path] = state;
+			std::lock_guard<std::mutex> lock(_mutex);
+			_changed.push_back(path);
+		}
+
+		it = _pending.erase(it);
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Watches a set of files on a background thread and reports the ones that changed.
+// Uses inotify on the files' folders on Linux, and polls modification times everywhere else
+// (or when inotify isn't available). Editors often save in several steps - truncate, write,
+// rename over the original - so a file is only reported once it has been quiet for the debounce time.
+class FileWatcher
+{
+public:
+
+	~FileWatcher() { Stop(); }
+
+	void Start(int debounceMs = 300, bool forcePolling = false);
+	void Stop();
+
+	inline bool IsRunning() const { return _thread.joinable(); }
+	inline bool IsPolling() const { return _polling; }
+
+	// Replaces the watched files. Paths should be absolute and normalised, they're reported back as given.
+	void SetFiles(const std::set<std::string>& paths);
+
+	// Files that changed and settled since the last call
+	std::vector<std::string> TakeChanged();
+
+private:
+
+	struct FileState
+	{
+		bool exists = false;
+		uintmax_t size = 0;
+		std::filesystem::file_time_type mtime = {};
+
+		bool operator==(const FileState& other) const { return exists == other.exists && size == other.size && mtime == other.mtime; }
+		bool operator!=(const FileState& other) const { return !(*this == other); }
+	};
+
+	struct Pending
+	{
+		std::chrono::steady_clock::time_point lastEvent;
+		FileState state;
+	};
+
+	static FileState Stat(const std::string& path);
+
+	void ThreadLoop();
+	void UpdateFiles();
+	void ReadEvents(int timeoutMs);
+	void PollFiles(const std::set<std::string>& files);
+	void MarkChanged(const std::string& path);
+	void CheckSettled();
+
+	std::thread _thread;
+	std::atomic<bool> _stopping = false;
+	std::atomic<bool> _polling = false;
+	int _debounceMs = 300;
+
+	std::mutex _mutex;
+	std::set<std::string> _files;
+	bool _filesDirty = false;
+	std::vector<std::string> _changed;
+
+	// only used by the watcher thread
+	std::set<std::string> _watchedFiles;
+	std::map<std::string, FileState> _known;
+	std::map<std::string, Pending> _pending;
+	std::chrono::steady_clock::time_point _lastPoll;
+
+	// files in folders inotify couldn't watch are polled instead
+	std::set<std::string> _unwatchedFiles;
+	int _inotifyFd = -1;
+	std::map<int, std::string> _watchDirs;
+	std::map<std::string, int> _dirWatches;
+};
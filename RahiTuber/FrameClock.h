@@ -0,0 +1,60 @@
+#pragma once
+
+#include <SFML/System/Clock.hpp>
+
+// Snapshot of the frame clock, shared by everything simulated in one frame
+struct FrameTime
+{
+	double time = 0;				// seconds since the clock started
+	float dt = 0;					// seconds since the previous frame
+	unsigned long long index = 0;
+};
+
+// Single source of time for layer motion, animation and states.
+// Read once per frame with Advance(), or stepped by hand with Step() to replay motion deterministically.
+class FrameClock
+{
+public:
+	const FrameTime& Advance()
+	{
+		return SetTime(_clock.getElapsedTime().asMicroseconds() * 0.000001);
+	}
+
+	const FrameTime& Step(float dt)
+	{
+		return SetTime(_frame.time + dt);
+	}
+
+	inline const FrameTime& Now() const { return _frame; }
+
+private:
+
+	const FrameTime& SetTime(double time)
+	{
+		_frame.dt = (float)(time - _frame.time);
+		_frame.time = time;
+		_frame.index++;
+		return _frame;
+	}
+
+	sf::Clock _clock;
+	FrameTime _frame;
+};
+
+// Stopwatch measured against the frame clock instead of reading the OS clock.
+// A timer that was never restarted starts counting from the first frame that reads it.
+class FrameTimer
+{
+public:
+	inline void restart(const FrameTime& now) { _start = now.time; }
+
+	inline float getElapsedSeconds(const FrameTime& now)
+	{
+		if (_start < 0)
+			_start = now.time;
+		return (float)(now.time - _start);
+	}
+
+private:
+	double _start = -1;
+};
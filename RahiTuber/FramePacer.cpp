@@ -0,0 +1,177 @@
+#include "FramePacer.h"
+
+#include "SFML/System/Sleep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+// spinning more than this per frame costs more CPU than a late frame is worth
+static const double MaxSleepMargin = 0.002;
+static const double MinSleepMargin = 0.0003;
+
+void FramePacer::SetRates(int activeFps, int idleFps)
+{
+	_activeFps = std::max(0, activeFps);
+	_idleFps = std::max(0, idleFps);
+}
+
+void FramePacer::MarkActive()
+{
+	_lastActive = Now();
+}
+
+void FramePacer::Wait()
+{
+	double now = Now();
+
+	_idle = _idleFps > 0 && (_lastActive < 0 || now - _lastActive > ActiveHoldTime);
+
+	int fps = _activeFps;
+	if (_idle && (fps == 0 || _idleFps < fps))
+		fps = _idleFps;
+
+	if (fps > 0)
+	{
+		double period = 1.0 / fps;
+		double target = _lastTarget + period;
+
+		// more than a frame behind, start again from here rather than rushing frames out to catch up
+		if (_lastTarget < 0 || now > target + period)
+			target = now;
+
+		SleepUntil(target);
+		_lastTarget = target;
+	}
+	else
+	{
+		_lastTarget = -1;
+	}
+
+	Measure(Now());
+}
+
+void FramePacer::SleepUntil(double target)
+{
+	double now = Now();
+
+	double coarse = target - now - _sleepMargin;
+	if (coarse > 0)
+	{
+		sf::sleep(sf::microseconds((sf::Int64)(coarse * 1000000)));
+
+		// how late the OS usually wakes us, rare stalls aren't worth spinning for on every frame
+		double after = Now();
+		double late = (after - now) - coarse;
+		_lateMean += (late - _lateMean) * 0.05;
+		_lateDeviation += (std::abs(late - _lateMean) - _lateDeviation) * 0.05;
+
+		_sleepMargin = std::clamp(_lateMean + 3 * _lateDeviation, MinSleepMargin, MaxSleepMargin);
+		now = after;
+	}
+
+	double spinStart = now;
+	while (now < target)
+	{
+		std::this_thread::yield();
+		now = Now();
+	}
+	_windowSpin += now - spinStart;
+}
+
+void FramePacer::Measure(double now)
+{
+	if (_lastFrame >= 0)
+	{
+		float dt = (float)(now - _lastFrame);
+		if (_smoothedDt <= 0)
+			_smoothedDt = dt;
+		else
+			_smoothedDt += (dt - _smoothedDt) * 0.1f;
+
+		_windowFrames++;
+		_windowSum += dt;
+		_windowSumSq += (double)dt * dt;
+	}
+	_lastFrame = now;
+
+	if (_windowStart < 0)
+	{
+		_windowStart = now;
+		_windowCpu = ProcessCpuSeconds();
+		return;
+	}
+
+	double elapsed = now - _windowStart;
+	if (elapsed < 1.0)
+		return;
+
+	double cpu = ProcessCpuSeconds();
+	_cpuPercent = (float)(100.0 * (cpu - _windowCpu) / elapsed);
+	_spinPercent = (float)(100.0 * _windowSpin / elapsed);
+
+	if (_windowFrames > 1)
+	{
+		double mean = _windowSum / _windowFrames;
+		double variance = std::max(0.0, _windowSumSq / _windowFrames - mean * mean);
+		_jitterMs = (float)(std::sqrt(variance) * 1000);
+	}
+
+	_windowStart = now;
+	_windowCpu = cpu;
+	_windowFrames = 0;
+	_windowSum = 0;
+	_windowSumSq = 0;
+	_windowSpin = 0;
+}
+
+double FramePacer::ProcessCpuSeconds()
+{
+#ifdef _WIN32
+	FILETIME created, exited, kernel, user;
+	if (GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user) == false)
+		return 0;
+
+	auto toSeconds = [](const FILETIME& ft) { return (((unsigned long long)ft.dwHighDateTime << 32) | ft.dwLowDateTime) * 0.0000001; };
+	return toSeconds(kernel) + toSeconds(user);
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 0.000001;
+#endif
+}
+
+size_t FramePacer::ProcessMemoryBytes()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == false)
+		return 0;
+
+	return counters.WorkingSetSize;
+#else
+	FILE* statm = fopen("/proc/self/statm", "r");
+	if (statm == nullptr)
+		return 0;
+
+	unsigned long long pages = 0;
+	unsigned long long resident = 0;
+	int read = fscanf(statm, "%llu %llu", &pages, &resident);
+	fclose(statm);
+	if (read != 2)
+		return 0;
+
+	return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "SFML/System/Clock.hpp"
+
+#include <cstddef>
+
+// Holds the main loop to a steady frame rate. Each frame has a deadline on a monotonic clock,
+// the thread sleeps until just before it and spins for the last fraction of a millisecond, with
+// the margin adapting to how late the OS has been waking it. Runs at the active rate while
+// anything is moving or being used, and drops to the idle rate once everything has been still
+// for a moment. Also keeps the measurements: a smoothed FPS, frame time jitter and CPU use.
+class FramePacer
+{
+public:
+
+	static constexpr double ActiveHoldTime = 1.0;	// seconds at the active rate after the last activity
+
+	// 0 for no limit, an idle rate of 0 always runs at the active rate
+	void SetRates(int activeFps, int idleFps);
+
+	// Something is talking, moving or being used this frame
+	void MarkActive();
+
+	// Call once per frame after presenting. Waits until the next frame is due, if there's a limit.
+	void Wait();
+
+	inline bool IsIdle() const { return _idle; }
+	inline float SmoothedFps() const { return _smoothedDt > 0 ? 1.f / _smoothedDt : 0.f; }
+
+	// Standard deviation of the frame times over the last second
+	inline float JitterMs() const { return _jitterMs; }
+	// Process CPU time over the last second, 100% being one core
+	inline float CpuPercent() const { return _cpuPercent; }
+	// Of which spent spinning for the deadline
+	inline float SpinPercent() const { return _spinPercent; }
+
+	inline double Now() const { return _clock.getElapsedTime().asMicroseconds() * 0.000001; }
+
+	// CPU time used by all threads of the process so far
+	static double ProcessCpuSeconds();
+
+	// Resident memory of the process, 0 if it can't be read
+	static size_t ProcessMemoryBytes();
+
+private:
+
+	void SleepUntil(double target);
+	void Measure(double now);
+
+	sf::Clock _clock;
+
+	int _activeFps = 60;
+	int _idleFps = 0;
+	bool _idle = false;
+	double _lastActive = -1;
+
+	double _lastTarget = -1;
+	double _sleepMargin = 0.001;		// how much sooner than the deadline to wake up and spin
+	double _lateMean = 0.0005;			// average oversleep, and how much it varies
+	double _lateDeviation = 0.0002;
+
+	double _lastFrame = -1;
+	float _smoothedDt = 0;
+
+	// the measurement window
+	double _windowStart = -1;
+	double _windowCpu = 0;
+	int _windowFrames = 0;
+	double _windowSum = 0;
+	double _windowSumSq = 0;
+	double _windowSpin = 0;
+
+	float _jitterMs = 0;
+	float _cpuPercent = 0;
+	float _spinPercent = 0;
+};
@@ -0,0 +1,324 @@
+#include "FrameRecorder.h"
+#include "TextureManager.h"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+const char* FrameRecorder::FormatName(int format)
+{
+	switch (format)
+	{
+	case FORMAT_PNG:
+		return "PNG";
+	case FORMAT_QOI:
+		return "QOI (fast)";
+	default:
+		return "";
+	}
+}
+
+bool FrameRecorder::Start(const std::filesystem::path& folder, Format format, int workers, int queueSize)
+{
+	Stop();
+
+	std::error_code ec;
+	std::filesystem::create_directories(folder, ec);
+	if (ec)
+	{
+		_error = "Couldn't create " + folder.string() + ": " + ec.message();
+		return false;
+	}
+
+	_folder = folder;
+	_format = format;
+	_frame = 0;
+	_captured = 0;
+	_written = 0;
+	_droppedReadback = 0;
+	_droppedQueue = 0;
+	_failed = 0;
+	_error = "";
+
+	workers = std::max(1, workers);
+	queueSize = std::max(1, queueSize);
+
+	// one buffer per queue entry plus one per worker, so memory use is fixed for the whole recording
+	_jobs.clear();
+	_freeJobs.clear();
+	for (int j = 0; j < queueSize + workers; j++)
+	{
+		_jobs.emplace_back(new Job());
+		_freeJobs.push_back(_jobs.back().get());
+	}
+
+	_stopping = false;
+	for (int w = 0; w < workers; w++)
+		_workers.emplace_back([this]() { WorkerLoop(); });
+
+	_recording = true;
+	return true;
+}
+
+void FrameRecorder::Stop(sf::RenderTexture* source)
+{
+	if (_readback.Pending() > 0)
+	{
+		if (_recording && source != nullptr && source->setActive(true))
+		{
+			_droppedReadback += _readback.Flush([this](const AsyncReadback::Frame& frame)
+				{
+					PushFrame(frame.pixels, frame.width, frame.height, frame.frame, true);
+				}, FlushTimeoutMs);
+		}
+		else
+		{
+			_droppedReadback += _readback.Pending();
+		}
+	}
+	_readback.Release();
+
+	if (_workers.empty())
+	{
+		_recording = false;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_queueMutex);
+		_stopping = true;
+	}
+	_queueCondition.notify_all();
+
+	for (auto& w : _workers)
+		w.join();
+	_workers.clear();
+
+	_queue.clear();
+	_freeJobs.clear();
+	_jobs.clear();
+	_recording = false;
+}
+
+void FrameRecorder::Submit(sf::RenderTexture& source)
+{
+	if (!_recording || !source.setActive(true))
+		return;
+
+	_readback.Collect([this](const AsyncReadback::Frame& frame)
+		{
+			PushFrame(frame.pixels, frame.width, frame.height, frame.frame, true);
+		});
+
+	_frame++;
+	if (!_readback.Start(source, _frame, 0))
+	{
+		if (_readback.GetError() != "")
+		{
+			_error = _readback.GetError();
+			Stop();
+			return;
+		}
+		_droppedReadback++;
+	}
+}
+
+bool FrameRecorder::PushFrame(const uint8_t* pixels, unsigned int width, unsigned int height, unsigned long long frame, bool bottomUp)
+{
+	_captured++;
+
+	Job* job = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(_queueMutex);
+		if (!_freeJobs.empty())
+		{
+			job = _freeJobs.back();
+			_freeJobs.pop_back();
+		}
+	}
+
+	if (job == nullptr)
+	{
+		_droppedQueue++;
+		return false;
+	}
+
+	size_t stride = (size_t)width * 4;
+	job->pixels.resize(stride * height);
+	job->width = width;
+	job->height = height;
+	job->frame = frame;
+
+	if (bottomUp)
+		AsyncReadback::CopyFlipped(pixels, job->pixels.data(), width, height);
+	else
+		memcpy(job->pixels.data(), pixels, stride * height);
+
+	{
+		std::lock_guard<std::mutex> lock(_queueMutex);
+		_queue.push_back(job);
+	}
+	_queueCondition.notify_one();
+
+	return true;
+}
+
+void FrameRecorder::WorkerLoop()
+{
+	std::vector<uint8_t> scratch;
+
+	while (true)
+	{
+		Job* job = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(_queueMutex);
+			_queueCondition.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+
+			// finish everything that was queued before stopping
+			if (_queue.empty())
+				return;
+
+			job = _queue.front();
+			_queue.pop_front();
+		}
+
+		if (WriteFrame(*job, scratch))
+			_written++;
+		else
+			_failed++;
+
+		std::lock_guard<std::mutex> lock(_queueMutex);
+		_freeJobs.push_back(job);
+	}
+}
+
+bool FrameRecorder::WriteFrame(Job& job, std::vector<uint8_t>& scratch)
+{
+	// image files hold straight alpha
+	TextureManager::Unpremultiply(job.pixels.data(), (size_t)job.width * job.height);
+
+	char name[64];
+	snprintf(name, sizeof(name), "frame_%06llu.%s", job.frame, _format == FORMAT_QOI ? "qoi" : "png");
+	std::filesystem::path path = _folder / name;
+
+	if (_format == FORMAT_QOI)
+	{
+		EncodeQOI(job.pixels.data(), job.width, job.height, scratch);
+
+		std::ofstream file(path, std::ios::binary);
+		file.write((const char*)scratch.data(), scratch.size());
+		return file.good();
+	}
+
+	sf::Image img;
+	img.create(job.width, job.height, job.pixels.data());
+	return img.saveToFile(path.string());
+}
+
+void FrameRecorder::EncodeQOI(const uint8_t* pixels, unsigned int width, unsigned int height, std::vector<uint8_t>& out)
+{
+	const uint8_t QOI_OP_INDEX = 0x00;
+	const uint8_t QOI_OP_DIFF = 0x40;
+	const uint8_t QOI_OP_LUMA = 0x80;
+	const uint8_t QOI_OP_RUN = 0xc0;
+	const uint8_t QOI_OP_RGB = 0xfe;
+	const uint8_t QOI_OP_RGBA = 0xff;
+
+	size_t numPixels = (size_t)width * height;
+	out.resize(14 + numPixels * 5 + 8);
+	uint8_t* p = out.data();
+
+	auto write32 = [&p](uint32_t v)
+	{
+		*p++ = (uint8_t)(v >> 24);
+		*p++ = (uint8_t)(v >> 16);
+		*p++ = (uint8_t)(v >> 8);
+		*p++ = (uint8_t)v;
+	};
+
+	*p++ = 'q'; *p++ = 'o'; *p++ = 'i'; *p++ = 'f';
+	write32(width);
+	write32(height);
+	*p++ = 4;	// RGBA
+	*p++ = 0;	// sRGB with linear alpha
+
+	uint8_t index[64 * 4] = {};
+	uint8_t prev[4] = { 0, 0, 0, 255 };
+	int run = 0;
+
+	for (size_t px = 0; px < numPixels; px++)
+	{
+		const uint8_t* c = pixels + px * 4;
+
+		if (memcmp(c, prev, 4) == 0)
+		{
+			run++;
+			if (run == 62 || px == numPixels - 1)
+			{
+				*p++ = QOI_OP_RUN | (uint8_t)(run - 1);
+				run = 0;
+			}
+			continue;
+		}
+
+		if (run > 0)
+		{
+			*p++ = QOI_OP_RUN | (uint8_t)(run - 1);
+			run = 0;
+		}
+
+		int hash = (c[0] * 3 + c[1] * 5 + c[2] * 7 + c[3] * 11) % 64;
+		if (memcmp(&index[hash * 4], c, 4) == 0)
+		{
+			*p++ = QOI_OP_INDEX | (uint8_t)hash;
+		}
+		else
+		{
+			memcpy(&index[hash * 4], c, 4);
+
+			if (c[3] == prev[3])
+			{
+				int8_t dr = (int8_t)(c[0] - prev[0]);
+				int8_t dg = (int8_t)(c[1] - prev[1]);
+				int8_t db = (int8_t)(c[2] - prev[2]);
+				int8_t drdg = (int8_t)(dr - dg);
+				int8_t dbdg = (int8_t)(db - dg);
+
+				if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+				{
+					*p++ = QOI_OP_DIFF | (uint8_t)((dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+				}
+				else if (drdg > -9 && drdg < 8 && dg > -33 && dg < 32 && dbdg > -9 && dbdg < 8)
+				{
+					*p++ = QOI_OP_LUMA | (uint8_t)(dg + 32);
+					*p++ = (uint8_t)((drdg + 8) << 4 | (dbdg + 8));
+				}
+				else
+				{
+					*p++ = QOI_OP_RGB;
+					*p++ = c[0];
+					*p++ = c[1];
+					*p++ = c[2];
+				}
+			}
+			else
+			{
+				*p++ = QOI_OP_RGBA;
+				memcpy(p, c, 4);
+				p += 4;
+			}
+		}
+
+		memcpy(prev, c, 4);
+	}
+
+	// end marker
+	for (int i = 0; i < 7; i++)
+		*p++ = 0;
+	*p++ = 1;
+
+	out.resize(p - out.data());
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "AsyncReadback.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Records the avatar to a numbered image sequence with alpha.
+// Frames are read back asynchronously on the render thread, then handed to a pool of encoder
+// threads through a bounded queue. When the queue is full the frame is dropped and counted,
+// the render thread never waits on disk or the encoders. File numbers follow the rendered
+// frame count, so a gap in the sequence is a dropped frame.
+class FrameRecorder
+{
+public:
+
+	enum Format
+	{
+		FORMAT_PNG,
+		FORMAT_QOI,
+		FORMAT_END
+	};
+
+	static const char* FormatName(int format);
+
+	~FrameRecorder() { Stop(); }
+
+	// how long Stop() waits on each readback still in flight
+	static constexpr unsigned int FlushTimeoutMs = 100;
+
+	// Creates the folder and starts the encoder threads
+	bool Start(const std::filesystem::path& folder, Format format, int workers = 2, int queueSize = 8);
+
+	// Finishes the readbacks still in flight and queues them, waits for queued frames to be written,
+	// then stops the encoder threads. Pass the render texture being recorded so its context is active
+	// for the readbacks; without it they can't be finished and are counted as dropped.
+	void Stop(sf::RenderTexture* source = nullptr);
+
+	inline bool IsRecording() const { return _recording; }
+
+	// Render thread, once per frame after source.display()
+	void Submit(sf::RenderTexture& source);
+
+	// Queues a frame of premultiplied RGBA, as the layers are drawn, for encoding. It's converted to straight
+	// alpha on the encoder thread. Returns false if the queue was full and the frame was dropped.
+	bool PushFrame(const uint8_t* pixels, unsigned int width, unsigned int height, unsigned long long frame, bool bottomUp);
+
+	// captured frames reached the CPU, each one is then either written, dropped by the queue or failed
+	inline unsigned long long FramesCaptured() const { return _captured; }
+	inline unsigned long long FramesWritten() const { return _written; }
+	inline unsigned long long FramesDropped() const { return _droppedReadback + _droppedQueue; }
+	inline unsigned long long FramesDroppedByQueue() const { return _droppedQueue; }
+	inline unsigned long long WriteFailures() const { return _failed; }
+
+	inline const std::filesystem::path& GetFolder() const { return _folder; }
+	inline const std::string& GetError() const { return _error; }
+
+	// Lossless "Quite OK Image" encoding of straight RGBA8, top row first. Recorded frames are un-premultiplied before they get here.
+	static void EncodeQOI(const uint8_t* pixels, unsigned int width, unsigned int height, std::vector<uint8_t>& out);
+
+private:
+
+	struct Job
+	{
+		std::vector<uint8_t> pixels;
+		unsigned int width = 0;
+		unsigned int height = 0;
+		unsigned long long frame = 0;
+	};
+
+	void WorkerLoop();
+	bool WriteFrame(Job& job, std::vector<uint8_t>& scratch);
+
+	std::filesystem::path _folder;
+	Format _format = FORMAT_PNG;
+	bool _recording = false;
+
+	AsyncReadback _readback;
+	unsigned long long _frame = 0;
+
+	std::mutex _queueMutex;
+	std::condition_variable _queueCondition;
+	std::deque<Job*> _queue;
+	std::vector<Job*> _freeJobs;
+	std::vector<std::unique_ptr<Job>> _jobs;
+	std::vector<std::thread> _workers;
+	bool _stopping = false;
+
+	std::atomic<unsigned long long> _captured = 0;
+	std::atomic<unsigned long long> _written = 0;
+	std::atomic<unsigned long long> _droppedReadback = 0;
+	std::atomic<unsigned long long> _droppedQueue = 0;
+	std::atomic<unsigned long long> _failed = 0;
+
+	std::string _error = "";
+};
@@ -0,0 +1,2509 @@
+#pragma once
+
+// Generated by res/pack_icons.py from the icons in res/, don't edit it by hand.
+// The editor icons packed into one PNG, 2 pixels apart, each with its edge repeated 1 pixel out.
+
+static constexpr unsigned int IconAtlasWidth = 1024;
+static constexpr unsigned int IconAtlasHeight = 458;
+
+struct IconAtlasRect
+{
+	const char* file;
+	int left, top, width, height;
+};
+
+static const IconAtlasRect IconAtlasRects[] = {
+	{ "anim.png", 134, 392, 48, 48 },
+	{ "empty.png", 2, 2, 128, 128 },
+	{ "arrowup.png", 870, 262, 64, 64 },
+	{ "arrowdn.png", 936, 262, 64, 64 },
+	{ "edit.png", 2, 392, 64, 64 },
+	{ "delete.png", 284, 392, 32, 32 },
+	{ "duplicate.png", 68, 392, 64, 64 },
+	{ "new_file.png", 132, 2, 128, 128 },
+	{ "open.png", 262, 2, 128, 128 },
+	{ "save.png", 392, 2, 128, 128 },
+	{ "save_as.png", 522, 2, 128, 128 },
+	{ "make_portable.png", 652, 2, 128, 128 },
+	{ "reload.png", 782, 2, 128, 128 },
+	{ "new_layer.png", 2, 132, 128, 128 },
+	{ "new_folder.png", 132, 132, 128, 128 },
+	{ "states.png", 262, 132, 128, 128 },
+	{ "reset.png", 184, 392, 48, 48 },
+	{ "plus.png", 318, 392, 32, 32 },
+	{ "lock_open.png", 392, 132, 128, 128 },
+	{ "lock_closed.png", 522, 132, 128, 128 },
+	{ "eye_open.png", 652, 132, 128, 128 },
+	{ "eye_closed.png", 782, 132, 128, 128 },
+	{ "pin.png", 2, 262, 128, 128 },
+	{ "pin_off.png", 132, 262, 128, 128 },
+	{ "refresh.png", 782, 262, 86, 86 },
+	{ "move.png", 234, 392, 48, 48 },
+	{ "drop.png", 262, 262, 128, 128 },
+	{ "filter_on.png", 392, 262, 128, 128 },
+	{ "filter_off.png", 522, 262, 128, 128 },
+	{ "tag.png", 652, 262, 128, 128 },
+};
+
+static const unsigned char IconAtlasPng[] = {
+	137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,4,0,0,0,1,202,
+	8,6,0,0,0,157,86,57,246,0,0,230,94,73,68,65,84,120,218,236,157,119,152,21,
+	229,213,192,127,231,110,161,179,52,81,68,96,193,2,138,189,247,222,107,212,168,73,76,143,
+	198,40,74,162,1,141,177,139,229,83,177,97,73,52,166,25,141,37,150,216,53,246,222,141,
+	5,20,84,170,40,210,123,91,216,123,190,63,222,119,195,186,110,153,59,119,230,222,153,123,
+	207,239,121,238,3,187,59,51,247,45,103,222,57,231,204,121,207,1,195,48,12,195,48,12,
+	195,48,12,195,48,74,30,201,229,224,69,139,22,73,151,46,93,250,3,251,2,59,1,27,
+	1,189,252,117,198,3,127,171,171,171,123,164,93,187,118,217,124,27,150,205,102,187,136,200,
+	73,192,225,192,186,64,69,142,151,88,8,188,14,140,17,145,79,242,109,143,239,251,62,192,
+	137,192,166,64,199,28,47,81,7,124,14,220,89,95,95,127,111,101,101,229,234,8,198,168,
+	131,136,252,28,56,26,88,15,88,9,204,0,62,6,94,81,213,231,50,153,204,188,168,133,
+	102,209,162,69,116,233,210,165,11,208,31,88,7,232,14,180,247,114,48,15,248,164,174,174,
+	110,114,187,118,237,52,130,62,86,139,200,166,192,32,160,83,174,50,235,199,125,6,240,129,
+	136,204,139,168,239,253,188,12,244,4,42,115,237,18,176,0,152,80,95,95,255,89,101,101,
+	101,20,247,74,165,136,108,2,108,0,116,6,234,129,165,126,46,190,82,213,233,153,76,102,
+	133,45,119,134,97,24,134,97,196,141,233,137,166,39,26,201,38,99,67,96,24,134,97,24,
+	134,97,24,134,97,24,165,79,32,47,89,93,93,93,166,170,170,234,0,224,12,96,15,160,
+	170,133,67,21,248,107,125,125,253,73,249,188,225,86,213,254,192,99,56,239,89,190,44,3,
+	126,33,34,119,135,190,192,178,101,210,161,67,135,203,129,145,228,239,52,81,224,33,85,253,
+	65,38,147,89,30,246,34,217,108,118,45,17,121,4,216,161,149,195,22,3,15,1,87,137,
+	200,135,249,14,100,93,93,157,84,85,85,245,7,182,6,250,182,49,22,31,215,215,215,63,
+	151,143,231,82,85,187,224,34,64,122,70,32,7,171,129,103,68,228,211,188,38,79,117,23,
+	223,127,137,160,77,19,85,245,169,76,38,179,58,15,57,232,32,34,135,225,60,236,45,78,
+	29,48,9,120,79,68,230,216,178,103,24,134,97,24,70,212,152,158,104,122,162,81,34,14,
+	0,85,29,12,220,128,11,251,15,42,204,35,69,100,116,152,6,173,90,181,170,162,178,178,
+	242,121,96,183,8,251,185,12,216,65,68,198,134,188,153,127,4,252,61,162,155,185,129,209,
+	34,50,50,15,135,196,131,192,17,65,135,21,248,179,170,254,62,147,201,204,15,57,6,221,
+	113,206,159,254,57,156,246,138,136,188,23,82,14,164,178,178,242,104,220,246,143,168,88,13,
+	220,35,34,115,67,142,193,16,96,255,136,239,193,247,68,228,149,144,114,64,135,14,29,14,
+	197,133,189,5,122,14,0,227,84,245,181,76,38,179,210,150,63,195,48,12,195,48,162,192,
+	244,68,211,19,141,244,144,105,67,144,143,3,222,0,246,203,209,248,253,109,125,125,125,187,
+	48,13,170,172,172,220,29,216,53,226,126,118,4,126,19,230,196,149,43,87,102,128,179,34,
+	54,254,1,78,206,102,179,61,194,156,216,161,67,135,205,129,195,114,56,165,10,248,149,136,
+	188,161,170,91,134,88,208,54,2,142,205,113,81,7,216,186,190,190,190,34,164,28,244,141,
+	120,81,7,183,15,107,203,144,114,32,192,54,49,220,131,155,101,179,217,246,33,229,160,23,
+	48,48,199,251,125,51,17,57,78,85,215,178,229,207,48,12,195,48,140,8,140,127,211,19,
+	77,79,52,74,193,1,160,170,195,128,59,128,110,33,174,219,59,147,201,108,16,178,77,59,
+	199,96,108,3,236,228,141,249,156,168,174,174,238,9,12,142,161,61,157,68,100,203,144,231,
+	238,72,184,173,8,27,1,207,170,106,96,7,139,170,110,142,243,102,134,113,232,116,200,100,
+	50,221,66,246,177,79,76,50,223,199,47,210,185,202,65,123,92,18,155,168,169,18,145,94,
+	33,207,93,39,228,189,210,13,56,82,85,215,197,48,12,195,48,210,111,128,118,80,213,62,
+	170,218,45,134,107,15,80,213,29,252,167,191,141,182,233,137,166,39,26,105,167,178,133,155,
+	249,120,224,58,114,207,92,217,128,0,213,33,207,173,142,169,175,85,34,18,182,61,18,87,
+	155,138,48,70,61,128,7,85,117,111,17,249,168,141,69,125,48,176,59,225,243,30,72,30,
+	231,86,196,52,230,153,144,114,80,17,163,28,84,20,97,140,218,3,135,168,234,3,97,67,
+	221,12,195,48,12,163,200,198,103,123,96,47,96,195,70,191,155,5,188,38,34,211,242,188,
+	118,53,112,48,77,222,106,171,234,84,224,9,17,169,139,176,31,27,226,50,180,119,194,229,
+	111,250,76,68,38,165,96,252,77,79,52,61,209,72,33,153,102,110,230,205,128,63,228,97,
+	252,3,44,81,213,137,33,207,253,48,166,190,142,173,174,174,206,57,209,72,54,155,157,133,
+	43,15,18,53,171,128,176,229,9,63,194,37,19,12,75,47,224,174,108,54,219,181,149,69,
+	189,167,127,168,230,147,244,176,78,85,23,134,60,55,174,36,36,115,171,171,171,53,132,28,
+	44,195,149,76,137,154,44,174,12,75,168,190,228,249,221,29,128,3,179,217,108,53,134,97,
+	24,134,145,62,142,108,108,252,123,122,3,223,81,213,126,121,94,251,91,198,191,103,0,112,
+	80,132,70,244,126,254,122,27,226,66,218,7,3,135,170,234,30,9,55,254,77,79,52,61,
+	209,40,5,7,192,234,213,171,43,129,155,129,46,121,94,247,206,76,38,179,40,228,130,242,
+	36,48,57,134,155,231,150,48,39,86,84,84,172,2,110,139,97,236,31,93,180,104,209,23,
+	161,58,147,205,190,10,124,144,231,247,15,21,145,115,155,251,195,234,213,171,51,126,81,207,
+	247,134,159,144,201,100,234,66,202,193,84,96,81,196,99,174,192,216,144,114,144,5,198,197,
+	32,7,147,23,45,90,180,56,164,28,124,5,204,206,243,251,123,138,200,246,182,20,26,134,
+	97,24,105,66,85,119,4,90,219,167,188,99,30,215,30,64,235,251,217,7,68,177,29,64,
+	85,183,5,54,110,225,207,91,168,234,166,73,28,123,211,19,77,79,52,74,200,1,80,81,
+	81,113,52,176,75,158,215,124,91,85,207,14,221,160,76,102,41,240,19,96,65,132,55,243,
+	232,37,75,150,252,39,143,5,250,74,224,63,17,142,251,4,224,212,154,154,154,80,111,241,
+	189,83,226,167,192,172,60,219,113,170,170,14,106,230,250,27,144,127,98,149,153,170,250,90,
+	30,114,176,202,143,121,148,89,72,223,19,145,169,121,200,193,187,192,180,8,219,51,31,120,
+	161,166,166,134,144,114,144,5,158,6,150,231,217,142,205,85,181,6,195,48,12,163,208,70,
+	236,16,85,189,72,85,111,86,213,223,251,80,112,35,24,3,218,248,123,31,85,237,24,242,
+	218,235,68,116,76,91,108,210,198,223,135,38,113,224,77,79,52,61,209,40,1,7,192,202,
+	149,43,51,62,65,222,8,114,223,191,162,184,178,25,95,1,87,168,234,190,153,76,38,47,
+	227,93,68,94,198,85,2,120,0,88,2,212,135,248,172,2,222,7,126,184,124,249,242,223,
+	117,233,210,69,243,88,100,150,171,234,17,192,185,192,20,223,223,92,219,179,26,231,133,187,
+	81,85,119,19,145,175,242,28,163,15,128,157,128,59,129,133,254,59,114,237,99,7,224,215,
+	13,63,172,92,185,82,124,226,147,173,67,54,43,139,11,127,122,87,85,31,204,183,132,136,
+	31,163,251,128,137,126,62,53,196,39,235,199,253,169,229,203,151,191,154,215,205,146,201,172,
+	86,213,71,128,215,113,94,231,108,200,246,44,7,62,80,213,251,68,100,105,158,99,52,7,
+	184,215,59,149,234,8,183,53,36,116,214,91,195,48,12,35,148,161,112,154,170,206,193,109,
+	5,60,31,56,25,184,20,248,84,85,207,10,112,254,81,170,250,162,170,214,249,207,199,170,
+	250,147,50,27,198,32,73,231,194,26,233,85,5,144,129,158,180,157,104,187,71,146,6,220,
+	244,68,211,19,141,210,64,252,34,212,48,169,239,18,124,47,207,231,192,24,224,101,96,70,
+	125,125,253,220,202,202,202,213,81,55,48,155,205,182,23,145,158,228,184,199,72,85,23,213,
+	213,213,45,110,223,190,125,54,202,246,172,90,181,170,162,178,178,178,187,55,158,115,58,53,
+	155,205,206,245,111,239,35,165,190,190,190,93,38,147,233,13,244,3,14,241,138,68,208,76,
+	164,95,55,68,1,136,72,103,255,187,239,229,224,8,90,128,219,142,240,21,176,180,190,190,
+	126,69,101,101,101,54,6,57,168,16,145,14,185,58,168,84,117,101,93,93,221,170,246,237,
+	219,107,196,114,32,149,149,149,237,201,61,87,70,125,54,155,93,225,189,178,81,203,65,69,
+	38,147,233,8,116,6,106,129,205,9,158,149,119,153,170,254,173,225,1,102,75,163,97,24,
+	70,108,134,223,221,192,113,109,28,246,61,17,185,167,133,243,79,7,174,105,225,188,15,69,
+	100,139,50,25,199,195,104,187,196,217,187,34,242,106,136,107,239,233,159,161,173,241,170,136,
+	188,155,71,251,183,161,237,168,219,165,34,242,231,4,141,249,90,166,39,154,158,104,122,98,
+	250,105,16,202,131,253,191,65,141,236,7,84,245,167,153,76,102,113,220,13,204,100,50,43,
+	128,47,147,50,96,85,85,85,245,196,151,120,36,20,21,21,21,43,129,47,252,231,53,85,
+	253,51,240,48,193,66,199,214,22,145,109,253,255,87,248,127,131,46,158,19,85,245,233,176,
+	251,183,114,148,131,122,92,52,72,82,228,64,201,63,164,42,106,57,168,199,101,15,94,12,
+	204,80,213,143,129,67,129,158,1,78,239,40,34,189,253,255,191,194,48,12,195,136,195,128,
+	58,35,128,241,15,48,28,184,167,153,243,107,91,49,254,193,133,234,126,6,12,17,145,250,
+	18,31,206,153,1,28,0,107,135,125,164,6,177,167,242,108,255,128,0,199,76,79,216,152,
+	215,154,158,104,122,162,233,137,233,167,193,224,223,217,127,130,48,86,85,127,92,8,227,223,
+	8,135,47,29,115,52,193,178,145,74,163,249,239,67,240,186,170,115,85,245,63,133,88,212,
+	141,208,114,176,16,120,28,23,22,23,132,92,230,223,48,12,195,200,157,211,2,30,183,93,
+	11,191,255,109,128,115,55,0,110,47,131,177,156,25,224,152,181,66,94,59,200,91,219,208,
+	111,65,85,181,10,88,47,192,161,211,18,54,230,166,39,154,158,104,122,98,9,57,0,54,
+	166,229,44,164,77,185,194,39,234,51,146,125,83,79,0,238,8,120,248,16,255,233,78,240,
+	173,3,239,250,4,44,70,178,229,96,62,110,223,87,16,122,144,176,253,134,134,97,24,165,
+	130,170,118,103,205,27,212,54,151,239,22,126,191,79,192,243,127,16,69,150,250,132,243,117,
+	128,99,218,249,189,246,113,56,0,242,49,108,7,6,60,110,114,194,198,220,244,68,211,19,
+	77,79,44,33,7,192,90,4,243,146,174,6,158,181,97,75,13,79,7,60,174,97,254,59,
+	16,44,183,65,22,183,221,192,72,7,65,223,32,4,157,127,195,48,12,35,119,86,228,98,
+	128,182,80,2,46,151,204,235,91,150,184,225,178,146,96,117,206,195,188,177,12,226,0,200,
+	103,11,64,109,128,99,190,20,145,21,9,27,118,211,19,77,79,52,61,177,132,28,0,85,
+	4,203,120,186,34,155,205,206,181,97,75,13,211,9,150,237,179,97,254,43,8,184,239,45,
+	155,205,174,176,225,77,13,75,114,88,15,50,54,92,134,97,24,177,24,172,203,129,87,114,
+	56,229,226,198,63,248,106,68,185,148,226,90,94,6,195,26,164,198,121,152,60,0,113,231,
+	0,8,18,157,145,68,3,218,244,68,211,19,77,79,44,33,7,192,68,255,105,139,201,171,
+	86,173,178,204,143,233,97,10,193,246,245,76,242,159,5,254,211,22,139,86,173,90,149,45,
+	165,129,82,213,181,84,117,168,170,110,165,170,235,148,152,28,44,10,168,168,44,244,31,195,
+	48,12,35,30,46,207,225,216,35,85,181,119,163,159,207,205,225,220,197,192,243,101,48,158,
+	113,229,1,8,98,228,134,210,135,189,142,209,49,160,14,151,52,202,86,79,44,113,76,79,
+	44,83,7,192,157,254,211,22,119,71,93,86,207,136,143,37,75,150,204,2,158,105,227,176,
+	44,112,151,255,76,32,216,62,160,79,163,46,151,82,68,195,255,72,85,125,22,152,5,140,
+	5,222,195,101,70,157,169,170,255,80,213,131,74,64,14,150,209,246,155,4,5,62,245,31,
+	195,48,12,35,6,68,228,113,224,210,28,78,25,228,159,85,125,128,109,115,56,239,82,17,
+	41,135,23,54,65,242,0,244,10,113,221,32,81,177,97,115,0,4,217,255,191,80,68,102,
+	37,112,188,203,78,79,44,19,123,193,244,196,50,163,210,63,88,110,240,15,166,35,105,57,
+	243,236,219,170,58,198,134,44,61,116,233,210,69,125,201,161,237,104,217,3,126,235,210,165,
+	75,95,6,232,216,177,99,165,151,131,245,105,57,100,110,166,170,190,95,2,134,255,110,192,
+	159,129,13,91,56,164,55,240,67,224,135,170,250,119,17,249,105,138,229,0,85,125,217,207,
+	105,75,123,183,198,46,93,186,244,75,187,107,12,195,48,98,119,2,156,171,170,227,128,191,
+	210,118,13,238,58,85,221,26,184,40,224,229,87,1,23,138,200,21,101,50,150,51,85,117,
+	53,173,239,217,15,19,170,31,103,14,128,32,81,134,137,220,63,175,170,31,148,139,158,88,
+	102,246,130,233,137,101,70,6,32,147,201,44,201,100,50,75,84,245,64,92,230,248,85,77,
+	30,38,119,168,234,129,153,76,102,137,13,89,234,30,142,19,128,189,113,251,14,27,71,111,
+	44,4,206,175,175,175,63,173,115,231,206,218,185,115,103,205,100,50,171,50,153,204,42,85,
+	125,8,24,223,228,248,44,48,94,85,31,74,123,86,87,85,253,17,240,82,43,198,127,83,
+	126,162,170,79,164,92,14,230,3,15,224,106,183,54,246,202,215,1,111,212,215,215,191,216,
+	185,115,103,58,119,238,108,55,141,97,24,70,252,107,242,93,192,136,0,135,62,4,188,141,
+	171,213,221,22,159,2,221,69,228,178,50,27,206,47,243,252,123,115,44,139,232,152,102,213,
+	144,0,199,76,75,226,64,151,139,158,88,166,107,146,233,137,229,52,223,77,127,49,119,238,
+	92,233,209,163,71,95,96,11,255,171,15,230,205,155,247,101,207,158,61,45,148,39,197,172,
+	92,185,50,83,93,93,61,196,27,189,75,84,245,221,76,38,179,160,165,227,231,206,157,75,
+	143,30,61,58,179,38,116,110,206,188,121,243,150,244,236,217,51,213,227,160,170,157,253,131,
+	181,123,136,211,127,36,34,119,164,92,14,164,186,186,186,59,208,13,88,165,170,179,50,153,
+	204,74,187,67,12,195,48,138,242,76,122,36,160,113,31,132,131,69,228,137,50,28,195,190,
+	192,209,173,28,114,191,136,124,153,227,53,183,6,118,109,205,64,23,145,127,135,108,239,14,
+	192,14,173,28,178,26,248,163,136,36,122,203,109,169,234,137,102,47,152,158,88,150,14,0,
+	195,40,113,69,225,68,224,214,144,167,63,40,34,71,217,40,26,134,97,24,1,158,55,251,
+	1,67,128,249,192,19,34,50,183,133,227,222,162,229,237,151,65,57,167,12,223,252,55,30,
+	195,13,129,221,128,198,175,39,23,3,47,139,200,231,33,175,249,29,154,207,214,191,210,235,
+	3,179,66,94,183,10,183,197,176,75,11,135,188,37,34,111,216,29,100,52,35,59,253,129,
+	85,34,50,195,70,195,200,135,74,27,2,163,204,168,205,227,220,237,109,248,12,195,48,140,
+	54,148,244,109,128,91,128,109,26,253,122,181,170,94,13,252,1,80,17,105,28,226,61,61,
+	15,7,192,88,224,151,34,242,122,57,143,185,136,124,6,124,166,170,131,188,19,96,137,136,
+	76,202,243,154,255,86,213,221,113,78,156,246,254,215,147,129,215,69,100,78,30,215,93,165,
+	170,143,3,251,240,237,4,133,255,53,227,223,104,102,77,57,19,56,13,88,207,255,60,22,
+	184,34,237,81,169,70,17,215,76,27,2,163,204,22,209,179,129,176,111,73,166,137,200,0,
+	27,69,195,48,12,163,133,103,76,55,111,148,247,109,227,208,197,192,237,34,114,170,170,222,
+	10,156,24,242,43,207,199,101,252,207,54,105,199,150,192,112,239,88,232,136,219,215,123,191,
+	136,92,103,179,20,106,94,59,1,203,163,14,203,87,213,245,129,30,184,125,214,211,252,62,
+	108,163,240,243,187,30,176,169,55,176,187,225,28,62,213,222,78,202,226,202,66,102,128,229,
+	184,146,121,203,128,121,254,190,250,66,68,166,199,216,182,235,253,189,220,28,167,137,200,141,
+	54,131,134,97,24,173,47,164,167,107,120,94,180,17,52,12,195,48,90,121,198,92,153,227,
+	115,101,161,230,207,84,85,189,74,85,159,87,213,233,170,58,175,149,99,31,182,89,50,202,
+	252,30,173,80,213,221,85,245,247,170,250,164,170,126,25,193,61,184,92,85,63,84,213,187,
+	85,245,55,62,135,68,20,109,221,185,141,239,93,236,157,83,134,97,24,70,43,139,233,41,
+	121,44,240,127,180,17,52,12,195,48,90,121,198,124,165,201,231,18,155,41,163,12,239,205,
+	195,85,245,33,85,93,86,160,251,108,158,170,62,170,170,195,85,181,58,100,155,31,14,240,
+	61,223,183,217,53,114,197,182,0,24,229,246,0,248,5,112,91,200,211,79,20,145,219,108,
+	20,13,195,48,140,22,158,49,171,113,225,194,73,102,129,136,116,79,193,88,30,2,236,1,
+	172,96,77,40,246,106,214,148,40,107,252,115,195,223,27,151,159,203,229,239,65,143,15,122,
+	126,115,215,171,111,225,250,97,127,174,199,213,108,223,13,23,158,254,190,207,133,96,124,83,
+	142,78,0,78,101,77,117,179,98,176,12,248,59,48,58,104,110,10,85,237,9,204,0,170,
+	218,56,244,10,17,249,157,205,180,145,11,150,4,208,40,55,102,229,113,238,88,27,62,195,
+	48,12,163,5,133,189,123,10,140,127,128,110,170,218,94,68,86,36,116,28,135,0,207,3,
+	235,152,84,229,60,118,79,1,135,139,72,157,141,133,110,13,140,6,246,74,64,115,58,2,
+	39,3,191,82,213,63,0,23,5,168,34,241,227,0,198,63,192,230,38,249,70,174,100,108,
+	8,140,50,99,94,216,103,9,240,142,13,159,97,24,134,209,2,203,83,212,214,14,9,53,
+	218,182,4,222,53,227,63,52,7,0,175,152,241,175,23,123,57,218,43,97,77,19,224,20,
+	96,162,170,254,166,141,99,55,12,120,77,75,78,109,152,3,192,48,218,224,139,144,231,189,
+	35,34,171,109,248,12,195,48,140,102,53,123,247,70,125,65,10,154,90,159,196,108,243,170,
+	122,52,240,26,238,109,169,17,158,237,84,181,44,51,195,171,106,47,85,253,15,112,94,194,
+	155,218,25,184,86,85,31,87,213,62,45,28,179,118,192,107,245,49,145,55,204,1,96,24,
+	173,43,104,211,248,230,30,190,160,188,96,163,103,24,134,97,180,193,77,41,104,227,172,164,
+	53,72,85,127,11,220,71,66,35,19,82,200,48,85,61,181,204,140,255,1,184,173,35,251,
+	165,168,217,7,1,47,170,234,174,205,252,109,131,128,215,232,222,138,19,193,48,204,1,96,
+	24,158,79,10,116,142,97,24,134,81,70,136,200,185,192,35,173,28,50,31,248,18,231,84,
+	30,13,76,139,224,107,23,229,120,252,29,9,51,220,174,243,99,97,68,203,13,170,122,64,
+	153,24,255,235,2,15,3,155,166,176,249,27,2,207,171,234,207,154,252,190,95,14,215,216,
+	200,196,221,48,7,128,97,180,206,132,16,231,76,178,97,43,105,229,161,163,170,158,160,170,
+	47,169,234,231,170,122,173,79,68,101,148,151,28,108,162,170,151,171,234,7,170,250,150,170,
+	158,235,223,42,25,38,7,129,229,64,68,14,7,78,199,237,197,158,132,75,32,251,87,96,
+	43,17,233,33,34,235,137,200,94,34,50,18,24,8,156,159,71,115,255,36,34,53,184,200,
+	131,197,1,142,255,18,184,44,33,227,44,170,250,47,224,215,38,117,177,241,23,85,173,45,
+	241,251,181,155,55,254,211,156,12,175,210,207,213,72,223,167,74,160,91,14,231,175,111,162,
+	110,152,3,192,48,90,39,76,54,255,247,109,216,74,154,78,184,125,116,29,113,89,188,123,
+	17,124,255,157,81,58,172,139,75,62,214,190,145,76,244,182,97,49,57,200,85,14,68,228,
+	58,17,217,77,68,214,23,145,205,68,228,231,34,210,220,115,100,7,224,216,60,218,218,203,
+	127,223,169,34,210,21,151,16,172,22,184,2,87,114,174,49,239,2,71,136,200,130,4,24,
+	109,27,2,111,1,223,53,113,139,93,150,255,81,226,125,188,31,216,166,68,250,114,165,170,
+	14,199,133,255,231,82,170,221,28,213,134,97,24,109,40,30,199,106,110,152,241,95,218,242,
+	112,188,170,46,104,97,238,255,165,170,93,109,148,74,94,6,122,171,234,147,173,172,1,127,
+	83,85,75,76,102,114,16,169,28,168,234,239,53,127,222,106,229,250,61,85,245,135,170,122,
+	154,170,238,151,160,113,62,64,85,191,86,163,144,252,165,68,239,217,81,37,58,95,103,231,
+	120,252,243,182,130,27,185,208,172,119,169,190,190,190,93,38,147,233,15,144,205,102,167,86,
+	84,84,212,217,80,165,159,250,250,250,234,76,38,51,192,207,235,180,138,138,138,149,109,28,
+	95,145,201,100,186,248,227,23,87,84,84,212,199,176,120,119,193,189,105,157,44,34,245,133,
+	24,7,85,221,22,120,59,135,83,174,17,145,223,150,144,28,196,62,175,41,82,30,70,2,
+	87,182,113,216,123,192,254,34,50,215,86,145,146,148,129,94,184,204,227,109,149,92,122,1,
+	56,192,234,107,155,28,68,33,7,170,122,16,240,120,68,205,127,84,68,14,75,201,56,159,
+	8,220,26,226,212,15,129,167,128,44,174,54,122,69,195,37,113,225,211,21,94,167,109,248,
+	123,166,201,207,141,143,223,16,104,231,255,174,254,216,76,163,191,87,0,107,209,118,212,199,
+	34,92,66,197,138,38,231,55,92,111,53,174,244,112,101,11,237,109,238,231,166,237,109,233,
+	231,140,63,47,23,135,212,89,34,114,101,148,243,89,76,125,194,151,140,252,111,137,46,73,
+	243,129,238,57,28,191,200,111,5,50,61,209,200,221,1,224,13,255,51,113,53,42,27,22,
+	190,153,192,141,217,108,118,180,57,2,82,109,248,143,0,78,101,77,88,243,44,224,230,108,
+	54,123,101,83,71,128,191,241,183,193,237,167,106,200,200,187,12,248,48,155,205,190,23,197,
+	66,160,170,123,1,191,5,14,241,191,90,5,188,3,252,81,68,110,143,249,161,81,9,172,
+	36,248,22,152,61,68,228,165,2,61,208,134,3,135,251,251,111,34,112,135,136,220,31,225,
+	130,190,181,159,215,6,165,97,185,159,215,119,203,109,129,87,213,179,9,190,23,246,67,96,
+	95,17,153,109,43,74,201,201,193,189,192,49,1,15,191,80,68,46,178,81,51,57,200,71,
+	14,84,181,19,206,177,24,36,113,87,22,248,10,88,175,141,227,78,19,145,27,19,62,198,
+	23,17,46,223,65,164,247,157,170,14,107,100,80,183,196,81,192,30,109,28,243,184,119,74,
+	180,54,119,55,137,136,38,200,161,114,148,136,60,24,145,62,17,171,158,24,160,239,119,1,
+	223,139,232,114,211,128,233,222,230,249,18,168,7,234,188,110,42,141,156,69,171,189,30,189,
+	153,239,123,167,4,221,98,125,68,228,107,211,19,141,192,14,128,250,250,250,42,128,76,38,
+	115,47,240,157,22,142,189,175,190,190,254,251,149,149,149,86,11,61,69,172,94,189,186,178,
+	162,162,226,46,90,222,103,247,239,108,54,219,176,255,176,222,203,193,65,180,156,80,228,243,
+	250,250,250,39,43,43,43,179,121,44,218,231,0,151,180,114,200,31,69,228,228,152,31,28,
+	239,16,108,207,216,98,191,175,50,238,7,217,174,192,255,1,187,52,243,231,15,128,35,69,
+	100,114,30,114,144,169,168,168,56,144,150,203,202,76,204,102,179,79,0,84,84,84,100,75,
+	253,190,80,213,243,128,139,115,60,109,28,176,143,136,204,180,149,165,100,228,96,40,240,17,
+	193,247,90,46,2,250,138,200,18,27,61,147,131,48,114,160,170,191,7,46,196,189,197,109,
+	139,71,129,11,252,255,223,109,227,216,149,192,207,68,228,174,132,142,241,237,192,143,114,61,
+	13,248,185,136,252,45,194,118,116,3,126,28,224,208,159,1,91,182,113,204,191,112,137,30,
+	91,227,1,17,153,30,243,216,94,1,156,25,240,240,249,192,110,34,50,46,164,129,152,41,
+	132,158,24,160,207,155,248,103,114,88,86,1,207,226,242,7,188,32,34,159,135,108,199,254,
+	192,94,192,209,180,29,61,20,55,155,137,200,216,176,39,155,158,88,94,52,220,200,39,100,
+	50,153,19,90,49,254,1,142,174,168,168,248,137,13,89,186,240,115,118,116,43,135,124,167,
+	97,254,51,153,204,208,76,38,51,148,214,179,137,110,80,81,81,177,113,30,139,246,69,109,
+	24,255,0,191,82,213,71,85,181,125,140,67,243,102,192,227,62,136,249,193,221,78,85,175,
+	7,94,110,193,248,7,216,2,248,88,85,79,200,67,14,54,166,245,154,178,235,55,154,255,
+	82,87,246,47,10,97,252,3,12,5,94,176,122,187,37,197,145,228,150,104,169,171,87,246,
+	12,147,131,156,229,64,85,207,2,46,13,104,252,3,252,82,68,222,3,170,3,28,219,14,
+	248,167,170,94,146,164,129,85,213,62,170,250,98,8,227,127,42,176,103,148,198,191,39,104,
+	152,116,151,0,199,4,169,186,16,251,243,66,68,206,2,30,8,120,120,119,224,118,85,13,
+	149,4,188,16,122,98,64,242,73,30,249,146,136,84,139,200,65,34,114,91,88,227,223,143,
+	253,127,68,228,108,17,217,8,216,25,184,17,152,83,164,219,173,71,158,246,130,233,137,229,
+	230,0,0,126,225,63,173,202,57,240,243,37,75,150,136,13,91,58,240,115,245,243,0,138,
+	77,195,252,15,245,159,182,216,100,201,146,220,95,128,169,234,145,4,15,255,59,4,120,83,
+	85,227,170,233,122,79,192,227,198,198,53,63,170,122,52,46,180,124,120,128,195,219,3,127,
+	82,213,227,66,200,1,192,38,1,13,220,146,94,216,189,114,156,79,201,173,33,184,122,189,
+	125,109,133,41,9,194,200,251,102,54,108,38,7,185,202,129,223,122,118,78,14,167,188,35,
+	34,51,252,255,115,41,67,123,142,170,30,156,144,245,118,39,156,115,123,247,28,79,125,21,
+	247,150,58,142,173,119,65,35,250,58,7,56,102,97,128,99,214,41,208,112,31,159,131,190,
+	178,53,240,207,60,238,149,216,244,196,28,56,38,196,57,43,128,227,69,100,143,56,26,36,
+	34,175,139,200,105,34,178,22,110,107,194,51,5,190,229,170,194,158,104,122,98,249,58,0,
+	130,78,232,144,246,237,219,87,216,176,165,3,63,87,67,114,184,161,123,250,79,91,116,111,
+	223,190,125,24,239,241,53,57,30,191,57,240,156,170,70,190,88,123,197,226,206,0,135,198,
+	242,54,69,85,175,6,238,35,216,30,208,198,92,22,66,14,50,4,75,38,19,116,254,211,
+	106,252,95,153,163,2,222,18,131,189,19,160,159,173,50,169,39,76,137,191,46,54,108,38,
+	7,33,228,96,175,28,207,185,164,209,243,106,22,144,203,190,237,179,19,176,222,30,227,13,
+	160,92,235,147,223,43,34,187,138,200,23,49,53,45,104,4,64,144,228,122,11,98,146,173,
+	48,58,205,10,224,167,184,253,218,65,56,78,85,47,12,241,85,113,235,137,65,100,107,107,
+	32,215,151,67,159,2,155,139,200,63,11,52,31,247,136,200,126,94,183,190,142,96,209,34,
+	121,127,109,30,246,130,233,137,101,234,0,104,239,63,109,209,46,31,1,51,10,142,248,57,
+	107,243,222,247,159,10,218,78,140,67,192,99,154,46,216,103,224,106,19,231,202,90,192,195,
+	170,186,79,12,227,115,69,27,127,127,92,68,190,140,248,193,213,75,85,159,5,206,8,121,
+	137,65,170,122,122,136,243,130,206,107,73,58,248,84,245,26,96,100,132,151,220,208,59,1,
+	172,246,110,186,201,198,116,47,25,38,7,77,233,144,195,177,11,69,228,161,38,191,203,37,
+	114,105,87,85,237,80,172,193,84,213,223,1,247,146,91,134,122,128,171,69,228,184,152,155,
+	23,196,1,144,33,186,45,0,157,84,181,71,33,198,93,68,222,5,114,217,42,120,129,170,
+	30,31,66,238,99,209,19,115,224,216,28,143,31,11,108,43,34,159,21,92,9,23,249,88,
+	68,78,7,186,249,123,56,201,121,212,202,90,79,44,87,7,128,97,196,205,190,121,156,219,
+	21,120,70,85,71,68,188,48,127,132,75,6,180,162,153,63,63,42,34,135,68,172,20,237,
+	12,188,14,236,157,231,165,142,51,113,10,60,230,162,170,99,128,211,99,184,252,250,222,9,
+	80,107,35,157,90,194,100,52,54,39,184,201,65,24,57,120,63,135,99,191,106,230,121,53,
+	54,71,227,161,125,49,6,82,85,255,0,92,30,226,212,83,69,100,68,1,154,24,100,11,
+	64,16,39,193,178,28,228,166,96,121,99,252,27,238,11,115,56,229,54,85,221,62,101,247,
+	235,81,57,28,59,7,216,74,68,22,23,179,193,34,146,21,145,81,184,151,7,247,199,244,
+	53,150,152,207,8,76,165,13,129,81,32,54,136,224,26,87,169,234,64,17,25,22,225,162,
+	252,15,85,125,14,151,241,119,99,92,72,223,19,34,242,104,196,74,209,143,128,219,8,150,
+	204,169,45,118,80,213,245,226,206,44,92,10,198,63,112,19,16,103,69,137,129,184,196,128,
+	123,139,200,36,27,245,178,192,28,0,70,206,114,32,34,211,84,245,159,192,15,2,28,254,
+	108,75,203,90,192,175,155,34,34,243,11,188,222,246,7,30,35,247,208,236,229,192,35,192,
+	218,170,122,41,107,202,173,213,227,222,52,70,253,243,214,254,223,44,223,124,9,214,248,231,
+	32,78,2,5,14,109,225,252,166,63,239,160,170,19,99,234,79,75,63,127,68,176,60,21,
+	237,129,135,84,117,231,124,42,13,21,80,206,134,146,91,182,253,115,68,100,117,140,237,233,
+	1,252,30,183,197,167,3,48,5,248,12,152,128,171,82,240,121,227,72,82,17,153,2,124,
+	215,235,132,127,137,216,14,179,103,147,81,190,14,0,191,183,186,134,53,117,59,165,209,141,
+	209,220,135,86,126,191,24,152,140,171,79,255,31,17,49,239,90,120,214,138,232,58,167,168,
+	106,71,17,249,89,132,78,128,47,137,105,175,191,151,201,171,128,168,223,108,108,142,171,89,
+	107,52,63,230,25,224,102,224,164,2,124,221,0,239,4,216,167,24,33,134,70,94,132,81,
+	12,45,114,206,228,32,172,28,252,24,216,158,182,29,226,87,183,240,251,183,113,153,198,219,
+	226,134,2,175,183,23,1,231,134,28,147,14,228,30,210,157,4,58,1,251,149,136,252,175,
+	3,124,174,170,231,137,200,101,9,111,235,65,57,28,251,153,136,220,26,163,220,111,1,60,
+	12,244,111,244,235,141,155,182,81,85,179,192,92,96,54,48,209,219,21,99,129,83,128,49,
+	68,23,173,99,207,38,163,124,29,0,56,239,122,28,89,87,167,168,234,111,69,228,1,19,
+	155,162,47,76,63,85,213,133,34,242,155,20,24,162,119,225,178,193,218,189,91,88,227,255,
+	22,114,219,11,153,47,253,112,219,1,246,17,145,9,54,11,134,97,52,69,68,234,129,13,
+	85,245,3,156,19,183,57,206,240,111,9,155,99,76,0,7,192,61,34,114,77,161,250,164,
+	170,135,145,95,101,21,35,57,58,218,165,170,218,93,68,70,38,184,157,135,230,112,236,229,
+	49,183,229,15,77,140,255,214,198,118,45,255,217,36,198,246,88,4,128,81,20,163,172,212,
+	169,5,238,87,213,43,108,40,66,49,59,226,235,253,90,85,175,75,184,33,250,120,76,198,
+	63,56,111,178,241,237,49,175,192,109,181,56,161,8,95,223,23,23,9,176,177,205,68,106,
+	8,179,247,219,158,155,38,7,121,201,129,136,108,129,203,216,254,9,176,202,127,94,2,142,
+	22,145,107,91,57,239,30,224,119,173,60,19,134,139,200,247,10,60,118,127,49,241,41,41,
+	70,168,234,38,9,110,223,86,1,143,171,19,145,191,198,168,107,236,8,236,148,52,21,200,
+	196,215,8,138,189,69,204,157,51,85,117,174,136,92,105,67,145,19,97,202,1,5,113,2,
+	244,41,64,214,224,48,15,135,155,200,45,84,45,23,230,136,200,171,38,82,223,26,243,74,
+	224,207,184,48,219,98,177,14,107,182,3,140,181,89,73,190,216,132,177,223,108,216,76,14,
+	242,149,3,17,249,59,240,247,16,231,93,161,170,15,224,234,160,175,135,115,174,223,37,34,
+	227,139,176,230,254,8,232,101,226,83,114,28,12,124,156,192,103,124,45,193,242,51,0,60,
+	25,115,115,54,74,224,188,117,48,209,53,204,1,16,47,163,84,245,62,75,250,149,19,255,
+	231,21,150,168,203,225,28,235,67,214,246,79,208,67,106,91,220,222,174,184,184,220,196,169,
+	89,227,255,118,224,251,9,104,78,111,224,57,85,221,87,68,62,180,217,49,195,207,48,57,
+	136,18,159,107,36,9,123,181,135,152,232,148,36,221,19,218,174,51,115,56,246,137,152,219,
+	50,39,129,227,211,201,68,215,8,138,133,50,134,163,26,24,109,195,144,147,194,50,5,56,
+	2,136,195,32,218,79,85,247,78,80,119,47,137,241,218,215,22,114,127,103,74,140,255,42,
+	224,159,9,49,254,27,88,11,120,86,85,183,180,25,74,52,182,5,192,48,57,200,227,209,
+	110,67,96,247,67,1,57,44,135,99,31,143,89,167,125,28,88,148,176,241,233,104,162,107,
+	4,165,20,35,0,46,37,26,47,216,90,192,79,104,57,188,237,59,170,218,77,68,22,152,
+	24,5,94,48,95,1,182,80,213,147,112,89,241,55,136,240,242,103,3,207,37,192,24,237,
+	0,28,16,195,165,95,6,254,236,195,70,141,53,227,93,13,220,69,110,117,129,11,69,47,
+	239,4,216,79,68,222,179,217,50,163,199,48,57,40,181,37,216,134,160,36,169,72,224,179,
+	126,32,110,203,75,16,94,19,145,105,5,104,214,72,92,194,225,164,176,202,68,215,40,91,
+	7,128,136,220,24,225,130,115,190,55,42,119,104,225,225,191,35,241,239,51,42,69,71,192,
+	45,192,45,170,122,30,174,76,91,223,8,46,59,40,33,221,139,114,139,195,100,224,94,224,
+	1,17,121,171,128,15,218,32,202,193,118,56,71,71,227,242,53,13,101,50,71,137,200,138,
+	2,180,179,29,112,15,46,178,36,169,244,0,158,81,213,3,68,228,237,2,205,209,182,124,
+	51,249,100,131,82,48,29,231,72,250,72,68,180,84,228,32,79,82,253,230,215,228,192,228,
+	160,80,114,16,225,184,25,41,80,211,18,216,166,237,115,56,246,233,2,233,178,183,170,234,
+	246,192,47,18,50,70,43,76,116,141,178,117,0,68,124,115,47,83,213,99,128,150,60,137,
+	91,155,3,32,175,241,29,133,203,167,48,194,59,2,242,137,8,152,147,144,62,125,169,170,
+	243,9,191,135,110,28,206,233,244,144,136,60,155,64,165,96,93,224,28,92,116,76,69,75,
+	138,130,170,142,106,237,97,36,146,159,126,225,141,255,251,200,173,36,80,177,232,14,60,173,
+	170,7,137,200,235,49,127,87,131,178,127,90,51,127,203,2,43,129,219,84,245,220,60,148,
+	133,196,200,65,20,182,83,137,46,175,38,7,38,7,145,202,65,11,115,20,228,77,241,229,
+	126,124,235,27,201,72,177,126,222,146,53,78,170,44,223,116,226,196,253,243,56,96,89,145,
+	251,223,240,243,217,41,188,31,182,205,225,216,87,10,168,243,157,160,170,79,3,23,0,197,
+	174,0,180,216,44,11,35,87,7,192,74,255,111,187,54,142,175,163,204,66,190,68,228,11,
+	85,157,141,219,18,208,220,3,52,201,168,159,179,182,182,68,52,204,127,125,192,135,122,54,
+	226,49,30,13,140,86,213,99,129,227,8,23,206,253,116,130,198,253,239,192,111,114,56,126,
+	17,240,0,112,107,140,6,98,144,57,171,15,168,236,159,220,198,117,70,0,87,18,147,55,
+	90,85,219,3,247,227,50,21,167,133,26,224,41,85,61,216,111,133,137,139,45,189,178,95,
+	221,194,223,219,55,154,191,48,198,95,98,228,160,136,134,95,69,10,228,205,228,192,228,160,
+	80,114,16,228,25,127,78,34,38,89,245,199,64,183,34,125,253,3,34,50,61,1,99,112,
+	113,158,186,64,81,244,68,114,75,56,249,118,33,199,212,151,231,188,71,85,215,6,246,244,
+	159,221,128,161,5,158,222,47,138,172,39,26,41,116,0,124,234,255,221,172,141,227,63,175,
+	171,171,43,171,201,247,123,140,187,180,240,231,101,73,110,123,93,93,93,125,135,14,29,62,
+	199,133,103,182,70,195,252,47,240,255,246,108,227,248,5,117,117,117,145,59,63,68,228,94,
+	224,94,85,237,129,171,145,252,125,130,121,125,39,0,163,146,50,238,34,114,186,170,14,1,
+	14,108,69,217,124,25,120,7,120,65,68,30,137,89,14,178,29,58,116,88,0,172,221,214,
+	188,250,246,55,119,31,116,0,134,5,80,246,105,69,217,140,226,126,236,0,252,27,216,63,
+	133,203,73,23,224,9,85,61,68,68,94,138,233,59,42,2,140,127,71,63,143,171,129,11,
+	91,82,250,147,44,7,17,146,165,52,49,57,48,57,136,84,14,242,112,156,88,158,128,28,
+	156,37,5,146,137,124,142,41,150,158,24,180,140,244,18,17,89,88,36,221,111,38,110,91,
+	226,61,126,157,236,129,219,42,60,216,59,48,54,193,109,87,93,55,134,175,127,47,159,210,
+	195,185,234,137,70,233,56,0,26,18,139,181,149,217,254,31,29,59,118,44,183,197,252,88,
+	190,185,175,177,49,211,146,220,240,142,29,59,170,170,254,35,128,3,160,97,254,63,241,255,
+	238,218,198,241,227,59,118,140,47,217,168,136,204,3,174,1,174,81,213,157,112,81,1,71,
+	0,181,205,28,254,12,240,43,17,89,153,168,39,189,200,65,170,58,28,183,181,97,61,220,
+	190,203,15,125,191,158,46,100,123,59,118,236,136,170,142,15,176,176,127,210,202,223,106,129,
+	225,197,28,83,85,237,8,60,4,236,155,226,245,164,179,119,2,28,42,34,207,23,115,121,
+	192,101,84,126,70,68,158,201,225,188,162,203,65,212,98,21,226,156,82,202,254,110,114,96,
+	114,144,143,28,212,71,116,76,146,231,185,20,190,59,87,71,132,4,208,19,10,173,39,6,
+	205,175,52,43,65,122,224,60,92,53,130,199,155,232,50,27,224,114,139,237,132,139,210,25,
+	18,192,161,210,22,127,73,128,158,104,164,205,1,160,170,55,123,97,61,4,216,171,133,99,
+	159,206,102,179,183,150,211,224,168,234,97,192,205,45,252,121,21,240,108,210,251,144,205,102,
+	111,205,100,50,135,1,251,181,112,200,243,13,243,239,251,132,136,212,210,114,182,213,105,217,
+	108,118,108,161,218,239,67,226,95,7,126,227,23,205,77,129,165,184,144,234,9,34,242,81,
+	82,199,94,68,198,0,99,18,34,7,99,51,153,204,64,160,127,11,135,76,87,213,214,74,
+	52,30,67,17,107,204,170,106,39,224,49,96,143,34,14,227,178,38,10,115,62,202,246,99,
+	170,122,120,142,202,118,28,74,255,14,56,39,90,80,138,42,7,49,96,225,140,38,7,38,
+	7,225,229,160,34,162,99,10,246,40,180,105,206,47,106,163,65,79,40,130,158,24,116,189,
+	249,50,233,19,32,34,159,3,159,3,119,54,26,215,238,192,70,192,134,222,33,176,97,163,
+	79,231,54,46,121,171,136,220,148,0,61,209,72,155,3,32,147,201,44,247,147,127,184,136,
+	92,10,252,188,209,205,182,4,151,36,230,188,138,138,138,149,229,48,40,170,186,5,112,49,
+	112,120,43,135,189,36,34,137,79,184,81,81,81,177,50,155,205,30,233,19,238,157,208,104,
+	33,89,10,252,69,85,207,105,152,255,70,139,192,35,34,178,51,46,92,169,202,255,186,14,
+	24,167,170,111,84,84,84,20,69,89,106,180,104,26,185,203,65,125,54,155,125,76,68,118,
+	196,237,75,107,8,11,93,5,124,172,170,175,101,50,153,213,173,92,162,119,17,239,199,142,
+	184,100,155,187,230,121,169,241,192,199,141,126,206,53,215,196,211,184,109,27,13,247,196,249,
+	121,180,165,3,240,176,170,238,83,128,196,128,45,222,82,228,254,22,179,183,221,77,37,135,
+	201,129,17,86,14,36,162,99,10,217,199,98,145,148,136,145,188,162,54,26,244,132,34,232,
+	137,65,29,0,47,165,242,230,19,153,15,188,233,63,77,117,160,245,113,47,103,183,198,37,
+	26,172,5,230,1,83,128,123,252,246,217,36,232,137,70,218,28,0,141,110,236,37,192,175,
+	179,217,236,5,34,50,196,201,157,142,207,100,50,11,203,97,48,84,117,19,220,30,184,239,
+	6,120,80,140,74,75,191,50,153,204,82,224,140,108,54,123,145,159,87,241,243,186,160,133,
+	227,87,1,47,102,179,217,55,68,164,187,31,155,121,153,76,166,206,110,153,244,226,231,245,
+	229,108,54,251,166,136,244,240,243,58,63,147,201,36,221,177,247,199,8,140,255,113,192,62,
+	184,125,174,245,192,37,33,31,210,151,52,90,47,86,229,185,14,116,0,238,82,213,161,34,
+	178,180,204,149,210,36,43,195,229,48,102,38,7,54,102,97,250,100,57,0,210,225,124,248,
+	134,157,23,197,49,69,208,19,167,3,253,218,56,102,21,240,231,146,19,28,145,137,192,68,
+	211,19,141,216,28,0,141,4,96,1,240,70,185,12,130,170,110,138,203,102,124,108,192,7,
+	224,95,68,228,197,20,26,128,11,105,198,187,216,202,241,43,129,175,237,54,41,57,71,64,
+	93,90,230,85,85,119,7,126,148,231,101,62,4,246,19,145,89,141,174,27,230,58,217,166,
+	206,0,85,173,7,46,203,163,109,3,112,145,57,215,155,100,230,36,23,21,192,46,184,144,
+	229,113,192,243,34,178,60,204,165,10,109,248,169,106,71,17,89,102,179,104,114,80,2,114,
+	96,57,0,74,211,17,17,216,89,81,64,61,241,95,192,25,109,28,115,162,136,76,182,41,
+	46,47,61,209,8,57,199,101,174,60,236,172,170,255,246,6,194,247,2,142,199,99,184,196,
+	110,134,81,78,20,107,239,228,201,121,158,255,62,176,119,99,227,63,202,49,16,145,203,129,
+	179,242,188,238,247,76,14,114,90,183,191,143,219,10,244,34,174,188,220,99,192,23,170,58,
+	66,85,43,11,96,16,72,136,54,247,86,213,203,85,117,34,176,68,85,63,80,213,145,62,
+	183,133,173,7,38,7,105,149,3,203,1,144,66,213,55,166,251,33,94,175,133,200,111,113,
+	249,160,154,227,107,96,83,17,249,187,77,175,97,152,3,160,181,135,240,22,170,250,52,240,
+	42,46,187,124,144,7,121,22,23,54,252,29,17,177,61,48,134,81,24,246,204,227,220,119,
+	129,125,68,100,110,68,107,159,182,160,152,92,73,219,111,38,90,99,75,85,45,86,120,104,
+	106,222,136,169,170,248,132,165,255,228,219,21,65,122,2,87,1,143,22,192,152,202,228,216,
+	238,35,113,165,74,127,135,43,1,37,192,230,222,104,29,167,170,219,37,97,120,77,14,76,
+	14,66,200,129,229,0,72,199,119,55,38,109,81,27,141,159,181,59,227,42,41,125,225,101,
+	245,11,224,26,17,233,35,34,227,76,93,50,12,115,0,180,246,16,62,25,120,139,220,74,
+	137,61,10,236,32,34,231,153,241,111,24,5,101,69,200,243,222,198,133,253,207,139,80,25,
+	203,182,162,152,92,139,43,139,22,198,144,122,79,68,138,101,128,73,138,100,225,66,218,142,
+	8,57,0,87,102,177,115,192,107,198,26,250,173,170,63,195,133,174,118,107,225,144,1,184,
+	74,44,219,148,177,97,100,114,144,94,57,176,28,0,233,187,199,210,22,181,209,244,89,251,
+	91,17,233,47,34,25,255,239,111,77,180,12,195,28,0,109,61,132,207,192,149,245,171,14,
+	112,248,82,224,79,192,150,34,114,152,136,188,99,226,98,24,5,231,137,16,231,188,233,141,
+	255,249,17,175,125,218,134,98,114,3,48,44,132,194,123,167,77,115,155,107,247,16,224,247,
+	1,15,223,13,120,74,85,187,198,100,156,72,192,54,159,8,220,22,64,153,238,4,220,163,
+	170,29,108,166,77,14,82,38,7,105,123,155,92,204,45,0,73,113,132,164,45,106,195,48,
+	12,115,0,228,165,56,28,12,92,29,224,208,143,113,111,242,250,138,200,47,69,228,3,19,
+	19,195,40,154,242,50,6,151,185,63,40,175,1,251,139,72,91,149,75,34,141,0,104,228,
+	4,248,3,46,71,72,80,69,115,34,240,87,147,131,54,25,78,11,73,107,91,96,103,224,
+	63,170,90,19,67,127,218,124,110,250,72,179,91,114,120,198,174,15,252,204,228,192,228,32,
+	101,114,144,182,183,201,22,141,96,81,27,134,97,148,139,3,64,85,171,112,165,196,90,99,
+	6,240,3,17,25,42,34,55,4,48,32,12,163,156,40,202,27,1,17,25,79,240,44,251,
+	47,3,7,136,200,162,152,250,163,1,219,252,39,92,102,255,182,222,124,45,5,142,11,153,
+	181,188,172,228,0,56,40,196,57,59,0,79,171,106,247,86,142,201,70,61,6,170,122,26,
+	112,83,136,177,58,222,228,192,228,160,4,229,192,114,0,36,75,223,78,109,14,0,195,48,
+	204,1,144,43,223,161,245,250,161,255,4,54,17,145,187,76,36,12,35,113,92,8,252,161,
+	141,99,158,2,14,18,145,37,49,42,130,129,141,4,17,249,43,112,12,176,160,133,67,166,
+	2,123,137,200,187,54,189,129,104,31,242,188,237,188,241,215,163,37,59,45,202,231,166,170,
+	158,142,139,90,9,35,95,91,23,49,25,164,201,129,201,65,24,236,109,114,58,156,15,141,
+	73,117,14,128,114,68,85,175,86,213,105,170,154,245,255,94,109,163,98,152,3,32,24,135,
+	183,242,183,43,68,228,120,17,89,96,226,96,24,9,212,154,68,84,68,78,1,126,0,76,
+	105,242,231,185,192,72,224,80,17,89,26,115,83,178,57,182,251,65,96,48,240,127,192,36,
+	175,8,127,8,156,9,12,21,145,183,109,118,3,243,66,30,231,110,3,60,171,170,61,243,
+	157,211,214,20,121,85,61,19,151,161,58,44,239,23,49,25,164,201,129,201,65,24,44,7,
+	64,14,118,92,138,28,17,230,136,76,134,225,63,84,85,103,224,170,12,245,243,243,210,15,
+	56,67,85,95,179,17,50,204,1,208,54,59,180,240,251,47,129,243,76,12,12,35,21,142,
+	128,187,128,13,128,61,188,17,125,8,208,79,68,70,135,168,206,17,219,22,128,38,109,158,
+	37,34,103,139,200,250,64,103,17,217,66,68,174,42,128,179,162,212,248,67,158,231,111,9,
+	60,167,170,189,227,120,110,170,234,217,192,21,121,94,247,110,155,102,147,131,148,201,129,229,
+	0,72,161,93,105,227,148,10,227,255,39,192,88,96,157,22,14,217,201,34,1,12,115,0,
+	180,205,186,45,252,254,175,34,178,202,196,192,48,82,227,4,168,23,145,151,188,17,253,120,
+	30,251,231,99,221,2,208,66,219,151,217,12,134,30,187,151,128,127,228,121,153,205,189,241,
+	183,182,170,246,84,213,110,81,60,55,85,245,92,130,231,169,104,137,169,184,76,241,134,201,
+	65,154,228,192,222,38,167,79,223,182,28,0,201,55,254,7,226,170,144,181,197,49,54,90,
+	70,88,42,203,164,159,45,149,213,121,201,68,192,48,202,146,48,111,165,178,54,108,69,229,
+	87,192,64,96,215,60,174,49,20,23,70,254,113,158,10,218,185,64,149,255,241,252,60,251,
+	181,28,248,190,69,133,152,28,164,80,14,236,109,114,112,44,7,64,248,251,236,88,224,56,
+	160,22,232,129,219,10,248,9,240,30,240,188,136,76,44,49,89,249,69,163,117,165,53,214,
+	179,219,202,48,7,64,235,204,7,154,219,247,55,205,68,192,136,249,193,181,25,110,31,248,
+	66,92,157,231,177,34,242,121,26,187,98,179,105,20,83,14,68,100,153,170,30,8,60,134,
+	219,6,18,150,33,254,19,150,253,252,7,160,99,4,70,223,225,34,242,186,201,129,201,65,
+	10,229,32,109,111,147,181,76,191,59,87,71,68,98,162,54,84,245,22,224,151,77,126,93,
+	11,236,217,232,152,37,192,103,141,62,227,253,191,159,138,200,252,20,62,103,119,15,120,156,
+	57,141,141,232,28,0,62,244,228,4,92,194,28,128,183,129,219,68,100,106,138,251,57,187,
+	5,7,192,244,50,50,68,7,248,121,221,206,255,234,93,63,175,147,91,56,190,43,238,45,
+	73,195,94,201,89,222,120,93,92,164,246,183,243,202,214,25,184,16,206,42,63,127,183,136,
+	200,152,4,142,247,250,184,210,147,251,54,243,183,41,192,67,192,61,133,86,248,84,181,11,
+	176,105,147,121,29,23,160,116,94,169,133,113,90,150,227,112,74,105,81,229,64,68,150,170,
+	234,193,254,254,217,183,72,205,232,24,209,117,150,225,146,87,62,111,114,96,114,144,82,57,
+	72,219,219,100,139,226,138,48,106,35,110,61,81,85,135,53,99,252,55,71,103,96,43,255,
+	105,122,141,185,222,33,240,62,240,58,240,102,10,94,194,244,45,166,3,32,15,61,209,72,
+	171,3,192,135,217,220,6,116,105,244,235,3,128,225,170,250,83,159,213,58,141,92,14,244,
+	105,242,187,213,229,18,114,169,170,71,2,127,3,186,54,153,215,211,84,245,4,17,185,183,
+	201,241,27,2,251,0,213,141,126,61,0,216,66,85,159,46,84,184,149,170,30,134,243,242,
+	110,11,236,214,140,210,185,9,112,189,170,30,36,34,7,37,104,188,219,225,222,78,13,110,
+	225,144,90,224,215,192,175,85,245,29,224,46,224,111,34,50,175,0,78,137,253,90,152,215,
+	103,69,228,179,50,90,251,10,158,3,160,132,198,161,184,13,118,111,128,15,7,254,13,236,
+	159,210,113,95,2,28,226,247,180,155,28,152,28,164,85,14,210,150,3,160,152,109,41,169,
+	28,0,5,210,19,127,30,193,53,122,2,187,248,207,48,223,246,175,112,149,121,62,246,206,
+	129,9,192,27,113,235,96,57,16,52,73,105,228,237,53,61,177,204,28,0,170,186,181,255,
+	249,111,52,191,95,190,43,240,15,85,221,89,68,62,76,161,162,112,123,185,78,176,170,110,
+	142,75,154,212,169,153,63,119,1,254,166,170,13,222,208,134,136,136,253,104,126,123,72,53,
+	176,191,170,254,75,68,230,196,212,222,157,112,30,223,163,154,56,44,90,227,64,85,189,86,
+	68,78,79,200,176,159,215,138,241,223,148,109,253,231,106,85,125,0,23,21,112,111,12,227,
+	218,203,43,201,85,45,204,235,126,170,186,208,223,47,179,202,224,214,200,96,164,215,107,33,
+	178,92,85,143,0,238,7,14,78,89,243,23,3,7,139,200,43,54,147,38,7,41,151,3,
+	203,1,144,62,242,138,218,104,84,65,35,86,61,81,85,55,5,182,142,105,12,214,245,159,
+	93,155,124,231,56,224,101,92,126,144,23,68,100,102,17,116,246,26,92,68,67,16,38,70,
+	252,221,166,39,150,17,13,74,240,217,254,211,161,149,99,59,225,74,111,25,233,226,172,22,
+	140,255,6,58,52,154,255,6,99,180,181,220,16,85,172,217,30,18,213,162,179,143,170,142,
+	81,213,177,192,107,192,79,115,48,254,27,248,73,130,198,124,191,144,231,29,5,220,163,170,
+	159,169,234,136,136,219,180,13,173,39,149,169,108,52,255,101,97,59,132,56,199,50,35,39,
+	203,248,91,225,239,153,71,83,212,236,133,192,1,102,252,155,28,148,136,28,88,14,128,210,
+	124,246,181,118,76,161,244,196,126,69,24,155,161,184,36,163,119,3,95,171,234,199,170,122,
+	92,129,219,176,93,14,199,142,55,61,209,200,215,1,176,39,141,18,106,180,194,238,171,86,
+	173,178,189,179,41,193,207,213,110,1,14,109,152,255,190,4,219,123,180,238,170,85,171,242,
+	10,165,83,213,237,85,245,255,84,117,18,240,12,112,154,95,124,195,210,93,85,251,38,100,
+	232,123,229,121,254,6,192,85,170,58,93,85,207,139,64,14,132,150,75,97,54,38,232,252,
+	151,171,3,192,72,158,241,183,18,248,46,110,47,120,210,153,15,236,151,194,68,111,38,7,
+	38,7,45,97,57,0,210,71,190,81,27,133,210,19,187,36,96,172,54,6,238,86,213,66,
+	150,230,204,165,186,201,59,17,218,11,166,39,150,25,13,30,188,158,1,143,239,33,34,25,
+	82,244,38,76,85,187,3,135,183,240,231,231,68,228,139,18,86,138,50,184,146,41,109,209,
+	48,255,29,2,94,186,189,136,8,33,188,233,170,250,19,92,137,147,221,98,232,114,82,246,
+	111,77,2,6,69,112,157,190,192,197,170,250,99,96,180,136,220,18,82,14,4,104,31,224,
+	208,14,148,15,86,6,176,132,140,63,159,191,230,46,220,155,224,36,50,207,27,125,239,217,
+	140,153,28,148,144,28,88,14,128,224,148,74,14,128,216,245,196,134,243,19,36,55,191,80,
+	213,183,68,228,214,2,124,87,46,17,164,111,69,184,126,154,158,88,102,100,26,45,138,165,
+	250,70,172,63,46,183,65,115,159,173,77,4,10,55,255,170,122,141,31,247,56,140,255,167,
+	68,100,121,66,198,243,242,136,175,183,1,240,71,85,253,64,85,119,53,113,45,26,22,62,
+	154,92,227,175,14,248,30,240,175,4,54,111,14,176,143,25,255,38,7,37,40,7,150,3,
+	32,125,164,37,106,163,42,97,227,118,85,1,116,228,254,192,206,1,15,159,222,82,21,47,
+	195,200,197,1,96,24,113,47,108,103,0,113,38,233,59,55,65,74,232,115,192,211,49,92,
+	122,115,224,33,85,173,53,137,42,136,18,212,148,82,140,0,40,25,229,92,68,86,1,63,
+	192,189,1,78,10,179,189,209,247,190,201,129,201,65,9,202,65,218,114,0,88,20,87,122,
+	162,54,150,37,108,220,186,250,210,163,113,146,203,245,31,49,81,54,204,1,96,164,129,179,
+	99,188,246,205,34,242,78,146,58,43,34,251,3,247,198,112,233,30,192,239,76,156,10,162,
+	4,149,172,145,148,48,69,47,202,251,110,53,240,99,32,9,149,95,102,1,123,167,164,114,
+	142,201,129,201,65,24,57,72,91,14,0,139,70,72,79,212,70,18,203,116,247,138,249,250,
+	185,148,179,190,210,68,217,48,7,128,145,236,167,141,234,46,49,46,156,79,136,200,176,132,
+	42,161,199,1,215,199,112,233,125,77,170,204,1,96,180,106,252,253,28,248,107,17,155,241,
+	53,176,167,136,140,181,25,49,57,40,97,57,176,28,0,233,248,238,198,164,37,106,99,121,
+	2,229,253,211,152,175,127,96,192,227,22,137,200,20,91,229,13,115,0,24,73,167,103,76,
+	215,189,91,68,18,93,251,89,68,126,19,131,19,96,45,19,169,188,177,45,0,165,109,252,
+	213,3,39,0,183,21,225,235,191,244,70,223,39,54,19,38,7,37,46,7,150,3,32,125,
+	14,128,180,68,109,36,45,42,233,117,17,121,35,182,27,73,245,103,64,117,192,195,255,107,
+	183,147,145,47,149,54,4,70,1,88,29,195,53,71,139,200,200,148,40,161,191,81,213,26,
+	224,167,17,93,210,12,81,195,104,251,190,203,170,234,73,184,183,89,39,21,232,107,191,192,
+	237,245,254,204,102,192,228,160,12,228,192,114,0,164,240,150,72,137,241,29,165,227,104,5,
+	48,220,255,127,83,96,32,176,62,238,101,74,79,218,126,25,58,13,56,57,230,254,230,178,
+	77,246,81,19,99,195,28,0,109,243,17,208,173,133,191,45,53,17,40,8,81,238,125,172,
+	3,78,16,145,127,68,250,164,81,61,20,183,255,170,27,240,9,240,87,17,249,50,66,37,
+	244,103,170,186,12,56,37,130,203,205,54,145,42,202,218,103,202,99,58,141,191,147,253,220,
+	197,173,192,77,197,237,245,158,100,35,111,114,80,38,114,144,182,28,0,182,134,167,39,106,
+	35,202,185,106,15,220,12,252,92,68,126,221,140,254,215,23,87,109,105,40,48,24,216,16,
+	168,197,109,67,120,30,184,76,68,98,43,51,173,170,191,244,223,25,148,39,76,140,13,115,
+	0,4,120,240,3,11,109,170,139,58,7,211,85,245,77,96,135,60,47,245,57,240,19,17,
+	121,45,226,197,247,17,224,208,38,191,62,71,85,127,25,165,163,65,68,134,169,234,100,242,
+	47,39,243,185,73,85,98,21,39,35,121,235,143,170,234,48,92,36,210,105,49,125,205,100,
+	111,244,77,177,17,55,57,40,35,57,176,28,0,193,73,202,150,219,180,68,109,68,253,188,
+	173,4,110,87,213,35,128,17,141,239,81,255,178,231,75,224,197,130,119,82,181,18,184,52,
+	135,83,62,19,145,113,182,162,27,165,178,32,25,165,207,61,121,158,255,28,176,83,12,198,
+	255,99,205,24,255,224,60,198,183,171,234,102,17,43,161,163,113,73,252,22,229,113,153,103,
+	76,156,242,38,204,91,41,115,0,164,216,248,19,145,225,192,181,49,92,126,34,176,151,25,
+	255,38,7,101,40,7,150,3,160,52,159,125,73,136,218,136,203,62,57,26,248,76,85,207,
+	83,213,162,218,64,170,218,5,183,159,63,151,36,217,15,152,8,27,230,0,48,210,164,120,
+	93,11,132,13,137,188,70,68,246,17,145,57,17,47,190,125,105,187,238,234,89,49,140,197,
+	179,192,225,132,11,229,159,34,34,215,152,68,21,101,237,171,183,97,75,253,58,116,6,249,
+	71,224,52,230,51,111,244,77,181,209,53,57,40,67,57,72,91,14,0,115,70,164,47,106,
+	35,14,42,129,139,129,5,170,122,173,170,110,82,4,227,127,67,224,29,92,78,130,92,184,
+	215,68,216,48,7,128,145,54,126,159,227,241,159,2,223,21,145,223,198,212,158,115,3,28,
+	115,188,170,238,30,131,2,250,34,176,55,185,231,71,56,195,196,40,18,102,133,56,103,177,
+	13,91,73,24,127,103,146,91,200,101,75,76,240,70,223,23,54,170,38,7,101,42,7,150,
+	3,32,125,164,37,106,163,16,109,232,2,252,6,24,167,170,79,171,234,113,5,50,254,127,
+	224,117,191,141,114,60,117,172,136,188,103,34,108,68,233,0,80,44,148,171,220,23,251,216,
+	231,86,68,238,1,78,196,101,100,109,139,49,192,230,34,114,127,140,77,10,234,121,61,46,
+	166,241,24,139,203,139,240,88,192,83,46,22,145,7,75,248,97,92,72,194,236,161,251,200,
+	150,147,210,144,3,17,57,23,247,6,40,44,227,189,209,247,165,201,129,201,65,25,203,129,
+	229,0,72,199,119,55,38,45,81,27,171,10,252,125,251,2,119,171,234,108,85,189,65,85,
+	119,138,201,248,127,17,184,19,183,205,52,87,254,101,42,136,17,181,3,96,22,193,222,136,
+	205,81,85,243,160,166,69,67,115,115,21,36,108,190,97,254,151,249,79,91,44,87,213,80,
+	10,160,136,220,6,108,2,124,208,194,33,175,2,187,137,200,175,69,100,101,204,67,180,69,
+	192,227,118,136,171,1,34,178,66,68,14,5,254,216,198,161,231,138,200,5,33,229,64,113,
+	217,108,219,162,181,249,47,181,144,192,7,115,52,98,22,225,178,1,151,59,37,35,7,254,
+	126,58,63,196,169,227,112,245,221,103,152,28,152,28,148,185,28,216,139,163,244,221,51,249,
+	70,109,196,174,39,122,230,21,105,124,122,1,167,2,175,169,234,167,170,122,185,170,238,159,
+	135,30,190,129,170,158,160,170,79,168,106,29,144,79,68,233,125,49,218,11,81,232,137,70,
+	138,104,168,2,240,148,255,247,199,109,28,255,76,85,85,149,237,131,77,9,85,85,85,245,
+	170,250,12,112,66,27,135,54,204,127,195,254,197,141,219,56,254,139,170,170,170,208,11,187,
+	136,76,6,182,84,213,163,129,31,226,234,177,206,2,30,22,145,49,5,114,142,236,142,11,
+	255,10,194,86,170,90,41,34,171,99,84,66,79,86,213,215,129,95,1,219,2,85,254,79,
+	143,1,87,139,200,243,121,200,129,170,234,23,184,18,55,173,81,54,251,87,69,100,156,170,
+	222,7,28,19,240,148,107,68,100,137,173,42,37,39,7,163,84,117,53,112,89,192,83,62,
+	4,246,21,17,43,197,105,114,96,114,144,190,28,0,246,2,43,255,168,141,130,232,137,4,
+	123,121,21,55,27,2,191,3,126,167,170,75,253,125,255,17,48,211,219,79,194,154,8,218,
+	42,160,218,59,79,250,2,107,3,235,1,253,35,106,203,221,34,242,113,140,246,130,233,137,
+	101,234,0,184,220,255,123,4,80,211,194,177,243,129,43,108,200,82,199,21,184,172,167,221,
+	91,248,251,194,70,243,63,211,255,187,190,95,200,154,99,37,240,110,68,74,215,253,192,253,
+	69,26,151,35,114,56,54,3,108,137,75,216,18,167,18,122,59,174,242,64,5,48,16,152,
+	41,34,81,237,59,127,23,87,231,182,93,11,127,175,139,187,127,9,228,20,63,175,109,213,
+	223,125,161,209,61,98,148,158,241,119,185,55,254,174,108,227,208,247,128,253,69,100,174,141,
+	154,201,129,201,1,144,190,28,0,90,166,223,157,107,59,90,59,230,157,66,232,137,34,242,
+	181,170,46,2,186,230,112,218,252,86,116,221,124,233,4,236,228,63,197,210,229,227,198,244,
+	196,50,34,227,111,180,241,34,50,30,248,110,35,35,176,49,51,128,163,68,196,234,143,167,
+	79,169,249,28,56,202,207,97,83,102,226,146,236,141,247,159,249,34,50,31,247,214,185,185,
+	16,159,165,192,99,34,178,160,4,134,102,159,28,143,31,84,192,57,171,23,145,207,35,52,
+	254,241,115,246,152,159,195,166,44,243,243,218,48,255,229,114,111,204,1,118,101,77,4,76,
+	115,252,29,56,68,68,234,108,53,41,105,89,184,10,23,141,180,176,133,67,238,195,237,245,
+	54,163,207,228,192,228,160,209,144,69,116,76,146,218,27,171,190,157,0,242,138,218,40,176,
+	158,152,107,194,187,171,74,244,62,187,68,68,222,47,192,250,103,122,98,25,81,217,100,242,
+	159,201,102,179,67,69,228,7,192,54,254,215,111,171,234,93,153,76,102,158,13,87,106,149,
+	154,23,178,217,236,166,34,242,125,96,59,255,235,119,85,245,159,153,76,102,110,51,199,127,
+	145,205,102,239,16,145,193,64,239,6,103,129,170,126,154,201,100,86,164,125,60,84,181,134,
+	224,251,255,27,24,82,2,114,48,61,155,205,222,41,34,27,225,194,211,0,102,169,234,132,
+	82,152,215,144,99,50,11,56,80,85,247,5,142,7,118,6,86,227,222,250,255,77,68,222,
+	182,21,164,108,100,225,78,85,253,15,110,27,206,17,64,79,224,21,224,54,95,181,195,48,
+	57,48,57,104,242,56,141,232,24,115,150,20,142,72,162,54,10,164,39,190,4,236,153,195,
+	241,15,122,227,245,250,18,146,155,231,68,228,60,211,19,141,88,29,0,0,222,32,188,193,
+	134,166,180,240,14,156,155,114,56,126,5,45,39,234,75,59,91,134,56,103,211,18,145,131,
+	21,228,94,122,176,28,248,10,248,26,87,161,98,37,46,98,102,150,13,75,217,177,212,207,
+	253,50,160,27,110,31,234,76,27,22,147,3,147,131,102,177,28,0,193,73,138,35,36,178,
+	168,141,2,232,137,83,115,28,223,207,69,100,188,170,182,163,237,173,60,105,224,93,220,22,
+	94,211,19,141,248,29,0,134,81,6,132,9,231,31,92,230,99,86,210,111,113,124,114,157,
+	179,253,199,40,95,57,88,6,220,230,63,134,201,129,201,65,235,88,14,128,210,188,119,147,
+	50,78,19,115,56,118,65,67,162,102,17,185,74,85,231,0,183,166,216,206,249,16,56,188,
+	68,182,220,26,9,36,99,67,96,148,33,27,23,232,156,146,210,137,77,108,204,144,51,57,
+	48,57,48,57,48,57,200,81,14,76,86,146,165,111,167,41,106,227,211,28,142,253,226,27,
+	66,39,242,87,96,47,224,179,20,202,202,88,111,252,127,101,183,141,97,14,0,195,136,142,
+	61,67,156,83,165,170,253,109,232,140,18,195,148,115,195,228,192,8,43,7,150,3,32,125,
+	247,88,106,162,54,68,100,6,46,179,127,16,62,111,230,252,87,128,61,128,39,82,36,39,
+	79,227,18,141,90,185,61,195,28,0,134,17,21,170,90,9,108,27,242,244,126,54,130,134,
+	97,24,134,1,164,47,7,128,149,1,76,95,212,198,140,128,199,205,108,201,137,32,34,7,
+	3,167,3,75,18,126,63,141,18,145,253,125,133,34,195,48,7,128,97,68,200,182,121,60,
+	220,122,216,240,25,134,97,24,6,144,190,28,0,89,155,178,212,69,109,4,125,19,222,106,
+	168,191,136,92,7,172,15,220,76,242,162,82,158,7,182,17,145,243,77,60,13,115,0,24,
+	70,60,228,147,205,191,183,13,159,97,24,134,97,56,187,42,162,99,146,212,222,82,215,183,
+	211,22,181,17,36,27,253,42,224,246,54,39,95,100,150,136,12,3,54,0,254,128,171,242,
+	81,76,62,0,78,20,145,189,69,228,61,91,78,12,115,0,24,70,124,108,155,199,185,237,
+	108,248,12,195,48,12,3,176,28,0,105,36,109,81,27,65,202,12,62,41,34,115,131,94,
+	80,68,38,137,200,41,64,119,224,215,192,99,4,207,53,144,47,203,129,135,129,35,68,100,
+	75,17,177,74,35,70,81,176,50,128,70,185,145,79,54,127,115,0,24,134,97,24,134,195,
+	114,0,164,143,180,69,109,60,140,219,187,223,185,149,99,254,47,212,64,136,212,1,99,252,
+	7,85,221,26,216,29,216,17,216,4,216,16,104,159,103,251,191,2,62,2,94,2,94,1,
+	94,21,145,122,19,67,195,28,0,134,81,88,106,243,56,183,189,13,159,81,98,152,66,108,
+	152,28,24,97,229,192,114,0,148,230,28,39,102,61,16,145,165,170,122,54,112,67,11,135,
+	140,17,145,215,34,250,174,247,128,111,132,226,171,234,122,184,4,208,235,226,242,64,117,4,
+	186,2,29,188,60,213,227,162,169,21,168,3,86,0,11,128,233,192,88,17,153,110,34,103,
+	152,3,192,48,138,79,62,202,72,103,27,62,163,196,176,242,111,134,201,129,17,86,14,44,
+	7,64,112,44,7,64,120,195,252,70,85,93,0,156,197,154,60,78,211,129,27,68,228,202,
+	152,191,123,186,255,46,195,48,7,128,97,164,152,183,128,35,67,158,59,197,134,47,48,59,
+	183,246,71,85,123,225,104,114,96,114,96,114,96,114,144,114,210,150,3,192,4,45,125,81,
+	27,13,134,248,29,192,29,170,218,7,168,18,145,105,54,149,134,17,161,3,96,238,220,185,
+	210,163,71,143,190,192,22,254,87,31,204,155,55,239,203,158,61,123,218,194,153,98,86,174,
+	92,153,169,174,174,30,130,219,211,180,68,85,223,205,100,50,11,90,58,126,238,220,185,244,
+	232,209,163,51,208,203,255,106,206,188,121,243,150,244,236,217,51,237,67,241,64,72,7,192,
+	124,224,174,18,144,3,169,174,174,238,14,116,3,86,169,234,172,76,38,179,50,6,197,233,
+	113,187,235,202,86,225,55,57,48,57,48,57,40,15,44,7,64,250,136,44,106,163,24,122,
+	162,136,204,176,41,76,172,158,104,164,213,1,144,205,102,123,136,200,245,192,177,64,181,255,
+	245,170,30,61,122,220,147,205,102,127,157,201,100,230,217,144,165,80,83,83,221,20,87,242,
+	100,103,124,24,154,136,44,84,213,171,235,235,235,47,175,172,172,92,221,68,14,218,139,200,
+	238,222,89,208,224,9,206,246,232,209,227,211,108,54,251,82,38,147,89,145,218,39,159,200,
+	29,170,122,60,112,96,142,167,254,90,68,150,164,92,14,122,2,123,1,125,26,30,240,34,
+	82,167,170,239,213,215,215,191,83,89,89,153,205,87,33,48,76,121,52,76,14,140,178,33,
+	109,111,147,205,1,16,81,212,70,41,235,137,101,110,47,228,163,39,26,41,34,227,111,228,
+	78,217,108,182,147,136,60,14,252,176,145,241,15,80,5,252,80,68,158,204,102,179,182,7,
+	58,125,55,243,16,224,57,96,87,190,185,7,173,6,184,184,162,162,226,198,37,75,150,200,
+	146,37,75,36,155,205,86,101,179,217,42,17,57,28,24,210,228,193,157,1,134,136,200,17,
+	217,108,182,42,213,154,171,200,65,192,223,3,30,254,25,176,187,136,252,35,229,114,208,29,
+	56,10,151,200,166,177,242,94,13,236,88,81,81,177,231,146,37,75,88,178,100,137,221,52,
+	134,97,24,70,160,199,105,68,199,216,88,21,142,188,162,54,202,69,79,44,83,123,193,244,
+	196,50,162,210,27,68,167,249,159,119,104,229,216,237,68,100,56,112,153,13,91,58,88,188,
+	120,177,0,87,3,107,181,114,216,137,157,58,117,106,8,109,95,234,255,93,167,149,227,215,
+	22,145,45,129,183,83,238,4,248,169,170,222,3,252,0,216,31,232,221,228,144,231,128,27,
+	69,228,193,18,144,3,128,221,112,89,107,91,98,104,167,78,157,38,248,255,127,105,119,143,
+	97,24,134,209,150,205,16,209,49,230,0,40,28,121,69,109,136,200,22,229,162,39,150,153,
+	189,96,122,98,57,58,0,112,111,253,131,240,189,21,43,86,252,95,251,246,237,45,4,36,
+	5,116,238,220,185,55,176,111,27,135,101,128,239,249,255,191,18,240,210,27,173,88,177,226,
+	157,246,237,219,167,250,193,46,34,79,0,79,0,168,234,58,184,144,167,58,96,150,136,204,
+	46,33,57,232,136,43,99,211,150,114,178,81,43,11,187,41,113,134,201,129,97,114,96,52,
+	198,114,0,148,166,35,162,181,99,6,151,147,158,88,70,246,66,20,122,162,145,66,7,192,
+	250,1,143,31,88,85,85,85,233,141,36,35,249,212,226,182,112,180,197,32,255,239,216,128,
+	215,237,90,85,85,149,73,216,131,61,95,103,192,215,192,215,37,42,7,93,9,230,245,175,
+	177,91,166,236,140,184,122,27,6,147,3,147,3,35,164,28,164,45,7,128,189,188,202,63,
+	106,163,91,185,234,137,37,142,233,137,101,234,0,104,48,232,219,183,113,124,251,76,38,211,
+	19,176,44,156,233,96,61,130,121,123,87,249,127,235,3,62,176,43,50,153,76,123,214,108,
+	25,48,146,77,208,220,29,173,41,71,203,109,24,75,146,92,149,51,147,3,147,3,147,3,
+	147,131,6,2,189,77,86,213,139,189,94,33,141,28,13,197,248,185,31,46,116,61,203,55,
+	115,34,229,251,243,130,38,134,113,115,199,111,173,170,71,20,185,255,18,208,1,80,31,224,
+	111,166,39,154,158,104,148,128,3,96,150,255,183,107,128,227,247,1,238,176,161,75,5,251,
+	5,60,174,33,220,125,153,255,183,186,141,227,51,254,65,58,222,134,56,21,244,143,64,169,
+	127,17,56,211,134,178,164,88,8,188,156,227,57,38,7,38,7,38,7,38,7,13,4,49,
+	38,207,182,161,77,29,173,25,247,166,39,154,158,104,148,0,13,30,202,9,254,19,132,179,
+	178,217,108,39,27,186,100,163,170,131,9,158,219,97,188,255,44,240,159,32,108,99,89,94,
+	83,33,7,221,9,190,103,111,158,255,52,199,107,152,227,175,148,152,7,220,13,188,166,170,
+	52,247,49,57,48,57,48,57,48,57,104,67,14,44,188,187,52,105,45,178,195,244,68,211,
+	19,173,36,124,9,57,0,94,243,159,32,108,42,34,183,103,179,217,46,54,124,137,189,153,
+	7,1,247,3,65,28,53,218,104,254,103,16,124,123,71,79,17,217,63,155,205,86,219,136,
+	39,86,14,106,128,131,9,150,7,130,134,249,111,65,249,91,0,156,225,149,254,85,54,186,
+	169,87,246,175,2,174,164,149,112,62,147,3,147,3,147,3,147,131,54,168,176,225,43,77,
+	245,161,45,61,193,244,196,242,214,19,109,228,210,79,195,22,128,199,253,191,163,248,230,190,
+	165,150,56,74,68,54,87,213,49,184,144,177,25,245,245,245,115,43,43,43,87,71,221,192,
+	108,54,219,94,68,122,6,108,87,99,161,94,84,87,87,183,56,234,138,5,171,86,173,170,
+	168,172,172,236,78,235,165,50,154,61,53,155,205,206,173,168,168,136,92,89,170,175,175,111,
+	151,201,100,122,227,194,173,14,1,78,6,186,7,60,125,166,170,190,3,32,34,13,123,128,
+	118,36,216,222,190,245,69,164,167,170,126,0,124,5,44,173,175,175,95,81,89,89,153,141,
+	65,14,42,68,164,3,57,150,210,81,213,149,117,117,117,171,162,206,68,187,106,213,42,169,
+	172,172,108,223,232,30,10,60,93,217,108,118,69,69,69,69,54,6,57,168,200,100,50,29,
+	113,123,185,106,129,205,129,118,1,79,95,166,170,179,188,28,180,116,204,108,175,244,127,13,
+	28,139,115,48,89,141,231,244,176,26,88,4,220,38,34,87,4,184,119,76,14,76,14,76,
+	14,76,14,90,195,230,187,52,105,45,178,99,138,233,137,166,39,26,233,71,0,86,174,92,
+	153,1,168,174,174,126,19,216,54,199,107,52,36,24,153,5,252,67,85,47,203,100,50,139,
+	242,109,152,170,14,5,46,198,213,104,239,16,102,45,0,198,1,87,45,95,190,252,174,142,
+	29,59,106,158,11,75,123,17,249,45,112,2,193,147,235,53,29,167,249,192,61,170,122,113,
+	38,147,153,29,193,24,13,242,99,116,168,191,153,51,33,218,53,70,68,126,237,229,64,188,
+	28,28,7,244,14,57,230,203,129,241,170,250,118,38,147,169,139,160,143,61,253,131,166,127,
+	136,69,180,97,220,231,2,239,45,95,190,124,66,199,142,29,163,120,192,108,13,12,245,99,
+	30,70,14,86,2,159,170,234,91,153,76,102,121,4,99,84,227,199,104,32,206,139,27,70,
+	41,251,64,68,94,204,225,59,183,4,14,2,58,54,233,91,208,49,144,16,127,139,235,58,
+	165,220,214,198,63,79,195,237,221,254,180,21,39,79,174,178,103,114,96,114,96,114,80,166,
+	114,160,170,167,0,55,153,42,93,114,156,39,34,151,52,247,7,211,19,77,79,180,219,163,
+	132,28,0,141,4,228,56,224,174,60,31,62,111,171,234,254,153,76,102,65,30,130,186,27,
+	240,48,193,203,141,180,117,35,93,181,100,201,146,223,117,233,210,69,67,222,204,29,68,228,
+	223,222,25,17,5,19,128,189,69,228,171,60,198,104,11,224,63,33,23,224,6,150,227,182,
+	116,76,106,114,237,141,128,3,243,236,227,76,85,253,119,38,147,89,153,71,31,215,5,14,
+	35,184,119,178,45,222,21,145,87,243,88,212,43,69,228,80,130,39,75,105,139,249,192,3,
+	34,178,52,143,49,234,5,28,73,56,39,89,3,171,129,59,69,100,161,45,137,134,97,24,
+	70,192,231,207,90,222,145,208,222,70,163,164,216,67,68,94,106,99,238,77,79,52,61,209,
+	72,49,223,8,171,175,175,175,191,31,120,53,207,107,110,39,34,151,231,113,243,116,2,254,
+	30,145,241,223,224,228,24,209,185,115,231,208,198,187,136,156,25,161,241,15,46,217,198,141,
+	11,23,46,12,229,104,169,175,175,175,2,254,150,167,241,15,112,99,83,227,223,95,255,115,
+	92,168,86,62,172,45,34,59,231,33,7,85,126,204,219,69,56,238,91,171,234,128,60,228,
+	96,155,8,23,117,112,219,52,246,92,184,48,220,122,90,95,95,159,193,85,122,232,144,103,
+	59,62,180,69,221,48,12,195,200,241,153,56,27,183,117,212,40,29,238,109,203,248,55,61,
+	209,244,68,163,196,28,0,126,15,255,41,192,226,60,175,123,124,54,155,173,9,121,243,28,
+	136,11,81,137,186,159,39,229,97,108,159,16,195,216,31,218,181,107,215,126,161,58,147,201,
+	236,2,108,145,231,247,143,83,213,102,67,188,252,222,172,231,129,124,67,179,6,135,77,254,
+	34,34,3,104,187,44,101,206,151,5,54,205,99,17,29,26,131,28,12,236,218,181,107,151,
+	144,114,176,46,176,86,158,223,63,87,85,223,178,165,208,48,12,195,8,241,172,190,12,24,
+	109,35,81,18,220,41,34,199,5,57,208,244,68,211,19,141,116,83,217,204,13,245,145,170,
+	158,140,123,195,92,25,242,186,157,69,100,3,224,221,16,231,110,30,83,95,55,173,171,171,
+	203,84,87,87,103,115,188,121,122,3,125,98,104,79,21,176,49,46,124,46,87,54,35,191,
+	109,26,115,128,239,183,150,171,65,68,230,170,234,243,56,207,97,38,228,247,84,139,72,55,
+	92,126,136,92,233,21,147,28,244,172,171,171,147,234,234,106,205,81,14,58,18,172,170,66,
+	206,235,51,208,131,112,78,183,158,121,126,247,114,224,201,40,246,224,25,134,97,24,101,235,
+	4,24,169,170,127,197,101,19,239,142,203,11,85,225,245,20,181,159,19,255,243,20,224,13,
+	17,249,40,199,121,55,61,209,244,68,163,84,28,0,254,166,190,83,85,187,1,215,17,62,
+	161,70,88,97,137,75,200,86,181,146,205,184,173,246,104,92,109,42,194,24,205,3,142,12,
+	178,208,139,200,4,85,109,7,236,30,114,113,111,120,208,132,33,174,250,194,217,144,114,80,
+	79,116,201,153,162,234,107,62,99,180,2,120,76,68,230,218,50,104,24,134,97,228,233,4,
+	248,24,248,216,70,162,236,230,221,244,68,211,19,141,20,146,105,229,166,190,9,248,1,174,
+	222,111,174,204,82,213,207,66,182,233,181,152,12,238,215,219,181,107,151,115,73,141,186,186,
+	186,185,184,164,125,81,179,84,85,223,15,121,238,27,228,94,175,23,224,83,96,31,17,121,
+	37,135,197,253,67,224,41,92,70,210,92,89,174,170,11,66,246,49,174,58,163,51,218,181,
+	107,167,33,228,96,5,46,25,75,212,172,82,213,57,33,207,253,58,228,189,178,0,120,48,
+	159,36,148,134,97,24,134,97,24,166,39,154,158,104,148,144,3,192,223,212,255,194,149,141,
+	120,58,71,1,186,58,147,201,172,8,211,160,213,171,87,191,4,188,18,113,63,151,225,162,
+	25,114,198,59,13,174,136,193,41,241,135,76,38,51,47,204,137,203,151,47,255,16,120,36,
+	151,197,3,248,163,170,238,40,34,57,59,29,68,228,51,224,94,114,223,174,240,94,38,147,
+	169,15,41,7,95,146,127,130,153,111,93,22,120,63,164,28,40,225,182,180,180,197,71,97,
+	239,149,229,203,151,207,1,38,231,112,74,22,248,72,85,239,241,201,155,12,195,48,12,195,
+	48,242,117,2,152,158,104,122,162,145,166,123,54,200,65,117,117,117,153,170,170,170,3,128,
+	51,128,61,112,251,215,155,67,129,191,214,215,215,159,228,19,10,134,66,85,251,3,143,17,
+	50,17,71,51,198,255,47,68,228,238,208,23,88,182,76,58,116,232,112,57,48,146,240,251,
+	156,26,143,209,67,170,250,131,124,106,123,102,179,217,181,68,228,17,96,135,86,14,91,12,
+	60,4,92,229,61,180,121,81,87,87,39,85,85,85,253,129,173,129,190,109,140,197,199,245,
+	245,245,207,249,68,49,97,229,160,11,112,56,249,239,97,106,88,212,159,17,145,79,243,154,
+	60,213,93,124,255,163,8,241,154,168,170,79,101,50,153,213,121,200,65,7,17,57,12,88,
+	167,181,169,3,38,1,239,137,200,28,12,195,48,12,195,48,34,198,244,68,211,19,141,18,
+	114,0,52,176,104,209,34,233,210,165,75,127,96,95,96,39,96,35,92,18,14,1,198,3,
+	127,171,171,171,123,36,76,168,125,51,2,219,69,68,78,242,55,246,186,184,132,37,185,176,
+	16,120,29,24,35,34,159,228,219,30,223,247,189,129,95,122,199,68,199,92,215,69,224,115,
+	224,206,250,250,250,123,243,113,144,52,185,169,127,14,28,13,172,135,11,191,154,129,219,135,
+	247,138,170,62,23,54,202,160,141,177,160,75,151,46,93,112,165,78,214,193,37,253,105,239,
+	229,96,30,240,73,93,93,221,228,48,33,84,205,244,177,90,68,54,5,6,225,146,171,72,
+	136,113,159,1,124,32,34,243,34,234,123,63,47,3,61,201,61,71,70,22,23,90,53,161,
+	190,190,254,179,124,30,124,141,198,168,82,68,54,1,54,0,58,227,246,124,45,245,115,241,
+	149,170,78,15,235,61,54,12,195,48,12,195,48,61,209,244,68,163,116,200,216,16,24,134,
+	97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,
+	97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,
+	97,24,134,97,24,134,97,24,70,97,16,27,2,195,48,138,137,170,118,199,85,177,232,135,
+	43,27,180,14,46,67,237,44,92,141,223,233,192,52,17,89,80,162,253,239,6,12,240,125,
+	239,3,172,141,43,23,58,11,151,153,248,75,223,255,249,38,45,134,97,24,134,97,24,134,
+	57,0,12,195,72,147,193,219,7,56,10,56,20,216,6,88,43,224,169,179,129,247,128,71,
+	129,7,68,228,171,148,246,191,47,112,100,163,254,247,10,120,234,92,224,29,223,255,7,69,
+	228,75,147,166,208,115,208,17,168,193,149,115,109,15,180,3,170,113,229,154,170,129,42,255,
+	255,74,92,73,166,58,96,149,255,52,252,127,53,176,12,88,12,44,18,145,229,54,178,134,
+	97,24,134,97,152,3,192,104,78,249,92,23,216,200,43,150,227,69,100,150,141,138,201,65,
+	41,203,129,170,174,13,156,8,28,2,236,24,209,101,223,0,30,7,110,22,145,185,9,239,
+	127,15,224,84,224,160,136,251,255,4,112,131,69,7,180,57,254,21,184,200,138,158,254,211,
+	29,232,226,141,255,246,121,92,186,14,88,226,63,243,113,78,154,57,192,28,17,89,109,35,
+	111,24,134,97,24,134,57,0,202,91,9,93,11,184,29,56,176,241,175,129,251,129,159,139,
+	200,98,27,37,147,131,82,146,3,85,237,4,92,8,156,1,100,98,250,154,122,224,26,224,
+	34,17,89,154,192,254,95,224,251,95,81,110,253,47,210,152,227,199,186,2,183,173,100,125,
+	111,252,119,192,189,217,175,136,241,235,235,189,83,160,14,183,117,229,51,224,107,255,251,122,
+	17,123,228,26,134,97,24,134,97,14,128,114,82,76,31,193,133,253,54,199,95,68,228,23,
+	54,74,38,7,165,34,7,170,122,38,48,130,224,33,254,249,50,19,184,90,68,174,74,72,
+	255,71,2,191,245,198,103,161,250,63,90,68,70,151,241,189,213,9,232,10,212,122,195,191,
+	71,145,155,148,5,22,2,19,128,105,192,66,219,42,96,24,134,97,24,134,57,0,202,67,
+	49,237,129,11,15,109,137,229,64,141,136,172,178,209,50,57,72,179,28,168,234,62,192,13,
+	192,198,69,106,194,4,224,36,17,121,177,72,253,223,3,184,21,183,189,163,24,124,10,252,
+	74,68,158,47,163,251,170,51,176,46,176,1,46,161,100,251,4,54,115,5,48,5,152,10,
+	124,101,17,95,137,144,155,117,128,65,64,111,92,46,142,134,173,33,29,253,191,157,189,44,
+	117,192,229,124,88,4,44,197,109,249,88,236,63,203,113,9,59,167,1,83,108,75,159,97,
+	24,134,97,14,0,163,65,209,216,26,120,183,141,195,250,139,200,23,54,90,38,7,105,149,
+	3,85,29,6,220,152,144,230,156,38,34,55,22,184,255,167,226,156,31,101,217,255,34,200,
+	91,133,55,224,54,241,134,127,69,10,154,93,143,219,30,48,22,152,36,34,106,43,99,193,
+	228,165,61,176,45,176,41,176,25,48,24,183,77,164,39,46,90,36,172,78,180,144,53,21,
+	75,38,248,185,253,0,248,192,34,62,12,195,48,140,164,81,105,67,80,48,130,236,127,174,
+	176,97,50,57,72,171,28,168,234,53,192,233,9,106,210,13,170,58,72,68,206,176,254,151,
+	156,33,151,241,6,219,182,184,112,255,234,20,53,191,2,87,246,177,15,48,73,85,223,1,
+	22,136,72,214,150,199,72,101,68,188,92,180,3,246,198,85,30,217,14,183,37,169,75,196,
+	50,83,227,63,27,3,251,1,43,241,213,33,84,245,121,224,30,224,45,92,180,64,157,229,
+	130,48,12,195,48,138,137,61,133,10,167,140,108,11,188,221,198,97,3,69,100,138,141,150,
+	201,65,218,228,64,85,31,4,190,147,208,230,221,7,28,27,231,155,86,85,189,23,56,38,
+	169,253,23,145,99,74,228,254,201,0,157,112,111,110,183,195,37,245,75,59,203,113,229,45,
+	63,5,150,88,68,64,36,114,210,7,23,25,114,144,55,252,135,20,89,223,89,5,76,4,
+	254,9,252,7,23,249,49,219,102,202,48,12,195,48,7,128,25,126,230,0,48,57,72,157,
+	28,168,234,191,128,239,230,121,153,73,184,242,105,95,227,66,105,21,232,11,172,131,219,159,
+	91,155,231,245,31,20,145,163,98,234,255,3,192,145,121,94,102,42,110,31,241,12,92,24,
+	49,184,144,246,62,190,255,3,242,188,254,191,69,228,200,148,223,59,149,64,127,96,43,47,
+	27,165,68,214,203,253,123,192,52,139,6,8,45,35,125,129,221,252,122,180,39,46,180,63,
+	105,204,197,149,47,125,18,120,69,68,166,217,204,25,134,97,24,133,196,182,0,24,134,145,
+	143,194,125,77,72,227,63,235,21,224,39,129,135,69,100,106,27,223,51,0,56,2,247,70,
+	111,223,16,107,215,145,170,122,77,212,225,240,190,255,97,12,235,213,192,51,192,19,192,67,
+	1,251,255,29,223,255,125,66,244,255,59,113,244,191,128,114,38,192,134,192,14,184,44,255,
+	165,70,6,231,240,169,1,94,197,69,3,24,193,229,163,29,112,56,240,51,96,47,146,153,
+	4,178,129,158,192,143,128,227,128,103,85,245,54,156,131,206,156,62,134,97,24,70,65,176,
+	8,128,194,41,40,22,1,96,148,148,28,228,145,240,238,58,224,98,17,153,31,242,123,123,
+	0,231,3,191,14,113,250,169,34,114,83,68,253,15,155,240,240,122,223,255,121,121,244,255,
+	2,96,120,49,251,95,64,57,203,0,91,0,219,227,246,115,151,58,43,129,215,128,177,182,
+	29,160,77,217,168,4,134,2,103,225,74,171,118,73,97,55,22,1,15,1,151,3,159,91,
+	37,32,195,48,12,195,28,0,102,248,25,38,7,73,236,199,94,192,115,57,158,118,7,112,
+	137,136,76,136,168,13,131,129,243,128,227,115,60,117,239,124,75,228,169,234,222,192,179,57,
+	158,118,39,48,42,1,253,223,87,68,158,77,201,253,210,14,216,6,216,154,96,9,52,75,
+	133,58,92,181,144,143,68,100,133,173,156,223,146,139,42,92,217,199,239,3,231,224,202,245,
+	165,157,89,192,53,192,93,192,151,34,82,111,51,109,24,134,97,152,3,192,12,63,195,228,
+	32,41,253,152,64,110,117,238,79,22,145,63,198,212,150,95,1,127,200,225,148,241,34,178,
+	113,158,223,249,9,46,177,88,168,254,171,182,248,98,183,233,91,253,49,205,46,220,141,178,
+	136,171,234,73,64,46,99,251,137,136,108,146,130,123,165,147,55,254,55,47,51,227,191,129,
+	213,192,56,224,77,115,2,124,67,46,58,224,50,237,255,22,216,189,4,231,252,21,96,52,
+	240,31,139,6,48,12,195,48,226,32,99,67,96,24,70,142,10,248,136,28,140,255,233,184,
+	55,206,127,140,171,61,254,218,251,0,65,147,105,13,81,213,51,243,232,255,153,57,24,255,
+	211,112,17,7,173,245,127,120,163,79,46,127,107,232,255,45,184,50,103,83,3,182,105,227,
+	124,250,95,32,25,171,198,133,253,151,171,241,15,46,207,195,80,96,51,85,181,18,177,252,
+	111,59,200,177,184,109,52,187,151,232,156,239,137,115,104,30,109,51,110,24,134,97,196,162,
+	59,219,16,20,76,113,177,8,0,35,245,114,224,223,202,78,4,214,14,112,248,84,96,247,
+	66,101,185,86,213,126,184,4,106,253,2,28,62,219,143,243,210,16,253,159,140,171,37,222,
+	22,95,0,187,136,200,23,205,92,7,194,237,225,7,24,211,92,29,113,85,237,239,251,191,
+	94,92,253,47,208,60,86,224,234,169,239,78,113,19,213,106,66,158,149,13,9,35,63,45,
+	231,250,241,126,191,255,112,220,182,151,110,101,208,229,249,192,239,129,63,217,118,0,195,48,
+	12,35,74,172,10,128,97,24,185,112,65,64,227,31,224,103,133,44,113,37,34,95,168,234,
+	207,188,177,212,22,107,249,190,228,250,38,252,194,128,198,127,67,255,155,51,254,135,231,217,
+	213,225,170,138,136,140,105,210,255,105,170,250,211,28,250,127,33,48,50,129,50,214,19,151,
+	240,47,238,231,147,2,245,184,26,237,171,112,251,238,151,251,127,87,224,146,241,213,1,213,
+	184,172,242,213,64,7,160,202,255,91,233,63,85,5,120,78,239,138,43,147,57,175,28,23,
+	29,85,237,134,75,244,247,219,2,140,119,82,232,14,92,9,244,84,213,63,132,77,26,106,
+	24,134,97,24,223,210,153,109,8,10,166,192,88,4,128,145,106,57,80,213,238,184,55,199,
+	65,194,145,127,229,67,211,139,209,206,160,57,1,178,64,31,17,153,21,240,186,189,129,25,
+	4,11,73,111,54,231,65,4,198,127,83,167,199,152,60,251,191,174,136,204,76,144,140,117,
+	1,246,7,250,198,248,53,203,112,111,87,23,251,127,103,3,115,68,100,73,14,237,236,10,
+	244,192,57,82,122,226,178,207,119,243,142,129,184,152,10,60,147,196,168,141,152,101,98,93,
+	156,163,106,88,25,25,255,77,229,245,54,92,229,144,185,246,20,53,12,195,48,242,197,114,
+	0,24,134,17,148,211,2,26,255,119,22,203,248,247,70,241,31,113,25,247,131,172,127,39,
+	229,112,233,147,2,174,153,119,2,127,84,85,154,124,134,71,221,87,85,29,222,244,123,112,
+	9,1,239,8,216,255,19,19,100,232,9,46,233,95,92,198,255,34,224,99,224,69,224,41,
+	17,249,143,136,188,45,34,83,114,49,254,189,140,45,242,231,189,45,34,79,2,79,226,146,
+	183,125,12,44,137,169,253,235,1,155,148,211,130,227,29,45,167,1,167,150,169,241,15,208,
+	209,223,167,191,82,213,246,246,24,50,12,195,48,242,214,149,109,8,10,166,200,88,4,128,
+	145,246,8,128,215,129,29,3,28,58,36,170,82,119,121,180,117,48,48,62,192,161,111,136,
+	200,78,81,247,31,104,218,255,225,49,119,185,105,36,64,228,253,47,192,156,245,5,14,38,
+	250,183,232,179,189,97,62,29,88,16,231,126,106,159,191,160,187,119,98,108,238,255,31,37,
+	11,112,81,0,95,149,193,90,89,13,252,20,184,214,27,193,5,253,250,22,254,47,69,212,
+	157,150,1,63,7,238,41,231,92,16,5,144,187,181,112,209,61,157,128,62,64,87,127,31,
+	215,224,156,80,51,112,91,133,230,0,115,113,145,68,95,3,139,45,87,131,97,24,105,193,
+	114,0,24,134,17,212,56,11,98,252,142,41,182,241,15,32,34,19,84,245,58,224,55,109,
+	28,186,163,170,246,17,145,25,109,244,191,79,192,254,95,231,191,187,144,198,127,195,119,140,
+	137,171,255,5,50,246,6,71,104,252,103,113,123,248,63,1,222,21,145,229,5,146,187,122,
+	111,24,204,81,213,137,184,136,134,13,125,191,162,176,218,186,1,67,85,245,107,17,201,150,
+	248,178,179,41,46,225,95,220,198,127,22,151,243,97,169,255,44,244,115,184,200,27,120,11,
+	253,167,166,145,33,216,203,27,136,107,249,246,53,124,226,180,204,59,226,202,3,126,132,115,
+	104,25,185,173,49,221,129,29,188,92,109,2,116,198,229,179,233,236,13,254,158,184,92,31,
+	85,121,124,199,98,224,43,191,246,204,243,114,180,24,183,125,231,101,224,35,17,153,109,179,
+	97,24,134,57,0,12,195,72,3,71,6,56,102,53,112,81,130,218,124,177,55,140,219,10,
+	219,63,10,184,41,192,49,65,12,137,139,75,180,255,113,211,27,232,31,209,181,86,225,42,
+	53,188,47,34,95,23,171,67,34,178,68,85,95,194,69,98,108,7,12,32,216,22,154,182,
+	88,207,27,46,51,40,81,124,69,143,107,9,86,209,34,44,95,3,159,226,74,117,126,2,
+	124,0,124,32,34,211,115,104,231,64,111,76,110,225,13,203,254,56,71,86,175,152,218,188,
+	30,112,181,170,254,188,216,78,187,132,203,79,21,174,138,200,86,56,39,220,118,192,250,5,
+	248,234,46,126,254,91,107,219,68,224,53,96,28,240,6,240,182,136,44,179,89,51,12,195,
+	28,0,134,97,36,141,67,3,28,243,108,146,50,85,139,200,124,85,125,10,56,40,64,223,
+	110,138,160,255,79,137,200,252,38,191,27,94,192,46,55,141,2,152,175,170,79,226,194,234,
+	243,237,127,156,202,122,5,176,14,46,212,54,10,198,3,111,38,65,169,22,17,5,102,170,
+	234,115,184,8,146,77,35,50,50,250,171,234,172,82,12,57,86,213,12,240,59,111,192,197,
+	193,20,224,121,92,222,134,87,69,228,203,60,230,119,50,206,217,244,152,111,251,0,96,47,
+	223,246,184,146,89,238,13,252,2,184,196,30,75,255,147,153,93,128,161,184,106,25,91,2,
+	155,37,184,185,235,55,117,70,168,234,199,192,155,192,127,129,247,68,228,85,155,85,195,48,
+	204,1,80,152,7,72,123,160,90,68,22,217,104,24,198,183,216,54,192,49,79,36,176,221,
+	79,6,112,0,108,21,224,58,91,7,252,174,36,246,191,45,7,192,54,69,110,99,23,92,
+	152,124,190,100,113,249,53,254,43,34,117,73,154,4,17,89,166,170,47,227,66,205,183,38,
+	255,4,188,155,120,71,199,194,18,92,107,118,5,142,139,225,186,239,3,127,246,198,255,103,
+	113,200,136,136,76,5,254,166,170,255,196,229,2,217,19,56,133,54,222,10,231,72,53,240,
+	35,85,125,81,68,94,46,83,125,173,7,112,172,255,236,72,188,213,55,10,193,38,254,243,
+	51,223,191,133,192,235,192,163,192,63,76,47,53,12,35,242,231,149,25,254,154,1,122,199,
+	29,42,106,73,0,141,180,202,129,223,59,25,228,205,126,173,87,128,147,52,222,3,112,111,
+	252,218,162,187,136,44,104,225,26,221,112,229,226,2,247,223,231,0,24,94,164,110,143,105,
+	72,18,150,67,255,123,52,19,189,80,200,57,218,39,130,231,209,135,184,253,254,217,4,223,
+	255,85,192,246,68,227,116,121,40,105,247,91,4,227,211,21,184,5,248,94,68,151,92,229,
+	239,221,219,129,43,68,100,78,17,250,212,23,56,211,59,53,122,17,205,54,16,245,125,58,
+	81,68,86,149,209,243,243,187,222,232,63,166,204,84,135,127,2,15,139,200,61,166,69,25,
+	134,17,5,101,29,1,160,170,135,3,95,138,200,187,38,10,173,142,147,22,224,107,90,83,
+	254,195,24,82,99,154,253,18,203,158,28,134,32,123,179,167,38,209,24,17,145,169,170,58,
+	25,24,24,160,143,11,90,248,91,191,0,95,53,57,193,253,159,4,12,106,227,208,245,2,
+	58,57,98,105,35,240,151,114,184,145,68,100,149,170,78,141,200,1,80,138,251,134,247,33,
+	216,118,155,32,44,5,30,6,174,23,145,55,139,56,231,95,170,234,233,184,210,156,231,226,
+	182,6,228,91,206,79,112,91,13,182,197,189,41,46,101,253,99,47,111,240,127,143,232,171,
+	106,164,133,31,0,63,80,213,63,224,202,204,254,91,68,158,53,213,196,48,140,176,100,202,
+	177,211,170,122,160,223,27,60,207,140,255,228,76,11,223,44,183,212,96,248,135,125,139,58,
+	28,24,46,34,102,244,231,79,144,125,172,179,18,220,254,32,89,151,91,75,54,214,47,162,
+	239,40,22,65,222,122,246,51,49,79,221,115,183,164,22,54,191,13,239,123,184,172,236,81,
+	112,59,112,122,49,141,255,70,78,128,172,136,188,13,252,18,248,71,68,151,237,15,236,239,
+	43,104,148,154,142,182,153,170,94,172,170,159,3,207,1,39,151,177,241,223,152,238,192,169,
+	192,51,170,250,153,170,94,168,170,91,216,176,24,134,145,43,101,21,1,160,170,59,3,151,
+	1,123,0,7,137,200,43,77,254,46,184,189,122,27,18,77,152,94,99,54,8,112,204,254,
+	170,26,181,33,181,10,24,47,34,19,211,50,77,34,34,170,58,60,162,57,31,46,34,99,
+	114,60,199,228,224,155,244,9,112,76,146,51,82,7,217,222,179,110,43,127,235,27,226,59,
+	134,23,177,191,223,72,6,24,176,255,125,49,140,226,210,31,216,47,162,181,238,82,224,26,
+	17,89,156,164,14,138,200,76,31,13,48,7,24,65,30,37,231,60,63,195,69,22,76,44,
+	5,1,80,213,19,129,19,112,219,100,140,182,117,137,11,128,11,84,245,5,224,78,17,185,
+	205,134,197,48,12,115,0,172,121,168,108,230,21,130,195,252,175,230,138,200,147,77,142,233,
+	3,220,139,75,64,84,44,110,137,113,12,158,4,190,223,210,62,231,132,205,151,2,191,142,
+	240,122,77,13,162,214,142,53,57,248,54,189,3,28,51,61,193,34,245,85,128,99,214,105,
+	229,111,107,71,244,29,105,237,191,97,20,130,129,184,132,144,249,176,26,184,16,184,82,68,
+	86,39,177,147,34,178,84,85,47,195,57,151,207,204,243,114,3,128,141,210,238,0,80,213,
+	99,128,145,184,114,125,70,238,236,9,236,233,29,40,87,139,200,189,54,36,134,97,180,70,
+	73,111,1,80,213,13,84,245,31,184,228,80,135,53,250,83,115,123,117,255,82,100,163,47,
+	110,14,4,174,79,81,123,163,110,107,208,55,178,38,7,205,232,172,101,176,22,106,200,191,
+	229,114,76,18,251,214,64,61,134,81,92,195,248,169,8,228,176,94,68,46,75,170,241,223,
+	168,175,75,136,174,106,202,215,105,157,115,85,221,73,85,159,198,57,221,205,248,207,159,237,
+	129,123,84,245,41,95,26,209,48,12,163,124,28,0,170,218,71,85,111,0,62,1,126,24,
+	224,248,158,222,48,42,117,142,77,217,126,193,130,58,1,76,14,90,100,102,128,99,214,75,
+	112,127,215,205,179,143,65,250,159,228,16,250,180,231,112,48,202,135,170,34,159,159,166,190,
+	166,86,143,83,213,77,84,245,175,192,107,192,190,38,246,145,179,63,240,138,170,222,161,170,
+	131,109,56,12,195,40,105,7,128,170,118,85,213,11,129,9,184,68,41,65,183,56,12,40,
+	147,249,110,79,176,112,230,146,117,2,180,145,91,192,228,160,121,130,236,239,239,147,224,254,
+	6,9,111,255,42,228,223,90,250,142,49,69,236,239,152,136,251,111,24,134,17,149,142,118,
+	45,48,14,248,169,141,72,236,28,15,140,87,213,171,84,181,135,13,135,97,24,37,229,0,
+	80,213,42,85,253,53,240,25,46,41,74,174,251,8,87,149,209,156,167,177,175,133,114,2,
+	152,28,52,207,151,1,142,233,157,224,190,230,155,195,96,122,153,247,223,48,10,246,56,47,
+	242,249,70,124,122,218,217,184,237,151,191,177,209,40,56,35,128,9,170,122,142,13,133,97,
+	24,37,225,0,80,213,159,0,159,2,215,229,161,132,127,6,44,47,131,249,254,154,96,225,
+	204,229,234,4,48,57,104,158,32,245,237,7,168,234,128,4,174,15,3,128,218,60,251,24,
+	164,255,181,41,239,255,52,123,28,26,9,64,138,124,190,17,253,26,116,176,170,126,136,171,
+	192,212,205,70,164,104,244,2,46,81,213,151,85,117,31,27,14,195,40,111,82,91,5,64,
+	85,15,199,101,246,223,52,196,233,223,216,123,39,34,43,84,117,12,112,86,137,207,247,85,
+	34,146,230,55,36,215,19,109,117,128,227,69,228,78,147,131,54,52,106,145,5,170,58,199,
+	43,16,173,113,4,197,13,125,111,169,77,109,49,75,68,22,182,210,255,133,190,44,99,239,
+	28,251,63,134,194,151,3,28,19,162,255,179,211,80,29,196,40,15,123,49,130,117,253,124,
+	220,203,141,37,254,87,157,129,44,176,8,104,7,116,192,85,11,152,15,212,248,223,173,4,
+	22,226,234,172,87,226,28,193,43,129,174,49,94,107,243,50,48,254,135,147,174,228,195,229,
+	192,174,192,51,170,250,91,17,185,198,134,195,48,204,1,144,150,7,202,158,56,79,242,78,
+	121,92,102,67,85,237,32,34,141,223,246,158,131,171,205,123,34,174,254,123,169,188,73,200,
+	226,146,33,222,72,140,229,229,82,234,4,232,166,170,149,77,50,70,155,28,52,207,187,192,
+	1,109,28,115,80,2,29,0,65,146,58,254,55,224,49,105,236,255,65,1,142,121,207,30,
+	133,70,137,144,1,46,178,97,72,132,174,118,51,112,178,141,68,98,185,90,85,55,22,145,
+	19,109,40,12,163,60,31,150,105,121,152,108,227,107,152,63,159,167,241,15,46,9,218,55,
+	222,204,137,72,189,136,140,22,145,193,56,199,72,85,196,159,32,109,222,48,134,239,173,18,
+	145,77,69,228,143,41,127,251,223,212,9,16,5,21,192,22,38,7,129,120,52,192,49,251,
+	38,41,209,144,111,203,254,17,245,45,200,49,251,53,211,255,66,58,4,198,52,211,255,125,
+	35,234,155,97,20,2,11,225,79,191,225,95,171,170,207,155,241,159,10,78,240,91,2,214,
+	181,161,48,12,115,0,36,237,97,50,88,85,239,1,222,161,237,55,112,185,112,169,170,54,
+	27,234,45,34,89,17,89,29,229,7,23,38,216,22,171,163,254,94,17,201,150,168,236,70,
+	229,4,216,89,85,183,49,57,104,147,7,3,28,83,9,156,159,32,25,57,223,59,121,218,
+	226,254,0,199,60,16,208,161,148,180,254,87,70,212,55,195,136,251,89,191,169,57,0,66,
+	81,145,160,57,220,15,120,29,216,211,166,37,53,236,10,188,167,170,123,219,80,24,70,249,
+	144,216,135,173,170,246,199,133,99,255,34,198,7,92,61,112,142,136,92,81,128,254,108,11,
+	188,221,198,97,3,69,100,74,2,231,34,201,145,3,81,108,7,80,224,53,17,121,183,156,
+	228,64,85,175,22,145,223,230,112,252,235,192,142,1,14,29,34,34,19,138,44,179,131,129,
+	241,1,14,125,67,68,118,138,186,255,184,82,164,141,137,59,23,64,211,72,131,200,251,95,
+	164,121,236,136,203,61,209,21,183,223,186,194,175,219,43,113,251,173,51,56,167,90,61,80,
+	237,159,105,13,21,46,170,252,189,93,231,207,171,196,109,133,105,56,183,88,215,234,9,108,
+	28,193,240,220,45,34,179,74,196,248,255,37,240,7,74,172,52,113,129,152,14,156,44,34,
+	143,22,121,14,79,6,110,78,216,216,76,194,149,177,173,5,250,38,172,109,117,126,109,72,
+	18,195,69,228,6,187,165,12,163,244,73,92,14,0,31,182,122,166,87,152,59,196,252,117,
+	21,184,72,128,94,192,159,128,207,74,40,76,190,92,184,62,2,71,128,224,34,1,58,0,
+	99,129,5,34,165,249,34,74,85,51,222,248,56,21,56,9,248,109,14,167,63,17,208,0,
+	62,15,248,97,145,187,122,94,192,227,30,207,225,154,143,231,209,255,56,19,2,142,41,80,
+	255,11,37,163,125,128,13,128,1,128,213,174,110,101,168,74,100,77,186,28,248,157,77,103,
+	104,214,3,30,81,213,115,68,228,178,34,205,225,245,20,62,225,105,115,140,7,238,3,222,
+	199,57,218,127,2,92,156,208,121,107,48,254,111,2,22,3,7,83,252,196,144,99,124,94,
+	128,83,236,182,50,140,210,38,49,86,142,55,190,134,123,227,191,88,74,95,214,127,162,224,
+	125,17,217,174,81,255,44,2,32,93,138,117,84,125,158,34,34,235,231,35,7,170,58,59,
+	162,123,34,139,123,195,246,191,183,108,146,131,167,195,59,231,102,17,44,34,231,100,17,249,
+	99,145,228,245,87,184,183,137,65,198,99,29,17,153,29,240,186,189,112,37,20,67,247,191,
+	133,242,147,225,23,112,145,49,121,244,191,30,88,91,68,230,38,100,157,217,0,216,18,176,
+	253,168,33,231,62,133,198,255,53,192,233,54,155,145,113,173,136,156,81,192,249,171,2,158,
+	2,246,42,98,159,103,225,182,49,221,46,34,175,55,106,219,213,192,25,41,153,183,159,139,
+	200,95,85,117,87,224,120,224,16,160,95,17,219,243,36,112,132,136,212,217,45,101,24,165,
+	73,209,195,237,84,53,163,170,39,225,106,176,255,31,197,125,227,147,193,69,69,68,241,49,
+	82,172,91,55,50,148,243,253,68,41,155,249,126,42,243,105,147,136,204,3,130,150,13,250,
+	131,170,238,85,132,245,100,239,128,198,47,192,213,65,141,127,223,255,57,57,246,127,239,56,
+	141,182,22,140,255,92,250,127,77,18,140,127,85,237,233,203,186,30,108,198,127,110,207,206,
+	148,183,255,247,102,252,71,206,233,62,162,162,80,188,95,36,227,127,53,240,47,224,48,17,
+	89,91,68,78,110,98,252,159,154,34,227,31,224,47,170,122,178,136,188,226,251,210,31,56,
+	202,247,113,89,17,218,115,32,240,145,221,78,134,81,218,134,78,49,21,128,99,113,225,89,
+	131,75,112,108,223,201,55,2,64,85,37,9,91,18,202,48,2,32,74,38,69,20,1,208,
+	43,150,5,32,199,189,14,170,218,9,152,8,172,29,224,240,105,192,174,34,242,69,129,228,
+	180,31,240,42,193,222,156,204,2,6,137,200,210,16,253,159,4,244,206,167,255,254,150,10,
+	27,13,48,166,185,105,243,253,127,5,232,31,224,26,51,129,245,115,237,127,12,115,182,169,
+	55,32,44,249,91,238,44,4,94,18,145,201,41,52,254,15,5,30,177,41,140,141,147,68,
+	228,214,152,231,112,34,48,168,192,253,122,30,248,59,240,111,17,89,216,66,187,182,3,94,
+	194,85,123,74,27,123,137,200,11,205,60,115,126,0,124,15,40,116,162,190,137,34,178,129,
+	221,78,134,81,122,20,229,13,130,170,30,160,170,239,0,247,148,168,241,31,21,35,85,117,
+	168,13,131,145,20,188,193,120,117,192,195,251,3,175,170,234,62,5,88,83,246,246,198,111,
+	208,176,201,171,195,24,191,254,156,209,57,246,191,37,165,109,12,185,149,9,108,241,120,63,
+	198,175,6,52,254,67,247,63,226,57,219,217,43,180,102,252,135,163,6,56,204,27,60,105,
+	50,254,43,129,235,108,250,98,229,15,222,185,22,215,28,190,91,96,227,255,62,96,107,17,
+	217,91,68,254,222,146,241,239,185,37,165,198,63,192,21,205,61,115,68,228,79,34,178,15,
+	176,41,240,239,2,182,103,125,175,171,27,134,97,14,128,188,30,26,59,249,250,176,79,2,
+	219,216,240,183,201,201,192,253,170,122,158,223,31,107,24,73,112,2,92,5,124,26,240,240,
+	126,192,51,126,95,122,92,235,202,175,128,103,115,48,126,39,136,200,149,121,246,127,66,14,
+	253,127,182,141,254,143,105,197,184,31,211,150,163,192,95,251,153,28,156,31,19,124,31,138,
+	105,4,238,6,108,107,119,83,36,236,228,199,51,45,140,2,214,183,105,139,93,183,187,34,
+	166,123,247,58,96,235,2,245,227,69,224,96,17,57,70,68,254,27,160,109,151,0,91,165,
+	120,222,182,87,213,171,90,121,246,140,19,145,35,113,219,165,158,41,80,155,182,81,213,209,
+	57,28,223,21,87,113,161,175,255,191,145,14,108,222,202,77,151,47,144,178,183,169,127,232,
+	127,167,140,198,54,138,45,0,147,113,229,107,20,183,31,235,239,192,125,34,50,173,192,202,
+	186,109,1,8,79,73,109,1,104,212,166,61,128,23,114,60,237,78,96,84,84,37,2,125,
+	169,191,243,112,73,147,114,97,111,17,121,62,207,239,222,19,23,142,154,198,254,239,41,34,
+	47,22,209,248,223,14,216,201,150,134,88,158,57,175,37,185,129,170,186,14,240,37,86,238,
+	175,80,124,87,68,238,143,104,238,106,252,127,231,16,127,158,163,9,192,133,34,114,119,204,
+	107,114,82,9,244,140,82,213,227,253,51,32,238,72,218,213,192,90,94,103,88,208,204,223,
+	43,113,14,221,193,184,200,164,198,44,244,243,185,28,24,231,175,101,36,131,32,243,246,142,
+	205,89,105,18,235,67,88,85,215,87,213,219,189,241,250,29,27,238,240,118,26,174,60,204,
+	85,192,125,170,122,178,47,149,101,24,197,17,72,103,64,158,150,227,105,199,3,227,85,245,
+	90,85,237,158,199,186,210,195,191,133,26,31,194,248,61,53,95,227,223,247,255,133,60,250,
+	127,157,175,168,16,182,255,221,85,245,218,144,253,63,173,200,198,255,64,51,254,99,99,219,
+	56,195,190,35,226,100,51,254,11,202,175,35,188,214,16,255,137,211,248,255,18,56,83,68,
+	134,228,98,252,123,174,43,161,121,187,62,224,115,232,78,17,25,130,43,231,59,59,198,246,
+	84,122,35,177,57,71,195,64,224,199,192,246,205,24,145,248,223,109,15,236,1,28,109,183,
+	100,98,216,45,224,188,253,216,207,177,97,14,128,64,74,94,31,95,23,246,19,224,71,54,
+	204,145,206,215,118,184,112,224,187,84,245,71,249,24,18,134,145,167,17,124,35,112,109,136,
+	83,127,3,204,81,213,199,85,117,184,170,14,8,176,166,12,240,199,62,129,75,224,23,70,
+	177,189,86,68,110,74,64,255,127,13,204,10,217,255,199,113,111,224,126,19,178,255,55,22,
+	209,248,207,0,187,219,157,19,43,123,169,106,207,4,183,239,120,155,162,194,42,249,170,26,
+	149,195,109,91,226,221,182,115,57,48,56,204,246,36,95,249,96,139,18,154,183,205,124,137,
+	204,160,207,162,107,128,245,112,47,137,226,162,185,249,223,16,56,12,232,28,240,26,107,3,
+	135,219,109,89,116,14,199,109,149,9,50,111,157,253,28,111,104,195,86,90,68,234,201,85,
+	213,174,184,178,62,103,96,123,72,226,158,183,61,112,222,185,103,85,245,79,192,179,197,78,
+	234,101,148,165,19,224,12,85,93,15,56,38,199,83,51,192,65,254,115,189,223,238,50,27,
+	248,26,248,10,183,237,165,47,176,14,46,227,126,109,158,77,125,48,142,250,216,190,255,3,
+	112,37,155,114,161,162,73,255,167,120,199,70,67,255,193,149,196,91,7,23,122,153,175,7,
+	254,190,66,214,7,111,129,29,105,254,77,131,17,161,72,2,187,0,15,39,173,97,222,16,
+	181,189,255,133,231,24,224,245,8,174,179,118,76,237,91,133,171,90,240,215,144,114,181,15,
+	240,187,18,156,183,211,85,245,65,17,121,57,224,179,168,14,56,83,85,199,3,55,3,237,
+	34,110,79,211,249,239,10,132,73,240,91,235,117,215,183,236,214,44,10,219,135,212,167,246,
+	193,85,15,90,100,67,104,14,128,198,11,112,21,46,180,239,247,49,62,36,140,111,211,1,
+	56,20,247,86,237,49,85,189,21,120,205,63,8,12,163,80,78,128,99,85,245,1,224,200,
+	60,46,51,144,248,194,204,30,8,225,160,200,85,193,190,47,207,254,215,70,224,228,104,209,
+	249,1,28,91,100,227,175,35,150,248,181,80,212,170,234,6,34,242,121,194,218,181,151,77,
+	77,81,56,16,247,82,38,95,86,196,208,182,15,129,147,243,204,93,113,81,9,207,221,111,
+	128,151,115,57,65,68,254,162,170,159,0,127,6,54,142,176,45,77,231,127,7,160,58,228,
+	181,118,4,150,1,99,237,246,44,40,155,250,177,15,67,181,159,243,167,109,24,75,131,188,
+	183,0,168,234,143,112,137,34,174,55,227,191,104,116,5,190,143,43,171,120,131,170,110,239,
+	195,109,13,163,80,78,128,163,8,23,14,31,55,215,138,200,209,34,146,141,177,239,217,132,
+	247,255,40,17,41,118,34,207,205,177,114,127,133,100,203,4,182,201,170,62,20,135,141,125,
+	242,197,124,249,204,127,162,226,65,92,221,251,208,198,191,170,238,139,139,120,41,85,142,82,
+	213,218,16,207,164,215,189,161,247,104,132,109,105,152,255,118,254,147,175,115,97,111,96,87,
+	187,61,11,198,110,126,204,243,90,75,26,205,191,81,174,14,0,85,61,92,85,63,4,110,
+	199,18,68,36,133,222,192,47,113,111,35,175,84,213,205,85,213,148,110,163,80,78,128,51,
+	128,83,19,212,164,211,10,25,246,158,192,254,159,154,128,176,255,6,6,219,29,82,80,214,
+	77,96,162,88,139,0,40,30,155,71,112,141,103,136,174,244,220,104,239,152,156,151,231,117,
+	190,83,6,115,23,234,153,34,34,139,68,228,48,162,115,76,55,204,127,127,130,151,220,109,
+	139,173,129,67,128,246,118,139,198,70,53,110,15,127,84,229,49,163,156,127,35,77,14,0,
+	85,221,67,85,95,5,30,2,54,179,33,76,36,253,112,89,97,239,7,46,84,213,33,54,
+	36,70,129,140,224,155,112,123,197,198,23,177,25,19,112,111,150,110,44,82,255,247,246,109,
+	40,22,227,113,101,164,110,74,130,76,120,67,212,246,254,23,158,13,146,210,16,95,157,160,
+	155,77,73,209,168,141,96,109,155,47,34,243,113,229,136,243,225,36,17,25,25,81,191,246,
+	43,131,185,59,58,207,121,59,3,248,85,158,109,248,123,163,249,239,22,241,189,188,62,46,
+	135,142,85,182,138,158,62,184,237,127,81,190,164,141,122,254,141,164,59,0,84,117,27,85,
+	125,18,87,251,123,103,27,186,212,40,128,231,3,247,171,234,217,170,58,200,134,196,40,128,
+	17,252,156,136,108,12,156,69,188,165,137,154,50,139,53,37,164,94,40,98,255,159,247,165,
+	153,206,242,109,42,20,179,129,179,68,100,227,40,74,29,70,200,122,118,87,20,133,1,9,
+	106,139,57,161,139,75,175,8,175,117,33,176,56,228,185,231,139,200,173,81,52,66,85,183,
+	3,54,42,131,185,171,85,213,173,243,124,38,221,2,92,16,242,244,197,126,206,27,168,240,
+	159,168,229,243,104,96,19,187,85,35,99,19,156,99,37,234,74,97,113,204,191,145,68,7,
+	128,170,14,86,213,123,128,119,128,3,108,200,82,187,16,92,234,29,1,195,85,117,93,27,
+	18,163,0,134,240,149,56,207,243,104,32,27,227,87,213,227,202,31,13,10,83,66,42,230,
+	254,15,242,109,139,179,255,89,255,29,3,253,119,38,141,222,118,55,20,133,30,62,249,98,
+	18,48,39,80,113,137,108,207,174,136,76,1,126,17,226,212,199,68,100,84,132,125,218,175,
+	140,230,239,168,8,230,237,98,224,177,16,167,254,194,207,121,3,203,252,39,14,123,100,95,
+	220,11,198,42,187,101,243,50,208,119,245,99,25,135,161,30,215,252,27,73,113,0,168,106,
+	127,85,189,5,24,71,145,51,72,27,209,60,183,113,137,161,174,6,254,165,170,63,87,213,
+	181,108,88,140,152,141,224,165,62,220,179,15,46,26,229,141,8,47,255,134,191,230,58,34,
+	114,102,18,203,96,250,254,159,137,43,231,23,87,255,251,36,181,255,102,252,21,157,94,9,
+	105,135,149,5,46,46,43,35,94,215,254,133,171,37,62,61,224,41,111,139,200,161,17,247,
+	233,208,50,154,191,157,34,154,183,67,113,57,1,130,204,219,116,224,112,63,215,141,153,69,
+	188,145,109,219,2,63,194,229,7,48,114,99,43,224,231,49,143,93,220,243,111,20,136,202,
+	102,12,255,12,112,182,87,44,171,109,136,74,114,206,119,198,149,228,250,185,170,94,40,34,
+	207,216,176,24,49,27,194,179,128,81,192,40,191,39,252,40,175,192,109,77,240,55,196,179,
+	128,255,226,50,27,63,32,34,95,165,168,255,179,155,244,255,104,223,255,173,114,232,255,204,
+	38,253,159,145,244,126,171,106,79,44,99,176,25,222,17,84,28,50,242,98,97,12,107,218,
+	35,170,250,44,240,59,224,7,184,189,220,141,153,8,252,211,175,219,127,142,161,79,229,84,
+	86,116,96,132,243,118,134,170,158,27,96,222,254,79,68,154,123,211,219,144,184,49,27,227,
+	125,221,25,247,22,123,40,240,38,240,169,221,194,173,50,24,216,30,232,30,243,247,100,129,
+	249,54,220,37,234,0,240,70,255,151,192,43,184,242,42,166,188,69,67,16,15,252,138,2,
+	182,71,112,219,58,222,182,169,89,99,175,224,246,187,117,45,35,57,40,134,49,60,3,184,
+	201,127,80,213,110,184,196,149,253,128,190,184,114,162,234,13,222,175,112,111,34,166,138,200,
+	194,18,234,255,141,254,131,170,214,224,246,107,175,7,172,235,251,47,192,215,141,250,63,77,
+	68,22,164,176,187,221,109,89,41,42,29,18,210,142,37,54,21,165,119,31,122,3,241,124,
+	224,124,95,174,174,33,59,248,180,38,97,227,209,62,168,93,89,195,114,122,65,53,80,85,
+	123,137,200,156,4,204,91,157,255,247,67,226,47,55,218,29,56,16,151,112,252,29,96,170,
+	221,202,223,96,0,238,37,74,191,2,125,223,251,68,28,77,100,36,200,1,32,34,43,128,
+	191,169,234,35,184,210,17,39,2,59,96,73,31,242,85,188,62,3,150,183,162,144,125,237,
+	13,158,66,24,185,127,6,46,22,145,47,108,154,254,199,116,224,6,220,155,146,147,137,175,
+	110,121,82,228,32,73,6,241,2,96,1,240,81,57,10,158,119,108,124,232,63,165,70,103,
+	91,90,138,138,61,183,141,102,117,189,24,214,177,41,192,148,2,245,167,28,243,24,213,2,
+	115,18,52,111,47,249,121,40,68,142,151,190,254,243,57,238,165,213,236,50,191,159,123,2,
+	59,242,237,232,141,56,153,133,123,49,108,148,8,153,86,22,133,185,34,242,55,224,187,192,
+	233,184,208,211,172,13,89,96,186,54,25,207,21,192,152,86,142,191,74,68,180,201,239,162,
+	174,141,250,47,96,19,17,57,209,140,255,255,49,25,184,28,183,199,238,74,224,22,92,104,
+	246,239,129,143,35,184,126,85,4,114,96,9,113,140,180,98,219,200,138,75,125,66,218,97,
+	142,160,226,178,188,196,250,83,142,14,128,94,9,108,211,221,196,176,189,164,21,54,0,190,
+	143,219,66,184,113,153,61,95,170,128,77,125,223,143,47,176,241,191,208,207,181,81,66,180,
+	233,21,246,225,170,55,248,136,128,227,112,201,57,134,218,208,181,201,58,170,218,69,68,26,
+	151,203,57,7,231,193,61,17,216,16,247,54,254,19,92,40,240,45,141,79,246,33,110,107,
+	71,212,150,255,0,231,136,200,59,54,45,128,115,100,205,1,238,4,110,107,198,208,159,14,
+	252,31,112,63,240,67,92,18,204,13,9,247,54,45,95,57,24,136,37,208,50,210,139,216,
+	16,20,149,164,132,107,218,203,3,147,131,40,41,199,4,198,181,9,109,215,223,189,158,212,
+	163,128,223,185,158,255,236,131,203,89,48,30,247,50,167,20,89,31,87,238,114,32,5,136,
+	228,105,134,5,192,237,182,132,150,161,3,160,145,35,96,10,112,133,170,254,27,151,56,228,
+	7,56,111,156,209,60,85,184,210,123,195,27,141,97,61,174,36,218,104,159,108,17,17,105,
+	73,49,26,25,129,242,252,58,240,251,98,214,68,79,32,115,113,73,212,70,3,99,219,56,
+	246,51,92,237,220,187,113,101,143,142,37,247,189,86,249,202,193,229,102,68,25,41,102,149,
+	13,65,81,73,74,14,159,69,54,21,69,165,212,156,200,229,24,1,208,62,193,109,251,39,
+	240,29,10,95,241,37,131,123,137,178,33,46,202,229,115,239,12,152,81,2,242,61,24,231,
+	244,233,82,196,118,76,245,250,178,81,206,14,128,70,198,203,4,224,2,85,189,15,248,9,
+	46,42,192,202,60,53,207,48,85,69,68,134,55,51,142,45,190,17,81,213,171,113,219,46,
+	194,50,14,247,198,255,33,155,130,255,177,20,248,55,240,39,224,197,28,207,253,4,231,144,
+	185,23,248,49,46,4,171,79,1,228,224,110,172,4,167,97,24,249,41,200,230,136,48,74,
+	173,10,67,57,230,182,72,242,86,192,44,240,0,176,7,176,69,145,218,208,1,151,44,112,
+	51,92,166,250,207,113,185,2,102,226,146,59,39,153,46,184,45,30,125,188,209,159,132,237,
+	30,31,1,207,219,210,105,14,128,230,28,1,31,169,234,89,222,40,250,25,206,251,183,142,
+	13,233,183,30,186,45,26,127,109,24,255,97,222,250,78,4,70,137,200,223,109,232,255,199,
+	42,111,240,95,1,188,44,34,97,67,33,21,120,75,85,223,7,238,195,133,239,31,78,176,
+	189,173,97,228,160,193,248,183,183,255,134,41,173,70,88,86,39,164,29,29,108,42,138,74,
+	169,85,97,152,101,115,152,72,94,196,149,9,220,171,200,237,232,14,108,215,232,231,133,190,
+	93,179,112,209,1,115,128,101,69,92,11,215,242,198,126,47,220,86,223,206,9,156,199,15,
+	108,217,52,7,64,107,78,128,122,111,20,189,135,11,147,62,9,56,8,232,102,67,251,45,
+	227,175,23,112,13,240,110,115,67,137,75,238,113,178,31,195,92,141,190,153,184,80,241,155,
+	69,196,66,110,191,185,136,253,17,231,164,138,106,15,106,29,240,2,240,42,112,128,159,175,
+	189,128,78,17,200,65,6,151,217,245,44,92,34,194,178,48,254,85,181,59,46,138,168,161,
+	12,224,58,184,228,101,179,72,127,25,188,32,253,239,134,43,231,211,215,43,5,13,101,16,
+	27,148,149,47,125,255,211,88,127,87,109,25,42,42,73,73,2,184,218,166,194,136,144,105,
+	101,216,231,207,83,210,206,143,188,193,189,63,208,49,33,109,170,241,159,129,141,126,183,192,
+	63,99,231,224,34,5,234,188,83,160,14,151,51,35,172,206,152,193,57,190,59,226,182,109,
+	84,226,42,37,52,188,225,79,242,118,156,101,192,147,94,231,50,204,1,16,200,17,176,26,
+	120,81,85,223,198,37,229,248,37,176,119,130,110,254,36,56,1,190,239,63,45,41,196,97,
+	140,189,197,192,181,192,213,34,98,123,44,215,24,232,239,3,55,3,143,224,188,190,113,176,
+	10,183,55,234,53,255,160,251,5,176,139,95,240,165,192,114,144,54,131,183,15,110,27,197,
+	161,192,54,4,76,232,164,170,179,129,247,252,184,63,32,34,95,165,180,255,125,129,35,27,
+	245,191,87,192,243,230,226,106,33,63,10,60,40,34,95,166,228,126,52,138,71,82,178,100,
+	207,183,169,40,42,165,86,133,161,28,35,0,22,164,168,173,211,112,47,94,246,37,185,91,
+	132,187,249,207,70,45,252,125,57,206,129,186,194,127,86,53,114,16,100,189,125,211,174,145,
+	177,95,229,245,191,180,86,38,248,10,120,2,183,93,214,40,3,98,49,54,252,27,173,67,
+	112,97,210,59,99,97,160,81,179,26,247,102,251,82,17,249,186,0,6,75,90,222,226,141,
+	247,227,242,247,150,30,150,34,146,239,88,180,244,167,158,184,45,1,39,1,91,167,69,230,
+	37,223,1,9,62,110,107,251,245,224,16,92,148,67,20,188,1,60,142,139,124,153,155,112,
+	163,191,7,112,42,46,66,42,202,254,63,1,220,144,212,232,0,85,221,6,231,24,51,138,
+	195,155,34,242,102,2,228,224,247,184,100,168,70,113,184,64,68,46,46,149,206,168,106,79,
+	220,155,219,114,162,123,74,163,224,246,194,237,203,55,146,203,56,224,89,27,6,115,0,68,
+	185,72,247,198,189,233,59,9,216,156,210,75,68,83,12,238,0,46,20,145,137,5,124,216,
+	38,221,1,48,9,184,21,248,167,136,124,81,100,197,164,47,112,52,46,89,224,150,36,60,
+	89,81,220,14,0,85,237,4,92,8,156,17,227,253,95,143,219,86,113,145,136,36,202,123,
+	237,251,127,129,239,127,69,25,246,127,7,96,7,91,182,139,198,43,34,242,94,2,228,224,
+	34,224,124,155,142,162,113,186,136,92,87,74,29,82,213,149,148,79,29,248,153,34,146,230,
+	28,91,91,224,18,4,26,201,227,101,224,191,54,12,229,71,220,6,121,61,240,5,240,32,
+	240,48,46,196,196,246,132,134,227,73,96,11,17,249,81,33,141,255,164,63,20,129,43,113,
+	219,78,174,240,178,86,108,190,4,198,120,39,192,5,184,168,132,178,68,85,207,196,213,230,
+	29,17,243,90,83,129,171,210,48,81,85,71,38,168,255,35,113,137,57,71,18,175,35,168,
+	113,255,71,36,76,12,172,254,187,1,165,87,135,62,109,148,98,21,134,114,74,82,246,105,
+	9,204,213,195,184,50,204,70,50,248,202,219,102,102,252,155,3,32,82,197,183,70,85,247,
+	7,142,7,214,199,133,99,63,15,252,5,23,178,58,203,134,62,48,19,129,235,128,191,185,
+	161,213,78,54,36,204,5,110,241,134,255,89,192,148,4,182,113,42,46,228,245,8,92,130,
+	198,201,101,100,248,239,163,170,31,227,156,50,107,21,240,171,215,6,174,84,213,241,170,186,
+	71,17,251,191,135,170,78,192,57,167,214,46,112,255,175,82,213,9,170,186,87,66,196,193,
+	12,191,226,146,148,173,72,11,109,42,138,74,41,86,97,120,170,140,230,239,229,18,232,195,
+	20,224,78,92,222,36,123,46,20,143,229,192,235,184,106,86,95,216,112,148,47,145,134,255,
+	122,227,116,91,220,126,159,76,27,138,234,118,184,4,88,61,108,26,154,229,11,92,178,175,
+	198,111,144,179,184,172,224,227,128,41,34,178,162,64,6,77,18,162,54,178,184,164,135,15,
+	226,194,253,95,111,86,160,165,184,57,244,90,24,170,10,92,94,128,31,227,182,196,172,77,
+	66,182,6,68,189,5,64,85,135,1,55,38,228,30,58,77,68,110,44,240,252,159,10,220,
+	80,174,253,111,102,60,182,3,118,178,229,188,104,188,33,34,111,21,187,17,170,122,46,48,
+	202,166,163,104,156,39,34,151,148,82,135,84,117,107,154,175,166,83,138,108,41,34,165,20,
+	241,80,141,203,133,179,165,221,154,5,229,61,92,34,225,21,54,20,70,36,85,0,84,181,
+	26,216,202,127,130,236,201,154,233,141,219,247,113,251,67,183,36,217,165,49,10,201,44,92,
+	98,179,230,194,114,50,184,82,97,107,3,95,168,234,56,224,139,50,40,253,183,28,151,160,
+	228,106,224,37,210,23,86,92,15,188,237,149,149,123,129,19,112,25,224,75,202,249,165,170,
+	215,0,167,39,168,73,55,168,234,32,17,57,195,250,95,52,42,48,138,73,82,170,48,84,
+	218,84,20,149,146,171,194,32,34,239,169,234,68,92,148,105,41,51,165,196,140,255,134,117,
+	233,37,96,44,238,69,224,198,118,139,198,202,4,224,45,172,26,139,17,213,67,89,85,51,
+	184,183,253,219,17,174,228,223,116,220,62,148,255,122,71,192,102,180,93,79,189,84,89,0,
+	252,7,247,102,59,27,96,222,6,122,103,192,20,85,29,11,204,16,145,250,18,27,147,44,
+	240,52,240,39,92,73,191,186,98,191,225,15,160,148,180,218,31,85,125,217,59,3,246,194,
+	149,14,220,143,18,112,126,169,234,131,192,119,18,216,180,211,85,181,31,112,172,136,104,140,
+	253,191,23,56,38,169,253,23,145,98,181,173,212,214,164,180,145,20,7,204,114,155,138,162,
+	82,83,162,253,122,0,151,255,164,148,185,187,132,251,54,207,235,120,99,113,17,1,253,236,
+	86,141,148,105,192,155,184,200,97,195,136,198,1,160,170,67,252,13,155,175,241,146,197,101,
+	113,159,230,29,1,59,3,67,40,205,164,53,205,177,12,120,14,120,145,220,223,214,84,227,
+	106,152,246,195,37,0,27,7,204,138,211,208,41,148,61,233,141,228,235,189,225,191,184,196,
+	230,124,5,46,23,198,43,184,58,185,191,244,14,129,84,202,188,170,254,43,2,227,127,18,
+	174,172,211,215,172,73,22,218,23,88,7,232,13,212,230,113,237,239,2,247,227,182,95,196,
+	209,255,7,128,35,243,188,204,84,92,244,207,12,156,99,20,92,253,228,62,190,255,3,242,
+	233,191,170,62,40,34,71,22,65,60,108,175,103,74,159,241,38,7,37,69,169,234,83,143,
+	150,129,3,224,79,101,32,159,51,112,219,59,55,196,109,151,92,219,110,217,188,152,137,11,
+	247,255,204,134,194,136,76,57,80,213,65,184,61,157,61,35,110,203,106,220,126,247,201,192,
+	38,254,59,214,167,116,67,7,87,225,18,187,60,3,228,91,186,171,3,176,169,55,18,62,
+	83,213,241,192,156,164,191,45,111,129,247,112,123,252,255,129,115,142,148,50,13,57,13,158,
+	5,14,6,78,196,57,192,218,167,200,248,191,198,27,216,185,146,197,85,182,120,18,120,88,
+	68,166,182,241,61,3,112,9,21,15,194,57,77,114,93,23,142,84,213,107,162,14,135,247,
+	253,15,99,88,175,246,247,254,19,192,67,1,251,255,29,223,255,125,66,244,255,59,113,244,
+	191,140,13,143,180,144,148,237,82,182,197,175,184,148,164,3,70,68,94,82,213,87,129,93,
+	74,116,222,158,16,145,73,101,36,167,159,249,207,166,192,80,115,4,228,204,116,92,184,255,
+	56,27,10,163,205,245,51,7,69,183,175,55,78,250,20,168,109,157,112,91,2,118,244,134,
+	109,166,68,198,92,129,55,188,225,179,32,166,239,88,128,43,27,51,65,68,242,222,243,83,
+	128,36,128,117,184,8,144,27,113,111,106,167,183,242,192,79,247,228,183,62,148,107,227,114,
+	3,156,136,171,155,219,142,136,19,117,54,51,158,146,71,95,194,38,188,187,14,184,56,172,
+	108,170,106,15,92,77,241,95,135,56,253,84,17,185,41,162,185,12,155,240,240,122,223,255,
+	121,121,244,255,2,96,120,49,251,31,176,173,59,224,182,119,25,197,225,5,17,249,48,1,
+	235,222,133,94,102,141,226,80,208,251,190,192,178,117,32,206,145,90,138,236,45,34,207,151,
+	177,220,246,196,69,5,12,166,116,183,177,68,161,239,79,192,85,12,155,99,195,97,68,230,
+	0,80,213,222,184,183,241,3,138,212,198,26,92,146,192,237,113,33,193,105,182,0,63,192,
+	37,248,251,186,64,223,55,15,23,85,241,153,136,132,46,195,20,179,3,96,26,112,151,55,
+	138,102,164,221,192,143,200,65,208,23,248,17,240,19,220,118,152,196,57,0,124,153,185,231,
+	114,60,237,14,224,18,17,153,16,209,88,13,6,206,195,149,27,45,168,82,165,170,123,227,
+	34,55,114,225,78,96,84,2,250,191,175,136,60,91,32,121,222,134,210,125,59,151,6,94,
+	23,145,183,19,176,174,141,0,174,178,233,40,26,37,87,5,160,137,124,93,10,252,190,196,
+	186,117,181,136,140,48,209,253,31,235,121,103,192,70,88,100,217,74,175,219,79,194,74,249,
+	25,81,59,0,84,181,59,238,237,251,134,9,105,107,79,92,149,129,237,112,251,130,211,196,
+	4,220,94,181,105,69,250,254,217,192,199,192,231,34,146,243,118,131,152,28,0,115,188,225,
+	255,39,224,163,70,6,169,57,0,214,48,216,59,2,142,141,235,62,204,195,1,48,193,63,
+	136,131,114,178,136,252,177,133,126,54,166,233,91,237,49,45,180,187,113,91,126,5,252,33,
+	135,182,140,23,145,141,243,156,167,79,200,205,57,243,141,254,71,44,51,39,1,185,92,251,
+	19,17,217,164,64,242,188,37,176,187,61,106,139,198,91,34,242,134,57,0,202,158,139,68,
+	228,194,18,127,118,126,136,139,26,45,5,198,138,200,102,38,182,45,178,129,215,137,54,44,
+	179,126,79,192,109,147,254,212,68,192,136,220,1,160,170,93,188,145,61,148,100,190,109,95,
+	11,216,214,127,122,37,124,124,167,224,146,216,125,158,128,182,100,113,137,65,198,1,147,69,
+	36,112,86,230,136,29,0,11,129,135,129,209,192,135,173,25,118,230,0,248,223,61,186,9,
+	110,91,192,177,68,188,5,39,140,3,32,71,101,126,58,240,211,166,111,156,155,244,51,104,
+	40,251,152,150,228,196,191,145,255,43,208,63,224,181,206,18,145,43,67,206,209,153,192,21,
+	1,15,159,230,251,255,124,204,114,179,151,239,255,128,184,251,159,99,187,182,199,57,146,141,
+	226,144,148,8,128,11,177,45,0,197,228,119,34,114,69,41,119,80,85,119,195,149,150,43,
+	5,246,16,145,151,76,108,219,164,125,35,71,192,58,148,94,206,176,58,92,130,196,201,184,
+	55,254,117,54,229,70,164,14,0,85,109,208,166,183,197,133,218,167,161,118,115,31,220,222,
+	210,173,128,110,9,107,219,215,184,55,254,31,37,112,220,234,113,217,198,223,16,145,64,161,
+	67,17,57,0,86,224,74,246,220,138,171,120,208,146,65,106,14,128,150,217,1,248,49,46,
+	233,92,36,142,128,92,29,0,170,218,9,183,215,44,72,114,158,169,192,238,34,50,173,133,
+	126,14,15,217,236,49,205,53,219,151,251,123,149,96,165,132,102,3,3,115,141,136,241,253,
+	159,140,115,68,182,197,23,192,46,65,239,179,8,100,167,191,239,255,122,113,245,63,68,155,
+	44,7,64,113,73,74,14,128,243,129,139,108,58,138,198,233,34,114,93,25,60,63,47,7,
+	126,151,242,110,140,22,145,145,38,178,161,237,130,158,192,186,254,25,221,51,101,237,159,231,
+	237,135,217,172,169,10,100,24,177,208,224,45,107,72,176,183,196,11,92,159,20,56,1,102,
+	0,15,225,74,7,238,0,108,14,116,41,114,155,230,0,79,1,111,37,124,236,102,250,79,
+	33,88,225,13,254,235,129,231,68,196,202,65,181,110,144,183,246,231,55,85,245,125,92,162,
+	196,159,227,50,194,119,1,170,10,216,196,11,8,158,153,247,103,45,24,255,195,243,108,195,
+	112,85,69,68,198,52,25,187,47,84,245,103,184,236,250,109,177,150,239,203,153,57,126,247,
+	133,1,141,255,134,254,127,81,64,217,153,166,170,63,205,161,255,23,18,127,9,173,85,118,
+	87,23,149,164,236,149,93,100,83,81,84,202,162,10,131,136,156,237,147,2,110,153,210,46,
+	188,107,198,127,222,118,193,12,96,108,35,219,166,175,127,222,245,246,186,75,82,146,9,46,
+	244,109,157,235,141,254,153,184,234,64,134,81,152,245,178,25,229,188,61,48,16,87,134,99,
+	29,210,145,116,175,2,87,50,112,39,96,99,92,89,188,66,178,216,43,221,47,227,222,176,
+	39,149,113,184,61,161,139,115,57,41,143,8,128,213,192,53,192,57,13,11,91,185,191,225,
+	207,151,38,83,49,2,151,40,112,211,60,20,166,92,42,129,116,199,121,166,131,56,7,127,
+	37,34,183,196,96,252,55,109,255,152,102,190,35,104,78,128,44,208,71,68,102,5,236,127,
+	111,255,192,14,82,145,36,182,61,255,1,218,153,75,255,215,21,145,153,49,182,101,107,96,
+	87,187,115,139,198,155,34,242,102,2,214,173,179,128,255,179,233,40,26,37,159,3,160,145,
+	172,237,132,219,10,144,198,112,240,61,69,228,69,19,215,88,105,231,109,155,158,64,15,220,
+	11,148,142,254,223,246,254,83,73,126,149,199,234,112,229,189,235,113,47,193,86,248,223,45,
+	6,190,244,70,255,114,155,10,163,152,84,54,163,80,175,0,62,81,213,105,184,68,27,155,
+	224,246,218,39,217,114,171,199,37,197,152,140,75,156,182,51,110,79,80,117,204,223,187,18,
+	120,1,151,13,125,69,130,199,231,51,92,200,255,252,2,127,175,0,71,121,131,241,78,224,
+	125,92,25,68,35,191,49,237,135,139,0,248,62,133,77,130,115,90,64,227,255,78,224,150,
+	102,252,70,195,163,110,144,119,40,52,117,2,252,209,27,157,109,101,199,207,0,39,1,163,
+	2,126,221,73,1,149,130,59,139,101,252,251,53,252,143,170,186,11,240,195,0,253,63,17,
+	136,51,59,120,149,221,178,69,37,41,111,148,58,216,84,20,149,37,101,243,128,20,121,221,
+	71,66,221,145,178,166,255,220,140,255,130,176,18,183,61,113,106,128,53,171,125,35,7,65,
+	181,255,185,218,63,59,151,249,245,117,121,35,3,127,153,255,215,244,92,35,21,198,68,91,
+	10,118,87,111,100,12,33,61,251,105,58,224,146,24,238,132,139,102,136,122,59,67,22,183,
+	215,246,63,36,59,180,113,26,240,90,208,55,156,173,200,64,20,139,217,84,224,239,192,63,
+	104,37,41,162,229,0,104,117,168,215,1,126,0,12,3,6,69,164,44,229,18,1,240,58,
+	193,18,186,13,193,101,171,141,213,248,111,66,83,39,192,96,92,210,156,182,120,67,68,118,
+	138,186,255,81,149,250,203,67,142,34,239,127,200,118,88,18,192,226,242,146,136,188,159,128,
+	117,237,92,130,59,218,140,232,25,41,34,163,203,236,89,122,49,174,76,106,26,56,185,152,
+	78,99,195,48,202,143,54,223,102,137,200,34,17,121,23,87,191,254,45,96,65,10,250,181,
+	28,120,199,27,156,15,120,227,51,27,209,181,223,1,46,5,238,75,176,241,63,3,120,64,
+	68,254,157,175,241,31,33,3,128,243,129,127,3,103,225,28,51,70,48,186,3,39,3,79,
+	0,87,71,101,252,231,168,76,245,13,104,200,141,105,198,248,29,94,128,38,14,111,178,110,
+	77,0,174,11,112,222,142,170,218,39,64,255,251,4,236,255,117,197,54,254,227,232,127,30,
+	88,214,226,226,82,157,144,118,204,183,169,40,42,157,203,173,195,34,114,62,240,251,20,52,
+	117,184,25,255,134,97,36,206,1,208,104,49,157,239,235,9,63,6,188,71,58,66,202,22,
+	1,175,0,127,193,149,158,251,146,240,161,57,227,128,43,113,111,176,231,36,180,191,115,129,
+	71,69,228,95,34,50,61,161,109,28,138,115,160,220,11,156,74,250,178,180,22,146,118,192,
+	113,254,158,187,137,226,38,54,58,50,192,49,171,73,86,166,239,139,9,230,248,59,42,162,
+	99,178,254,59,75,177,255,97,169,176,219,184,184,118,80,66,218,81,99,83,81,84,178,101,
+	41,252,34,151,3,123,2,175,39,176,121,111,0,123,137,200,13,38,158,134,97,36,214,1,
+	208,104,65,157,139,11,127,127,12,87,230,110,89,10,250,185,0,120,30,87,39,251,73,92,
+	121,141,160,76,196,133,23,223,234,29,8,73,100,33,240,180,136,220,41,34,147,82,48,31,
+	21,184,146,147,55,0,143,224,18,217,117,183,219,241,27,134,255,119,252,61,118,55,110,43,
+	75,177,21,249,67,3,28,243,172,136,204,107,242,187,225,5,108,99,211,40,128,249,184,170,
+	28,81,244,45,200,49,79,21,33,207,70,107,107,245,124,191,222,69,209,183,176,84,218,237,
+	92,84,146,82,133,161,157,77,69,81,41,219,42,12,34,242,162,136,236,76,178,146,80,142,
+	22,145,157,68,228,5,19,77,195,48,138,65,40,229,76,68,20,152,169,170,179,113,201,247,
+	54,195,133,120,39,253,33,63,219,43,196,255,5,182,7,182,198,101,1,109,142,233,222,0,
+	251,56,193,253,89,134,219,146,240,161,136,164,213,195,191,33,112,24,46,122,225,67,85,253,
+	154,86,194,134,211,158,35,160,141,61,254,25,92,169,154,109,128,163,113,21,45,146,194,182,
+	1,142,121,34,129,67,254,36,174,92,98,107,108,21,224,58,91,7,252,174,36,246,255,224,
+	54,142,217,38,198,239,47,203,55,143,198,183,176,242,175,197,165,236,29,48,190,68,224,115,
+	192,229,49,175,121,173,241,17,112,186,136,60,107,34,105,24,70,81,215,196,136,140,154,74,
+	92,102,242,77,253,191,149,41,233,123,95,220,219,213,45,112,245,212,193,133,247,63,14,188,
+	155,224,182,215,225,50,234,191,39,34,177,239,177,141,40,9,96,83,22,3,175,225,42,40,
+	52,212,74,95,141,171,135,250,25,206,89,83,95,70,14,128,238,222,224,239,219,232,254,233,
+	3,236,134,219,123,190,78,76,74,81,144,68,160,221,129,121,1,46,87,43,34,83,27,245,
+	115,120,145,134,121,76,67,183,84,117,0,48,37,192,57,221,69,100,65,11,253,239,70,176,
+	61,204,255,235,127,130,228,45,104,255,123,196,17,189,160,170,155,227,66,112,141,226,144,148,
+	50,128,195,128,27,109,58,138,70,217,148,1,12,40,143,215,2,191,41,240,215,94,39,34,
+	167,219,232,27,134,145,4,34,49,212,69,100,53,48,89,85,191,2,106,189,35,160,15,249,
+	213,209,140,253,25,128,123,203,255,128,55,246,119,196,103,205,39,185,111,173,178,56,15,242,
+	219,34,178,44,165,50,183,204,143,247,99,126,188,155,202,227,122,184,183,224,211,113,101,29,
+	231,80,218,111,17,187,227,146,250,13,228,219,37,211,102,0,255,242,50,185,183,151,209,110,
+	69,104,99,255,0,199,76,77,154,241,235,215,166,169,170,58,153,182,147,78,246,167,229,4,
+	167,253,2,124,213,228,4,247,127,18,109,39,142,92,143,120,18,181,89,232,119,241,159,115,
+	73,89,231,140,226,177,218,134,224,27,235,226,233,170,250,23,224,116,224,103,49,127,221,61,
+	56,167,244,107,54,242,134,97,148,148,3,160,209,162,186,18,152,160,170,211,128,13,128,77,
+	188,49,151,228,215,182,245,192,36,111,108,38,185,118,231,120,220,219,156,133,41,149,181,85,
+	184,42,18,207,1,159,180,113,108,181,55,88,214,245,78,130,73,148,94,22,233,142,192,70,
+	184,173,51,29,219,80,224,167,3,183,123,71,192,110,192,118,5,118,4,244,13,112,204,172,
+	4,143,245,236,0,14,128,245,128,15,243,112,0,204,78,112,255,231,4,112,0,244,195,57,
+	23,163,198,146,0,22,151,164,84,97,176,92,16,197,197,170,48,124,91,95,253,8,248,185,
+	170,222,228,157,0,7,120,189,53,10,166,0,15,2,55,139,200,231,54,218,134,97,148,180,
+	3,160,209,194,186,28,248,72,85,167,248,5,117,99,160,87,194,199,34,169,198,255,100,224,
+	117,17,153,147,82,25,91,229,13,254,39,113,149,20,114,73,74,213,222,27,201,253,112,165,
+	28,39,225,18,30,166,153,78,184,40,153,13,129,14,57,158,251,185,31,135,183,112,97,213,
+	91,248,107,196,109,100,5,41,19,55,163,201,207,195,139,56,198,195,113,137,59,27,248,58,
+	192,57,235,182,242,183,32,14,144,175,19,44,115,65,218,214,55,166,239,174,183,199,108,81,
+	73,138,3,102,185,77,69,81,177,42,12,45,235,171,239,226,183,124,170,234,142,192,126,192,
+	230,192,238,184,23,88,65,248,204,27,253,111,2,15,137,200,59,54,178,134,97,148,157,3,
+	160,209,194,186,24,248,175,15,193,221,8,24,140,133,2,6,229,75,111,248,127,149,226,62,
+	212,123,195,255,222,60,13,129,14,192,16,160,175,170,78,245,70,240,98,154,113,218,20,59,
+	71,64,11,123,252,5,23,10,61,208,127,242,81,198,86,225,28,41,227,112,217,219,119,35,
+	216,27,234,124,8,162,4,77,79,176,28,6,185,135,90,203,177,176,118,68,223,145,214,254,
+	231,131,37,127,43,225,103,188,201,65,106,176,173,56,193,116,214,55,112,229,249,26,158,231,
+	235,226,94,94,213,250,127,87,249,231,247,42,92,238,162,153,192,23,34,50,203,70,207,48,
+	12,83,14,190,189,168,46,0,222,82,213,207,189,19,96,48,208,213,134,191,89,102,121,195,
+	127,106,9,244,69,112,213,22,50,184,210,145,83,201,47,210,162,11,107,18,77,78,242,215,
+	75,250,155,165,106,220,219,213,33,68,19,182,47,64,79,96,15,96,231,24,13,183,166,223,
+	89,234,104,200,191,229,114,76,18,251,214,64,92,111,234,205,240,40,46,73,201,159,98,207,
+	251,226,98,14,152,112,186,235,87,56,7,234,135,54,26,134,97,152,3,32,252,98,58,79,
+	85,95,199,133,50,111,130,219,30,208,201,166,1,112,9,200,222,16,145,79,75,168,79,25,
+	220,219,211,67,128,29,128,151,128,151,113,94,243,124,168,193,149,110,235,7,76,196,69,75,
+	172,76,96,223,251,1,235,19,236,13,114,16,186,121,163,127,127,130,135,38,70,65,144,249,
+	90,47,193,114,184,110,158,125,12,210,255,190,9,238,127,49,115,56,36,57,17,172,25,126,
+	133,93,15,141,226,177,208,134,192,48,12,195,40,138,3,192,59,1,0,102,171,234,203,192,
+	167,192,80,92,88,116,135,50,157,131,197,192,219,192,56,17,209,18,238,103,47,224,40,92,
+	68,192,203,184,48,187,217,17,92,179,59,46,145,222,231,184,125,232,197,206,118,156,1,214,
+	194,229,189,232,77,52,123,112,59,225,202,85,238,227,251,90,104,102,4,56,166,105,158,128,
+	49,20,177,12,96,147,159,131,68,73,124,21,242,111,185,124,71,177,200,183,255,249,96,217,
+	199,139,75,82,34,48,150,216,84,20,21,219,122,105,24,134,97,20,207,1,208,200,17,144,
+	5,102,168,234,44,92,2,149,161,184,82,92,213,101,50,246,43,128,247,128,247,125,25,197,
+	114,97,61,224,56,214,68,4,188,150,167,114,88,225,13,156,181,128,153,126,155,201,44,90,
+	72,54,152,111,142,128,22,246,248,55,176,22,46,215,197,122,68,243,198,171,10,216,22,56,
+	16,23,45,83,172,80,252,47,3,28,211,59,193,50,151,111,14,131,233,101,222,255,124,176,
+	36,128,197,197,170,48,24,69,213,245,12,195,48,12,123,40,52,103,144,213,3,83,85,117,
+	6,238,237,230,80,92,200,106,169,42,46,245,192,7,192,59,34,178,162,76,229,46,131,43,
+	75,54,8,216,5,87,26,240,221,8,28,1,235,122,35,124,6,46,71,192,108,226,127,3,
+	153,193,133,230,15,246,223,31,133,3,171,10,216,18,23,234,63,52,1,243,21,36,31,197,
+	0,85,29,144,180,220,21,170,58,0,151,192,41,159,62,6,233,83,109,202,251,63,45,166,
+	38,148,139,67,55,201,207,155,36,208,217,166,162,168,88,21,6,195,48,12,35,57,14,128,
+	70,142,128,58,224,51,85,253,194,27,134,67,113,111,118,75,41,1,217,56,224,45,95,29,
+	193,112,108,232,13,148,157,128,231,113,181,200,151,19,62,169,90,21,46,146,100,29,220,91,
+	205,137,192,92,226,73,210,86,131,123,51,63,208,127,111,190,84,224,182,14,28,136,43,67,
+	84,153,144,123,115,129,170,206,161,237,82,158,71,240,205,240,251,98,108,3,24,211,76,155,
+	218,98,150,136,44,108,165,255,11,125,164,82,239,28,251,159,4,130,244,127,182,79,212,26,
+	139,248,216,18,87,84,146,146,3,32,107,83,81,84,44,75,189,97,24,134,145,60,7,64,
+	35,101,123,5,240,177,170,78,243,198,213,16,220,91,221,52,43,146,159,227,18,252,205,51,
+	145,107,209,104,223,28,247,22,125,44,240,20,48,129,22,194,248,3,82,141,115,36,245,193,
+	189,221,156,132,75,180,24,5,157,189,209,63,8,232,24,145,145,52,0,87,214,111,27,146,
+	153,57,253,93,224,128,54,142,57,40,129,6,240,129,1,142,249,111,192,99,210,216,255,131,
+	2,28,243,94,140,223,191,10,163,152,36,101,45,89,100,83,81,84,38,218,16,24,134,97,
+	24,137,117,0,52,114,4,44,1,222,87,213,73,184,125,213,131,113,229,207,210,196,23,192,
+	107,34,50,211,68,45,176,178,186,13,206,233,243,54,46,71,192,231,228,23,198,223,129,53,
+	225,249,83,85,117,50,225,183,26,180,243,134,255,6,184,146,132,81,80,11,236,9,236,26,
+	145,51,33,46,30,13,96,0,239,171,170,61,154,56,186,10,25,5,240,13,227,91,85,123,
+	224,182,81,4,233,91,20,253,223,175,153,254,23,13,223,255,125,35,234,191,145,78,146,146,
+	125,127,186,77,69,81,249,175,13,129,97,24,134,145,52,229,160,53,71,192,34,17,121,7,
+	120,12,120,139,232,222,226,198,201,215,192,3,34,242,160,25,255,161,232,228,141,226,225,192,
+	241,222,232,206,55,2,164,11,176,41,176,59,46,204,62,151,242,147,213,184,114,126,251,224,
+	202,15,70,97,252,247,2,126,0,140,240,70,106,199,132,207,201,131,1,142,169,4,206,79,
+	80,155,207,39,88,46,145,251,3,28,243,64,128,99,42,18,216,255,202,136,250,22,150,42,
+	140,98,146,148,4,179,227,109,42,138,198,155,182,237,208,48,12,195,248,134,125,157,182,6,
+	171,106,79,96,19,220,222,241,164,37,22,154,11,188,46,34,147,74,73,72,180,141,212,247,
+	5,96,1,240,42,46,34,224,139,40,186,4,204,3,166,248,235,173,224,219,57,2,196,27,
+	79,125,113,111,252,215,138,168,47,107,1,59,123,163,191,232,165,153,36,135,178,8,170,250,
+	58,176,99,128,67,135,224,182,112,52,38,238,40,128,166,161,247,131,3,26,29,111,136,200,
+	78,81,247,95,68,38,20,249,158,141,188,255,33,219,177,125,192,49,51,226,225,25,17,249,
+	56,33,207,145,249,184,132,169,70,97,185,64,68,46,182,97,48,12,195,48,26,200,164,173,
+	193,34,50,23,120,5,23,17,48,22,88,150,128,102,45,4,158,22,145,59,75,205,248,79,
+	8,221,128,67,128,223,0,199,224,194,249,243,145,93,193,109,39,217,6,23,122,63,144,111,
+	102,43,111,168,40,176,187,55,94,242,53,254,197,247,225,80,96,36,174,12,98,26,235,50,
+	63,17,240,184,243,2,24,232,113,26,255,45,181,161,57,30,207,225,123,30,207,163,255,133,
+	38,142,254,135,161,206,150,175,162,63,155,146,194,179,54,29,69,225,110,27,2,195,48,12,
+	163,169,97,146,90,84,53,227,13,181,77,113,123,169,11,93,114,106,57,110,175,250,71,190,
+	156,97,73,146,128,8,128,166,124,1,188,8,188,70,52,91,66,178,184,44,201,19,113,33,
+	179,235,227,222,252,71,113,127,116,244,142,134,67,112,213,9,146,181,0,228,22,1,208,195,
+	143,83,144,176,250,147,69,228,143,205,92,99,120,196,237,31,211,204,119,252,10,248,67,192,
+	121,95,71,68,102,7,236,127,47,220,246,158,208,253,47,208,253,26,180,255,245,192,218,222,
+	169,26,87,91,54,0,14,182,71,109,209,248,163,175,176,147,132,231,200,15,129,127,216,148,
+	20,148,7,68,228,104,27,6,195,48,12,163,100,28,0,141,20,139,74,111,92,109,10,172,
+	71,252,201,13,235,128,247,129,247,146,162,92,149,153,3,160,129,79,129,23,112,89,204,163,
+	200,50,189,26,183,21,32,138,125,203,149,192,246,184,92,6,155,38,118,1,200,193,1,224,
+	101,225,74,92,20,67,16,246,22,145,231,227,114,2,180,96,252,239,77,240,55,141,87,137,
+	200,153,49,246,127,31,17,121,174,192,247,106,172,253,15,209,158,158,184,60,30,70,225,249,
+	90,68,238,77,216,179,100,54,109,151,19,53,162,227,112,17,121,196,134,193,48,12,195,40,
+	57,7,64,35,229,162,33,75,251,80,92,249,183,168,183,56,100,113,219,14,222,18,145,101,
+	229,34,36,9,118,0,128,115,198,76,240,70,207,135,184,253,252,197,164,2,151,100,240,96,
+	47,135,137,78,130,22,194,1,208,9,23,41,177,118,128,195,167,1,187,138,200,23,205,92,
+	7,194,231,5,24,211,92,179,85,181,31,46,87,68,191,0,215,152,5,12,18,145,165,33,
+	250,63,9,232,157,79,255,99,186,79,251,225,182,71,5,137,52,153,9,172,159,107,255,67,
+	182,235,36,146,89,218,178,212,121,67,68,222,74,216,179,228,34,146,149,40,179,148,153,44,
+	34,131,108,24,12,195,48,140,166,100,74,169,51,34,178,82,68,198,227,246,42,191,232,149,
+	220,168,140,215,9,192,29,34,242,66,57,25,255,41,160,26,216,12,56,217,27,148,219,0,
+	237,139,33,126,184,228,119,167,0,103,1,91,82,130,25,208,189,193,120,117,192,195,251,3,
+	175,170,234,62,45,25,242,228,150,27,160,197,227,253,155,239,87,2,26,255,0,87,135,49,
+	126,253,57,163,115,236,255,222,5,48,172,246,193,57,63,250,199,217,255,144,124,129,81,12,
+	62,77,96,155,174,240,207,101,35,126,254,96,67,96,24,134,97,180,100,180,148,44,170,218,
+	5,87,45,96,8,225,195,14,39,227,50,251,207,41,87,33,73,120,4,64,83,150,1,31,
+	1,207,227,156,54,117,68,231,4,106,142,134,237,39,7,0,91,147,91,121,193,36,24,244,
+	18,82,38,38,0,27,229,112,202,55,246,196,183,34,82,195,155,49,250,155,107,119,227,182,
+	4,221,243,222,192,4,17,25,146,231,61,49,30,87,105,32,84,255,35,190,63,11,222,255,
+	28,219,55,4,87,245,194,40,28,19,69,228,177,132,62,79,78,0,254,100,83,20,43,83,
+	68,100,160,13,131,97,24,134,81,118,14,128,70,10,71,55,111,172,12,38,120,246,245,175,
+	128,215,68,228,171,114,23,146,148,57,0,26,59,2,222,246,142,128,137,184,132,103,81,179,
+	30,176,55,110,159,127,251,84,46,0,225,29,0,123,224,242,47,228,194,157,192,168,168,74,
+	228,249,82,119,231,145,251,30,243,102,115,19,228,248,221,123,122,217,74,99,255,247,20,145,
+	23,11,188,134,156,8,116,176,71,110,193,120,68,68,38,39,248,153,114,7,150,27,34,78,
+	126,36,34,119,216,48,24,134,97,24,101,235,0,104,164,116,244,192,237,207,222,16,232,218,
+	194,97,179,189,225,63,213,196,35,213,14,128,6,230,3,111,0,47,225,246,100,71,209,151,
+	181,128,61,188,225,223,35,213,11,64,72,7,128,151,139,83,129,27,66,156,122,29,112,177,
+	136,204,207,227,62,62,31,248,117,136,211,79,21,145,155,34,186,47,194,246,255,122,223,255,
+	121,33,191,183,187,239,255,111,66,156,126,154,136,220,88,132,53,100,71,92,82,76,35,126,
+	22,137,200,223,18,254,76,169,198,109,217,217,206,166,43,114,254,38,34,63,179,97,48,12,
+	195,48,204,1,176,70,241,0,151,192,107,19,96,3,92,153,54,112,229,228,222,16,145,79,
+	77,44,74,202,1,208,192,215,184,61,210,47,225,156,60,97,232,10,236,10,236,71,176,36,
+	120,37,237,0,240,178,113,13,112,122,136,83,179,192,83,192,147,192,67,109,57,220,84,117,
+	0,112,4,112,144,31,255,138,16,223,121,173,136,156,17,241,189,17,182,255,245,192,127,66,
+	244,255,64,220,118,147,76,18,250,159,195,56,85,2,63,109,180,222,26,241,241,138,136,188,
+	151,130,231,202,0,92,190,158,141,109,202,34,227,77,96,103,17,201,218,80,24,134,97,24,
+	230,0,248,182,242,145,1,214,241,142,128,153,192,56,123,104,150,180,3,160,129,233,192,203,
+	192,235,64,208,188,14,157,113,111,47,15,32,120,146,185,178,112,0,120,249,184,23,56,38,
+	207,203,76,198,57,102,190,198,109,191,81,160,175,191,71,123,3,181,121,94,255,65,17,57,
+	42,166,251,227,126,32,223,107,79,193,85,38,104,232,63,192,186,190,255,107,225,170,155,228,
+	195,125,34,114,76,145,215,145,161,192,62,182,162,198,74,226,223,254,55,145,137,254,192,189,
+	192,14,54,117,121,243,9,112,160,136,76,179,161,48,12,195,48,204,1,96,152,3,224,155,
+	100,189,193,249,42,240,22,46,250,35,219,204,189,209,14,23,162,186,55,185,37,124,43,43,
+	7,128,151,145,7,128,35,19,218,205,7,128,99,226,114,240,121,103,226,125,9,238,255,131,
+	192,209,34,162,9,88,75,14,40,213,123,41,33,252,199,87,194,73,211,243,37,3,252,25,
+	23,33,98,132,227,109,191,198,217,214,69,195,48,12,195,28,0,134,57,0,90,235,26,240,
+	57,240,44,240,30,176,196,255,190,161,180,224,65,184,10,18,153,146,93,0,34,114,0,120,
+	57,9,27,14,31,39,5,11,123,47,247,254,7,28,163,10,224,187,148,200,22,154,132,241,
+	137,136,60,157,226,231,204,15,129,81,228,31,237,83,110,220,9,252,92,68,234,108,40,12,
+	195,48,12,115,0,24,230,0,8,198,42,96,60,240,28,174,108,224,94,184,146,126,153,146,
+	95,0,34,116,0,120,89,25,6,220,152,144,238,21,60,225,93,194,250,31,89,194,195,136,
+	199,168,11,46,159,65,15,140,168,248,26,248,87,18,162,60,34,144,143,145,192,201,228,191,
+	237,165,212,153,9,156,43,34,183,217,80,24,134,97,24,230,0,48,204,1,16,142,21,254,
+	223,246,101,179,0,68,236,0,240,242,178,55,112,19,46,122,162,24,76,0,126,37,34,47,
+	20,233,126,217,11,248,3,197,11,117,31,15,156,146,111,169,195,2,56,1,14,194,229,56,
+	48,242,99,30,46,145,228,226,18,123,238,28,134,219,22,112,148,77,241,55,152,3,220,12,
+	92,33,34,203,108,56,12,195,48,12,115,0,24,230,0,48,138,234,0,104,36,55,103,2,
+	35,112,73,236,10,193,44,96,180,136,92,149,144,251,230,76,224,183,184,36,134,133,96,182,
+	239,255,149,41,89,87,4,216,23,203,2,159,15,51,129,199,75,205,248,111,34,39,27,1,
+	223,3,14,166,124,147,5,46,192,109,85,251,183,136,220,97,98,111,24,134,97,152,3,192,
+	48,7,128,145,56,7,128,151,157,78,192,133,192,25,196,183,165,162,30,184,6,184,72,68,
+	150,38,236,222,233,4,92,224,29,1,113,245,63,11,92,157,196,254,7,28,163,33,192,142,
+	184,50,155,70,112,38,0,207,136,72,125,25,61,139,186,0,91,1,235,227,28,107,29,128,
+	213,192,124,160,6,151,184,117,37,176,16,232,14,84,2,203,253,239,186,250,123,176,33,215,
+	75,103,127,239,44,242,231,37,241,90,211,129,241,34,50,214,196,221,48,12,195,48,7,128,
+	97,14,0,35,241,14,128,70,50,212,27,56,9,247,22,111,199,136,46,251,6,240,56,240,
+	7,17,153,147,240,123,104,45,224,87,49,245,255,22,17,153,85,2,235,204,214,192,230,230,
+	8,104,147,101,192,235,34,50,206,134,194,48,12,195,48,12,115,0,24,230,0,48,18,231,
+	0,104,34,79,125,112,251,122,15,197,37,91,12,26,34,63,11,248,47,240,40,240,128,136,
+	124,149,210,251,169,15,112,180,239,255,86,57,244,127,102,147,254,207,40,209,245,102,32,176,
+	9,238,45,175,177,134,229,192,71,192,59,34,178,218,134,195,48,12,195,48,12,115,0,24,
+	134,145,70,131,175,27,208,207,127,250,226,74,196,169,55,120,191,194,133,193,78,21,145,133,
+	37,218,255,26,96,0,176,30,176,174,239,191,224,50,187,55,244,127,154,136,44,40,67,185,
+	216,8,87,22,174,92,147,5,174,4,190,0,38,137,200,120,91,45,12,195,48,12,195,48,
+	7,128,97,24,134,81,234,206,128,106,92,50,201,26,220,254,234,74,220,62,233,149,184,253,
+	213,21,184,92,16,13,63,103,112,123,176,235,129,106,255,172,91,229,47,87,133,115,48,213,
+	249,243,146,120,173,37,192,124,17,153,107,179,111,24,134,97,24,134,97,24,134,97,24,134,
+	97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,
+	97,24,134,97,24,134,97,24,134,97,24,134,97,24,134,145,27,221,187,119,111,95,91,91,
+	219,251,198,27,111,220,84,85,119,188,242,202,43,7,215,214,214,246,168,169,169,169,74,106,
+	155,85,181,163,170,158,160,170,47,169,234,231,170,122,173,170,14,41,183,185,83,213,77,84,
+	245,114,85,253,64,85,223,82,213,115,85,117,64,41,246,53,99,183,170,97,24,134,97,24,
+	134,97,24,134,97,148,62,86,5,192,48,12,195,48,12,195,48,140,196,211,189,123,247,76,
+	77,77,77,37,174,114,74,133,183,101,164,25,251,70,253,39,219,232,179,122,254,252,249,245,
+	11,23,46,204,198,212,182,142,163,70,141,218,239,148,83,78,57,69,68,118,6,58,3,115,
+	84,245,137,209,163,71,255,233,210,75,47,125,115,225,194,133,117,73,27,83,85,93,11,248,
+	21,112,4,208,19,120,5,184,77,68,94,44,39,217,82,213,125,129,227,129,157,113,21,123,
+	94,0,254,38,34,111,155,3,192,48,12,195,48,12,195,48,12,35,94,99,31,111,236,183,
+	199,149,82,109,55,98,196,136,238,167,156,114,202,64,160,214,27,171,29,113,101,85,43,26,
+	157,154,193,149,91,93,6,44,197,149,86,157,11,204,24,61,122,244,140,155,111,190,121,33,
+	174,4,107,29,176,114,254,252,249,43,23,46,92,88,159,103,91,43,71,141,26,117,244,176,
+	97,195,126,15,108,222,140,113,249,204,232,209,163,47,186,244,210,75,95,93,184,112,161,38,
+	200,232,61,30,184,9,87,102,183,41,247,1,191,16,145,69,37,110,248,247,6,110,7,14,
+	104,225,144,191,3,167,136,200,50,187,43,13,195,48,12,195,48,12,195,48,162,53,252,171,
+	106,107,107,187,221,120,227,141,235,101,179,217,221,178,217,236,233,217,108,246,174,108,54,59,
+	78,85,151,104,126,172,202,102,179,51,178,217,236,43,217,108,246,150,108,54,251,203,43,175,
+	188,114,219,218,218,218,117,107,107,107,123,212,214,214,182,171,169,169,201,185,205,151,94,122,
+	233,70,170,122,119,43,223,187,50,155,205,94,112,246,217,103,119,76,144,225,59,50,192,120,
+	189,171,170,61,75,216,248,239,165,170,159,6,24,135,231,85,181,218,238,78,195,48,12,195,
+	48,12,195,48,140,104,12,255,118,181,181,181,189,110,188,241,198,189,178,217,236,245,217,108,
+	246,83,85,93,165,241,179,60,155,205,126,156,205,102,255,172,170,223,185,242,202,43,251,214,
+	214,214,118,170,169,169,201,4,108,183,220,120,227,141,191,80,213,201,109,124,207,191,206,62,
+	251,236,205,18,98,248,158,157,195,248,124,224,183,9,148,162,3,224,222,28,198,225,2,187,
+	75,75,28,85,173,84,213,31,169,234,131,94,56,238,80,213,191,170,234,141,170,122,165,170,
+	158,174,170,199,169,234,150,170,218,203,70,172,100,201,0,67,128,67,128,131,112,225,65,251,
+	1,123,2,187,2,91,1,27,1,107,1,29,108,184,12,195,48,12,195,48,114,50,252,43,
+	252,27,255,131,179,217,236,61,170,58,91,139,71,93,54,155,125,91,85,135,251,12,254,29,
+	107,106,106,90,221,50,125,233,165,151,118,203,102,179,99,84,181,190,141,107,191,114,246,217,
+	103,239,147,0,27,231,188,16,227,50,86,85,215,46,49,91,111,168,170,102,115,24,131,133,
+	170,218,185,20,250,94,105,203,78,139,236,8,140,1,186,225,146,136,252,79,94,88,147,92,
+	36,11,172,0,230,171,234,60,96,34,240,14,46,105,196,88,96,177,136,165,89,72,57,235,
+	0,123,224,246,158,209,130,28,40,110,175,217,10,96,37,176,16,152,9,124,137,219,115,86,
+	103,195,104,24,134,97,24,134,241,45,227,191,195,168,81,163,54,58,229,148,83,126,36,34,
+	223,3,250,22,185,73,85,34,178,45,176,237,136,17,35,254,59,98,196,136,91,70,143,30,
+	253,228,165,151,94,250,245,194,133,11,87,182,112,206,230,34,50,148,54,170,171,121,3,186,
+	119,145,141,222,139,128,243,67,156,58,20,120,65,85,247,22,145,25,37,34,126,71,146,91,
+	62,188,174,192,94,192,35,230,0,40,93,6,2,93,252,255,27,11,135,52,250,55,131,203,
+	240,217,25,232,135,75,250,113,4,46,225,200,103,192,99,170,122,31,240,137,136,172,182,33,
+	77,37,93,113,201,101,154,210,88,14,26,100,161,202,203,76,47,96,16,46,193,204,2,96,
+	138,151,135,249,56,167,145,97,24,134,97,24,70,57,27,254,82,83,83,211,101,196,136,17,
+	7,13,27,54,108,4,176,109,210,218,40,34,91,1,99,70,140,24,241,2,112,253,205,55,
+	223,252,210,252,249,243,151,54,147,196,175,7,208,61,192,37,187,121,189,178,88,198,255,37,
+	192,57,121,92,98,8,240,188,170,238,35,34,95,150,128,24,14,13,113,206,102,165,224,0,
+	200,96,180,196,179,192,100,190,249,246,191,205,181,2,151,133,180,43,176,53,240,123,224,101,
+	224,41,85,61,88,85,69,85,105,238,99,36,150,47,112,111,244,115,126,110,120,199,65,111,
+	255,80,59,6,248,14,46,107,173,97,24,134,97,24,70,185,26,255,153,81,163,70,173,51,
+	105,210,164,211,134,13,27,118,85,18,141,255,70,84,139,200,254,35,71,142,188,113,210,164,
+	73,39,159,115,206,57,235,214,212,212,84,52,57,166,11,238,101,96,91,14,133,206,221,187,
+	119,239,210,214,150,130,152,140,255,43,243,52,254,27,24,236,157,0,253,74,64,20,195,68,
+	99,116,41,133,123,208,28,0,45,243,21,112,40,240,4,46,180,59,87,43,93,112,17,22,
+	53,192,222,192,67,184,237,1,123,218,208,166,138,165,56,79,223,20,92,152,127,216,251,172,
+	26,88,207,203,212,247,252,255,13,195,48,12,195,48,202,205,248,95,239,148,83,78,57,67,
+	68,206,192,69,208,166,129,129,34,114,246,200,145,35,207,57,231,156,115,134,214,212,212,52,
+	142,14,13,26,1,208,126,196,136,17,107,157,114,202,41,5,53,34,85,245,26,96,100,132,
+	151,220,208,59,1,6,164,92,28,195,68,229,86,152,3,160,244,153,0,28,7,92,134,11,
+	223,206,135,74,92,84,192,179,184,168,128,45,108,120,83,195,124,156,35,232,109,156,51,40,
+	223,123,174,55,110,223,209,119,113,219,5,12,195,48,12,195,40,34,141,162,50,187,168,234,
+	96,85,221,83,85,127,160,170,191,85,213,203,84,181,71,75,81,156,22,201,25,216,248,151,
+	81,163,70,173,115,202,41,167,156,44,34,63,243,134,115,170,186,0,156,52,98,196,136,203,
+	207,57,231,156,157,106,106,106,218,117,239,222,157,26,87,55,48,168,81,223,171,80,253,246,
+	145,199,99,128,211,99,184,252,250,222,9,80,155,98,145,12,243,98,175,36,146,187,89,14,
+	128,150,102,215,39,239,83,213,37,192,165,192,135,192,77,228,159,156,36,131,203,30,255,54,
+	240,23,224,2,17,153,105,35,158,120,86,249,57,155,131,139,226,200,55,11,168,0,235,226,
+	162,1,62,6,222,0,150,217,48,27,101,164,108,87,224,146,107,86,3,237,129,142,64,39,
+	175,68,213,248,223,11,208,7,231,52,235,228,143,175,240,31,105,242,32,174,240,207,180,74,
+	214,68,96,101,252,239,51,77,126,110,248,180,247,138,216,218,172,217,194,213,248,211,160,32,
+	52,254,40,46,201,231,60,156,67,176,241,223,178,192,106,255,111,227,159,213,255,187,186,137,
+	194,209,56,137,104,61,46,137,232,82,96,22,48,195,255,173,14,183,13,105,177,255,219,50,
+	255,189,117,192,74,17,169,79,185,40,52,29,247,42,63,87,213,254,211,48,215,29,253,167,
+	170,201,252,75,51,215,203,176,230,5,71,166,201,177,77,127,110,144,149,6,25,164,153,227,
+	26,207,85,150,53,17,129,13,115,177,186,209,223,155,30,215,248,103,252,191,141,175,209,84,
+	22,26,228,97,149,191,254,178,70,191,171,243,159,213,254,239,77,229,210,104,125,205,233,234,
+	215,147,117,219,248,183,165,231,251,129,192,190,254,222,55,66,48,98,196,136,158,195,134,13,
+	251,37,240,11,32,173,181,229,51,34,114,240,200,145,35,59,1,151,119,236,216,241,149,97,
+	195,134,53,60,159,130,208,3,151,11,32,118,227,223,219,45,39,199,248,53,3,89,147,24,
+	112,82,185,152,136,230,0,40,31,71,64,22,120,72,85,103,0,79,19,77,2,143,42,224,
+	36,224,71,170,122,43,112,30,176,164,37,71,132,145,12,253,1,152,228,149,240,35,105,62,
+	57,96,24,135,208,166,184,196,42,99,129,215,189,98,103,24,165,164,116,175,139,75,182,179,
+	11,176,61,46,26,42,45,101,51,27,18,124,54,166,38,65,227,187,28,120,15,120,11,120,
+	21,24,7,124,37,34,139,18,54,142,213,222,137,211,211,27,89,235,224,202,167,166,69,15,
+	145,70,142,166,198,125,74,10,171,129,217,192,215,56,231,209,92,255,172,170,43,161,181,164,
+	165,63,117,13,96,212,183,102,216,7,101,43,224,25,115,2,132,163,123,247,238,29,106,106,
+	106,142,247,198,127,41,212,148,223,99,228,200,145,245,222,152,207,37,154,51,232,118,129,124,
+	238,149,12,112,179,183,51,226,102,128,119,2,236,35,34,159,165,108,14,195,36,104,47,137,
+	232,121,115,0,228,198,46,17,60,64,154,210,17,248,13,240,67,224,18,224,239,184,204,241,
+	70,114,89,183,25,131,32,138,123,113,75,92,114,149,183,129,79,112,111,3,13,35,77,202,
+	121,53,46,209,229,225,192,47,189,98,80,109,163,19,43,29,252,179,105,23,26,133,121,170,
+	106,29,48,21,184,21,120,24,151,199,164,174,64,78,229,10,92,36,199,32,156,131,179,11,
+	37,178,111,50,225,250,92,131,161,187,85,163,223,215,227,162,71,198,226,28,216,139,9,159,
+	207,166,208,6,126,13,193,222,216,119,42,96,51,205,9,16,206,248,175,24,53,106,212,1,
+	195,134,13,251,33,165,149,3,105,111,85,173,20,145,92,116,194,90,98,204,123,224,141,255,
+	91,128,19,10,56,14,253,88,83,29,96,130,73,188,57,0,74,73,185,237,11,140,34,62,
+	207,79,47,224,106,224,71,184,44,157,79,53,60,16,45,10,32,81,116,6,118,36,190,16,
+	160,14,192,110,184,136,128,215,189,2,111,24,73,90,11,171,88,19,165,82,3,236,12,28,
+	128,139,138,233,111,35,148,24,170,113,137,154,174,242,31,128,105,170,250,160,127,190,188,198,
+	154,10,39,85,34,146,107,228,81,134,53,97,237,213,222,16,27,128,219,23,218,197,134,63,
+	49,84,224,222,80,238,234,63,120,39,192,68,255,124,153,193,154,40,129,198,115,26,167,129,
+	95,211,134,81,223,240,255,142,9,29,83,115,2,228,200,136,17,35,250,15,27,54,236,104,
+	162,201,246,223,176,181,170,241,214,43,104,126,27,76,195,22,159,198,219,137,34,69,68,182,
+	207,229,186,34,178,78,247,238,221,215,174,169,169,145,102,202,9,230,123,143,85,0,127,2,
+	126,86,132,105,238,203,154,237,0,159,164,68,52,195,56,67,45,2,160,76,148,221,134,201,
+	254,51,241,123,153,43,112,161,177,247,226,246,237,92,42,34,75,109,22,18,131,0,251,16,
+	253,219,255,230,190,167,55,112,16,46,247,196,219,216,182,0,35,25,235,161,120,89,220,4,
+	248,29,206,97,105,164,135,254,192,175,253,7,224,31,192,255,1,31,171,170,136,72,46,202,
+	104,22,23,202,186,45,206,97,105,164,135,46,184,136,179,45,253,207,227,113,85,138,230,69,
+	188,94,128,139,110,60,140,111,134,226,119,44,129,49,52,39,64,64,186,119,239,94,81,83,
+	83,179,7,176,67,30,151,105,200,137,177,124,254,252,249,115,22,44,88,240,37,46,87,202,
+	44,156,67,171,33,47,134,54,50,198,235,113,47,85,250,3,67,122,244,232,209,175,166,166,
+	166,139,255,93,251,8,13,185,246,57,30,95,61,114,228,200,30,243,231,207,239,124,249,229,
+	151,47,142,240,126,171,244,182,202,143,139,56,221,235,176,102,59,192,216,52,168,53,33,117,
+	116,115,0,148,129,241,143,87,114,247,47,160,145,217,21,24,1,108,174,170,167,137,200,100,
+	155,141,68,48,4,247,134,171,80,84,227,28,66,189,128,23,128,69,54,5,70,145,215,67,
+	245,202,252,195,54,34,37,193,143,252,231,112,224,145,28,35,206,6,122,89,48,74,227,217,
+	54,4,87,242,54,106,125,99,95,224,216,18,29,55,115,2,4,96,196,136,17,125,134,13,
+	27,182,59,46,34,41,87,86,207,159,63,127,238,130,5,11,198,2,207,1,47,140,30,61,
+	122,220,205,55,223,188,48,68,59,106,79,57,229,148,93,128,189,122,244,232,177,67,77,77,
+	77,195,246,145,118,133,54,234,84,181,147,119,68,44,142,232,122,149,192,237,192,247,19,48,
+	229,189,129,231,84,117,95,17,249,208,28,0,201,196,202,0,182,54,195,78,17,170,5,110,
+	43,194,132,87,225,50,206,222,175,170,219,217,108,20,157,174,184,183,255,197,184,71,7,0,
+	135,224,50,149,27,70,49,57,218,140,255,146,228,97,63,183,65,217,192,140,255,146,228,48,
+	63,183,70,238,78,128,30,54,20,45,210,144,232,56,87,195,108,233,252,249,243,223,61,247,
+	220,115,79,30,52,104,208,190,131,6,13,186,108,208,160,65,175,133,49,254,1,70,143,30,
+	61,101,208,160,65,119,14,26,52,232,132,75,46,185,228,128,201,147,39,255,122,242,228,201,
+	15,47,92,184,112,50,238,5,203,234,2,142,73,123,114,143,28,104,201,248,175,2,254,153,
+	16,227,191,129,181,128,103,85,117,203,132,203,102,217,110,1,48,7,64,235,55,85,7,224,
+	93,138,23,41,81,129,11,209,251,167,170,238,98,245,102,139,70,37,174,92,95,177,238,23,
+	241,139,233,1,184,240,73,35,190,123,190,191,170,238,230,63,182,159,189,177,16,58,135,232,
+	119,109,36,74,150,239,230,240,246,223,140,196,210,37,234,185,45,7,133,101,43,224,25,85,
+	237,209,88,79,107,250,41,71,124,248,255,166,184,4,199,129,141,50,85,157,59,111,222,188,
+	191,156,123,238,185,63,190,249,230,155,31,140,186,93,163,71,143,254,202,59,3,142,187,228,
+	146,75,14,153,60,121,242,21,11,23,46,124,11,87,234,121,101,220,114,43,34,21,81,232,
+	148,170,90,13,220,13,28,147,192,233,239,229,157,0,91,151,154,58,100,14,128,210,54,4,
+	4,87,90,169,71,2,4,109,125,92,20,194,166,54,51,69,225,251,68,228,169,205,147,110,
+	184,80,195,158,54,37,145,223,239,199,169,234,91,184,164,88,47,249,207,84,85,125,75,85,
+	143,179,17,250,31,211,109,8,108,110,105,166,100,173,81,50,216,220,230,225,4,192,34,1,
+	190,193,136,17,35,250,13,27,54,108,243,28,198,165,94,85,39,207,159,63,255,162,243,206,
+	59,239,188,155,111,190,249,211,184,219,56,122,244,232,241,131,6,13,186,236,146,75,46,57,
+	124,242,228,201,191,90,176,96,193,195,126,61,92,17,179,19,32,95,189,165,29,46,103,216,
+	81,9,22,129,30,56,231,88,82,35,153,45,2,192,248,22,15,144,156,196,70,2,108,132,
+	43,235,177,150,191,241,109,134,10,195,33,196,92,175,53,132,19,96,111,210,83,67,61,13,
+	198,255,40,156,7,189,185,7,212,118,192,221,254,24,3,174,180,33,176,185,197,69,198,25,
+	165,137,205,173,57,1,162,100,51,96,227,224,143,99,157,56,127,254,252,81,231,157,119,222,
+	45,97,67,253,243,112,4,204,29,52,104,208,253,151,93,118,217,113,83,166,76,249,158,119,
+	4,204,33,166,36,204,249,232,241,222,248,191,15,56,34,5,50,208,29,120,90,85,119,74,
+	162,10,88,174,55,166,57,0,154,191,177,198,0,223,73,224,92,237,0,140,38,254,44,244,
+	134,99,15,92,244,69,146,16,92,150,213,93,237,254,141,228,94,255,1,112,110,128,67,207,
+	245,199,150,53,34,50,27,87,157,194,40,45,14,242,115,27,148,229,192,67,54,108,37,199,
+	67,126,110,77,193,54,39,64,254,86,159,11,255,223,132,224,219,74,230,45,88,176,224,250,
+	243,207,63,255,142,155,111,190,121,85,12,237,145,218,218,218,142,181,181,181,189,107,107,107,
+	215,173,173,173,237,83,91,91,219,171,182,182,182,155,255,125,85,77,77,77,230,170,171,174,
+	210,129,3,7,190,118,217,101,151,253,114,202,148,41,167,47,92,184,240,77,92,5,130,40,
+	117,15,205,227,220,246,184,151,148,135,166,72,28,106,128,167,84,117,215,18,112,0,84,152,
+	3,160,244,140,129,62,170,122,59,112,106,66,155,88,1,28,7,156,13,84,88,20,64,108,
+	116,194,85,125,216,34,169,118,24,46,34,100,91,74,100,47,82,145,238,247,238,192,245,57,
+	156,114,189,63,167,220,157,0,79,2,151,152,4,149,12,151,248,57,205,149,169,184,18,165,
+	70,105,240,182,159,83,195,156,0,145,48,98,196,136,117,134,13,27,54,24,23,185,216,22,
+	217,249,243,231,255,231,188,243,206,123,241,166,155,110,202,198,225,140,24,53,106,84,159,73,
+	147,38,253,112,210,164,73,183,79,154,52,233,217,73,147,38,61,50,105,210,164,91,39,77,
+	154,116,222,164,73,147,126,50,105,210,164,189,207,57,231,156,141,107,107,107,251,215,214,214,
+	174,247,175,127,253,171,195,94,123,237,245,228,29,119,220,113,150,170,62,164,170,81,150,229,
+	14,165,187,249,220,100,15,1,7,167,80,36,186,0,79,168,234,238,9,106,83,182,92,239,
+	79,43,3,184,230,166,26,128,171,135,124,92,194,141,170,118,192,233,184,48,189,199,114,44,
+	219,100,4,91,160,118,241,6,118,146,169,240,74,198,44,96,138,77,91,40,174,193,37,169,
+	9,74,47,127,206,207,204,9,32,231,249,183,16,35,76,140,82,205,104,17,57,47,143,243,
+	95,247,107,209,214,54,148,169,230,61,63,151,70,244,78,128,114,46,17,56,152,128,81,148,
+	170,58,227,170,171,174,122,250,166,155,110,26,23,147,51,162,246,148,83,78,25,33,34,199,
+	123,61,175,129,109,26,31,55,114,228,72,29,49,98,196,114,63,103,51,128,47,128,73,192,
+	135,184,45,184,123,17,205,27,96,201,213,214,80,213,142,222,248,223,55,197,50,209,217,59,
+	1,14,21,145,231,147,96,254,133,56,167,36,94,158,151,189,3,192,191,69,239,1,140,193,
+	133,211,164,193,154,238,230,157,21,255,5,190,178,231,108,100,180,199,133,253,15,76,73,123,
+	219,121,103,197,108,96,169,77,95,78,247,253,143,129,159,134,56,245,167,170,250,188,136,220,
+	110,78,0,25,169,170,207,120,133,164,157,73,85,170,88,9,28,33,34,79,69,112,173,87,
+	188,146,124,40,37,18,26,89,70,212,3,143,18,239,155,255,168,67,21,63,3,26,202,182,
+	213,121,163,108,19,160,175,57,1,18,199,70,65,29,0,11,22,44,120,113,225,255,183,119,
+	230,225,117,85,85,255,255,172,164,45,20,40,105,202,40,8,148,58,128,162,56,160,2,226,
+	128,128,12,226,244,115,64,17,68,156,33,5,149,215,84,212,22,133,183,5,94,201,117,132,
+	70,28,16,94,65,4,5,125,85,64,6,145,73,64,69,102,144,185,105,197,66,153,122,115,
+	59,15,73,214,239,143,125,34,151,244,38,185,231,142,231,156,251,253,60,207,125,146,220,156,
+	97,159,189,247,57,103,175,239,94,123,173,66,225,175,245,40,68,103,103,231,132,142,142,142,
+	119,155,217,251,71,24,255,163,188,218,108,19,96,19,224,197,148,142,13,212,140,49,203,166,
+	192,229,209,24,181,89,20,47,131,216,164,138,227,108,66,152,192,124,175,153,253,41,1,207,
+	192,150,164,101,5,128,34,247,249,77,128,83,8,193,222,210,164,234,236,10,124,149,224,13,
+	208,178,29,184,198,247,194,158,145,241,159,38,151,138,78,194,82,128,27,105,225,96,38,49,
+	239,253,151,17,102,242,43,229,59,238,126,171,153,61,34,17,192,174,2,54,118,247,243,129,
+	35,213,187,82,193,5,102,246,241,26,31,115,17,48,159,176,116,106,87,85,113,42,120,16,
+	184,58,37,101,189,21,56,7,248,61,65,240,46,197,43,128,131,129,111,145,172,56,73,45,
+	41,2,116,118,118,182,117,116,116,188,136,40,112,245,56,239,228,53,61,61,61,183,247,246,
+	246,62,80,143,178,116,119,119,191,120,230,204,153,123,16,226,39,165,113,204,178,9,112,37,
+	33,246,83,181,247,252,63,139,254,142,155,61,224,26,224,31,69,247,215,55,170,40,203,100,
+	224,247,238,190,191,153,201,251,72,2,64,67,7,174,184,123,27,112,44,240,41,210,55,115,
+	49,129,144,158,238,82,224,6,117,229,234,186,3,176,59,176,27,233,91,83,223,70,80,217,
+	31,5,22,171,41,203,226,44,170,75,165,184,69,116,140,131,84,149,255,121,158,126,220,221,
+	207,139,6,186,34,185,28,96,102,215,214,241,248,87,3,15,0,255,79,85,157,104,126,75,
+	240,218,72,58,247,18,38,58,174,24,30,183,141,193,3,238,254,64,180,237,239,136,151,119,
+	190,17,34,192,181,238,190,255,88,34,64,150,150,115,118,119,119,111,51,115,230,204,237,129,
+	73,101,108,254,48,193,205,190,94,76,37,4,161,75,18,19,41,95,168,58,187,6,198,255,
+	253,192,254,192,0,97,210,176,162,56,62,102,54,175,72,152,88,15,84,147,33,105,50,240,
+	75,119,223,205,204,154,229,197,170,52,128,45,202,65,192,137,84,231,202,210,76,182,0,78,
+	142,214,226,138,202,217,145,176,14,44,173,130,216,100,130,247,130,220,111,199,193,221,191,66,
+	152,165,172,150,3,163,99,137,231,7,6,215,90,24,193,106,57,74,242,88,105,129,107,27,
+	112,174,199,9,75,234,214,171,218,19,199,250,168,109,26,105,252,87,234,153,246,83,130,251,
+	245,21,49,247,123,8,248,120,2,235,254,181,192,181,180,78,96,192,125,40,211,125,222,204,
+	30,6,30,171,87,65,242,249,252,178,66,161,176,140,100,121,73,78,42,71,0,136,2,230,
+	85,219,159,239,1,246,51,179,167,204,236,57,51,235,175,240,56,67,37,196,128,175,87,89,
+	182,157,128,207,84,48,150,107,119,247,183,185,251,44,119,127,87,20,28,177,81,207,167,170,
+	108,231,200,163,67,2,64,19,13,129,55,69,47,194,173,82,80,220,117,163,116,82,35,168,
+	130,159,208,184,166,98,182,33,172,169,154,156,130,178,142,165,84,110,71,249,185,118,91,245,
+	158,223,5,56,185,134,135,60,57,58,166,120,225,160,96,51,224,98,213,68,98,184,56,106,
+	147,70,243,67,194,204,158,72,6,15,71,109,146,6,190,11,124,150,16,171,162,18,110,3,
+	206,148,8,208,28,34,247,255,93,128,25,101,108,62,144,207,231,31,90,182,108,217,194,122,
+	149,39,151,203,45,152,63,127,254,61,132,184,17,73,97,2,229,77,58,29,91,229,121,238,
+	138,140,255,167,107,80,230,161,18,239,251,211,9,19,169,213,240,209,152,99,185,195,9,94,
+	175,55,0,103,16,98,35,60,238,238,221,238,30,119,34,175,18,1,32,182,171,142,187,111,
+	237,238,167,187,251,99,192,10,119,191,59,18,47,54,149,0,208,88,67,96,123,194,58,177,
+	151,164,160,184,43,162,155,227,116,130,107,229,234,17,29,118,2,176,175,198,54,21,177,25,
+	65,165,158,154,130,178,174,39,172,1,187,141,224,66,56,80,226,94,126,177,154,116,76,190,
+	77,109,133,158,201,209,49,197,134,131,130,143,18,92,119,69,115,249,106,212,22,205,226,74,
+	224,102,53,67,211,185,57,106,139,52,240,35,224,191,70,25,187,149,250,76,30,254,125,4,
+	191,72,232,245,101,94,4,232,238,238,222,98,230,204,153,59,68,99,172,241,88,212,211,211,
+	243,207,249,243,231,47,175,103,153,250,251,251,175,46,20,10,87,19,38,212,146,192,32,229,
+	185,159,87,51,190,191,29,216,223,204,158,171,145,253,231,163,188,239,207,24,237,158,45,247,
+	158,112,247,113,141,106,119,55,119,239,5,46,4,166,143,248,247,22,64,15,112,89,3,140,
+	234,88,117,231,238,255,143,224,153,244,85,130,40,54,188,236,248,12,224,126,119,111,74,160,
+	201,150,19,0,34,117,232,235,192,91,73,199,122,239,11,204,236,183,192,108,96,111,130,43,
+	208,229,69,66,192,42,210,19,200,39,73,180,17,130,231,109,159,146,242,62,72,112,145,187,
+	21,248,85,212,230,125,69,66,192,0,240,47,53,235,168,247,253,255,16,2,125,214,154,67,
+	163,99,139,13,7,5,223,2,62,168,154,104,26,31,140,218,160,217,220,30,189,179,68,115,
+	184,60,106,131,166,61,126,99,108,251,39,224,152,49,158,41,165,62,171,135,127,31,193,223,
+	72,110,150,164,172,139,0,47,38,120,37,150,195,99,102,214,87,239,2,245,244,244,220,61,
+	111,222,188,115,10,133,194,77,192,114,154,159,255,125,128,13,39,114,74,177,166,194,227,223,
+	6,188,211,204,70,139,57,81,137,253,51,52,198,189,249,93,224,11,84,54,163,126,135,153,
+	149,179,223,201,140,239,17,113,16,33,205,96,185,94,111,117,93,2,224,238,159,4,126,205,
+	232,19,141,59,1,215,185,251,30,18,0,234,207,254,192,199,72,199,122,233,53,188,48,202,
+	102,129,16,244,239,125,132,104,183,39,1,31,2,206,215,24,39,54,59,16,130,4,165,65,
+	4,26,4,138,211,227,172,35,184,63,93,70,8,118,116,107,52,200,123,80,205,90,242,1,
+	252,113,170,119,81,27,139,19,163,115,136,13,7,5,191,97,67,165,94,212,159,233,81,221,
+	39,133,199,128,115,213,44,13,231,92,234,184,182,186,14,124,185,198,199,187,34,193,215,154,
+	101,17,96,59,202,143,184,191,8,248,119,35,10,149,203,229,174,154,55,111,222,113,125,125,
+	125,103,21,10,133,123,128,39,129,60,97,66,173,209,217,180,214,80,222,18,151,63,86,112,
+	236,191,69,198,127,190,198,246,159,143,243,190,63,19,152,89,129,81,61,174,183,142,187,239,
+	74,249,241,6,222,10,92,229,238,155,215,73,0,40,203,110,112,247,207,18,98,153,140,103,
+	111,110,10,92,92,69,28,3,9,0,101,52,198,84,66,196,202,169,41,41,242,247,205,236,
+	153,232,198,42,254,12,153,217,141,102,118,170,153,253,209,204,6,16,113,216,8,216,139,244,
+	228,46,191,43,122,65,149,122,112,45,38,40,189,139,104,190,162,157,196,123,126,175,232,1,
+	92,111,126,26,157,75,108,56,40,88,20,5,7,92,166,218,168,59,203,162,96,127,139,18,
+	88,182,229,132,184,59,235,212,76,117,103,93,84,215,203,83,84,230,11,205,236,158,81,102,
+	249,43,141,144,127,99,194,175,57,171,34,192,86,148,151,105,199,243,249,252,19,133,66,225,
+	169,70,21,44,151,203,61,56,99,198,140,175,207,155,55,111,159,190,190,190,67,251,250,250,
+	102,247,245,245,253,42,18,4,158,0,158,37,76,182,173,34,44,189,172,199,184,106,176,191,
+	191,255,185,66,161,80,40,99,219,31,80,158,167,192,48,183,0,7,154,217,120,199,174,169,
+	7,64,209,251,254,135,192,231,99,212,91,185,226,240,23,136,23,168,251,205,192,213,238,62,
+	94,246,135,186,120,0,184,251,177,132,229,76,229,218,217,47,1,62,41,1,160,126,116,17,
+	210,177,164,129,33,194,186,127,81,123,118,39,29,193,31,135,31,78,183,169,201,42,50,254,
+	119,34,44,151,152,212,128,211,77,2,126,21,157,83,148,30,24,116,0,231,169,38,234,198,
+	121,81,29,39,157,179,9,241,108,68,125,120,32,170,227,36,189,195,202,161,30,239,185,123,
+	82,208,94,195,34,192,22,25,234,131,157,148,49,209,230,238,107,123,122,122,150,205,159,63,
+	191,225,162,96,46,151,91,53,99,198,140,59,103,204,152,241,195,25,51,102,28,61,111,222,
+	188,55,247,245,245,29,208,215,215,119,76,95,95,223,169,125,125,125,23,244,245,245,93,95,
+	40,20,30,6,150,16,60,5,134,69,129,170,178,9,184,251,191,122,122,122,238,238,237,237,
+	93,90,198,123,243,65,224,180,50,15,125,19,112,144,153,149,35,182,91,189,238,101,51,251,
+	9,33,178,255,120,94,21,43,129,143,152,217,234,50,14,123,72,5,229,221,19,184,198,221,
+	59,171,17,53,226,214,157,187,31,15,204,175,160,142,143,104,228,61,48,129,22,193,221,247,
+	3,78,72,209,53,223,95,134,130,39,226,243,226,232,133,155,22,241,107,41,154,49,171,228,
+	126,223,148,176,238,106,135,6,158,118,7,224,215,238,254,142,38,230,180,77,186,8,240,73,
+	119,255,51,240,115,213,70,77,57,202,204,210,180,20,236,26,66,42,186,3,213,116,53,229,
+	106,210,187,20,172,30,233,140,23,167,228,218,95,11,252,201,221,15,0,158,27,227,249,153,
+	150,182,156,92,102,123,174,136,140,234,166,147,203,229,214,228,114,185,7,24,33,78,118,119,
+	119,79,237,234,234,122,5,97,242,240,213,192,46,211,166,77,219,174,163,163,99,179,200,158,
+	152,88,244,153,64,112,247,30,171,161,214,246,247,247,223,82,40,20,238,142,81,188,147,9,
+	147,86,99,173,127,191,138,16,247,165,220,177,71,93,60,0,138,250,234,185,238,222,15,252,
+	140,210,98,208,34,224,195,102,118,123,157,159,15,111,140,68,128,3,71,137,135,80,83,15,
+	0,119,63,1,248,78,133,101,125,189,187,91,153,241,16,36,0,148,97,8,64,8,244,246,
+	63,192,150,41,42,122,78,99,153,154,51,28,245,127,114,138,202,124,135,154,173,34,126,75,
+	153,57,136,75,240,203,232,231,225,21,190,108,126,43,195,102,204,129,193,249,238,254,0,242,
+	108,169,21,111,52,179,127,164,176,220,15,18,4,206,143,170,9,107,194,69,192,211,41,46,
+	127,61,210,216,166,105,9,196,107,9,65,16,199,20,1,82,66,89,57,238,129,126,130,187,
+	125,114,7,226,185,92,127,46,151,187,149,16,107,9,128,89,179,102,109,220,213,213,181,173,
+	187,239,76,136,234,190,115,244,153,62,109,218,180,109,34,113,96,163,168,30,38,68,198,246,
+	32,176,38,159,207,223,58,103,206,156,159,246,246,246,222,27,227,157,233,64,151,187,223,68,
+	240,6,152,94,244,239,231,34,251,230,123,13,88,14,28,107,182,220,204,126,235,238,55,19,
+	38,95,15,139,234,232,94,224,2,160,55,230,68,201,245,85,188,43,246,0,174,117,247,3,
+	74,100,68,168,153,7,128,187,127,133,144,97,174,82,238,106,148,241,159,121,1,32,50,254,
+	55,37,184,210,239,145,162,162,175,71,129,253,106,205,68,194,154,160,173,83,84,230,33,228,
+	42,91,201,125,127,30,240,206,10,119,95,12,124,37,250,253,109,84,150,37,226,157,238,126,
+	158,153,29,173,214,24,117,96,240,15,192,220,189,0,108,174,26,169,136,101,41,113,249,31,
+	139,167,9,107,92,143,161,49,75,117,178,200,58,146,229,242,191,193,35,185,204,237,234,145,
+	165,101,187,148,181,101,86,68,128,118,202,11,180,253,24,176,48,109,23,215,211,211,179,166,
+	167,167,103,97,84,246,235,138,255,23,121,12,188,10,120,61,176,107,100,172,79,140,158,117,
+	183,229,114,185,203,122,123,123,31,173,240,189,249,75,119,255,21,97,34,107,79,224,126,224,
+	186,50,93,232,203,50,98,107,116,47,23,151,249,105,224,107,192,215,220,125,19,51,171,212,
+	227,227,135,84,39,22,191,22,248,179,187,191,51,42,83,53,180,149,24,119,126,141,242,151,
+	106,140,198,69,141,236,199,89,247,0,104,7,190,4,124,152,116,197,59,184,173,145,42,80,
+	43,216,27,209,205,255,50,210,17,245,127,152,167,212,116,177,141,255,28,240,137,42,14,113,
+	156,153,253,59,58,214,113,132,217,252,74,248,132,187,63,107,102,221,106,149,49,7,7,29,
+	238,254,115,66,122,83,81,62,231,155,217,81,25,186,158,179,9,94,51,187,170,105,99,241,
+	32,217,73,3,188,133,187,79,98,140,37,111,21,184,192,239,153,194,122,200,130,8,176,148,
+	176,102,126,139,49,222,213,203,243,249,252,205,133,66,225,254,44,221,144,145,199,192,95,128,
+	191,212,233,157,57,72,8,110,89,109,128,203,186,46,1,24,165,236,171,170,216,247,70,119,
+	63,191,202,177,194,238,145,8,176,63,33,176,98,165,153,31,218,70,244,229,57,132,0,243,
+	213,176,136,198,4,172,110,25,1,224,0,66,228,200,141,83,86,238,115,52,174,169,41,59,
+	70,47,213,246,148,149,251,126,53,93,44,227,255,12,170,75,35,117,162,153,253,95,209,11,
+	231,255,220,253,68,42,119,233,250,178,187,15,153,217,87,212,58,99,190,216,143,114,247,165,
+	192,23,85,27,101,241,125,51,251,82,6,175,235,106,66,106,172,215,170,137,203,226,46,146,
+	31,229,62,46,219,3,181,204,9,127,68,74,235,33,213,34,64,62,159,191,179,80,40,220,
+	221,209,209,241,246,18,227,174,33,96,89,127,127,255,197,39,157,116,210,175,123,123,123,149,
+	29,166,57,84,50,30,110,118,166,169,99,8,203,8,222,82,197,49,118,35,44,39,248,103,
+	149,227,205,57,60,191,204,229,27,85,94,215,106,224,240,70,199,142,202,172,0,224,238,219,
+	3,61,164,203,229,27,96,157,153,253,76,207,166,154,177,89,244,176,152,156,178,114,15,86,
+	251,128,106,49,227,255,27,192,172,42,14,241,51,51,59,163,132,113,122,134,187,239,2,124,
+	170,194,227,206,114,247,21,102,246,223,106,165,49,69,128,47,185,123,59,112,156,106,99,76,
+	206,202,168,241,63,204,141,132,153,169,215,168,169,199,228,238,20,25,255,113,188,25,247,170,
+	161,0,112,32,240,238,20,183,113,106,69,128,92,46,119,61,176,221,156,57,115,182,236,232,
+	232,120,25,207,167,92,94,155,207,231,159,232,239,239,63,59,151,203,253,172,156,40,248,66,
+	20,141,19,86,185,251,193,192,229,192,219,171,56,212,174,84,231,109,246,78,158,95,102,186,
+	73,13,140,255,247,154,217,173,141,174,207,76,10,0,238,62,17,152,7,188,50,133,197,127,
+	68,183,121,205,104,3,246,38,157,57,118,251,213,124,101,223,239,71,1,167,84,113,136,107,
+	205,236,211,99,188,116,62,29,165,247,219,191,194,227,159,226,238,11,205,76,145,239,199,126,
+	185,31,239,33,112,203,241,170,141,146,156,105,102,95,104,129,235,188,33,250,41,17,96,116,
+	227,255,134,140,94,219,231,121,62,8,107,53,76,166,242,72,220,73,19,1,174,141,222,61,
+	105,19,1,46,4,158,232,234,234,250,84,116,29,14,220,145,203,229,126,218,219,219,123,179,
+	110,227,166,211,158,198,66,155,217,74,119,127,23,240,59,130,56,214,12,54,169,209,113,86,
+	1,239,54,179,235,154,82,151,25,53,8,62,5,156,89,195,70,106,36,255,171,224,97,53,
+	227,149,192,190,164,83,232,122,128,144,42,75,140,125,175,191,157,224,206,85,41,15,3,123,
+	153,89,126,156,243,116,2,127,5,94,94,197,185,246,53,179,27,212,106,227,182,233,60,96,
+	182,106,226,5,156,106,102,115,90,236,154,247,166,242,76,30,89,229,54,138,162,145,167,224,
+	94,134,16,223,225,243,49,118,235,6,190,61,202,224,191,156,243,1,252,2,248,88,134,218,
+	253,110,96,255,18,17,204,133,168,244,222,172,228,30,249,137,153,125,46,33,229,159,12,252,
+	31,233,205,184,180,2,56,212,204,154,230,201,213,150,193,78,189,31,33,234,127,26,141,255,
+	1,224,247,122,52,213,132,23,19,34,165,166,209,248,31,2,22,168,9,199,189,215,55,3,
+	122,171,56,196,211,192,251,199,51,254,163,129,103,30,120,63,213,165,217,234,141,202,44,198,
+	174,235,57,84,23,203,33,107,124,185,5,141,127,34,67,247,38,53,255,127,184,41,77,198,
+	127,241,163,58,230,246,57,42,143,7,178,77,52,134,250,88,198,218,254,53,132,52,102,91,
+	184,59,163,125,132,104,21,251,47,202,124,240,62,224,138,20,22,127,57,112,72,51,141,255,
+	204,9,0,238,254,122,66,170,136,173,83,122,9,139,129,191,235,185,84,53,91,3,251,145,
+	190,117,255,195,172,68,25,0,202,225,28,42,95,230,51,0,124,212,204,202,78,179,24,109,
+	251,209,104,223,74,120,37,10,240,89,110,93,127,7,248,180,106,130,79,71,117,209,170,220,
+	73,88,7,221,234,252,41,170,139,86,225,123,192,31,24,49,187,55,150,241,235,238,135,1,
+	247,0,239,201,104,157,188,134,176,28,96,11,221,14,162,22,175,217,10,246,25,76,212,5,
+	152,173,1,62,0,92,150,162,122,47,0,7,153,217,95,154,93,144,204,196,0,112,247,109,
+	128,239,83,157,139,110,83,47,129,144,79,116,177,158,75,85,177,9,33,127,251,212,20,95,
+	195,191,9,238,65,98,244,251,253,56,224,176,42,14,113,116,37,235,174,204,236,58,119,63,
+	26,184,160,194,243,30,230,238,55,153,217,89,106,197,113,235,250,103,145,155,95,171,214,213,
+	113,10,8,11,132,96,168,19,8,203,185,90,145,235,105,205,128,176,239,142,62,143,3,151,
+	18,210,170,221,75,200,189,190,142,144,221,105,199,168,95,28,69,240,248,203,58,195,34,64,
+	234,98,2,180,10,157,157,157,147,59,58,58,54,231,133,129,15,11,133,66,97,77,6,4,
+	128,36,142,19,214,186,251,135,128,139,9,30,1,73,38,31,25,255,183,37,161,48,153,240,
+	0,136,6,137,103,164,252,5,176,26,184,212,204,228,199,85,57,19,162,62,176,93,138,175,
+	97,0,120,84,77,57,230,253,254,70,224,7,85,28,226,139,102,246,139,42,94,56,191,160,
+	186,148,117,63,136,174,65,140,95,215,243,169,46,187,67,90,153,21,93,187,8,220,67,157,
+	242,106,39,156,191,68,215,158,234,71,118,149,251,239,0,124,9,184,4,120,8,88,75,112,
+	161,93,29,253,253,163,22,49,254,71,138,0,242,4,72,150,225,223,62,125,250,244,105,115,
+	231,206,61,108,193,130,5,191,94,176,96,193,125,11,22,44,184,119,193,130,5,23,205,158,
+	61,251,125,29,29,29,73,91,254,151,198,52,128,163,138,0,132,9,161,223,36,184,139,44,
+	5,14,72,138,241,63,108,48,53,99,0,15,176,57,33,159,227,142,192,166,192,36,130,98,
+	102,209,103,45,193,21,122,57,240,4,65,57,121,210,204,6,70,28,203,8,169,163,14,39,
+	221,138,214,67,192,77,197,235,184,198,11,120,147,17,38,69,125,97,10,33,167,102,251,136,
+	7,211,96,100,20,175,139,250,195,112,191,40,245,32,218,29,216,37,229,245,145,71,94,32,
+	227,241,195,42,238,245,110,51,251,65,181,5,48,179,31,68,217,70,114,149,236,30,93,195,
+	27,212,148,101,213,117,206,221,55,5,78,110,145,75,62,217,204,114,106,249,13,184,35,122,
+	71,236,217,34,215,251,183,232,154,197,134,180,122,44,21,121,2,36,203,248,159,52,119,238,
+	220,151,118,117,117,157,96,102,31,227,133,49,200,246,157,53,107,214,203,129,45,79,61,245,
+	212,115,18,232,9,16,203,124,75,240,56,97,157,187,127,148,16,0,244,195,9,43,222,179,
+	192,59,205,236,174,36,21,170,89,75,0,118,4,190,27,61,188,54,34,120,34,88,212,185,
+	218,35,163,175,45,50,252,28,88,67,72,151,240,172,187,63,10,252,131,16,145,123,17,240,
+	82,96,78,52,48,72,43,67,192,111,9,107,67,90,137,41,4,119,253,29,138,140,254,225,
+	126,208,22,213,203,240,223,30,245,139,245,81,127,232,39,4,100,91,2,44,35,184,252,191,
+	137,116,123,181,56,240,88,36,118,136,82,21,20,34,196,239,81,133,97,245,237,26,190,112,
+	190,29,5,245,171,196,48,221,195,221,231,181,104,112,183,74,234,250,20,119,159,74,152,9,
+	204,50,223,51,179,83,212,226,99,26,197,27,17,210,138,101,153,187,162,107,21,66,34,64,
+	178,141,255,182,185,115,231,238,53,115,230,204,111,48,122,170,224,237,186,187,187,143,202,231,
+	243,143,157,126,250,233,87,38,164,232,153,241,0,40,26,39,172,119,247,143,69,182,227,225,
+	9,41,214,51,132,153,255,196,121,114,53,75,0,120,15,112,8,163,7,105,107,31,81,190,
+	201,64,39,176,61,97,150,247,253,69,162,192,20,194,90,176,52,211,79,58,35,89,86,203,
+	206,192,78,99,244,195,246,18,253,117,35,130,250,191,37,240,146,232,70,31,32,120,18,180,
+	167,188,62,214,18,214,55,138,210,198,255,94,84,158,30,110,126,61,12,171,200,48,221,10,
+	152,89,193,238,179,221,253,50,51,251,171,90,183,172,186,62,193,221,55,6,142,201,232,37,
+	158,109,102,39,168,165,199,229,198,232,89,255,234,140,94,223,189,209,53,102,230,209,173,46,
+	219,58,34,64,103,103,231,164,142,142,142,77,162,113,121,123,212,254,235,9,19,27,107,243,
+	249,252,186,66,161,48,148,149,6,232,238,238,222,186,171,171,235,8,224,29,227,108,250,10,
+	224,101,64,82,4,0,203,226,189,108,102,3,238,126,84,212,231,142,106,114,113,158,38,164,
+	239,188,47,137,117,213,44,1,96,121,149,157,182,157,176,108,96,211,140,60,67,110,6,30,
+	28,209,137,91,225,229,181,190,6,15,176,137,164,219,251,163,152,39,9,75,0,68,105,190,
+	89,225,126,127,53,179,227,234,248,194,57,206,221,247,0,246,170,240,154,14,81,211,150,93,
+	215,199,186,123,27,240,185,140,93,218,143,205,236,88,181,112,217,92,23,61,255,95,149,177,
+	235,186,47,186,54,33,226,136,0,127,38,100,62,106,170,8,208,217,217,185,201,220,185,115,
+	247,236,234,234,250,0,193,83,111,43,158,159,216,120,16,184,35,151,203,221,215,219,219,187,
+	52,26,255,13,68,63,215,3,235,243,249,252,96,161,80,72,155,96,244,58,51,123,13,227,
+	123,159,110,150,48,155,37,147,2,64,145,8,240,41,130,215,240,39,155,84,140,37,192,126,
+	113,50,77,181,138,0,240,7,224,68,226,165,240,114,50,18,181,114,4,171,129,11,204,108,
+	101,11,190,184,22,68,47,137,105,122,135,51,16,189,32,215,171,42,74,220,252,238,31,6,
+	14,174,96,215,101,192,39,26,80,196,79,0,183,17,226,89,196,225,96,119,255,176,153,253,
+	90,173,92,246,203,253,243,30,130,165,124,62,35,151,244,35,51,59,70,45,27,155,63,71,
+	63,179,34,2,220,87,116,77,66,196,97,119,224,207,238,62,166,8,80,207,137,165,206,206,
+	206,141,230,206,157,251,193,153,51,103,158,8,236,54,226,223,187,1,135,2,204,154,53,107,
+	93,119,119,247,51,64,95,36,12,44,0,22,152,217,194,158,158,158,39,123,123,123,87,18,
+	188,5,210,226,49,176,35,193,59,121,60,214,37,108,124,151,185,37,0,35,250,250,160,187,
+	127,38,18,1,62,211,224,211,47,38,204,252,63,148,228,58,154,208,164,134,201,187,251,183,
+	129,249,148,239,190,111,81,231,243,42,58,111,18,249,27,240,199,22,125,105,173,37,4,57,
+	122,71,204,246,244,17,253,34,11,44,33,196,180,16,165,249,122,133,251,125,193,204,30,110,
+	192,51,237,97,119,255,2,112,94,133,215,38,1,32,94,125,31,227,238,171,73,127,76,128,
+	239,201,237,191,106,17,96,128,244,199,4,184,139,108,185,253,143,246,190,22,117,22,1,104,
+	146,39,64,119,119,247,94,51,103,206,252,100,9,227,127,36,147,204,108,251,200,104,126,75,
+	241,63,102,205,154,181,186,187,187,251,9,66,80,236,123,128,59,115,185,220,3,189,189,189,
+	207,241,124,48,232,129,72,24,24,72,136,183,192,112,16,235,180,9,0,173,48,78,24,114,
+	247,207,71,34,64,163,38,12,30,143,140,255,71,146,94,63,19,154,120,238,95,0,31,139,
+	30,86,229,26,113,195,129,225,218,50,210,63,87,1,189,102,182,188,133,239,209,135,8,145,
+	251,119,136,115,95,147,45,143,144,1,194,186,79,5,255,43,53,122,116,63,178,194,1,254,
+	79,204,236,127,27,248,178,249,95,119,223,7,248,108,204,93,95,235,238,71,154,217,5,106,
+	237,88,245,125,130,187,47,4,190,151,210,75,248,146,153,125,95,45,89,53,55,18,60,125,
+	222,150,226,242,223,165,102,20,105,21,1,58,59,59,219,59,58,58,94,79,245,222,56,147,
+	205,236,37,132,248,78,239,138,68,129,21,145,40,176,128,144,34,121,1,240,207,92,46,183,
+	160,183,183,183,64,152,72,90,19,121,10,52,84,16,232,236,236,180,40,189,223,38,101,108,
+	190,50,26,243,167,217,254,75,93,236,134,72,4,56,54,42,123,189,151,217,45,34,184,253,
+	47,72,67,221,52,211,144,94,11,124,141,144,27,49,45,101,174,53,55,1,151,183,248,11,
+	107,16,184,133,16,212,49,214,125,157,161,58,88,76,112,135,19,165,233,170,96,159,187,205,
+	172,225,235,196,163,115,222,221,160,107,148,8,16,12,232,131,83,88,244,131,101,252,215,148,
+	187,128,223,165,176,220,191,147,241,47,234,36,2,108,209,168,19,118,119,119,111,61,115,230,
+	204,221,8,107,254,107,205,102,102,246,114,51,59,216,204,142,51,179,239,152,217,149,179,102,
+	205,186,101,193,130,5,191,92,176,96,193,87,23,44,88,112,240,236,217,179,95,62,125,250,
+	244,105,29,29,29,19,27,120,221,155,204,156,57,179,131,242,226,80,45,37,253,49,158,82,
+	233,205,99,102,78,8,212,124,102,29,79,211,7,236,155,22,227,191,169,198,116,180,22,233,
+	54,160,151,214,116,139,89,73,136,76,190,10,241,20,193,221,107,168,5,175,125,125,116,237,
+	3,234,6,37,222,54,238,239,0,246,174,96,215,111,52,177,216,149,156,123,239,232,90,69,
+	252,119,201,85,132,108,34,105,97,167,168,204,162,182,44,2,206,77,81,121,207,165,53,150,
+	125,105,9,64,246,69,128,114,221,224,107,201,150,102,182,159,153,125,213,204,254,111,214,172,
+	89,55,47,88,176,224,187,179,103,207,222,187,163,163,99,114,131,202,176,3,240,162,50,183,
+	125,154,144,15,62,41,180,183,210,189,108,102,110,102,95,32,164,160,175,53,143,1,239,48,
+	179,133,105,170,147,182,38,55,8,64,14,248,123,11,190,36,110,35,164,111,17,129,59,34,
+	33,160,213,120,138,176,102,72,148,230,136,10,246,249,153,153,253,190,206,194,196,12,119,127,
+	187,187,191,174,196,115,237,247,192,207,26,116,173,34,212,249,191,136,31,128,177,25,108,30,
+	149,85,212,135,229,192,217,41,40,231,217,84,151,13,73,136,114,69,128,45,27,112,174,141,
+	8,169,152,155,201,22,102,118,212,172,89,179,206,154,61,123,246,123,59,58,58,26,81,158,
+	233,148,191,124,245,223,132,76,79,105,182,255,6,51,48,86,248,47,160,167,134,135,124,36,
+	50,254,83,39,230,38,193,157,126,25,112,2,240,68,11,61,152,215,1,191,212,236,255,6,
+	117,114,35,176,162,133,174,121,16,120,24,205,254,143,102,100,79,165,178,60,174,255,93,199,
+	50,125,220,221,239,36,40,190,215,3,119,184,251,82,119,207,213,160,12,71,69,215,44,42,
+	123,177,47,79,192,32,116,44,38,181,120,188,151,70,190,75,206,74,112,249,206,66,241,94,
+	68,227,68,128,107,27,32,2,180,211,220,152,98,197,188,122,214,172,89,159,236,234,234,218,
+	163,158,39,233,236,236,108,235,232,232,120,25,176,115,25,155,15,245,247,247,255,187,80,40,
+	44,73,80,223,120,186,130,125,50,241,254,50,179,175,0,167,214,224,80,15,69,198,127,42,
+	39,241,218,18,208,16,152,217,109,4,183,217,66,139,60,148,23,0,151,233,221,180,1,79,
+	1,127,109,161,193,209,50,180,246,127,44,62,73,121,107,235,138,233,173,151,18,235,238,61,
+	192,207,217,48,32,97,39,240,101,119,255,155,187,79,139,158,107,139,8,203,155,226,48,145,
+	230,229,172,205,138,8,176,62,65,3,209,98,38,68,101,19,141,97,136,250,174,247,172,148,
+	51,105,189,165,110,90,2,144,125,17,160,141,100,197,101,122,71,103,103,231,190,29,29,29,
+	117,123,23,116,119,119,111,17,197,61,216,182,140,177,195,210,158,158,158,69,189,189,189,203,
+	18,84,71,247,87,176,207,189,25,26,43,204,161,186,201,162,7,35,227,127,113,90,235,32,
+	73,1,245,46,0,126,72,252,96,112,105,28,152,252,209,204,90,201,227,33,14,195,233,95,
+	6,51,126,157,78,200,129,187,82,77,62,42,31,173,96,159,186,204,252,69,249,100,187,199,
+	217,236,77,188,48,13,224,89,13,186,102,241,194,23,251,32,176,93,130,138,180,93,84,38,
+	209,248,103,236,57,9,42,207,57,50,134,69,51,69,0,119,223,210,221,25,237,83,5,235,
+	73,86,44,175,73,221,221,221,175,232,234,234,154,94,199,115,188,156,144,173,160,156,119,210,
+	253,209,216,54,73,252,54,230,243,104,25,112,93,198,198,10,223,164,178,152,77,247,19,2,
+	254,61,153,230,235,111,75,80,67,172,35,184,100,252,138,108,187,68,63,7,156,175,247,209,
+	168,12,18,226,35,60,76,182,103,74,214,16,20,68,81,218,224,126,115,100,80,199,225,247,
+	102,246,64,157,138,52,171,204,237,222,227,238,179,162,103,218,3,64,220,88,4,111,138,174,
+	93,84,247,62,121,146,100,196,4,216,60,237,131,132,148,179,146,100,196,4,56,27,137,189,
+	34,1,34,0,245,241,4,72,98,142,251,73,132,216,4,205,22,0,60,159,207,223,186,108,
+	217,178,127,36,236,29,121,63,112,73,140,93,190,99,102,153,91,162,107,102,115,129,175,199,
+	216,229,30,194,204,127,234,99,150,181,37,172,33,86,0,255,5,92,147,81,227,207,129,191,
+	144,33,55,154,58,177,158,144,34,241,113,178,59,99,242,4,13,204,211,155,66,62,83,193,
+	62,23,214,73,140,216,35,122,217,151,203,25,238,190,91,21,101,250,140,154,191,38,239,147,
+	229,192,21,77,44,194,21,90,243,159,8,214,17,188,173,154,197,66,90,123,205,191,188,30,
+	178,47,2,12,144,172,137,187,129,254,254,254,37,133,66,161,46,81,247,59,59,59,39,117,
+	116,116,236,2,236,88,198,230,171,122,122,122,158,154,63,127,126,18,223,5,93,132,32,118,
+	227,113,61,112,122,134,199,10,167,3,95,41,99,211,59,128,253,204,236,153,44,92,119,91,
+	2,27,226,57,224,120,224,206,12,190,56,86,2,63,48,51,5,125,27,159,53,209,67,231,
+	153,12,94,219,122,66,174,248,33,53,115,73,131,123,91,226,175,133,127,212,204,46,174,83,
+	145,166,87,176,207,215,162,231,217,197,192,163,49,247,253,100,84,7,162,122,254,171,69,207,
+	45,94,200,77,45,122,110,33,26,33,2,24,181,139,1,224,209,88,249,57,160,159,16,24,
+	122,109,36,48,148,99,19,12,185,251,195,61,61,61,55,247,246,246,214,101,150,182,187,187,
+	251,141,51,103,206,220,131,242,82,233,45,38,89,209,255,139,237,173,103,129,183,0,99,165,
+	165,253,95,224,208,200,75,59,179,152,89,15,112,36,163,199,162,187,132,48,243,159,153,137,
+	187,9,9,109,136,199,220,253,115,81,133,239,156,161,62,118,27,112,179,222,63,101,83,32,
+	164,177,121,23,233,72,241,85,46,79,209,90,89,47,226,210,85,193,62,23,214,177,60,149,
+	100,235,56,194,221,231,68,121,97,47,36,254,58,179,46,42,91,155,38,94,248,46,121,200,
+	221,151,211,248,28,213,203,205,236,33,181,64,98,200,19,102,225,27,157,37,98,93,116,110,
+	33,146,40,2,236,79,109,114,211,59,181,155,176,27,116,247,27,128,43,243,249,252,196,66,
+	161,240,98,194,76,251,182,64,231,180,105,211,54,237,232,232,152,72,8,154,59,252,153,16,
+	9,16,235,221,253,201,124,62,127,94,161,80,168,203,122,245,206,206,206,141,58,58,58,246,
+	5,222,80,86,197,184,63,72,252,73,128,70,190,35,159,6,14,118,247,3,8,169,136,223,
+	76,16,91,174,7,206,139,130,180,183,202,120,225,23,238,126,53,112,12,240,62,96,11,130,
+	215,246,79,205,236,134,172,93,111,34,5,128,40,24,201,29,132,25,148,31,82,70,148,205,
+	20,176,30,184,64,145,160,99,243,52,97,6,229,29,192,38,25,184,158,33,194,218,127,205,
+	254,151,190,247,219,129,227,42,216,245,23,117,44,86,165,107,247,142,1,190,26,149,45,174,
+	49,127,156,187,159,162,224,113,53,225,82,224,232,38,156,83,36,139,199,128,87,52,225,156,
+	173,142,198,60,217,23,1,106,41,0,76,48,179,131,221,125,232,156,115,206,249,78,111,111,
+	239,143,243,249,252,170,66,161,48,4,208,221,221,189,89,87,87,215,139,9,235,239,95,74,
+	152,36,220,17,152,76,200,170,116,105,46,151,251,75,111,111,239,218,58,24,255,204,157,59,
+	119,207,153,51,103,238,15,76,45,103,188,215,223,223,255,112,161,80,72,67,182,167,39,128,
+	37,4,239,219,181,4,175,133,167,91,240,190,88,25,93,251,170,168,141,159,37,76,218,101,
+	142,9,9,47,223,31,128,173,9,107,79,166,165,188,174,159,136,30,182,34,62,11,162,135,
+	251,155,129,141,51,240,112,121,92,77,58,186,225,75,72,171,23,135,43,204,236,225,122,21,
+	200,204,158,113,247,139,136,31,161,255,104,224,171,102,246,176,187,95,65,240,100,41,123,172,
+	17,213,197,247,213,37,170,230,212,38,8,0,167,170,218,19,199,109,77,16,0,110,83,181,
+	51,143,144,58,117,127,85,69,34,69,128,63,3,251,81,27,79,128,90,209,102,102,239,158,
+	53,107,214,203,103,205,154,117,78,79,79,207,111,122,123,123,31,207,231,243,107,115,185,220,
+	138,92,46,247,32,13,14,162,220,217,217,105,115,231,206,157,218,213,213,245,110,96,239,50,
+	119,123,170,167,167,231,193,222,222,222,165,234,106,34,105,180,37,177,80,102,134,153,65,136,
+	8,127,14,112,34,233,119,163,187,5,120,188,202,84,43,173,138,19,210,110,220,76,80,38,
+	211,204,147,132,53,109,162,52,71,86,176,207,185,13,40,215,137,196,95,199,183,141,187,127,
+	180,138,50,30,169,238,80,147,247,201,163,192,234,6,158,114,117,116,78,145,44,250,105,108,
+	160,178,129,232,156,170,119,56,4,248,153,170,34,145,188,58,18,1,170,137,9,80,203,24,
+	0,197,188,28,56,189,187,187,251,103,125,125,125,239,153,61,123,246,182,211,167,79,223,180,
+	163,163,163,161,182,75,103,103,103,219,220,185,115,183,234,234,234,250,47,51,251,52,229,79,
+	68,37,49,253,223,104,239,201,127,154,217,215,204,236,53,102,246,38,51,155,103,102,139,90,
+	112,188,176,202,204,126,106,102,111,51,179,151,154,217,9,102,150,201,140,93,109,9,111,136,
+	97,17,224,60,130,11,237,179,41,173,231,181,192,207,145,219,119,181,34,192,3,192,95,27,
+	60,152,175,37,131,209,53,72,5,42,213,192,238,111,160,204,117,117,69,220,103,102,151,212,
+	187,108,102,246,47,224,132,10,118,61,60,218,255,18,224,190,152,251,190,33,170,19,81,61,
+	87,101,244,92,34,30,139,50,122,174,196,142,225,162,207,250,200,112,250,186,222,127,201,21,
+	1,220,125,75,119,103,228,167,204,241,89,221,236,20,51,123,43,240,139,238,238,238,223,44,
+	88,176,224,51,179,103,207,222,109,250,244,233,157,81,44,128,122,27,255,147,230,206,157,251,
+	178,174,174,174,57,102,118,28,229,123,35,15,230,243,249,123,11,133,130,98,193,8,9,0,
+	85,188,64,6,128,31,1,95,38,161,209,52,199,225,17,20,252,175,22,12,17,82,40,254,
+	133,116,230,84,238,79,105,255,109,20,135,87,176,207,57,13,124,22,93,76,124,151,222,247,
+	186,251,214,85,148,245,112,117,139,154,48,63,163,231,18,241,184,39,163,231,74,11,167,19,
+	150,82,173,81,85,36,83,4,160,114,79,128,122,11,59,147,204,108,111,51,251,222,172,89,
+	179,254,176,96,193,130,83,103,207,158,253,182,233,211,167,111,59,125,250,244,205,58,58,58,
+	218,107,125,194,206,206,206,41,115,231,206,125,123,87,87,215,119,205,172,139,242,214,253,135,
+	202,112,127,162,167,167,231,158,222,222,222,103,212,181,132,4,128,234,6,223,235,205,236,231,
+	192,167,8,110,53,105,81,145,29,184,200,204,150,23,45,109,16,213,137,0,15,0,127,34,
+	164,137,73,19,15,211,218,249,160,199,227,3,49,183,95,108,102,223,107,112,25,43,113,99,
+	61,34,122,134,125,143,144,18,168,158,117,34,74,191,63,254,68,99,60,176,134,162,115,137,
+	100,242,120,131,198,14,142,98,189,140,198,175,8,107,206,101,24,101,71,4,24,32,120,56,
+	54,138,157,204,236,216,72,8,184,116,193,130,5,51,103,207,158,253,250,233,211,167,111,61,
+	125,250,244,41,29,29,29,21,197,55,235,236,236,108,155,62,125,250,228,233,211,167,79,155,
+	62,125,250,246,115,231,206,157,57,115,230,204,243,204,236,16,202,75,249,87,204,125,209,88,
+	85,136,68,50,33,109,5,54,179,43,221,253,73,224,59,192,219,43,184,41,27,77,30,184,
+	72,93,173,230,44,34,120,1,188,13,216,158,250,172,63,171,37,107,34,1,64,148,26,45,
+	187,239,6,76,143,185,219,121,77,40,234,57,209,179,103,114,140,125,186,128,239,22,149,121,
+	118,140,125,167,187,251,110,102,118,191,122,73,213,20,136,31,96,178,146,115,136,100,179,14,
+	216,168,1,231,16,163,115,43,176,23,112,57,176,171,170,35,145,34,64,156,192,128,171,105,
+	206,210,204,201,102,246,102,224,205,179,102,205,202,119,119,119,223,6,92,23,101,1,232,35,
+	100,160,24,32,136,191,35,199,136,195,127,183,69,118,68,123,119,119,247,86,93,93,93,187,
+	3,251,2,251,153,217,142,84,54,81,186,174,191,191,255,158,66,161,240,136,186,147,144,0,
+	80,27,35,97,248,215,187,9,179,106,103,0,31,38,217,145,225,111,54,51,165,2,170,15,
+	207,2,87,2,111,1,94,70,178,197,160,39,101,28,140,201,219,43,216,167,225,2,128,153,
+	173,119,247,75,128,143,199,216,237,165,238,254,57,51,251,113,5,2,192,112,221,72,0,168,
+	158,5,192,30,13,56,135,72,54,5,66,118,161,122,159,67,140,127,175,188,25,248,77,100,
+	112,137,148,138,0,253,253,253,43,11,133,194,170,142,142,14,167,252,201,24,31,97,136,87,
+	75,167,153,29,8,28,56,107,214,172,245,221,221,221,79,16,2,240,253,139,48,1,211,94,
+	116,222,182,200,254,153,0,108,30,61,15,182,54,179,23,1,83,106,80,150,187,122,122,122,
+	110,80,244,127,33,1,160,118,131,239,98,33,96,9,240,89,224,118,66,128,192,164,166,9,
+	220,197,221,119,205,106,20,201,4,176,138,144,94,113,105,52,184,223,40,161,229,236,140,62,
+	121,53,89,73,94,21,115,251,235,154,24,105,253,194,152,2,0,192,59,128,31,155,217,163,
+	238,126,93,244,119,189,234,70,148,102,97,3,4,128,133,170,230,196,179,172,1,2,192,50,
+	85,115,89,228,129,3,129,159,0,159,80,117,36,138,151,2,219,150,35,0,244,244,244,172,
+	156,58,117,234,179,95,255,250,215,87,3,155,148,101,253,187,247,155,89,27,208,81,135,178,
+	79,52,179,157,128,157,154,80,111,107,242,249,252,117,203,150,45,83,10,80,145,104,218,210,
+	88,232,162,117,244,107,129,51,129,143,0,255,32,153,81,246,95,2,252,208,221,183,139,17,
+	81,85,196,99,144,32,4,253,153,16,23,32,137,149,220,17,25,125,155,170,185,106,35,0,
+	52,241,249,115,37,241,35,124,111,93,69,217,37,0,212,134,197,25,57,135,168,142,149,25,
+	57,71,86,88,15,28,77,152,200,17,201,225,139,196,203,92,179,152,48,49,87,238,123,244,
+	102,224,6,210,155,213,169,20,3,249,124,254,234,57,115,230,252,118,254,252,249,207,170,11,
+	9,9,0,117,18,1,162,207,112,208,165,15,0,63,32,121,202,123,59,240,86,224,108,130,
+	154,42,17,160,62,56,33,219,194,31,9,110,95,235,147,214,101,9,177,10,246,163,76,133,
+	188,197,216,33,230,246,55,54,185,188,231,198,220,254,217,42,202,190,131,186,71,77,120,58,
+	35,231,16,213,177,42,35,231,72,243,184,173,212,103,46,97,105,231,90,213,84,211,249,37,
+	193,43,35,14,139,128,127,199,216,254,161,124,62,255,131,66,161,112,25,217,200,10,49,8,
+	220,219,211,211,115,110,111,111,239,223,212,133,132,4,128,198,189,88,30,7,186,9,41,102,
+	146,144,106,205,71,136,0,135,16,82,224,108,52,44,2,72,8,168,11,75,9,25,2,110,
+	34,121,30,33,70,112,73,219,135,228,7,175,108,52,113,221,0,155,29,93,247,71,49,7,
+	249,55,84,81,246,14,117,143,154,240,92,70,206,33,170,99,77,70,206,145,69,46,4,14,
+	208,125,212,84,30,1,62,95,193,126,253,148,25,251,194,221,135,242,249,252,210,147,78,58,
+	233,186,121,243,230,245,20,10,133,203,73,183,104,54,8,60,156,207,231,191,183,108,217,178,
+	63,170,11,137,52,48,33,99,215,99,132,224,37,183,18,102,219,223,8,76,108,242,67,161,
+	189,168,174,63,28,13,254,207,80,215,107,136,161,157,20,129,171,56,48,78,27,97,109,221,
+	82,194,178,5,17,216,44,77,134,150,153,45,113,247,30,224,155,101,108,190,200,204,122,171,
+	40,251,102,234,30,53,97,105,70,206,33,36,0,100,153,191,16,50,4,92,65,8,238,43,
+	26,199,90,194,146,218,229,21,236,251,28,229,199,56,90,221,211,211,179,106,254,252,249,67,
+	192,109,192,201,179,103,207,94,62,117,234,212,247,19,130,242,165,105,114,114,208,221,31,205,
+	231,243,223,61,233,164,147,46,237,237,237,149,7,139,72,5,109,25,187,158,55,240,124,144,
+	167,37,192,101,192,29,52,207,29,188,141,23,206,66,111,10,252,23,112,208,127,44,67,121,
+	1,212,131,233,196,79,41,87,111,65,162,184,161,39,2,175,163,57,1,106,146,74,28,49,
+	210,205,108,176,233,141,106,118,114,52,72,29,143,227,71,236,55,72,188,56,21,19,212,61,
+	106,51,80,203,200,57,68,117,120,70,206,145,101,30,141,68,128,155,84,21,13,229,203,192,
+	157,149,236,152,207,231,159,43,20,10,75,203,236,251,253,20,121,11,228,114,185,251,78,59,
+	237,180,57,253,253,253,223,117,247,133,132,212,125,105,96,189,187,63,146,207,231,191,119,210,
+	73,39,93,212,219,219,171,216,31,66,2,64,195,223,232,238,83,8,81,100,39,140,120,9,
+	47,140,6,233,15,209,88,151,112,139,62,35,235,120,27,224,84,66,202,145,226,128,134,162,
+	54,108,76,136,185,144,52,23,251,145,13,189,9,176,55,241,242,201,139,210,117,217,76,17,
+	224,80,160,119,148,127,223,5,188,211,204,254,144,228,107,104,33,214,102,228,28,162,58,36,
+	4,165,131,165,132,229,0,23,168,42,26,194,165,102,54,191,84,124,134,114,200,229,114,43,
+	163,192,119,229,4,245,203,71,34,192,127,232,233,233,89,124,234,169,167,126,123,225,194,133,
+	167,20,10,133,219,163,227,36,89,72,91,147,207,231,111,95,180,104,209,201,223,248,198,55,
+	206,235,237,237,93,174,46,36,36,0,52,135,195,128,173,198,120,25,223,79,200,25,255,76,
+	2,202,250,106,224,107,238,174,117,224,181,103,79,130,11,89,26,216,130,176,76,69,198,96,
+	154,213,8,179,153,192,206,192,76,194,242,158,111,0,7,155,217,235,162,0,165,34,25,252,
+	35,35,231,16,213,241,84,70,206,209,10,172,35,164,92,61,69,85,81,87,250,128,79,215,
+	224,56,203,128,21,101,108,183,188,212,118,185,92,110,229,140,25,51,126,62,111,222,188,153,
+	253,253,253,23,187,251,147,81,31,72,18,3,64,62,159,207,255,126,206,156,57,95,220,121,
+	231,157,47,158,63,127,190,150,252,136,212,145,9,215,82,119,223,25,216,191,12,67,106,13,
+	193,165,108,75,66,106,173,14,154,51,83,60,9,248,24,240,27,228,226,86,75,182,2,118,
+	75,81,121,219,129,93,8,238,142,79,180,120,219,13,197,185,23,221,221,204,44,49,179,3,
+	102,182,144,209,61,1,54,40,123,5,117,35,170,111,163,37,238,190,46,122,254,214,197,88,
+	49,179,37,170,233,196,179,138,23,198,231,169,53,131,40,11,64,173,57,25,120,12,248,105,
+	29,239,223,86,101,29,97,221,127,161,6,199,26,158,217,223,122,156,237,150,48,198,100,92,
+	46,151,187,29,152,217,213,213,181,127,103,103,231,49,83,167,78,125,19,48,37,106,251,102,
+	77,152,12,2,171,242,249,252,253,253,253,253,231,230,114,185,223,246,246,246,62,163,238,35,
+	210,74,234,61,0,220,189,13,248,12,81,116,253,50,121,150,224,13,112,4,33,58,119,51,
+	98,4,108,5,204,113,247,141,212,13,107,51,190,7,246,37,190,168,181,142,144,150,237,57,
+	154,227,110,54,25,120,19,202,10,16,247,30,76,115,125,181,215,185,110,196,232,244,167,244,
+	216,162,246,70,79,26,143,157,237,151,248,216,105,2,207,7,222,137,2,109,214,154,175,18,
+	2,241,213,130,37,140,147,10,213,221,215,230,243,249,59,10,133,194,131,99,109,151,203,229,
+	86,205,152,49,227,15,167,157,118,218,17,11,23,46,60,166,191,191,255,143,192,98,130,151,
+	193,58,26,23,203,99,29,208,159,207,231,239,233,235,235,59,115,206,156,57,159,158,49,99,
+	198,143,101,252,11,9,0,205,103,15,224,229,21,220,212,151,155,217,197,192,129,192,187,128,
+	63,16,84,251,70,25,129,6,188,25,248,160,186,97,77,216,137,144,249,33,46,119,19,214,
+	106,95,4,92,21,189,96,26,29,128,230,69,132,204,0,173,204,234,152,219,111,154,226,107,
+	221,180,206,117,35,70,231,145,148,30,91,212,150,254,148,30,187,213,185,145,16,59,231,49,
+	85,69,77,248,61,240,221,26,30,111,177,187,47,25,103,28,253,64,46,151,187,167,183,183,
+	183,44,183,249,158,158,158,254,157,119,222,249,210,211,78,59,237,67,11,23,46,252,64,95,
+	95,223,119,251,250,250,174,43,20,10,143,69,98,195,50,130,119,111,45,226,110,12,69,6,
+	255,114,224,25,119,95,180,116,233,210,235,250,250,250,190,57,103,206,156,15,206,152,49,99,
+	118,111,111,239,63,213,109,68,22,72,245,18,128,104,13,253,143,35,163,45,78,240,165,21,
+	4,15,0,204,108,29,240,39,119,191,129,224,62,254,81,224,3,192,142,212,223,221,104,51,
+	224,120,119,255,189,153,173,80,119,172,24,3,222,86,65,91,173,1,238,137,126,31,4,30,
+	142,6,22,219,0,47,33,172,235,158,66,253,103,155,39,2,175,1,22,208,186,179,189,113,
+	131,167,117,82,27,151,197,102,208,89,231,186,17,163,243,79,96,159,58,30,91,164,131,231,
+	8,194,107,189,142,45,234,199,195,132,12,1,191,35,76,162,136,202,248,23,112,116,45,15,
+	152,207,231,31,45,20,10,119,77,157,58,245,64,74,199,98,90,219,223,223,127,93,161,80,
+	248,123,220,99,247,244,244,12,246,244,244,220,70,228,173,208,221,221,189,77,87,87,215,235,
+	8,217,191,94,9,188,100,218,180,105,91,117,116,116,108,20,141,217,218,121,62,16,247,112,
+	80,238,145,194,132,71,159,65,96,125,62,159,239,239,239,239,239,35,76,12,253,221,204,254,
+	145,203,229,158,152,63,127,190,178,122,136,76,26,78,105,22,0,62,3,252,132,48,115,127,
+	35,229,173,187,115,224,18,51,187,104,140,227,110,73,136,41,112,4,33,72,219,150,117,20,
+	75,214,0,95,50,179,31,169,59,86,204,110,81,123,197,229,239,192,95,199,248,255,100,96,
+	7,194,58,253,109,8,25,6,234,229,53,51,72,88,142,114,95,43,54,160,187,63,24,213,
+	115,185,188,204,204,30,77,233,181,190,148,120,179,197,15,153,217,174,186,205,107,82,247,31,
+	5,126,89,167,195,31,62,214,123,69,36,138,151,3,7,215,233,216,87,70,70,170,168,253,
+	253,91,252,231,70,192,121,132,73,27,17,143,1,194,164,201,173,47,48,8,106,144,149,170,
+	187,187,251,117,115,230,204,57,177,163,163,227,93,132,108,71,237,132,153,245,213,249,124,254,
+	250,57,115,230,124,171,183,183,183,46,177,175,186,187,187,167,116,117,117,189,136,224,13,186,
+	5,97,146,109,147,17,229,40,30,115,173,3,86,18,68,187,133,185,92,110,81,111,111,175,
+	38,227,132,4,128,132,191,8,218,9,51,128,195,238,180,235,9,174,220,139,25,59,104,86,
+	63,112,188,153,173,42,227,69,51,49,50,74,14,1,246,3,94,11,76,139,190,175,101,221,
+	221,78,72,93,183,90,105,1,43,234,195,199,18,95,160,89,5,252,156,242,214,107,182,17,
+	102,109,119,138,4,129,173,162,193,71,173,61,3,158,6,46,33,61,57,112,107,121,63,223,
+	79,80,241,203,229,141,102,246,143,148,94,235,27,136,183,230,242,159,102,182,155,110,245,154,
+	212,253,230,212,207,115,164,195,204,150,169,150,83,193,36,224,152,58,29,251,108,20,7,160,
+	17,2,192,240,251,127,30,240,117,213,78,44,190,10,124,107,131,202,172,209,248,179,187,187,
+	251,149,93,93,93,31,159,54,109,218,65,29,29,29,91,229,243,249,66,127,127,255,13,185,
+	92,238,167,189,189,189,119,170,250,133,144,0,80,205,139,224,127,128,19,71,126,77,136,66,
+	122,119,244,147,18,255,255,145,153,93,83,193,249,38,3,47,6,94,15,188,131,224,178,189,
+	67,100,24,78,226,121,119,163,74,88,74,136,69,112,187,4,128,216,236,67,136,3,17,151,
+	63,83,217,108,251,4,130,170,188,117,212,31,182,140,254,30,246,14,168,198,67,96,13,240,
+	127,140,19,68,39,163,3,187,155,137,231,206,121,152,153,253,58,165,215,250,97,224,87,49,
+	118,185,197,204,246,209,173,94,179,250,31,170,195,187,207,205,172,77,181,155,42,190,80,167,
+	227,254,64,85,219,48,1,96,152,79,2,63,34,76,206,136,177,249,35,112,40,37,214,233,
+	215,122,252,217,221,221,189,233,204,153,51,167,228,114,185,149,243,231,207,95,174,170,23,34,
+	57,164,50,6,128,187,79,2,186,71,17,52,166,17,92,155,150,16,214,115,47,229,121,143,
+	128,197,192,117,21,158,118,53,193,109,247,17,224,98,130,231,193,150,132,117,226,47,33,44,
+	21,216,149,16,59,96,139,200,32,156,192,243,107,143,198,226,105,148,54,168,18,218,9,130,
+	76,92,150,2,15,84,120,206,1,130,23,73,63,193,205,115,98,212,214,29,209,103,27,130,
+	40,52,37,250,190,157,231,215,160,149,211,199,6,90,180,45,23,198,20,0,118,76,241,181,
+	238,88,65,221,136,218,177,158,218,167,18,83,166,134,244,81,143,84,128,131,170,214,166,112,
+	46,176,8,184,20,152,170,234,24,149,197,192,81,52,39,227,145,16,66,2,64,77,30,246,
+	237,227,24,134,219,19,130,252,172,136,30,122,139,129,94,51,171,200,192,42,161,140,174,140,
+	62,139,128,235,221,253,156,200,200,219,50,58,247,46,209,103,122,244,247,20,66,80,148,182,
+	200,48,92,31,61,132,159,32,172,73,213,154,193,248,28,64,252,153,60,7,174,173,225,64,
+	109,125,244,89,14,252,27,184,63,250,126,50,193,51,160,51,26,144,108,30,253,61,145,231,
+	131,75,78,32,136,83,30,245,165,135,41,237,185,210,10,44,138,185,253,54,41,190,214,109,
+	234,92,55,98,108,214,214,65,0,80,160,70,9,0,18,0,234,204,56,51,212,127,118,247,
+	55,3,151,19,38,102,196,134,125,243,99,132,52,216,13,33,151,203,173,204,229,114,43,85,
+	245,66,72,0,168,26,119,223,8,56,188,204,205,219,34,195,107,10,240,176,153,61,84,231,
+	23,147,3,207,68,159,187,70,148,123,114,145,97,56,16,137,0,203,163,50,174,148,235,127,
+	108,218,137,23,52,110,152,133,192,147,13,40,223,234,232,243,204,40,247,220,176,241,223,30,
+	9,8,70,107,207,34,46,142,185,253,182,41,190,214,109,235,92,55,98,124,99,125,138,4,
+	0,25,68,41,57,166,40,159,7,120,62,67,192,94,170,142,23,112,138,153,221,168,106,16,
+	66,164,82,0,0,46,163,252,89,95,143,182,29,162,201,145,98,205,108,117,145,97,8,33,
+	119,169,168,156,247,86,176,143,3,87,52,185,220,3,35,126,138,192,146,152,219,111,159,226,
+	107,221,190,206,117,35,198,102,77,74,142,41,36,0,136,248,60,77,136,211,244,115,224,195,
+	170,14,32,120,61,158,170,106,16,66,12,147,170,160,69,238,62,131,224,246,93,182,221,29,
+	253,252,181,153,105,128,150,29,58,8,1,24,227,242,168,6,104,137,37,174,87,198,140,20,
+	95,235,140,58,215,141,144,225,39,202,24,82,164,228,152,34,62,107,128,143,80,34,210,125,
+	11,178,132,144,210,122,72,85,33,132,72,165,0,64,101,1,252,134,8,235,158,68,118,248,
+	64,133,3,179,63,170,234,18,203,191,98,110,63,221,221,95,148,58,139,35,148,121,122,157,
+	235,70,72,0,16,229,141,13,210,112,76,81,225,227,150,144,238,238,179,180,174,199,221,16,
+	112,36,240,148,186,131,16,34,149,2,128,187,127,134,202,34,127,127,222,204,164,202,103,135,
+	221,168,108,253,238,159,85,117,201,197,204,254,77,252,101,49,71,167,240,82,227,150,121,89,
+	84,55,66,134,159,168,189,129,152,134,99,138,234,248,41,112,8,80,104,193,107,63,149,224,
+	254,47,132,16,233,17,0,220,125,248,51,13,248,118,5,135,88,108,102,63,85,51,103,134,
+	141,129,183,86,176,223,10,158,143,206,47,146,203,29,49,183,63,42,133,215,120,84,157,235,
+	68,140,143,60,0,132,4,128,214,226,79,192,62,180,86,70,149,27,128,83,212,244,66,136,
+	212,9,0,81,100,124,3,78,38,68,243,143,203,43,212,196,153,98,79,42,75,223,117,129,
+	170,46,21,220,30,115,251,93,221,253,131,169,177,54,66,89,119,173,115,157,8,9,0,66,
+	2,64,75,98,102,99,125,238,143,198,16,183,181,64,85,60,67,88,250,170,231,146,16,34,
+	125,2,64,196,142,84,22,193,255,2,51,91,174,38,206,12,83,128,151,87,176,223,131,192,
+	58,85,95,42,184,188,130,125,142,73,209,245,29,211,160,58,17,99,163,37,0,66,2,64,
+	107,242,20,240,118,224,55,25,239,215,71,1,79,168,185,133,16,169,20,0,220,189,157,176,
+	118,107,171,152,187,174,2,62,175,230,205,12,70,8,156,54,57,230,126,3,104,237,127,122,
+	26,217,236,58,224,159,49,119,59,192,221,247,75,252,136,44,148,241,128,152,187,253,51,170,
+	19,81,91,228,1,32,36,0,180,46,171,9,233,1,115,25,189,190,51,128,43,213,204,66,
+	136,84,10,0,238,14,176,25,112,120,5,187,127,201,204,86,169,121,51,195,68,42,155,253,
+	191,145,214,141,254,155,86,42,89,174,113,173,187,119,37,248,89,214,69,101,129,152,180,116,
+	165,62,200,3,64,72,0,208,51,96,22,193,43,43,75,99,132,91,128,57,106,94,33,68,
+	42,5,128,200,248,55,224,149,192,222,49,119,191,31,56,95,77,155,41,182,0,226,166,124,
+	123,14,120,64,85,151,58,126,6,172,175,96,191,249,238,126,65,228,53,148,148,231,88,187,
+	187,95,0,204,175,96,247,245,81,93,136,218,35,15,0,33,1,64,0,252,8,120,55,241,
+	51,208,36,145,165,132,229,178,154,244,16,66,164,79,0,40,50,254,39,1,135,17,102,127,
+	203,101,21,97,246,127,141,154,54,51,180,3,47,139,217,87,7,8,179,255,26,148,167,12,
+	51,123,138,202,5,188,35,128,251,221,253,192,4,60,199,14,36,136,145,71,84,120,136,243,
+	163,186,16,181,167,30,179,245,143,169,90,37,0,0,253,170,214,212,113,21,240,22,224,241,
+	148,95,199,209,102,246,248,88,129,16,133,16,34,177,2,64,100,252,67,152,241,253,80,204,
+	151,249,15,1,173,153,205,22,155,2,47,141,185,207,61,128,114,167,167,151,31,85,177,239,
+	46,192,85,238,254,3,119,111,248,136,199,221,205,221,127,16,13,42,119,105,82,29,136,198,
+	191,247,206,86,181,166,142,122,60,31,238,83,181,166,146,123,9,25,2,210,154,117,229,187,
+	192,31,212,140,66,136,84,10,0,209,236,191,71,47,230,247,2,47,142,177,251,53,192,183,
+	204,76,179,190,217,26,160,237,76,136,5,81,46,255,138,94,226,114,197,76,107,163,155,253,
+	29,184,172,202,195,28,15,220,231,238,135,52,240,249,117,72,100,0,28,95,229,161,46,139,
+	234,64,212,135,90,47,19,57,13,184,94,213,218,242,2,192,109,72,120,78,250,187,101,172,
+	207,147,192,219,128,223,165,236,178,254,14,156,168,214,21,66,164,82,0,40,114,253,39,50,
+	248,62,28,99,247,71,128,19,128,103,213,164,153,98,34,193,253,191,92,250,9,174,255,171,
+	85,117,169,103,94,13,142,241,74,224,10,119,191,208,221,223,80,199,103,215,27,220,253,66,
+	224,138,232,156,73,184,118,209,152,247,222,130,72,0,16,173,45,0,20,128,127,168,74,83,
+	207,42,224,3,192,247,82,82,222,126,224,35,84,22,55,71,8,209,194,76,72,88,121,134,
+	103,255,95,14,188,54,198,3,112,38,240,48,154,245,205,26,83,41,63,5,228,90,194,44,
+	92,191,170,45,3,35,115,179,191,185,123,14,232,174,193,225,14,7,14,119,247,59,129,27,
+	128,191,2,119,154,217,195,21,26,252,47,7,94,7,236,69,200,41,253,186,26,94,122,206,
+	204,254,166,30,80,87,106,233,1,240,105,96,165,170,180,229,5,128,107,101,132,101,134,33,
+	194,132,210,163,192,247,169,189,199,80,45,249,52,176,80,77,38,132,72,187,0,0,97,118,
+	230,93,148,231,246,61,0,124,3,184,193,204,20,249,52,123,131,179,233,148,23,4,114,40,
+	50,234,22,163,116,92,89,18,1,102,185,251,107,129,3,106,116,200,215,21,27,235,238,62,
+	20,245,153,37,132,0,80,143,71,131,169,69,209,38,59,69,125,112,135,232,179,45,176,61,
+	245,243,156,250,147,153,205,82,203,55,228,29,83,11,102,153,217,245,170,206,150,23,0,254,
+	130,92,255,179,200,124,160,15,184,152,120,203,16,27,89,190,223,168,153,132,16,89,17,0,
+	38,199,24,240,159,3,156,11,172,115,247,54,51,147,241,151,173,190,185,99,153,219,254,51,
+	250,12,70,131,58,121,130,100,135,131,9,107,50,15,173,147,33,56,108,220,191,177,201,215,
+	121,57,240,62,53,119,67,168,197,140,222,165,64,78,85,217,242,2,192,163,192,29,170,202,
+	204,114,5,33,67,192,229,4,241,55,41,220,9,124,89,205,35,132,168,102,0,156,52,94,
+	2,236,86,198,118,247,1,115,129,21,128,140,255,236,209,1,76,43,99,187,231,8,65,112,
+	214,203,248,207,224,8,221,108,208,204,222,77,152,237,200,42,243,205,236,221,10,96,154,154,
+	247,222,82,224,75,170,198,150,23,0,214,16,98,206,136,108,115,55,33,67,192,157,9,41,
+	207,114,66,138,236,181,106,26,33,68,86,4,128,118,194,236,255,120,134,223,18,224,104,224,
+	9,25,125,153,29,152,237,8,108,60,206,118,171,8,217,31,86,68,127,171,31,100,87,8,
+	56,14,248,92,81,91,103,129,21,192,231,162,107,19,141,125,207,84,202,58,66,164,112,185,
+	124,183,182,0,48,72,240,2,89,161,106,108,9,22,71,247,253,101,9,40,203,231,8,158,
+	39,66,8,145,25,1,96,115,66,68,211,177,120,14,248,36,112,215,176,193,103,102,50,252,
+	178,197,36,198,143,254,191,38,50,254,159,81,117,181,140,8,240,19,96,111,224,150,12,92,
+	206,45,192,222,209,53,137,116,188,247,214,0,123,0,247,171,10,91,90,0,24,4,46,138,
+	198,34,34,91,239,152,177,62,43,128,247,3,103,54,177,136,63,137,250,158,16,66,100,74,
+	0,216,19,120,253,24,255,95,14,28,71,136,184,171,245,222,217,101,91,96,235,49,254,191,
+	142,16,241,255,113,181,127,203,13,208,238,51,179,125,128,239,164,248,50,190,99,102,251,152,
+	217,125,106,209,166,80,201,236,217,10,66,102,26,181,89,118,40,84,176,207,122,224,66,25,
+	255,45,203,32,240,5,224,139,52,62,224,240,189,209,121,133,16,34,83,2,192,36,194,186,
+	166,209,220,51,87,1,95,33,184,221,13,167,219,145,241,151,61,218,9,179,255,163,205,206,
+	12,0,55,71,131,120,197,125,104,93,33,224,203,132,20,124,183,167,168,216,183,3,111,143,
+	202,46,154,128,187,67,136,47,18,151,253,129,135,84,131,153,98,82,5,251,252,6,200,171,
+	234,90,158,31,16,188,1,26,149,2,116,37,112,152,153,173,30,203,75,65,8,33,210,40,
+	0,108,25,13,232,75,177,30,56,29,56,143,17,185,118,245,208,203,28,27,51,122,180,221,
+	33,224,54,66,196,127,25,255,18,1,110,52,179,55,0,255,147,130,226,254,143,153,189,193,
+	204,20,52,172,249,196,121,118,220,10,188,130,16,104,116,138,170,46,83,196,153,64,120,18,
+	56,31,120,170,66,225,64,100,143,63,16,226,2,60,217,128,115,29,11,60,168,42,23,66,
+	100,81,0,120,41,33,239,118,41,46,5,122,9,107,48,69,182,153,74,136,5,81,138,71,
+	9,110,112,138,150,46,138,133,128,175,17,210,248,93,153,192,226,93,9,188,49,42,163,104,
+	166,181,231,255,177,247,150,148,185,203,127,3,251,70,3,239,78,194,18,52,145,29,86,149,
+	185,221,223,121,126,230,127,35,194,18,52,33,32,164,128,220,19,184,167,142,231,56,143,32,
+	62,9,33,68,58,5,0,119,31,237,211,78,112,177,108,31,229,1,251,13,51,91,42,151,
+	167,236,219,114,132,156,236,165,26,246,105,224,175,72,4,18,165,69,128,127,152,217,33,192,
+	161,132,220,205,205,230,10,224,80,51,59,196,204,254,161,22,74,20,235,203,216,230,3,192,
+	55,35,99,111,34,163,184,125,23,191,195,134,127,23,169,161,28,79,144,203,163,247,206,96,
+	52,94,26,47,245,154,6,37,173,199,227,192,91,168,143,0,253,0,48,83,85,44,132,168,
+	53,19,26,105,252,143,193,38,148,118,255,127,12,165,60,105,37,38,82,218,253,191,0,252,
+	25,232,87,21,137,113,132,128,43,128,43,220,253,181,192,135,128,253,8,153,3,26,193,173,
+	81,63,189,196,204,238,82,107,36,174,111,12,191,135,198,50,252,174,6,78,32,44,51,26,
+	22,153,203,17,12,228,149,148,62,198,26,148,252,11,184,17,88,26,83,48,144,2,212,154,
+	44,7,222,13,156,5,28,83,163,99,174,38,196,197,90,165,234,21,66,164,86,0,24,135,
+	29,128,221,75,24,255,135,3,119,234,165,218,50,108,70,136,5,49,210,248,191,18,165,251,
+	19,241,140,189,187,8,169,66,113,247,169,192,91,129,189,128,221,128,25,209,103,211,10,15,
+	191,18,88,16,125,238,39,204,16,222,100,102,253,170,249,84,136,0,223,33,164,243,123,73,
+	209,191,86,1,71,0,255,23,203,130,124,94,216,222,220,204,150,169,134,83,197,157,132,108,
+	51,197,65,33,7,128,171,162,241,71,37,76,66,75,4,50,253,252,24,131,65,119,63,150,
+	48,97,117,6,213,123,216,126,1,101,29,17,66,212,235,121,214,168,19,141,225,1,96,192,
+	167,9,249,77,135,233,3,62,65,136,246,62,84,198,131,87,100,131,221,8,75,65,134,89,
+	70,152,145,123,18,137,64,162,246,207,164,173,8,30,39,59,1,47,6,118,142,62,195,41,
+	40,159,142,158,69,125,192,191,129,69,192,98,51,147,24,149,141,246,223,154,16,216,239,105,
+	66,154,191,56,207,152,225,20,180,155,154,217,74,213,102,170,153,28,25,238,171,171,48,222,
+	39,82,158,167,136,200,246,51,101,248,215,247,3,191,32,120,183,86,194,133,4,65,50,142,
+	0,33,132,16,169,18,0,38,1,63,5,62,30,253,189,56,50,254,175,163,200,229,78,15,
+	190,204,51,28,7,98,215,232,239,21,192,53,145,225,37,227,95,8,81,239,247,82,27,193,
+	43,164,220,96,127,27,155,153,98,146,100,115,92,52,49,134,24,208,142,150,128,136,13,159,
+	39,111,32,100,10,216,54,230,97,30,1,94,31,141,129,36,0,8,33,234,66,18,178,0,
+	76,33,184,99,66,136,206,252,57,224,122,148,230,173,213,152,200,243,51,175,171,8,107,169,
+	101,252,11,33,234,103,233,189,48,168,236,144,153,45,31,43,207,246,136,143,140,255,140,218,
+	113,196,243,4,144,241,47,74,241,15,66,134,128,56,110,252,107,9,235,254,87,168,250,132,
+	16,89,23,0,182,2,118,228,249,153,255,171,244,66,109,73,38,19,196,160,21,4,183,255,
+	69,50,254,133,16,66,8,145,82,254,5,236,19,141,105,202,225,4,162,216,53,66,8,145,
+	9,198,72,1,248,94,119,191,199,221,247,41,78,165,52,242,35,50,207,12,194,154,183,23,
+	161,84,74,66,8,33,132,200,198,56,119,130,187,255,216,199,230,87,170,65,33,68,171,60,
+	24,219,220,253,72,119,127,117,244,59,18,0,90,18,35,172,253,223,66,198,191,16,66,8,
+	33,50,56,14,254,138,187,15,149,48,254,31,115,247,205,85,67,66,136,86,17,0,38,186,
+	251,86,238,46,163,175,181,105,35,44,1,16,66,8,33,132,200,234,56,248,67,238,190,170,
+	200,248,95,235,238,111,208,68,151,16,162,149,4,0,211,12,191,16,66,8,33,132,104,145,
+	113,240,158,238,254,84,36,0,124,81,227,96,33,132,16,66,8,33,132,16,34,155,2,0,
+	238,62,221,221,115,90,234,42,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	68,235,146,137,244,123,3,67,3,47,136,158,210,110,237,152,89,67,175,205,221,247,5,142,
+	3,14,4,166,164,160,218,150,3,87,3,103,153,217,245,173,208,217,221,125,107,96,79,96,
+	17,112,175,153,121,140,125,13,104,7,58,128,109,162,159,147,128,193,168,46,159,5,158,1,
+	214,199,57,110,43,113,204,235,58,19,81,142,179,239,204,87,218,127,222,3,252,162,232,254,
+	126,26,120,143,153,253,93,173,43,132,16,66,8,33,210,64,155,170,64,8,33,132,16,66,
+	8,33,132,200,62,19,210,126,1,35,103,255,1,6,125,240,63,223,79,104,155,80,119,79,
+	128,104,246,255,76,224,85,41,170,186,41,192,7,129,93,220,253,248,172,123,1,184,251,219,
+	129,75,129,105,132,89,251,239,186,251,137,99,205,214,187,251,132,168,77,15,2,222,2,236,
+	14,188,136,32,156,21,139,103,30,125,242,192,3,238,126,43,112,13,112,179,153,173,214,99,
+	166,52,63,188,99,233,127,234,254,216,215,79,179,20,28,251,123,188,208,187,103,107,224,116,
+	96,127,181,166,16,66,8,33,132,72,3,169,94,2,80,202,248,31,73,189,151,3,164,212,
+	248,31,201,125,64,73,17,192,83,150,156,182,84,91,187,123,59,112,43,240,198,226,238,3,
+	188,214,204,238,47,177,253,214,192,209,192,81,192,43,162,251,36,78,31,26,174,179,39,129,
+	95,1,63,2,30,106,245,165,1,197,75,0,138,13,244,90,27,234,227,29,187,146,37,0,
+	238,62,25,88,85,226,95,79,153,217,182,122,149,8,33,132,16,66,136,52,144,218,37,0,
+	229,24,255,16,188,1,234,101,196,102,196,248,39,42,255,153,238,190,111,116,77,89,163,29,
+	216,190,196,119,123,141,104,207,45,220,253,116,224,33,224,127,128,221,162,123,36,174,97,58,
+	44,24,108,7,124,17,184,27,184,192,221,95,150,180,138,113,247,109,221,253,231,238,126,129,
+	187,111,223,136,115,150,50,208,199,250,62,33,199,222,104,148,239,55,214,107,68,8,33,132,
+	16,66,72,0,72,128,241,223,0,17,224,184,12,24,255,197,34,192,113,209,39,107,172,7,
+	250,74,24,233,175,137,140,224,54,119,63,18,184,7,56,17,152,74,237,188,99,140,16,44,
+	240,99,192,29,238,62,199,221,19,97,52,186,251,182,192,149,192,199,129,35,128,43,162,239,
+	154,70,53,134,122,45,4,4,33,132,16,66,8,33,36,0,36,140,74,214,245,215,73,4,
+	56,48,99,253,225,192,177,174,201,138,24,237,251,122,82,78,89,70,41,183,19,102,225,71,
+	178,187,187,79,3,46,0,254,151,48,99,63,214,241,134,215,250,175,2,158,2,22,19,220,
+	252,151,21,253,111,172,62,182,25,240,223,192,181,238,190,115,66,140,255,215,20,215,7,112,
+	85,26,69,0,25,255,66,8,33,132,16,66,100,84,0,72,144,8,48,37,99,253,97,74,
+	6,175,105,152,123,74,24,231,175,1,110,4,62,58,198,189,224,192,66,194,58,254,35,8,
+	158,18,219,1,59,3,47,1,102,0,47,142,126,127,31,144,3,238,5,134,70,211,35,128,
+	55,3,183,184,251,91,18,100,252,55,76,4,40,103,173,127,28,131,190,156,109,107,29,100,
+	80,8,33,132,16,66,136,52,146,138,65,241,88,17,253,227,46,7,128,250,7,6,76,26,
+	238,62,133,48,179,127,28,176,239,184,157,162,168,110,138,5,147,114,190,175,243,117,84,92,
+	22,119,127,19,240,215,24,125,126,32,50,146,207,4,110,48,179,181,49,202,217,14,236,17,
+	213,247,97,140,190,126,124,25,240,33,51,187,38,33,198,127,49,247,0,7,153,217,146,90,
+	157,187,56,8,96,173,12,247,74,142,81,97,16,192,169,132,44,15,35,41,152,217,84,189,
+	74,132,16,66,8,33,68,26,72,188,7,64,177,129,63,48,52,224,35,13,254,4,45,7,
+	72,44,102,182,220,204,46,5,142,7,174,175,198,0,31,38,1,162,70,220,178,60,76,233,
+	40,238,27,28,58,18,10,222,14,188,23,184,38,142,241,31,213,247,160,153,253,29,248,68,
+	36,4,252,145,210,30,1,155,3,151,52,202,19,192,221,183,41,97,252,15,20,223,26,69,
+	191,39,222,19,64,51,255,66,8,33,132,16,66,100,72,0,24,205,184,147,8,80,177,16,
+	112,31,112,86,139,246,245,101,108,24,8,112,36,107,129,185,4,87,255,201,132,25,252,31,
+	186,251,101,238,126,90,52,11,28,167,190,61,74,51,248,30,96,38,176,114,20,17,224,215,
+	13,138,9,112,218,8,227,255,50,224,146,162,191,47,143,62,197,34,192,25,245,44,80,165,
+	34,128,140,127,33,132,16,66,8,33,50,38,0,12,250,224,168,255,171,149,8,80,201,18,
+	130,148,115,117,21,2,66,217,129,247,234,77,220,178,152,217,16,97,109,254,120,2,192,103,
+	9,222,2,215,0,223,7,62,15,28,10,124,21,248,133,187,183,85,80,214,65,51,59,27,
+	120,39,33,104,224,72,182,37,164,9,172,119,118,0,31,97,252,127,132,23,122,69,172,34,
+	44,89,248,67,209,119,237,245,110,203,184,34,128,140,127,33,132,16,66,8,33,50,40,0,
+	140,103,212,215,66,4,24,211,90,114,223,215,221,47,113,247,101,158,14,150,69,229,221,119,
+	12,99,116,121,11,247,247,187,24,59,74,255,230,192,139,34,163,215,120,97,188,0,139,12,
+	248,23,85,33,90,220,10,28,52,138,8,176,55,208,93,231,235,255,26,240,29,224,100,224,
+	35,102,182,170,68,25,87,69,194,192,127,3,243,129,89,141,104,152,114,69,0,25,255,66,
+	8,33,132,16,66,100,84,0,104,148,8,80,106,45,121,100,68,159,9,124,144,244,68,198,
+	159,18,149,247,204,177,68,128,22,23,0,170,97,45,176,166,154,3,152,217,189,81,27,141,
+	92,14,96,192,137,238,254,178,122,93,188,153,61,99,102,95,54,179,83,74,25,255,69,219,
+	173,54,179,111,154,217,113,102,246,68,163,26,167,22,134,187,140,127,33,132,16,66,8,33,
+	198,176,175,147,84,152,209,162,253,79,104,155,96,99,185,234,15,12,13,120,241,62,227,109,
+	63,146,145,75,13,138,140,255,87,165,180,93,95,21,137,0,199,155,217,245,181,58,104,146,
+	98,38,84,88,150,251,9,65,239,38,198,61,93,244,249,182,153,61,87,3,67,252,86,119,
+	239,38,204,176,23,139,112,155,1,39,187,251,145,102,214,146,121,237,143,125,253,52,139,147,
+	2,176,18,227,223,221,15,136,126,61,30,152,78,121,203,28,70,219,102,115,119,191,175,204,
+	34,174,7,30,1,190,21,245,131,219,245,10,18,66,8,33,132,16,141,36,49,179,101,229,
+	204,228,143,103,212,143,220,39,238,250,254,118,107,127,71,244,107,154,141,255,98,238,3,54,
+	16,1,198,51,158,71,75,177,87,206,246,205,54,250,199,42,139,187,79,0,254,14,188,110,
+	12,67,127,248,231,114,66,208,192,7,35,225,224,38,224,166,40,150,64,45,174,165,157,176,
+	214,254,144,17,255,90,7,188,198,204,30,108,80,157,158,3,124,42,250,243,34,51,59,188,
+	94,231,26,153,6,112,44,226,138,0,113,102,254,127,120,199,210,129,113,140,250,122,179,44,
+	234,171,29,122,5,9,33,132,16,66,136,70,146,8,15,128,82,134,250,200,89,253,97,3,
+	191,158,158,0,132,168,239,100,196,248,31,190,142,227,168,34,245,95,150,48,179,1,119,159,
+	73,136,124,191,109,100,232,175,0,30,3,30,0,254,89,244,243,113,96,77,173,12,254,18,
+	101,25,116,247,89,192,126,192,70,69,255,154,72,8,60,120,66,43,183,85,28,79,128,10,
+	220,254,219,155,124,121,155,235,110,20,66,8,33,132,16,45,41,0,196,49,232,27,32,2,
+	28,152,193,54,174,217,53,197,245,12,168,179,49,95,81,89,34,247,251,87,0,187,0,5,
+	224,95,132,89,119,111,130,219,253,63,129,139,129,163,138,139,8,124,196,221,191,110,102,171,
+	27,80,134,226,245,47,3,122,36,10,33,132,16,66,8,145,93,154,26,4,176,28,195,188,
+	212,54,181,14,12,56,161,109,130,69,219,76,33,61,1,255,202,101,138,186,249,6,34,192,
+	50,51,187,205,204,30,54,179,53,102,54,212,140,53,247,209,57,207,2,70,122,25,108,11,
+	236,19,231,88,238,254,34,119,255,133,187,255,210,221,183,139,177,235,249,192,82,130,24,242,
+	243,24,231,219,222,221,47,114,247,243,221,125,219,90,215,77,156,37,0,149,198,12,16,66,
+	8,33,132,16,162,213,104,154,7,64,28,215,252,122,122,2,212,58,117,160,16,49,185,131,
+	16,99,224,213,35,190,127,39,240,167,114,141,127,224,170,162,99,60,199,243,203,89,198,19,
+	33,110,114,247,29,195,175,182,34,70,185,191,78,72,23,8,176,187,187,31,108,102,79,54,
+	218,248,47,222,39,198,82,128,179,163,159,199,52,161,189,215,19,82,44,10,33,132,16,66,
+	8,209,26,2,64,220,224,124,245,18,1,100,252,199,35,3,89,0,18,71,20,11,224,74,
+	66,188,134,225,254,104,192,222,238,110,209,54,30,195,248,7,120,54,102,25,86,86,80,244,
+	103,138,126,223,29,184,202,221,15,170,86,4,168,102,54,191,92,17,192,204,142,141,234,174,
+	27,216,145,242,98,2,108,14,220,92,226,251,21,192,222,49,140,255,69,102,182,70,79,19,
+	33,132,16,66,8,209,20,251,35,13,198,255,72,163,63,238,49,75,101,7,40,117,156,24,
+	70,229,171,205,236,190,102,55,158,187,191,10,184,183,12,131,199,226,92,103,86,179,0,36,
+	21,119,127,15,240,187,17,247,227,179,192,246,209,53,173,139,97,252,255,30,248,104,189,227,
+	7,184,251,198,192,69,192,251,138,190,190,23,24,85,4,24,47,11,64,173,92,249,199,19,
+	1,206,190,51,95,201,245,78,5,74,237,88,48,179,169,122,149,8,33,132,16,66,136,52,
+	208,208,24,0,213,26,255,163,29,163,214,49,1,202,48,50,239,75,66,227,37,165,28,162,
+	106,74,181,99,39,176,85,244,41,215,248,255,67,35,140,255,168,239,173,1,14,7,46,43,
+	250,250,213,192,213,49,99,16,148,109,252,31,251,250,105,86,206,12,191,98,2,8,33,132,
+	16,66,8,81,154,134,45,1,168,133,241,95,124,172,106,151,3,136,138,140,190,146,158,1,
+	205,112,199,79,82,70,130,26,240,44,176,156,23,166,135,51,96,203,232,247,197,35,140,255,
+	237,129,63,142,48,254,135,163,249,159,59,74,117,12,2,231,153,217,53,113,10,230,238,7,
+	2,159,96,116,55,121,143,142,61,252,255,87,17,150,3,28,108,102,139,107,105,252,23,255,
+	62,222,62,49,99,2,8,33,132,16,66,8,33,1,32,137,198,127,53,34,128,16,9,101,
+	61,176,178,132,0,48,90,6,135,111,177,97,208,192,118,224,61,227,156,231,80,119,127,113,
+	185,193,254,220,125,10,240,43,160,35,230,245,188,42,42,227,145,181,54,254,37,2,8,33,
+	132,16,66,8,81,57,117,95,2,80,79,131,92,81,253,69,139,50,84,225,126,131,132,25,
+	251,114,241,42,206,53,238,126,149,26,255,229,252,47,206,57,132,16,66,8,33,132,104,21,
+	234,234,1,208,136,217,248,114,61,1,36,12,84,207,104,174,246,205,8,2,152,149,44,0,
+	17,19,129,77,75,24,223,203,71,217,254,43,132,200,251,175,41,190,21,128,95,3,171,198,
+	48,254,207,143,19,241,223,204,86,184,251,251,8,51,249,163,45,1,216,4,248,240,136,103,
+	201,93,81,25,235,102,252,23,111,35,79,0,33,132,16,66,8,33,154,44,0,52,210,21,
+	127,44,17,160,221,218,83,25,25,94,180,20,91,178,161,187,255,16,163,164,243,51,179,37,
+	238,126,48,33,8,224,238,69,247,242,102,192,167,107,25,4,208,204,110,2,110,42,245,63,
+	119,159,76,200,4,48,210,248,63,216,204,158,170,183,241,47,17,64,8,33,132,16,66,136,
+	120,212,101,9,64,51,214,225,143,182,28,64,198,191,112,247,9,238,254,78,119,255,188,187,
+	239,146,192,34,190,170,196,119,253,192,51,209,167,164,8,0,28,4,220,83,244,245,123,128,
+	139,34,195,188,222,117,58,25,184,16,120,111,209,215,119,143,103,252,151,107,208,55,98,31,
+	33,132,16,66,8,33,36,0,164,208,248,79,194,185,91,1,43,34,13,101,137,12,255,9,
+	192,5,132,217,242,179,129,219,221,253,208,132,85,237,91,75,124,247,0,33,56,224,250,49,
+	234,96,9,112,48,112,111,209,215,239,5,186,27,80,230,147,129,247,39,193,248,151,8,32,
+	132,16,66,8,33,68,19,4,128,36,24,224,18,1,68,17,251,68,159,15,19,162,234,67,
+	88,107,63,47,18,6,154,142,187,183,71,70,124,177,241,234,192,173,102,230,102,54,102,127,
+	54,179,39,9,158,0,197,34,192,212,152,101,216,200,221,55,138,89,244,157,138,126,191,39,
+	50,254,151,84,99,168,215,194,128,175,227,177,61,230,247,66,8,33,132,16,66,100,87,0,
+	144,225,45,18,200,22,209,103,164,241,183,59,240,186,132,148,241,245,192,110,37,190,191,166,
+	220,3,68,34,192,129,192,121,192,185,132,20,124,229,26,255,123,1,139,128,127,187,251,219,
+	98,148,251,20,224,79,192,111,128,131,202,53,254,71,51,200,107,57,123,95,143,99,187,251,
+	50,74,7,101,124,92,183,153,16,66,8,33,132,72,11,53,153,5,77,146,241,175,104,255,
+	245,35,73,145,247,203,44,203,205,209,207,213,132,104,245,255,177,153,129,227,221,253,19,227,
+	205,176,215,249,26,12,56,142,13,133,184,39,139,202,94,174,8,176,4,248,100,5,197,56,
+	26,216,38,250,253,51,192,141,101,158,239,1,224,157,181,52,212,107,73,173,143,221,214,214,
+	230,238,126,46,240,133,17,255,250,153,158,12,66,8,33,132,16,34,45,84,237,1,144,36,
+	163,80,198,191,24,193,211,209,231,138,145,246,43,112,24,165,131,239,53,146,87,2,31,25,
+	121,75,1,191,170,101,36,255,113,152,56,202,239,66,8,33,132,16,66,136,140,81,149,193,
+	236,238,62,232,131,153,49,254,203,21,51,146,148,89,160,156,50,143,44,239,120,251,20,111,
+	95,201,241,147,116,173,209,126,251,2,215,178,161,224,117,21,112,168,153,13,54,161,221,218,
+	129,63,0,135,140,248,215,90,224,181,102,246,96,131,202,113,14,240,169,232,207,139,204,236,
+	112,61,22,133,16,66,8,33,132,200,38,21,123,0,100,205,248,23,227,147,182,44,0,69,
+	220,8,220,80,226,251,3,129,99,154,116,9,159,37,4,239,27,201,165,192,67,234,109,66,
+	8,33,132,16,66,136,68,8,0,73,49,254,219,173,93,198,191,40,71,44,24,2,78,98,
+	195,148,122,6,156,225,238,111,105,100,121,220,125,111,32,87,226,254,91,1,156,220,204,184,
+	4,66,8,33,132,16,66,8,9,0,137,52,254,147,228,138,47,18,207,45,132,128,109,35,
+	141,235,77,128,75,221,189,33,89,1,220,253,213,132,89,254,77,75,252,251,91,102,246,72,
+	29,207,189,149,187,127,199,221,191,233,238,155,140,177,221,100,119,255,111,119,239,117,247,237,
+	212,117,132,16,66,8,33,132,200,6,177,178,0,200,248,111,109,82,152,5,224,63,152,153,
+	187,251,87,129,125,129,93,70,252,123,107,224,74,119,255,144,153,221,84,199,50,239,29,25,
+	255,47,42,241,239,91,8,94,1,245,228,116,224,211,209,239,123,184,251,71,74,148,113,19,
+	224,34,224,61,209,87,29,192,17,234,253,66,8,33,132,16,66,164,159,178,61,0,100,252,
+	139,180,99,102,253,192,145,64,161,196,191,135,69,128,47,68,1,250,106,105,248,183,187,251,
+	49,192,53,163,24,255,79,2,71,154,217,154,122,87,65,209,239,239,137,12,253,98,79,128,
+	77,128,95,21,25,255,0,131,234,57,66,8,33,132,16,66,100,196,38,146,241,255,194,235,
+	44,211,144,84,22,128,38,212,71,173,202,226,238,255,15,248,37,176,81,169,127,3,127,6,
+	186,129,187,171,89,143,239,238,70,72,245,215,67,8,248,87,74,112,91,70,200,68,240,151,
+	6,212,223,54,132,204,7,175,41,250,122,61,207,167,255,27,4,138,197,143,123,128,131,204,
+	108,137,30,149,66,8,33,132,16,66,180,128,0,48,48,52,144,8,183,239,70,204,252,75,
+	0,24,91,0,40,231,251,70,93,107,181,101,113,247,35,129,159,0,27,143,178,201,58,224,
+	55,192,89,192,223,204,108,32,70,57,219,129,61,128,227,128,195,70,17,26,134,141,255,15,
+	153,217,53,13,236,47,219,2,87,142,16,1,74,33,227,95,8,33,132,16,66,8,9,0,
+	217,52,254,37,0,180,150,0,16,237,247,110,224,124,96,234,88,155,17,210,242,93,73,72,
+	39,120,47,240,20,48,0,12,69,247,208,68,96,75,224,85,192,91,129,131,129,221,24,123,
+	137,205,147,192,97,141,152,249,175,64,4,144,241,47,132,16,66,8,33,68,171,9,0,173,
+	100,252,75,0,104,61,1,32,218,119,119,224,130,200,120,183,113,132,128,97,86,0,43,9,
+	46,243,109,132,136,254,83,202,189,175,128,155,129,143,155,89,95,19,251,205,104,34,128,140,
+	127,33,132,16,66,8,33,36,0,100,219,248,151,0,48,190,0,144,138,14,93,65,219,184,
+	251,102,192,55,9,46,251,27,215,177,120,43,128,111,1,185,6,4,252,171,68,4,144,241,
+	47,132,16,66,8,33,132,4,128,236,27,255,18,0,90,87,0,40,186,214,221,129,83,128,
+	67,9,41,50,107,209,206,78,136,39,112,9,112,138,153,61,146,164,250,138,68,128,51,8,
+	158,12,95,49,179,39,244,88,20,66,8,33,132,16,66,2,0,0,19,218,38,216,192,208,
+	128,183,91,8,22,94,143,236,0,205,74,245,39,1,160,181,5,128,232,122,13,216,29,56,
+	6,248,32,97,109,127,220,99,14,215,217,147,192,197,192,143,129,135,170,201,40,32,132,16,
+	66,8,33,132,16,117,19,0,70,75,253,55,161,109,66,93,189,6,154,101,252,75,0,72,
+	230,245,53,185,110,55,3,222,6,28,0,236,5,236,2,116,68,247,205,240,199,163,207,16,
+	208,15,60,0,220,2,92,3,220,98,102,171,85,147,66,8,33,132,16,66,136,68,11,0,
+	163,205,254,143,119,192,106,4,128,102,26,255,18,0,0,88,30,109,191,185,110,141,13,234,
+	217,128,73,192,214,192,22,132,160,127,237,132,108,0,203,129,103,129,103,128,245,154,233,23,
+	66,8,33,132,16,66,36,145,9,73,42,140,102,158,155,206,213,170,2,33,132,16,66,8,
+	33,132,104,33,1,160,209,193,255,154,61,243,47,0,184,15,56,75,213,80,154,104,86,127,
+	45,240,120,244,17,66,8,33,132,16,66,136,244,11,0,37,55,44,195,253,95,198,127,170,
+	141,255,227,205,236,122,85,133,16,66,8,33,132,16,66,100,147,182,102,158,92,198,191,140,
+	127,33,132,16,66,8,33,132,16,141,97,3,15,128,82,238,255,195,41,255,100,252,103,138,
+	229,132,53,255,103,201,248,23,66,8,33,132,16,66,136,22,20,0,74,17,199,80,159,208,
+	54,193,198,139,33,32,227,191,185,168,238,133,16,66,8,33,132,16,162,245,168,249,18,128,
+	241,210,210,101,193,248,119,247,87,169,28,66,8,33,132,16,66,8,33,210,196,6,134,248,
+	104,179,247,163,5,1,140,147,49,32,233,198,255,120,226,69,106,27,89,51,254,66,8,33,
+	132,16,66,8,209,242,180,149,107,0,23,27,250,238,238,3,67,3,158,37,227,95,8,33,
+	132,16,66,8,33,132,200,50,54,154,145,95,75,210,98,252,203,3,64,8,33,132,16,66,
+	8,33,68,86,153,80,247,19,140,178,116,32,161,44,143,126,78,201,80,27,47,87,55,23,
+	66,8,33,132,16,66,8,49,1,106,63,243,159,50,163,191,152,171,163,159,31,204,80,27,
+	95,173,110,46,132,16,66,8,33,132,16,162,106,15,128,140,173,237,63,43,250,185,11,144,
+	133,8,251,247,21,93,147,16,66,8,33,132,16,66,136,22,198,160,50,15,128,20,207,242,
+	143,139,187,239,11,156,153,114,17,224,62,224,120,51,187,94,221,92,8,33,132,16,66,8,
+	33,132,69,6,175,3,12,250,96,201,141,90,49,130,127,202,69,0,25,255,66,8,33,132,
+	16,66,8,33,54,20,0,134,25,233,9,144,229,89,254,24,34,192,113,192,129,164,35,48,
+	224,114,194,154,255,179,100,252,11,33,132,16,66,8,33,132,40,166,77,85,32,132,16,66,
+	8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,100,128,255,15,103,56,231,59,72,
+	244,194,171,0,0,0,0,73,69,78,68,174,66,96,130,
+};
@@ -0,0 +1,138 @@
+#include "LatencyTracker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+double LatencyTracker::Now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double LatencyTracker::FromStreamTime(double streamTime, double streamNow)
+{
+	double now = Now();
+
+	// some hosts leave the times at 0, or give an ADC time after the callback started
+	if (streamTime <= 0 || streamNow <= 0 || streamTime > streamNow)
+		return now;
+
+	return now - (streamNow - streamTime);
+}
+
+void LatencyTracker::Begin(Source source, double inputTime, double handledTime)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if ((int)_pending.size() >= MaxPending)
+		return;
+
+	Sample sample;
+	sample.source = source;
+	sample.input = inputTime;
+	sample.stages[StageHandled] = handledTime;
+	_pending.push_back(sample);
+}
+
+void LatencyTracker::Mark(Stage stage)
+{
+	double now = Now();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto& sample : _pending)
+	{
+		if (sample.stages[stage] < 0 && (stage == StageHandled || sample.stages[stage - 1] >= 0))
+			sample.stages[stage] = now;
+	}
+}
+
+void LatencyTracker::FrameDisplayed()
+{
+	Mark(StageDisplayed);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto finished = std::stable_partition(_pending.begin(), _pending.end(), [](const Sample& sample) { return sample.stages[StageDisplayed] < 0; });
+	for (auto it = finished; it != _pending.end(); ++it)
+	{
+		auto& history = _history[it->source];
+		int& next = _next[it->source];
+		if ((int)history.size() < History)
+			history.push_back(*it);
+		else
+			history[next] = *it;
+		next = (next + 1) % History;
+	}
+	_pending.erase(finished, _pending.end());
+}
+
+LatencyTracker::Stats LatencyTracker::GetStats(Source source) const
+{
+	Stats stats;
+
+	std::vector<float> totals;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		const auto& history = _history[source];
+		stats.count = (int)history.size();
+		totals.reserve(history.size());
+		for (const auto& sample : history)
+		{
+			totals.push_back((float)((sample.stages[StageDisplayed] - sample.input) * 1000.0));
+			for (int s = 0; s < StageCount; s++)
+				stats.stageMeanMs[s] += (float)((sample.stages[s] - sample.input) * 1000.0);
+		}
+	}
+
+	if (totals.empty())
+		return stats;
+
+	for (auto& stageMs : stats.stageMeanMs)
+		stageMs /= totals.size();
+
+	std::sort(totals.begin(), totals.end());
+	for (float total : totals)
+		stats.meanMs += total;
+	stats.meanMs /= totals.size();
+	stats.p50Ms = totals[totals.size() / 2];
+	stats.p95Ms = totals[std::min(totals.size() - 1, totals.size() * 95 / 100)];
+	stats.maxMs = totals.back();
+
+	return stats;
+}
+
+void LatencyTracker::Clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pending.clear();
+	for (auto& history : _history)
+		history.clear();
+	_next.fill(0);
+}
+
+const char* LatencyTracker::SourceName(Source source)
+{
+	switch (source)
+	{
+	case SourceAudio: return "audio";
+	case SourceHotkey: return "hotkey";
+	case SourceHTTP: return "http";
+	case SourceLoopback: return "loopback";
+	default: return "";
+	}
+}
+
+std::string LatencyTracker::StatsJson() const
+{
+	std::string json = "{";
+	for (int s = 0; s < SourceCount; s++)
+	{
+		Stats stats = GetStats((Source)s);
+
+		char buf[256] = {};
+		snprintf(buf, sizeof(buf), "%s\"%s\":{\"count\":%d,\"meanMs\":%.2f,\"p50Ms\":%.2f,\"p95Ms\":%.2f,\"maxMs\":%.2f,\"handledMs\":%.2f,\"drawnMs\":%.2f}",
+			s == 0 ? "" : ",", SourceName((Source)s), stats.count, stats.meanMs, stats.p50Ms, stats.p95Ms, stats.maxMs,
+			stats.stageMeanMs[StageHandled], stats.stageMeanMs[StageDrawn]);
+		json += buf;
+	}
+	return json + "}";
+}
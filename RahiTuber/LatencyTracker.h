@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Input-to-photon latency. Each input is stamped when it happened - the ADC time of an audio
+// buffer, the moment a hotkey or HTTP request arrived - and followed through the frame that shows
+// it: handled (analysed, or the state changed), drawn into the layers, and displayed.
+// The last few hundred of each source are kept for rolling statistics.
+// Times are seconds on one steady clock, see Now().
+class LatencyTracker
+{
+public:
+
+	enum Source
+	{
+		SourceAudio,
+		SourceHotkey,
+		SourceHTTP,
+		SourceLoopback,		// a synthetic impulse injected into the audio callback
+		SourceCount
+	};
+
+	enum Stage
+	{
+		StageHandled,
+		StageDrawn,
+		StageDisplayed,
+		StageCount
+	};
+
+	static constexpr int History = 256;		// samples kept per source
+	static constexpr int MaxPending = 64;	// inputs waiting for a frame, more are dropped
+
+	struct Stats
+	{
+		int count = 0;
+		float meanMs = 0;
+		float p50Ms = 0;
+		float p95Ms = 0;
+		float maxMs = 0;
+		std::array<float, StageCount> stageMeanMs = {};		// from the input to the end of each stage
+	};
+
+	static double Now();
+
+	// Converts a PortAudio stream time to Now()'s clock, from the stream's own idea of the current time
+	static double FromStreamTime(double streamTime, double streamNow);
+
+	// Any thread. An input that has been handled and will show in the next frame drawn.
+	void Begin(Source source, double inputTime, double handledTime = Now());
+
+	// Render thread, when the frame reaches a stage. Inputs that haven't reached the stage before wait for the next frame.
+	void Mark(Stage stage);
+
+	// Render thread, after display(). Inputs that were drawn are finished and go into the statistics.
+	void FrameDisplayed();
+
+	Stats GetStats(Source source) const;
+	void Clear();
+
+	static const char* SourceName(Source source);
+
+	// All sources, for the HTTP endpoint
+	std::string StatsJson() const;
+
+private:
+
+	struct Sample
+	{
+		Source source = SourceAudio;
+		double input = 0;
+		std::array<double, StageCount> stages = { -1, -1, -1 };
+	};
+
+	mutable std::mutex _mutex;
+	std::vector<Sample> _pending;
+	std::array<std::vector<Sample>, SourceCount> _history;
+	std::array<int, SourceCount> _next = {};
+};
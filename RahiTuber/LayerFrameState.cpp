@@ -0,0 +1,85 @@
+#include "LayerFrameState.h"
+
+#include <algorithm>
+
+void LayerFrameState::Begin(int count)
+{
+	_count = count;
+
+	_idToIndex.clear();
+	_idToIndex.reserve(count);
+
+	for (auto& link : _links)
+		link.assign(count, -1);
+
+	_ownVisible.assign(count, 0);
+	_hideWithParent.assign(count, 0);
+	_depth.assign(count, 0);
+	_visible.assign(count, 0);
+	_neededByOthers.assign(count, 0);
+}
+
+void LayerFrameState::SetId(int idx, const std::string& id)
+{
+	if (id != "")
+		_idToIndex.emplace(id, idx);
+}
+
+int LayerFrameState::Find(const std::string& id) const
+{
+	if (id == "")
+		return -1;
+
+	auto it = _idToIndex.find(id);
+	if (it == _idToIndex.end())
+		return -1;
+
+	return it->second;
+}
+
+void LayerFrameState::Finish()
+{
+	const std::vector<int>& motionParent = _links[LinkMotionParent];
+	const std::vector<int>& folder = _links[LinkFolder];
+
+	for (int l = 0; l < _count; l++)
+	{
+		// depth is the length of the motion parent chain. The walk is capped so a bad cycle can't hang the frame
+		int depth = 0;
+		for (int mp = motionParent[l]; mp != -1 && depth < _count; mp = motionParent[mp])
+			depth++;
+		_depth[l] = depth;
+
+		// hidden along with each motion parent for as long as the chain keeps hiding with its parent
+		bool visible = _ownVisible[l] != 0;
+		int steps = 0;
+		for (int cur = l; visible && _hideWithParent[cur] && motionParent[cur] != -1 && steps < _count; steps++)
+		{
+			cur = motionParent[cur];
+			visible &= _ownVisible[cur] != 0;
+		}
+
+		if (folder[l] != -1)
+			visible &= _ownVisible[folder[l]] != 0;
+
+		_visible[l] = visible;
+
+		// anything this layer follows has to be calculated even when it's hidden
+		for (int link : { LinkMotionParent, LinkClip, LinkMotionTimer, LinkBounceTimer, LinkBlinkSync })
+		{
+			int target = _links[link][l];
+			if (target != -1)
+				_neededByOthers[target] = 1;
+		}
+	}
+
+	// back to front, parents before children
+	_calculateOrder.resize(_count);
+	for (int l = 0; l < _count; l++)
+		_calculateOrder[l] = _count - 1 - l;
+
+	std::stable_sort(_calculateOrder.begin(), _calculateOrder.end(), [this](int lhs, int rhs)
+		{
+			return _depth[lhs] < _depth[rhs];
+		});
+}
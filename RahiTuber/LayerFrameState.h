@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <string>
+#include <unordered_map>
+
+// Per-frame layer state, stored as one flat array per field and indexed like the layer list.
+// Rebuilt once at the start of each frame so the motion, visibility and draw passes can follow
+// links between layers by index instead of searching the layer list by id.
+class LayerFrameState
+{
+public:
+
+	enum Link
+	{
+		LinkMotionParent,
+		LinkFolder,
+		LinkClip,
+		LinkMotionTimer,
+		LinkBounceTimer,
+		LinkBlinkSync,
+		LinkCount
+	};
+
+	// Starts a new frame with the given number of layers. All links are cleared.
+	void Begin(int count);
+
+	// Registers the id of a layer, must be done for every layer before resolving links
+	void SetId(int idx, const std::string& id);
+
+	// Returns the index of the layer with this id, or -1
+	int Find(const std::string& id) const;
+
+	// Inputs for each layer: the link targets (by id) and its own visibility including tags
+	void SetLink(Link link, int idx, const std::string& targetId) { _links[link][idx] = Find(targetId); }
+	void SetOwnVisibility(int idx, bool visible, bool hideWithParent)
+	{
+		_ownVisible[idx] = visible;
+		_hideWithParent[idx] = hideWithParent;
+	}
+
+	// Computes depth, effective visibility, dependencies and the calculation order from the inputs
+	void Finish();
+
+	inline int Size() const { return _count; }
+	inline int GetLink(Link link, int idx) const { return (idx >= 0 && idx < _count) ? _links[link][idx] : -1; }
+	inline int Depth(int idx) const { return _depth[idx]; }
+	inline bool Visible(int idx) const { return _visible[idx] != 0; }
+	inline bool NeededByOthers(int idx) const { return _neededByOthers[idx] != 0; }
+
+	// Layer indices ordered so that motion parents are calculated before their children
+	inline const std::vector<int>& CalculateOrder() const { return _calculateOrder; }
+
+private:
+
+	int _count = 0;
+
+	std::unordered_map<std::string, int> _idToIndex;
+
+	std::array<std::vector<int>, LinkCount> _links;
+	std::vector<char> _ownVisible;
+	std::vector<char> _hideWithParent;
+
+	std::vector<int> _depth;
+	std::vector<char> _visible;
+	std::vector<char> _neededByOthers;
+	std::vector<int> _calculateOrder;
+};
@@ -29,7 +29,12 @@
 
 LayerManager::~LayerManager()
 {
-	_textureMan->Reset();
+	_saver.Stop();
+	if (_textureMan != nullptr)
+	{
+		ReleaseTextures();
+		_textureMan->RemoveUser();
+	}
 	//_chatReader.Cleanup();
 }
 
@@ -55,7 +60,7 @@ void SaveRTImage(sf::RenderTexture& rt, const std::string& name)
 
 //#define DEBUG_CLIP_RENDERING
 
-void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask)
+void LayerManager::Draw(const FrameTime& frame, sf::RenderTarget* target, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask)
 {
 	_lastTalkLevel = talkLevel;
 	_lastTalkMax = talkMax;
@@ -73,6 +78,16 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 		_loadingThread = nullptr;
 	}
 
+	UpdateExport();
+	UpdateSaves();
+	UpdateHotReload();
+
+	if (_primary)
+	{
+		_textureMan->UpdateScaledTextures(_appConfig->_textureVariants);
+		_textureMan->ReleaseUnusedTiles();
+	}
+
 	// reset to default states
 	if (_statesDirty)
 	{
@@ -84,6 +99,8 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 		_statesDirty = false;
 	}
 
+	BeginFrameState();
+
 	float talkFactor = 0;
 	if (_lastTalkMax > 0)
 	{
@@ -95,7 +112,7 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 	for (size_t stateIdx = 0; stateIdx < _states.size(); stateIdx++)
 	{
 		auto& state = _states[stateIdx];
-		if (!state._active && state._schedule && state._timer.getElapsedTime().asSeconds() > state._currentIntervalTime)
+		if (!state._active && state._schedule && state._timer.getElapsedSeconds(frame) > state._currentIntervalTime)
 		{
 			bool canTrigger = state._enabled;
 			if (canTrigger && state._canTrigger != StatesInfo::CanTrigger::TRIGGER_ALWAYS)
@@ -112,13 +129,13 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 
 				state._active = true;
 				state._currentIntervalTime = state._intervalTime + GetRandom11() * state._intervalVariation;
-				state._timer.restart();
+				state._timer.restart(frame);
 				_statesOrder.push_back(&_states[stateIdx]);
 			}
 		}
 
 		if (state._activeType == StatesInfo::Held && state._keyIsHeld)
-			state._timer.restart();
+			state._timer.restart(frame);
 	}
 
 	// Do tag visibility
@@ -135,13 +152,13 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 	{
 		if (state->_active &&																											//     Is active
 			(state->_useTimeout || state->_schedule) &&															// AND On a schedule/using the spamTimeout
-			state->_timer.getElapsedTime().asSeconds() >= state->_timeout &&				// AND Has timed out
+			state->_timer.getElapsedSeconds(frame) >= state->_timeout &&				// AND Has timed out
 			// AND Not currently being held on
 			(state->_activeType == state->Toggle || (state->_activeType == state->Held && state->_keyIsHeld == false)))
 		{
 			state->_active = false;
 			RemoveStateFromOrder(state);
-			state->_timer.restart();
+			state->_timer.restart(frame);
 		}
 
 		if (state->_active)
@@ -151,10 +168,10 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 
 			for (auto& st : state->_layerStates)
 			{
-				LayerInfo* layer = GetLayer(st.first);
-				if (layer && st.second != StatesInfo::NoChange)
+				int layerIdx = _frameState.Find(st.first);
+				if (layerIdx != -1 && st.second != StatesInfo::NoChange)
 				{
-					layer->_visible = st.second;
+					_layers[layerIdx]._visible = st.second;
 				}
 			}
 
@@ -173,46 +190,37 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 
 	_effectMan->UpdateEffects(_layers);
 
-	std::vector<LayerInfo*> calculateOrder;
-	for (int l = _layers.size() - 1; l >= 0; l--)
-		calculateOrder.push_back(&_layers[l]);
+	FinishFrameState();
 
-	std::sort(calculateOrder.begin(), calculateOrder.end(), [](const LayerInfo* lhs, const LayerInfo* rhs)
-		{
-			return (lhs->_lastCalculatedDepth < rhs->_lastCalculatedDepth);
-		});
+	_physics._substeps = _appConfig->_physicsSubsteps;
 
-	for (auto layer : calculateOrder)
+	for (int l : _frameState.CalculateOrder())
 	{
+		LayerInfo* layer = &_layers[l];
+
 		// Don't calculate if invisible
-		bool reallyVisible = layer->EvaluateLayerVisibility();
+		bool reallyVisible = _frameState.Visible(l);
 		bool calculate = reallyVisible;
 
 		// if invisible, re-enable calculation if any other layer needs it as a parent, clip or sync
-		if (layer->blinkSyncID != "")
+		if (layer->blinkSyncID != "" || _frameState.NeededByOthers(l))
 			calculate = true;
 
-		if (!calculate)
+		if (calculate)
 		{
-			for (int l = _layers.size() - 1; l >= 0; l--)
+			float layerTalk = talkLevel;
+			float layerMax = talkMax;
+			PhonemeMask layerPhoneme = phMask;
+			if (_audioChannels != nullptr && layer->_audioChannel >= 0 && layer->_audioChannel < _audioChannels->Channels())
 			{
-				LayerInfo& checkLayer = _layers[l];
-				//check if any layer relies on it as a parent
-				if (checkLayer._motionParent == layer->_id 
-					|| checkLayer._clipID == layer->_id 
-					|| checkLayer.motionTimerID == layer->_id
-					|| checkLayer.blinkSyncID == layer->_id
-					|| checkLayer.bounceTimerID == layer->_id
-					)
-				{
-					calculate = true;
-					break;
-				}
+				auto levels = _audioChannels->GetLevels(layer->_audioChannel);
+				layerTalk = levels.talk;
+				layerMax = levels.max;
+				layerPhoneme = (PhonemeMask)levels.phoneme;
 			}
-		}
 
-		if (calculate)
-			layer->CalculateDraw(windowHeight, windowWidth, talkLevel, talkMax, phMask);
+			layer->CalculateDraw(frame, windowHeight, windowWidth, layerTalk, layerMax, layerPhoneme);
+		}
 		else
 		{
 			//minimal update to keep things rolling
@@ -220,12 +228,14 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 		}
 	}
 
+	_physics.ReleaseUntouched();
+
 
 	for (int l = _layers.size() - 1; l >= 0; l--)
 	{
 		LayerInfo& layer = _layers[l];
 
-		bool visible = layer.EvaluateLayerVisibility();
+		bool visible = _frameState.Visible(l);
 
 		if (visible)
 		{
@@ -247,7 +257,7 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 				|| usingBlendmode == g_blendmodes["Clip to Backdrop"];
 
 
-			LayerInfo* clipLayer = GetLayer(layer._clipID);
+			LayerInfo* clipLayer = layer.FrameLink(LayerFrameState::LinkClip);
 
 			bool sharpEdge = _appConfig->_sharpEdge && layer._scaleFiltering == 1;
 
@@ -290,7 +300,7 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 					state.shader = _blendingShader.get();
 
 				for(auto& sp : layer._sprites)
-					sp.second->Draw(target, state);
+					sp.second->Draw(frame, target, state);
 			}
 			else
 			{
@@ -349,7 +359,7 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 				// Draw clip layer onto an empty canvas
 				for (auto& csp : clipLayer->_sprites)
 				{
-					csp.second->Draw(&clipRTs._clipRT, clipState);
+					csp.second->Draw(frame, &clipRTs._clipRT, clipState);
 				}
 
 #ifdef DEBUG_CLIP_RENDERING
@@ -377,7 +387,7 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 				// Draw layer to be clipped onto an empty canvas
 				for (auto& sp : layer._sprites)
 				{
-					sp.second->Draw(&clipRTs._soloLayerRT, state);
+					sp.second->Draw(frame, &clipRTs._soloLayerRT, state);
 				}
 
 				clipRTs._soloLayerRT.display();
@@ -416,20 +426,50 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 		{
 			for (auto& sp : layer._sprites)
 			{
-				sp.second->Tick();
+				sp.second->Tick(frame);
 			}
 		}
 
 		layer._oldVisible = visible;
 	}
 
+	// position, frame and colour of every visible layer, to compare against the next frame
+	uint64_t drawnHash = 0xcbf29ce484222325ull;
+	auto hashValue = [&drawnHash](const void* data, size_t size)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		for (size_t b = 0; b < size; b++)
+			drawnHash = (drawnHash ^ bytes[b]) * 0x100000001b3ull;
+	};
+
+	float globalMotion[5] = { _globalPos.x, _globalPos.y, _globalScale.x, _globalScale.y, _globalRot };
+	hashValue(globalMotion, sizeof(globalMotion));
+
+	for (int l = 0; l < (int)_layers.size(); l++)
+	{
+		const SpriteSheet* sprite = _layers[l]._activeSprite;
+		if (sprite == nullptr || !_frameState.Visible(l))
+			continue;
+
+		float motion[7] = { sprite->getPosition().x, sprite->getPosition().y, sprite->getOrigin().x, sprite->getOrigin().y,
+			sprite->getRotation(), sprite->getScale().x, sprite->getScale().y };
+		int look[3] = { l, sprite->CurrentFrame(), (int)sprite->getColor().toInteger() };
+
+		hashValue(&sprite, sizeof(sprite));
+		hashValue(motion, sizeof(motion));
+		hashValue(look, sizeof(look));
+	}
+
+	_animating = drawnHash != _drawnHash;
+	_drawnHash = drawnHash;
+
 	if (_uiConfig->_menuShowing && _uiConfig->_showLayerBounds)
 	{
 		for (int l = _layers.size() - 1; l >= 0; l--)
 		{
 			LayerInfo& layer = _layers[l];
 
-			bool visible = layer.EvaluateLayerVisibility();
+			bool visible = _frameState.Visible(l);
 
 			if (visible && layer._isFolder == false)
 			{
@@ -523,8 +563,6 @@ void LayerManager::Draw(sf::RenderTarget* target, float windowHeight, float wind
 			}
 		}
 	}
-
-	_hoveredLayers.clear();
 }
 
 void LayerManager::DrawOldLayerSetUI()
@@ -629,6 +667,9 @@ void LayerManager::DrawOldLayerSetUI()
 
 void LayerManager::UpdateWindowTitle()
 {
+	if (_primary == false)
+		return;
+
 	_appConfig->_lastLayerSet = _fullLoadedXMLPath;
 
 	if (_appConfig->_nameWindowWithSet)
@@ -644,19 +685,6 @@ void LayerManager::UpdateWindowTitle()
 	}
 }
 
-void LayerManager::CopyFileAndUpdatePath(std::string& filePath, std::filesystem::path targetFolder, std::filesystem::copy_options copyOpts)
-{
-	std::error_code ec;
-	fs::path fsFilePath(filePath);
-	if (filePath != "")
-	{
-		ResolveAbsolutePath(fsFilePath);
-
-		fs::copy(fsFilePath, targetFolder, copyOpts, ec);
-		filePath = targetFolder.append(fsFilePath.filename().string()).string();
-	}
-}
-
 void LayerManager::ResolveAbsolutePath(std::filesystem::path& fsFilePath)
 {
 	if (fsFilePath.is_relative())
@@ -880,8 +908,8 @@ This works best when all your sprite images are located in a subfolder of RahiTu
 
 		if (SaveLayers(xmlPath.string(), _saveLayersPortable, _copyImagesPortable, _optimisePortable))
 		{
-			std::error_code ec;
-			_loadedXMLExists = fs::exists(xmlPath, ec);
+			// written in the background, but it will be there
+			_loadedXMLExists = true;
 			_fullLoadedXMLPath = xmlPath.string();
 			_loadedXMLAbsDirectory = xmlPath.parent_path().string();
 			fs::path proximateXMLPath = fs::proximate(xmlPath, appFolder);
@@ -998,6 +1026,9 @@ void LayerManager::DrawButtonsLayerSetUI()
 
 void LayerManager::DrawGUI(ImGuiStyle& style, float maxHeight)
 {
+	// kept until the next menu pass, which might be a few frames away
+	_hoveredLayers.clear();
+
 	float topBarBegin = ImGui::GetCursorPosY();
 
 	ImGui::PushID("layermanager"); {
@@ -1104,6 +1135,7 @@ void LayerManager::DrawGUI(ImGuiStyle& style, float maxHeight)
 						if (ImGui::ImageButton("filter", _tagFilters[t.first] ? *_filterOnIcon : *_filterOffIcon, headerBtnSize, sf::Color::Transparent, btnColor))
 						{
 							_tagFilters[t.first] = !_tagFilters[t.first];
+							_layerListDirty = true;
 						}
 
 						ImGui::TableNextColumn();
@@ -1126,6 +1158,7 @@ void LayerManager::DrawGUI(ImGuiStyle& style, float maxHeight)
 
 					for (auto& l : _layers)
 						l._tags.erase(deleteTag);
+					_layerListDirty = true;
 
 					for (auto& st : _states)
 						st._tagStates.erase(deleteTag);
@@ -1185,6 +1218,14 @@ void LayerManager::DrawGUI(ImGuiStyle& style, float maxHeight)
 
 		ImGui::Separator();
 
+		if (_export.IsStarted())
+		{
+			ImGui::AlignTextToFramePadding();
+			std::string txt = "Exporting " + _export.CurrentItem() + "...";
+			TextCentered(ANSIToUTF8(txt).c_str());
+			ImGui::ProgressBar(_export.Progress());
+		}
+
 		if (_loadingFinished == false)
 		{
 			DrawLoadingMessage();
@@ -1244,52 +1285,93 @@ void LayerManager::DrawGUI(ImGuiStyle& style, float maxHeight)
 				ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 2);
 			}
 
-			bool anyfiltered = false;
-			for (auto& t : _tagFilters)
-				anyfiltered |= t.second;
+			if (_layerListDirty || _layerListCount != _layers.size())
+				RebuildLayerList();
 
-			for (int l = 0; l < _layers.size(); l++)
+			for (auto& layer : _layers)
 			{
-				auto& layer = _layers[l];
-				layer._parent = this;
+				layer._lastHeaderPos = { -1,-1 };
+				layer._lastHeaderScreenPos = { -1,-1 };
+				layer._lastHeaderSize = { 0,0 };
+			}
+
+			// rows scrolled out of view are skipped, using the height they had when they were last drawn.
+			// Anything with a popup or window open is always drawn, or it would close.
+			const bool canSkip = !ImGui::IsPopupOpen("", ImGuiPopupFlags_AnyPopupId);
+			const float indentSize = 8 * _appConfig->scalingFactor;
+			const float spacing = ImGui::GetStyle().ItemSpacing.y;
+			float skippedHeight = 0;
+			bool folderOpen = false;
+			bool indented = false;
+
+			for (auto& row : _layerListRows)
+			{
+				auto& layer = _layers[row.layer];
 
-				if (layer._inFolder == "")
+				if (row.inFolder && !folderOpen)
+					continue;
+
+				if (row.inFolder != indented)
 				{
-					layer._lastHeaderPos = { -1,-1 };
-					layer._lastHeaderScreenPos = { -1,-1 };
-					layer._lastHeaderSize = { 0,0 };
+					if (row.inFolder)
+						ImGui::Indent(indentSize);
+					else
+						ImGui::Unindent(indentSize);
+					indented = row.inFolder;
+				}
 
-					bool filtered = false;
-					if (anyfiltered)
-					{
-						filtered = true;
-						for (auto& t : layer._tags)
-							if (_tagFilters[t] == true)
-								filtered = false;
+				ImVec2 pos = ImGui::GetCursorPos();
+				ImVec2 screenPos = ImGui::GetCursorScreenPos();
+				pos.y += skippedHeight;
+				screenPos.y += skippedHeight;
 
-						//continue showing if it's a folder containing filtered tags
-						if (filtered && layer._isFolder)
-						{
-							for (auto& l : layer._folderContents)
-							{
-								for (auto& t : GetLayer(l)->_tags)
-									if (_tagFilters[t] == true)
-										filtered = false;
-							}
-						}
-					}
+				float height = layer._lastGuiHeight;
+				bool inView = ImGui::IsRectVisible(screenPos, { screenPos.x + ImGui::GetContentRegionAvail().x, screenPos.y + height });
 
+				if (!inView && canSkip && height > 0 && !layer._scrollToHere && !layer.AnyPopupOpen())
+				{
+					layer._lastHeaderPos = toSFVector(pos);
+					layer._lastHeaderScreenPos = toSFVector(screenPos);
+					layer._lastHeaderSize = sf::Vector2f(ImGui::GetContentRegionAvail().x - 8 * _appConfig->scalingFactor, ImGui::GetFrameHeight());
 
+					// open layers always show their borders
+					if (layer._guiOpen && !layer._isFolder)
+						_hoveredLayers.push_back(layer._id);
 
-					if (filtered) // skip if filtered away.
-						continue;
+					if (layer._isFolder)
+						folderOpen = layer._guiOpen;
 
-					if (!layer.DrawGUI(style, l))
-						break;
+					skippedHeight += height;
+					continue;
 				}
 
+				if (skippedHeight > 0)
+				{
+					ImGui::Dummy({ 0, std::max(0.f, skippedHeight - spacing) });
+					skippedHeight = 0;
+				}
+
+				float startY = ImGui::GetCursorPosY();
+				bool listUnchanged = layer.DrawGUI(style, row.layer);
+
+				// layers were added, removed or moved, and the rows are stale until the next frame
+				if (!listUnchanged || _layerListDirty)
+				{
+					_layerListDirty = true;
+					break;
+				}
+
+				layer._lastGuiHeight = ImGui::GetCursorPosY() - startY;
+				if (layer._isFolder)
+					folderOpen = layer._guiOpen;
 			}
 
+			if (skippedHeight > 0)
+				ImGui::Dummy({ 0, std::max(0.f, skippedHeight - spacing) });
+
+			if (indented)
+				ImGui::Unindent(indentSize);
+
 			if (_dragActive)
 			{
 				ImGui::PopStyleColor(3);
@@ -1548,6 +1630,7 @@ void LayerManager::DrawMenusLayerSetUI()
 LayerManager::LayerInfo* LayerManager::AddLayer(const LayerInfo* toCopy, bool isFolder, int insertPosition)
 {
 	_errorMessage = "";
+	_layerListDirty = true;
 
 	LayerInfo newLayer = LayerInfo();
 
@@ -1557,24 +1640,9 @@ LayerManager::LayerInfo* LayerManager::AddLayer(const LayerInfo* toCopy, bool is
 
 	if (toCopy != nullptr)
 	{
-		newLayer = LayerInfo(*toCopy);
+		newLayer = toCopy->DeepCopy();
 		newLayer._name += " Copy";
 
-		for (int sp = SP_IDLE; sp < SP_END; sp++)
-		{
-			if(toCopy->_sprites.count((SpriteType)sp) > 0)
-				newLayer._sprites[(SpriteType)sp] = toCopy->_sprites.at((SpriteType)sp).Copy();
-		}
-
-		newLayer._uniqueTracking.reset();
-		newLayer._uniqueTrackingMotion.reset();
-
-		newLayer._uniqueTracking = std::make_shared<LayerInfo::TrackingSettings>();
-		newLayer._uniqueTrackingMotion = std::make_shared<LayerInfo::TrackingMotion>();
-
-		*(newLayer._uniqueTracking.get()) = *(toCopy->_uniqueTracking.get());
-		*(newLayer._uniqueTrackingMotion.get()) = *(toCopy->_uniqueTrackingMotion.get());
-
 		newLayer.SyncAnims(newLayer._animsSynced);
 
 		int idx = 0;
@@ -1626,7 +1694,7 @@ LayerManager::LayerInfo* LayerManager::AddLayer(const LayerInfo* toCopy, bool is
 
 	GenerateGuid(guid);
 
-	layer->_blinkTimer.restart();
+	layer->_blinkTimer.restart(_appConfig->_frameClock.Now());
 	layer->_isBlinking = false;
 	layer->_blinkVarDelay = GetRandom11() * layer->_blinkVariation;
 	layer->_parent = this;
@@ -1740,6 +1808,8 @@ void LayerManager::RemoveLayer(int toRemove)
 	if (toRemove < 0 || toRemove >= _layers.size())
 		return;
 
+	_layerListDirty = true;
+
 	if (_layers[toRemove]._isFolder)
 	{
 		for (std::string& id : _layers[toRemove]._folderContents)
@@ -1761,6 +1831,8 @@ void LayerManager::MoveLayerTo(int toMove, int position, bool skipFolders)
 	if (toMove < 0)
 		return;
 
+	_layerListDirty = true;
+
 	if (toMove >= _layers.size())
 		return;
 
@@ -2048,6 +2120,72 @@ bool LayerManager::HandleLayerDrag(float mouseX, float mouseY, bool mousePressed
 	return useInput;
 }
 
+void LayerManager::RebuildLayerList()
+{
+	_layerListDirty = false;
+	_layerListCount = _layers.size();
+	_layerListRows.clear();
+
+	bool anyFiltered = false;
+	for (auto& t : _tagFilters)
+		anyFiltered |= t.second;
+
+	auto passesFilter = [&](const LayerInfo& layer)
+	{
+		if (!anyFiltered)
+			return true;
+
+		for (auto& t : layer._tags)
+		{
+			auto filter = _tagFilters.find(t);
+			if (filter != _tagFilters.end() && filter->second)
+				return true;
+		}
+		return false;
+	};
+
+	std::map<std::string, int> indexById;
+	for (int l = 0; l < _layers.size(); l++)
+	{
+		_layers[l]._parent = this;
+		indexById[_layers[l]._id] = l;
+	}
+
+	std::vector<int> children;
+	for (int l = 0; l < _layers.size(); l++)
+	{
+		LayerInfo& layer = _layers[l];
+		if (layer._inFolder != "")
+			continue;
+
+		children.clear();
+		if (layer._isFolder)
+		{
+			for (auto it = layer._folderContents.begin(); it != layer._folderContents.end();)
+			{
+				auto found = indexById.find(*it);
+				if (found == indexById.end())
+				{
+					it = layer._folderContents.erase(it);
+					continue;
+				}
+
+				if (passesFilter(_layers[found->second]))
+					children.push_back(found->second);
+				it++;
+			}
+		}
+
+		//continue showing if it's a folder containing filtered tags
+		if (!passesFilter(layer) && children.empty())
+			continue;
+
+		_layerListRows.push_back({ l, false });
+		for (int c : children)
+			_layerListRows.push_back({ c, true });
+	}
+}
+
 int LayerManager::GetLayerUnderCursor(float mouseX, float mouseY)
 {
 	bool aboveAll = true;
@@ -2170,48 +2308,215 @@ void LayerManager::MakePortablePath(std::string& path, bool xmlRelative, fs::pat
 	std::replace(path.begin(), path.end(), '\\', '/');
 }
 
-bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePortable, bool copyImages, bool optimise)
+void LayerManager::UpdateExport(bool wait)
 {
-	if (_loadingFinished == false)
+	if (!_export.IsStarted() || (!wait && !_export.IsFinished()))
+		return;
+
+	_export.Wait();
+
+	logFmtToFile(_appConfig, "Exported %d images in %dms", _export.JobCount(), _exportTimer.getElapsedTime().asMilliseconds());
+
+	for (auto& err : _export.GetErrors())
+		logToFile(_appConfig, "ERROR: " + err);
+
+	if (_export.Failures() > 0)
+		_errorMessage = "Failed to export " + std::to_string(_export.Failures()) + " images, see the log for details.";
+
+	if (_exportOptimise)
 	{
-		return false;
+		for (auto& layer : _layers)
+		{
+			logToFile(_appConfig, "Optimising " + layer._name + "...");
+			layer.OptimiseSprites();
+		}
 	}
-	else if (_loadingThread != nullptr)
+
+	std::string xmlPath = _exportXMLPath;
+	std::string errorMessage = _errorMessage;
+	_export.Clear();
+	_exportXMLPath = "";
+
+	// written in the background, so it may not exist yet, but it will be there
+	if (SaveLayers(xmlPath, true))
+		_loadedXMLExists = true;
+
+	if (errorMessage != "")
+		_errorMessage = errorMessage;
+}
+
+void LayerManager::UpdateHotReload()
+{
+	if (_appConfig->_hotReloadImages == false)
 	{
-		if (_loadingThread->joinable())
-			_loadingThread->join();
+		if (_imageWatcher.IsRunning())
+			_imageWatcher.Stop();
+		return;
+	}
 
-		delete _loadingThread;
-		_loadingThread = nullptr;
+	bool refreshFiles = !_imageWatcher.IsRunning() || _imageWatchTimer.getElapsedTime().asSeconds() > 1.f;
+	if (!_imageWatcher.IsRunning())
+		_imageWatcher.Start();
+
+	// images can be swapped from the UI at any time, so the watched files are refreshed every second
+	if (refreshFiles)
+	{
+		_imageWatchTimer.restart();
+
+		std::set<std::string> paths;
+		for (auto& layer : _layers)
+		{
+			for (auto& sp : layer._sprites)
+			{
+				if (sp.second && sp.second->TexturePath() != "")
+					paths.insert(_textureMan->NormalisePath(sp.second->TexturePath()));
+			}
+		}
+		_imageWatcher.SetFiles(paths);
 	}
 
-	_errorMessage = "";
+	auto changed = _imageWatcher.TakeChanged();
+	if (!changed.empty())
+		_textureMan->QueueReload(changed);
 
-	tinyxml2::XMLDocument doc;
+	// co-hosts are drawn after the main avatar, and pick up what it swapped in this frame
+	auto reloads = _primary ? _textureMan->ApplyReloads() : _textureMan->LastReloads();
+	for (auto& reloaded : reloads)
+	{
+		logToFile(_appConfig, "Reloaded " + fs::path(reloaded.path).filename().string());
 
-	bool xmlRelative = _appConfig->_savePortableRelativeToXML || _isPortableRelativeToXML;
+		for (auto& layer : _layers)
+		{
+			for (auto& sp : layer._sprites)
+			{
+				if (sp.second && sp.second->TexturePath() != "" && _textureMan->NormalisePath(sp.second->TexturePath()) == reloaded.path)
+					sp.second->SwapTexture(reloaded.tex, reloaded.oldSize);
+			}
+		}
+	}
+}
 
-	doc.LoadFile(settingsFileName.c_str());
+void LayerManager::ReleaseTextures()
+{
+	// other avatars may be drawing from the same cache
+	if (_textureMan->Users() <= 1)
+	{
+		_textureMan->Reset();
+		return;
+	}
 
-	logToFile(_appConfig, "Saving " + settingsFileName);
+	std::set<void*> callers;
+	for (auto& layer : _layers)
+	{
+		for (auto& sp : layer._sprites)
+		{
+			if (sp.second)
+				callers.insert((void*)sp.second.get());
+		}
+	}
+	_textureMan->Release(callers);
+}
 
-	if (doc.Error())
+std::shared_ptr<const LayerManager::SaveSnapshot> LayerManager::TakeSaveSnapshot(const std::string& path, bool xmlRelative)
+{
+	auto snap = std::make_shared<SaveSnapshot>();
+	snap->path = path;
+	snap->xmlRelative = xmlRelative;
+
+	// saved with the default visibility, whatever states are active right now
+	bool anyActive = AnyStateActive();
+
+	for (auto& layer : _layers)
 	{
-		doc.LoadFile((_appConfig->_appLocation + settingsFileName).c_str());
+		snap->layers.push_back(layer.DeepCopy());
+		if (anyActive && _defaultLayerStates.count(layer._id))
+			snap->layers.back()._visible = _defaultLayerStates[layer._id];
 	}
 
+	for (int h = 0; h < _states.size(); h++)
+	{
+		std::lock_guard<std::mutex> lock(_stateLocks[h]);
+		snap->states.push_back(_states[h]);
+	}
+
+	snap->tagDefaults = _tagDefaults;
+
+	snap->globalScale = _globalScale;
+	snap->globalPos = _globalPos;
+	snap->globalRot = _globalRot;
+
+	snap->statesPassThrough = _statesPassThrough;
+	snap->statesHideUnaffected = _statesHideUnaffected;
+	snap->statesIgnoreStick = _statesIgnoreStick;
+	snap->undoRotationEffectFix = _appConfig->_undoRotationEffectFix;
+
+	snap->globalTracking = *_globalTracking;
+	snap->globalTrackingMotion = *_globalTrackingMotion;
+
+	snap->globalPresets = _globalPresets;
+	snap->currentGlobalPreset = _currentGlobalPreset;
+
+	return snap;
+}
+
+void LayerManager::QueueSave(const std::string& path, bool xmlRelative)
+{
+	std::shared_ptr<const SaveSnapshot> snap = TakeSaveSnapshot(path, xmlRelative);
+
+	_saver.Save(path, [this, snap](std::string& contents, std::string& error)
+		{
+			return SerializeLayerSet(*snap, contents, error);
+		});
+}
+
+void LayerManager::UpdateSaves()
+{
+	for (auto& result : _saver.TakeResults())
+	{
+		if (!result.ok)
+		{
+			_errorMessage = "Failed to save " + result.path + ": " + result.error;
+			logToFile(_appConfig, "Save Failed: " + result.error);
+		}
+		else if (!result.unchanged)
+		{
+			logFmtToFile(_appConfig, "Saved Layer Set %s (%.1fms)", result.path.c_str(), result.ms);
+		}
+	}
+
+	if (_appConfig->_autosaveInterval <= 0 || _export.IsStarted() || _layers.empty())
+	{
+		_autosaveTimer.restart();
+		return;
+	}
+
+	if (_autosaveTimer.getElapsedTime().asSeconds() < _appConfig->_autosaveInterval)
+		return;
+
+	// same file and settings as the save on exit; unchanged sets aren't rewritten
+	_autosaveTimer.restart();
+	QueueSave(_appConfig->lastLayerSettingsFile, _appConfig->_savePortableRelativeToXML || _isPortableRelativeToXML);
+}
+
+bool LayerManager::SerializeLayerSet(const SaveSnapshot& snap, std::string& contents, std::string& error)
+{
+	// runs on the saver thread, so only the snapshot is used from here on
+	tinyxml2::XMLDocument doc;
+
+	// edit the existing file, so anything this version doesn't know about is kept
+	doc.LoadFile(snap.path.c_str());
+
 	auto root = doc.FirstChildElement("Config");
 	if (!root)
 		root = doc.InsertFirstChild(doc.NewElement("Config"))->ToElement();
 
 	if (!root)
 	{
-		_errorMessage = "Could not save config element: " + settingsFileName;
-		logToFile(_appConfig, "Save Failed: " + _errorMessage);
+		error = "Could not save config element: " + snap.path;
 		return false;
 	}
 
-	root->SetAttribute("XMLRelative", xmlRelative);
+	root->SetAttribute("XMLRelative", snap.xmlRelative);
 
 	auto layers = root->FirstChildElement("layers");
 	if (!layers)
@@ -2219,78 +2524,17 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 
 	if (!layers)
 	{
-		_errorMessage = "Could not save layers element: " + settingsFileName;
-		logToFile(_appConfig, "Save Failed: " + _errorMessage);
+		error = "Could not save layers element: " + snap.path;
 		return false;
 	}
 
-	fs::path settingsFileDir = fs::path(settingsFileName).remove_filename();
-
-	if (makePortable && copyImages)
-	{
-		fs::path targetFolder(_appConfig->_appLocation);
-
-		if (xmlRelative)
-			targetFolder = settingsFileDir;
-
-		targetFolder.append(_layerSetName);
-		std::error_code cec;
-		fs::create_directory(targetFolder, cec);
-
-		fs::copy_options copyOpts = fs::copy_options::overwrite_existing;
-		for (auto& layer : _layers)
-		{
-			for (auto& sp : layer._sprites)
-			{
-				CopyFileAndUpdatePath(sp.second.path, targetFolder, copyOpts);
-			}
-		}
-
-		if (optimise)
-		{
-			sf::Clock updateTimer; 
-			sf::RenderWindow progress;
-			progress.create(sf::VideoMode(300, 100), "RahiTuber Optimisation", sf::Style::Titlebar);
-			ImGui::SFML::Init(progress);
-			ImGui::SFML::SetCurrentWindow(progress);
-			int layerNum = 0;
-			for (auto& layer : _layers)
-			{
-				logToFile(_appConfig, "Optimising " + layer._name + "...");
-				layer.OptimiseSprites();
-			
-				ImGui::SFML::Update(progress, updateTimer.restart());
-
-				ImGui::SetNextWindowSizeConstraints({ 300, 100 }, { 300, 100 });
-				ImGui::SetNextWindowPos({ 150, 50 }, 0, { 0.5, 0.5 });
-				ImGui::Begin("Please Wait", 0, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
-
-				ImGui::AlignTextToFramePadding();
-				std::string txt = "Optimising " + layer._name + "...";
-				TextCentered(ANSIToUTF8(txt).c_str());
-
-				ImGui::ProgressBar((float)layerNum / _layers.size());
-
-				ImGui::End();
-				ImGui::EndFrame();
-				ImGui::SFML::Render(progress);
-				progress.display();
-				layerNum++;
-			}
-			ImGui::SFML::Shutdown(progress);
-			progress.close();
-		}
-	}
-
 	layers->DeleteChildren();
 
-	ResetStates();
-
-	for (int l = 0; l < _layers.size(); l++)
+	for (int l = 0; l < snap.layers.size(); l++)
 	{
 		auto thisLayer = layers->InsertEndChild(doc.NewElement("layer"))->ToElement();
 
-		auto& layer = _layers[l];
+		const auto& layer = snap.layers[l];
 
 		thisLayer->SetAttribute("id", layer._id.c_str());
 
@@ -2304,7 +2548,8 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 		{
 			auto tagElement = tagsElement->InsertNewChildElement("Tag");
 			tagElement->SetText(t.c_str());
-			tagElement->SetAttribute("visible", _tagDefaults[t]);
+			auto tagDefault = snap.tagDefaults.find(t);
+			tagElement->SetAttribute("visible", tagDefault != snap.tagDefaults.end() && tagDefault->second);
 		}
 
 		if (layer._isFolder == false)
@@ -2313,6 +2558,8 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 			thisLayer->SetAttribute("talkThreshold", layer._talkThreshold);
 			thisLayer->SetAttribute("smoothInput", layer._smoothTalkFactor);
 			thisLayer->SetAttribute("smoothAmount", layer._smoothTalkFactorSize);
+			thisLayer->SetAttribute("audioChannel", layer._audioChannel);
+			thisLayer->SetAttribute("talkOnVoice", layer._talkOnVoice);
 			thisLayer->SetAttribute("restartOnSwap", layer._restartTalkAnim);
 			thisLayer->SetAttribute("usePhonemes", layer._usePhonemes);
 			thisLayer->SetAttribute("separatePhonemeTints", layer._separatePhonemeTints);
@@ -2360,18 +2607,13 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 
 			thisLayer->SetAttribute("restartAnimsOnVisible", layer._restartAnimsOnVisible);
 
-			if (makePortable)
-			{
-				for (auto& sp : layer._sprites)
-				{
-					MakePortablePath(sp.second.path, xmlRelative, settingsFileDir);
-				}
-			}
-
 			for (int s = SP_IDLE; s < SP_END; s++)
 			{
-				auto& sp = layer._sprites[(SpriteType)s];
+				auto found = layer._sprites.find((SpriteType)s);
+				if (found == layer._sprites.end())
+					continue;
 
+				const auto& sp = found->second;
 				if (!sp || sp.path == "")
 					continue;
 
@@ -2380,10 +2622,10 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 				sprElement->SetAttribute("path", sp.path.c_str());
 				SaveColor(sprElement, &doc, "tint", sp.tint);
 
-				sprElement->SetAttribute("idleOffsetX", sp->_offsetFromIdle.x);
-				sprElement->SetAttribute("idleOffsetY", sp->_offsetFromIdle.y);
+				sprElement->SetAttribute("idleOffsetX", sp.sprite->_offsetFromIdle.x);
+				sprElement->SetAttribute("idleOffsetY", sp.sprite->_offsetFromIdle.y);
 
-				if (sp->FrameCount() > 1 || sp->GridSize() != sf::Vector2i(1, 1) || layer._animsSynced == true)
+				if (sp.sprite->FrameCount() > 1 || sp.sprite->GridSize() != sf::Vector2i(1, 1) || layer._animsSynced == true)
 					SaveAnimInfo(sprElement, &doc, "anim", *sp.sprite, layer._animsSynced);
 
 			}
@@ -2505,54 +2747,54 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 		}
 	}
 
-	root->SetAttribute("globalScaleX", _globalScale.x);
-	root->SetAttribute("globalScaleY", _globalScale.y);
-	root->SetAttribute("globalPosX", _globalPos.x);
-	root->SetAttribute("globalPosY", _globalPos.y);
-	root->SetAttribute("globalRot", _globalRot);
+	root->SetAttribute("globalScaleX", snap.globalScale.x);
+	root->SetAttribute("globalScaleY", snap.globalScale.y);
+	root->SetAttribute("globalPosX", snap.globalPos.x);
+	root->SetAttribute("globalPosY", snap.globalPos.y);
+	root->SetAttribute("globalRot", snap.globalRot);
 
-	root->SetAttribute("statesPassThrough", _statesPassThrough);
-	root->SetAttribute("statesHideUnaffected", _statesHideUnaffected);
-	root->SetAttribute("statesIgnoreAxis", _statesIgnoreStick);
+	root->SetAttribute("statesPassThrough", snap.statesPassThrough);
+	root->SetAttribute("statesHideUnaffected", snap.statesHideUnaffected);
+	root->SetAttribute("statesIgnoreAxis", snap.statesIgnoreStick);
 
-	root->SetAttribute("DisableRotationEffectFix", _appConfig->_undoRotationEffectFix);
+	root->SetAttribute("DisableRotationEffectFix", snap.undoRotationEffectFix);
 
 	auto globalTracking = root->FirstChildElement("GlobalTracking");
 	if (!globalTracking)
 		globalTracking = root->InsertNewChildElement("GlobalTracking");
 	
-	globalTracking->SetAttribute("followElliptical", _globalTrackingMotion->_followElliptical);
-	globalTracking->SetAttribute("mouseNeutralX", _globalTracking->_mouseNeutralPos.x);
-	globalTracking->SetAttribute("mouseNeutralY", _globalTracking->_mouseNeutralPos.y);
-	globalTracking->SetAttribute("mouseAreaX", _globalTracking->_mouseAreaSize.x);
-	globalTracking->SetAttribute("mouseAreaY", _globalTracking->_mouseAreaSize.y);
-	globalTracking->SetAttribute("neutralFollowsWindow", _globalTracking->_mouseNeutralFollowsWindow);
-
-	globalTracking->SetAttribute("trackingAxis", _globalTracking->_trackingAxis);
-	globalTracking->SetAttribute("trackingDeadzone", _globalTracking->_axisDeadzone);
-	globalTracking->SetAttribute("trackingSmooth", _globalTrackingMotion->_trackingSmooth);
-	globalTracking->SetAttribute("trackingLimitX", _globalTrackingMotion->_trackingMoveLimits.x);
-	globalTracking->SetAttribute("trackingLimitY", _globalTrackingMotion->_trackingMoveLimits.y);
-	globalTracking->SetAttribute("untrackedWhenHidden", _globalTrackingMotion->_trackingOffWhenHidden);
-	globalTracking->SetAttribute("trackingRotLimitX", _globalTrackingMotion->_trackingRotation.x);
-	globalTracking->SetAttribute("trackingRotLimitY", _globalTrackingMotion->_trackingRotation.y);
-
-	globalTracking->SetAttribute("trackingSelect", _globalTracking->_trackingSelect);
-	if (_globalTracking->_trackingSelect == LayerInfo::TRACKINGSELECT_SPECIFIC)
-	{
-		globalTracking->SetAttribute("trackingControllerName", _globalTracking->_trackingJoystick.second.name.c_str());
-		globalTracking->SetAttribute("trackingControllerAlikeIdx", _globalTracking->_trackingJoystick.second.alikeIdx);
-	}
-
-	globalTracking->SetAttribute("trackingScaleMode", _globalTrackingMotion->_trackingScaleMode);
-	globalTracking->SetAttribute("trackingScaleHorizontalX", _globalTrackingMotion->_trackingScaleHorizontal.x);
-	globalTracking->SetAttribute("trackingScaleHorizontalY", _globalTrackingMotion->_trackingScaleHorizontal.y);
-	globalTracking->SetAttribute("trackingScaleVerticalX", _globalTrackingMotion->_trackingScaleVertical.x);
-	globalTracking->SetAttribute("trackingScaleVerticalY", _globalTrackingMotion->_trackingScaleVertical.y);
-	globalTracking->SetAttribute("clampTrackingScale", _globalTrackingMotion->_clampTrackingScale);
-	globalTracking->SetAttribute("trackingScaleClampX", _globalTrackingMotion->_trackingScaleClamp.x);
-	globalTracking->SetAttribute("trackingScaleClampY", _globalTrackingMotion->_trackingScaleClamp.y);
-	globalTracking->SetAttribute("trackingScaleAbsolute", _globalTrackingMotion->_trackingScaleAbsolute);
+	globalTracking->SetAttribute("followElliptical", snap.globalTrackingMotion._followElliptical);
+	globalTracking->SetAttribute("mouseNeutralX", snap.globalTracking._mouseNeutralPos.x);
+	globalTracking->SetAttribute("mouseNeutralY", snap.globalTracking._mouseNeutralPos.y);
+	globalTracking->SetAttribute("mouseAreaX", snap.globalTracking._mouseAreaSize.x);
+	globalTracking->SetAttribute("mouseAreaY", snap.globalTracking._mouseAreaSize.y);
+	globalTracking->SetAttribute("neutralFollowsWindow", snap.globalTracking._mouseNeutralFollowsWindow);
+
+	globalTracking->SetAttribute("trackingAxis", snap.globalTracking._trackingAxis);
+	globalTracking->SetAttribute("trackingDeadzone", snap.globalTracking._axisDeadzone);
+	globalTracking->SetAttribute("trackingSmooth", snap.globalTrackingMotion._trackingSmooth);
+	globalTracking->SetAttribute("trackingLimitX", snap.globalTrackingMotion._trackingMoveLimits.x);
+	globalTracking->SetAttribute("trackingLimitY", snap.globalTrackingMotion._trackingMoveLimits.y);
+	globalTracking->SetAttribute("untrackedWhenHidden", snap.globalTrackingMotion._trackingOffWhenHidden);
+	globalTracking->SetAttribute("trackingRotLimitX", snap.globalTrackingMotion._trackingRotation.x);
+	globalTracking->SetAttribute("trackingRotLimitY", snap.globalTrackingMotion._trackingRotation.y);
+
+	globalTracking->SetAttribute("trackingSelect", snap.globalTracking._trackingSelect);
+	if (snap.globalTracking._trackingSelect == LayerInfo::TRACKINGSELECT_SPECIFIC)
+	{
+		globalTracking->SetAttribute("trackingControllerName", snap.globalTracking._trackingJoystick.second.name.c_str());
+		globalTracking->SetAttribute("trackingControllerAlikeIdx", snap.globalTracking._trackingJoystick.second.alikeIdx);
+	}
+
+	globalTracking->SetAttribute("trackingScaleMode", snap.globalTrackingMotion._trackingScaleMode);
+	globalTracking->SetAttribute("trackingScaleHorizontalX", snap.globalTrackingMotion._trackingScaleHorizontal.x);
+	globalTracking->SetAttribute("trackingScaleHorizontalY", snap.globalTrackingMotion._trackingScaleHorizontal.y);
+	globalTracking->SetAttribute("trackingScaleVerticalX", snap.globalTrackingMotion._trackingScaleVertical.x);
+	globalTracking->SetAttribute("trackingScaleVerticalY", snap.globalTrackingMotion._trackingScaleVertical.y);
+	globalTracking->SetAttribute("clampTrackingScale", snap.globalTrackingMotion._clampTrackingScale);
+	globalTracking->SetAttribute("trackingScaleClampX", snap.globalTrackingMotion._trackingScaleClamp.x);
+	globalTracking->SetAttribute("trackingScaleClampY", snap.globalTrackingMotion._trackingScaleClamp.y);
+	globalTracking->SetAttribute("trackingScaleAbsolute", snap.globalTrackingMotion._trackingScaleAbsolute);
 
 
 	auto canvasPresets = root->FirstChildElement("CanvasPresets");
@@ -2561,19 +2803,18 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 
 	if (!canvasPresets)
 	{
-		_errorMessage = "Could not save CanvasPresets element: " + settingsFileName;
-		logToFile(_appConfig, "Save Failed: " + _errorMessage);
+		error = "Could not save CanvasPresets element: " + snap.path;
 		return false;
 	}
 
 	canvasPresets->DeleteChildren();
 
-	canvasPresets->SetAttribute("currentPreset", _currentGlobalPreset);
+	canvasPresets->SetAttribute("currentPreset", snap.currentGlobalPreset);
 
-	for (int gp = 0; gp < _globalPresets.size(); gp++)
+	for (int gp = 0; gp < snap.globalPresets.size(); gp++)
 	{
 		auto thisPresetElmt = canvasPresets->InsertEndChild(doc.NewElement("Preset"))->ToElement();
-		const auto& thisPreset = _globalPresets[gp];
+		const auto& thisPreset = snap.globalPresets[gp];
 
 		thisPresetElmt->SetAttribute("name", thisPreset._name.c_str());
 		thisPresetElmt->SetAttribute("scaleX", thisPreset._scale.x);
@@ -2589,17 +2830,16 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 
 	if (!hotkeys)
 	{
-		_errorMessage = "Could not save hotkeys element: " + settingsFileName;
-		logToFile(_appConfig, "Save Failed: " + _errorMessage);
+		error = "Could not save hotkeys element: " + snap.path;
 		return false;
 	}
 
 	hotkeys->DeleteChildren();
 
-	for (int h = 0; h < _states.size(); h++)
+	for (int h = 0; h < snap.states.size(); h++)
 	{
 		auto thisHotkey = hotkeys->InsertEndChild(doc.NewElement("hotkey"))->ToElement();
-		const auto& stateInfo = _states[h];
+		const auto& stateInfo = snap.states[h];
 
 		thisHotkey->SetAttribute("enabled", stateInfo._enabled);
 
@@ -2633,46 +2873,127 @@ bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePort
 		thisHotkey->SetAttribute("interval", stateInfo._intervalTime);
 		thisHotkey->SetAttribute("variation", stateInfo._intervalVariation);
 
+		for (auto& state : stateInfo._layerStates)
 		{
-			std::scoped_lock lockState(_stateLocks[h]);
-			for (auto& state : stateInfo._layerStates)
+			if (state.second != StatesInfo::State::NoChange)
 			{
-				if (state.second != StatesInfo::State::NoChange)
-				{
-					auto thisState = thisHotkey->InsertEndChild(doc.NewElement("state"))->ToElement();
-					thisState->SetAttribute("id", state.first.c_str());
-					thisState->SetAttribute("state", state.second);
+				auto thisState = thisHotkey->InsertEndChild(doc.NewElement("state"))->ToElement();
+				thisState->SetAttribute("id", state.first.c_str());
+				thisState->SetAttribute("state", state.second);
 
-				}
 			}
-			for (auto& tagState : stateInfo._tagStates)
+		}
+		for (auto& tagState : stateInfo._tagStates)
+		{
+			if (tagState.second != StatesInfo::State::NoChange)
 			{
-				if (tagState.second != StatesInfo::State::NoChange)
-				{
-					auto thisState = thisHotkey->InsertEndChild(doc.NewElement("tagState"))->ToElement();
-					thisState->SetAttribute("tagId", tagState.first.c_str());
-					thisState->SetAttribute("state", tagState.second);
-				}
+				auto thisState = thisHotkey->InsertEndChild(doc.NewElement("tagState"))->ToElement();
+				thisState->SetAttribute("tagId", tagState.first.c_str());
+				thisState->SetAttribute("state", tagState.second);
 			}
 		}
 	}
 
-	std::string outFile = settingsFileName;
-	if (outFile.find("/") == std::string::npos && outFile.find("\\") == std::string::npos)
+	tinyxml2::XMLPrinter printer;
+	doc.Print(&printer);
+	contents = printer.CStr();
+
+	return true;
+}
+
+bool LayerManager::SaveLayers(const std::string& settingsFileName, bool makePortable, bool copyImages, bool optimise)
+{
+	if (_loadingFinished == false)
 	{
-		outFile = fs::path(_appConfig->_appLocation).append(outFile).string();
+		return false;
+	}
+	else if (_loadingThread != nullptr)
+	{
+		if (_loadingThread->joinable())
+			_loadingThread->join();
+
+		delete _loadingThread;
+		_loadingThread = nullptr;
 	}
 
-	doc.SaveFile(outFile.c_str());
+	// finish writing the portable copy first, so this save has its final paths
+	if (_export.IsStarted())
+		UpdateExport(true);
 
-	if (doc.Error())
+	_errorMessage = "";
+
+	bool xmlRelative = _appConfig->_savePortableRelativeToXML || _isPortableRelativeToXML;
+
+	logToFile(_appConfig, "Saving " + settingsFileName);
+
+	fs::path settingsFileDir = fs::path(settingsFileName).remove_filename();
+
+	if (makePortable && copyImages)
 	{
-		_errorMessage = "Failed to save document: " + outFile;
-		logToFile(_appConfig, "Save Failed: " + _errorMessage);
-		return false;
+		fs::path targetFolder(_appConfig->_appLocation);
+
+		if (xmlRelative)
+			targetFolder = settingsFileDir;
+
+		targetFolder.append(_layerSetName);
+		std::error_code cec;
+		fs::create_directory(targetFolder, cec);
+
+		// copying and cropping runs on worker threads, the XML is written by UpdateExport once they're done
+		_export.Clear();
+		for (auto& layer : _layers)
+		{
+			for (auto& sp : layer._sprites)
+			{
+				if (sp.second.path == "")
+					continue;
+
+				fs::path source(sp.second.path);
+				ResolveAbsolutePath(source);
+				fs::path target = fs::path(targetFolder).append(source.filename().string());
+
+				bool crop = optimise && sp.second && sp.second->FrameCount() == 1 && sp.second->getTexture() != nullptr
+					&& _croppedImages.count(target.string()) == 0;
+				_export.Add(source, target, crop);
+
+				sp.second.path = target.string();
+			}
+		}
+
+		int workers = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+		_export.Start(workers);
+		_exportXMLPath = settingsFileName;
+		_exportOptimise = optimise;
+		_exportTimer.restart();
+
+		logFmtToFile(_appConfig, "Exporting %d images with %d threads...", _export.JobCount(), workers);
+		return true;
 	}
 
-	logToFile(_appConfig, "Saved Layer Set " + outFile);
+	ResetStates();
+
+	if (makePortable)
+	{
+		for (auto& layer : _layers)
+		{
+			if (layer._isFolder)
+				continue;
+
+			for (auto& sp : layer._sprites)
+				MakePortablePath(sp.second.path, xmlRelative, settingsFileDir);
+		}
+	}
+
+	std::string outFile = settingsFileName;
+	if (outFile.find("/") == std::string::npos && outFile.find("\\") == std::string::npos)
+	{
+		outFile = fs::path(_appConfig->_appLocation).append(outFile).string();
+	}
+
+	std::error_code ec;
+	outFile = fs::absolute(outFile, ec).string();
+
+	QueueSave(outFile, xmlRelative);
 
 	_lastSavedLocation = outFile;
 
@@ -2684,6 +3005,14 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 	if (!_loadingFinished)
 		return false;
 
+	_layerListDirty = true;
+
+	if (_export.IsStarted())
+		UpdateExport(true);
+
+	// a save of this file might still be in flight
+	_saver.Flush();
+
 	_loadingFinished = false;
 
 	_errorMessage = "";
@@ -2706,6 +3035,8 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 
 	_loadingThread = new std::thread([&]
 		{
+			sf::Clock loadTimer;
+
 			tinyxml2::XMLDocument doc;
 			doc.LoadFile(_loadingPath.c_str());
 
@@ -2763,13 +3094,18 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 			if (!_mergingLayerSet)
 			{
 				_statesOrder.clear();
+				ReleaseTextures();
 				_layers.clear();
-				_textureMan->Reset();
 				_croppedImages.clear();
 				_lastSavedLocation = _loadingPath;
 				_tagList.clear();
 			}
 
+			if (_appConfig->_layerSetCache)
+				_textureMan->BeginCache(fs::path(_loadingPath).replace_extension(".rtcache"));
+			else
+				_textureMan->CloseCache();
+
 			auto thisLayer = layers->FirstChildElement("layer");
 			int layerCount = 0;
 			while (thisLayer)
@@ -2851,6 +3187,8 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 				thisLayer->QueryAttribute("talkThreshold", &layer._talkThreshold);
 				thisLayer->QueryAttribute("smoothInput", &layer._smoothTalkFactor);
 				thisLayer->QueryAttribute("smoothAmount", &layer._smoothTalkFactorSize);
+				thisLayer->QueryAttribute("audioChannel", &layer._audioChannel);
+				thisLayer->QueryAttribute("talkOnVoice", &layer._talkOnVoice);
 				thisLayer->QueryAttribute("restartOnSwap", &layer._restartTalkAnim);
 				thisLayer->QueryAttribute("usePhonemes", &layer._usePhonemes);
 				thisLayer->QueryAttribute("separatePhonemeTints", &layer._separatePhonemeTints);
@@ -2979,7 +3317,7 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 
 				thisLayer->QueryAttribute("smoothTalkTint", &layer._smoothTalkTint);
 
-				layer._blinkTimer.restart();
+				layer._blinkTimer.restart(_appConfig->_frameClock.Now());
 				layer._isBlinking = false;
 				layer._blinkVarDelay = GetRandom11() * layer._blinkVariation;
 
@@ -3431,7 +3769,15 @@ bool LayerManager::LoadLayers(const std::string& settingsFileName)
 				layer.CalculateLayerDepth();
 			}
 
-			logToFile(_appConfig, "Loaded Layer Set " + _loadingPath);
+			if (_textureMan->GetCache().IsActive())
+			{
+				const TextureCache& cache = _textureMan->GetCache();
+				logToFile(_appConfig, "Image cache: " + std::to_string(cache.Hits()) + " cached, " + std::to_string(cache.Misses()) + " decoded");
+				if (!_textureMan->FinishCache())
+					logToFile(_appConfig, "Failed to write image cache for " + _loadingPath);
+			}
+
+			logToFile(_appConfig, "Loaded Layer Set " + _loadingPath + " in " + std::to_string(loadTimer.getElapsedTime().asMilliseconds()) + "ms");
 			_loadingPath = "";
 
 			_loadingFinished = true;
@@ -3473,6 +3819,8 @@ void LayerManager::LayerInfo::SetUnloadingTimer(int timer)
 /*
 void LayerManager::HandleHotkey(const sf::Event& evt, bool keyDown)
 {
+	const FrameTime& now = _appConfig->_frameClock.Now();
+
 	for (auto& l : _layers)
 		if (l._renamePopupOpen)
 			return;
@@ -3556,7 +3904,7 @@ void LayerManager::HandleHotkey(const sf::Event& evt, bool keyDown)
 		if (stateInfo._activeType == StatesInfo::Held)
 			spamTimeout = 0;
 
-		if (match && stateInfo._timer.getElapsedTime().asSeconds() > spamTimeout)
+		if (match && stateInfo._timer.getElapsedSeconds(now) > spamTimeout)
 		{
 			if (evt.type == sf::Event::JoystickMoved)
 				stateInfo._axisWasTriggered = true;
@@ -3567,7 +3915,7 @@ void LayerManager::HandleHotkey(const sf::Event& evt, bool keyDown)
 				// deactivate
 				stateInfo._active = false;
 				RemoveStateFromOrder(&stateInfo);
-				stateInfo._timer.restart();
+				stateInfo._timer.restart(now);
 			}
 			else if (!stateInfo._active && keyDown)
 			{
@@ -3612,7 +3960,7 @@ void LayerManager::HandleHotkey(const sf::Event& evt, bool keyDown)
 					}
 
 					AppendStateToOrder(&stateInfo);
-					stateInfo._timer.restart();
+					stateInfo._timer.restart(now);
 					stateInfo._active = true;
 					_statesTimer.restart();
 				}
@@ -3637,6 +3985,8 @@ void LayerManager::CheckHotkeys()
 	if (_loadingFinished == false)
 		return;
 
+	const FrameTime& now = _appConfig->_frameClock.Now();
+
 	for (auto& l : _layers)
 		if (l._renamePopupOpen)
 			return;
@@ -3657,11 +4007,12 @@ void LayerManager::CheckHotkeys()
 		bool keyDown = false;
 		float spamTimeout = 0.2;
 		bool changed = false;
+		double httpReceived = -1;
 
 		StatesInfo& stateInfo = _states[h];
 
 		// Check websocket
-		if (_appConfig->_listenHTTP && _appConfig->_webSocket != nullptr)
+		if (_primary && _appConfig->_listenHTTP && _appConfig->_webSocket != nullptr)
 		{
 			WebSocket::QueueItem qItem = _appConfig->_webSocket->QueueFront();
 
@@ -3688,7 +4039,10 @@ void LayerManager::CheckHotkeys()
 				}
 
 				if ((stateInfo._wasTriggered != keyDown) && stateInfo._enabled)
+				{
 					changed = true;
+					httpReceived = qItem.receivedTime;
+				}
 
 				_appConfig->_webSocket->PopQueueFront();
 			}
@@ -3774,16 +4128,25 @@ void LayerManager::CheckHotkeys()
 
 		stateInfo._wasTriggered = keyDown;
 
-		if (changed && stateInfo._timer.getElapsedTime().asSeconds() > spamTimeout)
+		if (changed && stateInfo._timer.getElapsedSeconds(now) > spamTimeout)
 		{
+			// keys are polled once a frame, so a hotkey's latency starts from here
+			if (_primary)
+			{
+				if (httpReceived >= 0)
+					_appConfig->_latency.Begin(LatencyTracker::SourceHTTP, httpReceived);
+				else
+					_appConfig->_latency.Begin(LatencyTracker::SourceHotkey, LatencyTracker::Now());
+			}
+
 			if (stateInfo._active && ((stateInfo._activeType == StatesInfo::Toggle && keyDown) || (stateInfo._activeType == StatesInfo::Held && !keyDown)))
 			{
 				stateInfo._keyIsHeld = false;
-				stateInfo._timer.restart();
+				stateInfo._timer.restart(now);
 
 				if (stateInfo._activeType == StatesInfo::Toggle
 					|| (stateInfo._activeType == StatesInfo::Held &&
-								((stateInfo._useTimeout == true) && stateInfo._timer.getElapsedTime().asSeconds() > stateInfo._timeout)
+								((stateInfo._useTimeout == true) && stateInfo._timer.getElapsedSeconds(now) > stateInfo._timeout)
 						||	(stateInfo._useTimeout == false)
 						)
 					)
@@ -3851,13 +4214,13 @@ void LayerManager::CheckHotkeys()
 						}
 
 						AppendStateToOrder(&stateInfo);
-						stateInfo._timer.restart();
+						stateInfo._timer.restart(now);
 						stateInfo._active = true;
 						_statesTimer.restart();
 					}
 					else if (stateInfo._activeType == StatesInfo::Held)
 					{
-						stateInfo._timer.restart();
+						stateInfo._timer.restart(now);
 						stateInfo._active = true;
 					}
 					
@@ -3872,6 +4235,26 @@ void LayerManager::CheckHotkeys()
 	return;
 }
 
+bool LayerManager::IsTalking() const
+{
+	int count = std::min((int)_layers.size(), _frameState.Size());
+	for (int l = 0; l < count; l++)
+	{
+		if (_layers[l]._wasTalking && _frameState.Visible(l))
+			return true;
+	}
+	return false;
+}
+
+bool LayerManager::VoiceActive(int channel) const
+{
+	// the same test as the levels: a channel that isn't captured falls back to the mix
+	if (_audioChannels != nullptr && channel >= 0 && channel < _audioChannels->Channels())
+		return _audioChannels->VoiceActive(channel);
+
+	return _voiceActive;
+}
+
 void LayerManager::ResetStates()
 {
 	if (!AnyStateActive())
@@ -3894,6 +4277,7 @@ void LayerManager::Init(AppConfig* appConf, UIConfig* uiConf)
 	if (_appConfig)
 	{
 		_textureMan = &_appConfig->_textureMan;
+		_textureMan->AddUser();
 		_textureMan->LoadIcons(_appConfig->_appLocation);
 
 		_resetIcon = _appConfig->_textureMan.GetIcon(TextureManager::ICON_RESET);
@@ -4642,6 +5026,59 @@ void LayerManager::DrawHTTPCopyHelpers(LayerManager::StatesInfo& state, ImVec4&
 	ImGui::PopStyleColor();
 }
 
+void LayerManager::BeginFrameState()
+{
+	int count = (int)_layers.size();
+	_frameState.Begin(count);
+
+	for (int l = 0; l < count; l++)
+	{
+		_layers[l]._frameIndex = l;
+		_frameState.SetId(l, _layers[l]._id);
+	}
+
+	for (int l = 0; l < count; l++)
+	{
+		const LayerInfo& layer = _layers[l];
+		_frameState.SetLink(LayerFrameState::LinkMotionParent, l, layer._motionParent);
+		_frameState.SetLink(LayerFrameState::LinkFolder, l, layer._inFolder);
+		_frameState.SetLink(LayerFrameState::LinkClip, l, layer._clipID);
+		_frameState.SetLink(LayerFrameState::LinkMotionTimer, l, layer.motionTimerID);
+		_frameState.SetLink(LayerFrameState::LinkBounceTimer, l, layer.bounceTimerID);
+		_frameState.SetLink(LayerFrameState::LinkBlinkSync, l, layer.blinkSyncID);
+	}
+}
+
+void LayerManager::FinishFrameState()
+{
+	// visibility can only be read once states and tags have been applied for this frame
+	int count = (int)_layers.size();
+	for (int l = 0; l < count; l++)
+	{
+		const LayerInfo& layer = _layers[l];
+
+		bool visible = layer._visible;
+		for (auto& t : layer._tags)
+			visible &= _tagList[t];
+
+		_frameState.SetOwnVisibility(l, visible, layer._hideWithParent);
+	}
+
+	_frameState.Finish();
+
+	for (int l = 0; l < count; l++)
+		_layers[l]._lastCalculatedDepth = _frameState.Depth(l);
+}
+
+LayerManager::LayerInfo* LayerManager::LayerInfo::FrameLink(LayerFrameState::Link link) const
+{
+	int idx = _parent->_frameState.GetLink(link, _frameIndex);
+	if (idx == -1)
+		return nullptr;
+
+	return &_parent->_layers[idx];
+}
+
 void LayerManager::LayerInfo::CalculateLayerDepth()
 {
 	if (_parent == nullptr)
@@ -4720,7 +5157,7 @@ bool LayerManager::LayerInfo::EvaluateLayerVisibility()
 	return visible;
 }
 
-void LayerManager::LayerInfo::DoIndividualMotion(bool talking, bool screaming, float talkAmount, double& rot, sf::Vector2<double>& motionScale, ImVec4& activeSpriteCol, sf::Vector2<double>& motionPos, bool becameVisible)
+void LayerManager::LayerInfo::DoIndividualMotion(const FrameTime& frame, bool talking, bool screaming, float talkAmount, double& rot, sf::Vector2<double>& motionScale, ImVec4& activeSpriteCol, sf::Vector2<double>& motionPos, bool becameVisible)
 {
 	float newMotionY = 0;
 	float newMotionX = 0;
@@ -4755,17 +5192,17 @@ void LayerManager::LayerInfo::DoIndividualMotion(bool talking, bool screaming, f
 			if (!_isBouncing)
 			{
 				_isBouncing = true;
-				_bounceTimer.restart();
+				_bounceTimer.restart(frame);
 			}
 		}
 
 		if (_isBouncing)
 		{
-			float motionTime = _bounceTimer.getElapsedTime().asSeconds();
-			auto bounceLayer = _parent->GetLayer(bounceTimerID);
+			float motionTime = _bounceTimer.getElapsedSeconds(frame);
+			auto bounceLayer = FrameLink(LayerFrameState::LinkBounceTimer);
 			if (bounceLayer != nullptr)
 			{
-				motionTime = bounceLayer->_bounceTimer.getElapsedTime().asSeconds();
+				motionTime = bounceLayer->_bounceTimer.getElapsedSeconds(frame);
 			}
 			int bounces = floor(motionTime / _bounceFrequency);
 
@@ -4808,14 +5245,14 @@ void LayerManager::LayerInfo::DoIndividualMotion(bool talking, bool screaming, f
 		{
 			if (!_isBreathing)
 			{
-				_motionTimer.restart();
+				_motionTimer.restart(frame);
 				_isBreathing = true;
 			}
-			float motionTime = _motionTimer.getElapsedTime().asSeconds();
-			auto motionLayer = _parent->GetLayer(motionTimerID);
+			float motionTime = _motionTimer.getElapsedSeconds(frame);
+			auto motionLayer = FrameLink(LayerFrameState::LinkMotionTimer);
 			if (motionLayer != nullptr)
 			{
-				motionTime = motionLayer->_motionTimer.getElapsedTime().asSeconds();
+				motionTime = motionLayer->_motionTimer.getElapsedSeconds(frame);
 			}
 
 			float coolDownTime = _breathFrequency / 5;
@@ -4846,14 +5283,14 @@ void LayerManager::LayerInfo::DoIndividualMotion(bool talking, bool screaming, f
 		{
 			if (_isBreathing)
 			{
-				_motionTimer.restart();
+				_motionTimer.restart(frame);
 				_isBreathing = false;
 			}
-			float motionTime = _motionTimer.getElapsedTime().asSeconds();
-			auto motionLayer = _parent->GetLayer(motionTimerID);
+			float motionTime = _motionTimer.getElapsedSeconds(frame);
+			auto motionLayer = FrameLink(LayerFrameState::LinkMotionTimer);
 			if (motionLayer != nullptr)
 			{
-				motionTime = motionLayer->_motionTimer.getElapsedTime().asSeconds();
+				motionTime = motionLayer->_motionTimer.getElapsedSeconds(frame);
 			}
 
 			float coolDownFactor = (_breathFrequency - motionTime) / _breathFrequency;
@@ -4891,9 +5328,9 @@ void LayerManager::LayerInfo::DoIndividualMotion(bool talking, bool screaming, f
 	motionPos.y -= _motionY;
 }
 
-void LayerManager::LayerInfo::CalculateInheritedMotion(sf::Vector2<double>& motionScale, sf::Vector2<double>& motionPos, double& motionRot, double& motionParentRot, ImVec4& motionTint, sf::Vector2<double>& physicsPos, bool becameVisible, SpriteSheet* lastActiveSprite, float timeMult)
+void LayerManager::LayerInfo::CalculateInheritedMotion(const FrameTime& frame, sf::Vector2<double>& motionScale, sf::Vector2<double>& motionPos, double& motionRot, double& motionParentRot, ImVec4& motionTint, bool becameVisible, SpriteSheet* lastActiveSprite, float frameSeconds)
 {
-	LayerInfo* mp = _parent->GetLayer(_motionParent);
+	LayerInfo* mp = FrameLink(LayerFrameState::LinkMotionParent);
 	if (mp)
 	{
 		float motionDelayNow = _motionDelay;
@@ -4976,32 +5413,28 @@ void LayerManager::LayerInfo::CalculateInheritedMotion(sf::Vector2<double>& moti
 		motionPos += originMove;
 
 		bool physics = (_motionDrag > 0 || _motionSpring > 0);
-		physicsPos = motionPos;
 
-		if (physics && becameVisible)
+		PhysicsIntegrator::Body* body = nullptr;
+		if (physics)
+			body = _parent->_physics.Acquire(this, _physicsSlot);
+
+		if (physics && (becameVisible || body->initialised == false))
 		{
-			_lastAccel = { 0.f, 0.f };
-			_physicsTimer.restart();
+			_parent->_physics.Reset(*body, motionPos);
+			_physicsTimer.restart(frame);
 		}
-		else if (physics && lastActiveSprite != nullptr && _motionLinkData.size() > 0)
+		else if (physics && lastActiveSprite != nullptr)
 		{
 			double motionDrag = _motionDrag;
 			double motionSpring = _motionSpring;
-			double fadeIn = _physicsTimer.getElapsedTime().asSeconds() / 0.5;
+			double fadeIn = _physicsTimer.getElapsedSeconds(frame) / 0.5;
 			if (fadeIn < 1.0)
 			{
 				motionDrag = _motionDrag * fadeIn;
 				motionSpring = _motionSpring * fadeIn;
 			}
 
-			const MotionLinkData& lastFrame = _motionLinkData.front();
-			sf::Vector2<double> oldScale(lastFrame._scale.x, lastFrame._scale.y);
-			sf::Vector2<double> oldPos(lastFrame._physicsPos.x, lastFrame._physicsPos.y);
-
-			sf::Vector2<double> idealAccel = (sf::Vector2<double>(motionPos) - oldPos);
-			sf::Vector2<double> accel = sf::Vector2<double>(_lastAccel) + (idealAccel - sf::Vector2<double>(_lastAccel)) * (1.0f - motionSpring);
-			sf::Vector2<double> newPhysicsPos = oldPos + (1.0 - motionDrag) * accel * timeMult;
-			_lastAccel = accel;
+			sf::Vector2<double> newPhysicsPos = _parent->_physics.Advance(*body, motionPos, frameSeconds, motionDrag, motionSpring);
 
 			sf::Vector2<double> offset = sf::Vector2<double>(motionPos) - newPhysicsPos;
 			double movementDist = Length(offset);
@@ -5083,8 +5516,6 @@ void LayerManager::LayerInfo::CalculateInheritedMotion(sf::Vector2<double>& moti
 				}
 			}
 
-			physicsPos = newPhysicsPos;
-
 			if (_distanceLimit == 0.f)
 			{
 				newPhysicsPos = motionPos;
@@ -5107,16 +5538,12 @@ void LayerManager::LayerInfo::DoConstantMotion(sf::Time& frameTime, sf::Vector2<
 	mpRot += _storedConstantRot;
 }
 
-void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask)
+void LayerManager::LayerInfo::CalculateDraw(const FrameTime& frame, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask)
 {
-	sf::Time frameTime = _frameTimer.restart();
-	float fps = 1.0 / frameTime.asSeconds();
-
-	float timeMult = 1.0;
-	if (fps > 60)
-	{
-		timeMult = 60.0 / fps;
-	}
+	// time since this layer was last calculated, which can span several frames if it was hidden
+	float sinceCalculated = _frameTimer.getElapsedSeconds(frame);
+	_frameTimer.restart(frame);
+	sf::Time frameTime = sf::seconds(sinceCalculated > 0 ? sinceCalculated : frame.dt);
 
 	SpriteSheet* lastActiveSprite = _activeSprite;
 
@@ -5134,7 +5561,7 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 
 	ImVec4 activeSpriteCol = _sprites[SP_IDLE].tint;
 
-	bool reallyVisible = EvaluateLayerVisibility();
+	bool reallyVisible = _parent->_frameState.Visible(_frameIndex);
 	bool becameVisible = (reallyVisible == true) && (_oldVisible == false);
 
 	float talkFactor = 0;
@@ -5166,24 +5593,23 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 			if (sp.second)
 				sp.second->Restart();
 
-		_motionTimer.restart();
+		_motionTimer.restart(frame);
 	}
 	
 	_oldVisible = reallyVisible;
 
 	bool screaming = _scream && talkFactor > _screamThreshold;
 
-	if (_screamTimer.getElapsedTime().asSeconds() < _minScreamTime)
+	if (_screamTimer.getElapsedSeconds(frame) < _minScreamTime)
 		screaming = true;
 
-	bool talking = !screaming && talkFactor > _talkThreshold;
-	DetermineVisibleSprites(talking, screaming, activeSpriteCol, talkAmount, phMask);
+	bool talking = !screaming && (_talkOnVoice ? _parent->VoiceActive(_audioChannel) : talkFactor > _talkThreshold);
+	DetermineVisibleSprites(frame, talking, screaming, activeSpriteCol, talkAmount, phMask);
 
 	_wasTalking = talking;
 
 	sf::Vector2<double>  motionScale = { 1.0,1.0 };
 	sf::Vector2<double>  motionPos = { 0, 0 };
-	sf::Vector2<double>  physicsPos = motionPos;
 	double motionRot = 0;
 	double motionParentRot = 0;
 	ImVec4 mpTint;
@@ -5195,13 +5621,13 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 
 	bool hasParent = !(_motionParent == "" || _motionParent == "-1");
 	if (hasParent)
-		CalculateInheritedMotion(motionScale, motionPos, motionRot, motionParentRot, mpTint, physicsPos, becameVisible, lastActiveSprite, timeMult);
+		CalculateInheritedMotion(frame, motionScale, motionPos, motionRot, motionParentRot, mpTint, becameVisible, lastActiveSprite, frameTime.asSeconds());
 
 	if (_inheritTint)
 		activeSpriteCol = mpTint;
 
 	if (!hasParent || _allowIndividualMotion)
-		DoIndividualMotion(talking, screaming, talkAmount, motionRot, motionScale, activeSpriteCol, motionPos, becameVisible);
+		DoIndividualMotion(frame, talking, screaming, talkAmount, motionRot, motionScale, activeSpriteCol, motionPos, becameVisible);
 
 	DoConstantMotion(frameTime, motionScale, motionPos, motionRot);
 
@@ -5211,13 +5637,13 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 	{
 		if (!_isScreaming)
 		{
-			_screamTimer.restart();
+			_screamTimer.restart(frame);
 			_isScreaming = true;
 		}
 
 		if (_screamVibrate)
 		{
-			float motionTime = _screamTimer.getElapsedTime().asSeconds();
+			float motionTime = _screamTimer.getElapsedSeconds(frame);
 			motionPos.y += sin(motionTime / 0.02 * _screamVibrateSpeed) * _screamVibrateAmount;
 			motionPos.x += sin(motionTime / 0.05 * _screamVibrateSpeed) * _screamVibrateAmount;
 		}
@@ -5230,7 +5656,6 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 	MotionLinkData thisFrame;
 	thisFrame._frameTime = frameTime;
 	thisFrame._pos = motionPos;
-	thisFrame._physicsPos = physicsPos;
 	thisFrame._scale = motionScale;
 	thisFrame._rot = motionRot;
 	thisFrame._parentRot = motionParentRot + (_passRotationToChildLayers ? _rot : 0.0);
@@ -5260,7 +5685,7 @@ void LayerManager::LayerInfo::CalculateDraw(float windowHeight, float windowWidt
 
 }
 
-void LayerManager::LayerInfo::DetermineVisibleSprites(bool talking, bool screaming, ImVec4& activeSpriteCol, float& talkAmount, PhonemeMask phMask)
+void LayerManager::LayerInfo::DetermineVisibleSprites(const FrameTime& frame, bool talking, bool screaming, ImVec4& activeSpriteCol, float& talkAmount, PhonemeMask phMask)
 {
 	SpriteType activeType = SP_IDLE;
 
@@ -5269,13 +5694,13 @@ void LayerManager::LayerInfo::DetermineVisibleSprites(bool talking, bool screami
 
 	bool canStartBlinking = (talkBlinkAvailable || blinkAvailable) && !_isBlinking && _useBlinkFrame;
 
-	bool shouldBlink = canStartBlinking && _blinkTimer.getElapsedTime().asSeconds() > _blinkDelay + _blinkVarDelay;
+	bool shouldBlink = canStartBlinking && _blinkTimer.getElapsedSeconds(frame) > _blinkDelay + _blinkVarDelay;
 	float blinkDur = _blinkDuration;
 
-	auto blinkSync = _parent->GetLayer(blinkSyncID);
+	auto blinkSync = FrameLink(LayerFrameState::LinkBlinkSync);
 	if (blinkSync != nullptr)
 	{
-		shouldBlink = canStartBlinking && (blinkSync->_isBlinking || _blinkTimer.getElapsedTime().asSeconds() > blinkSync->_blinkDelay + blinkSync->_blinkVarDelay);
+		shouldBlink = canStartBlinking && (blinkSync->_isBlinking || _blinkTimer.getElapsedSeconds(frame) > blinkSync->_blinkDelay + blinkSync->_blinkVarDelay);
 		blinkDur = blinkSync->_blinkDuration;
 		if (!blinkSync->_isBlinking)
 			_isBlinking = false;
@@ -5284,7 +5709,7 @@ void LayerManager::LayerInfo::DetermineVisibleSprites(bool talking, bool screami
 	if (shouldBlink)
 	{
 		_isBlinking = true;
-		_blinkTimer.restart();
+		_blinkTimer.restart(frame);
 		if (!_sprites[SP_BLINK]->IsSynced())
 			_sprites[SP_BLINK]->Restart();
 		if (!_sprites[SP_TALKBLINK]->IsSynced())
@@ -5307,7 +5732,7 @@ void LayerManager::LayerInfo::DetermineVisibleSprites(bool talking, bool screami
 		}
 
 
-		if (_blinkTimer.getElapsedTime().asSeconds() > blinkDur)
+		if (_blinkTimer.getElapsedSeconds(frame) > blinkDur)
 		{
 			_isBlinking = false;
 			_blinkVarDelay = GetRandom11() * _blinkVariation;
@@ -5435,7 +5860,7 @@ void LayerManager::LayerInfo::AddTrackingMovement(sf::Vector2<double>& mpPos, do
 		axisEffect = _joypadEffect;
 	}
 
-	bool visible = EvaluateLayerVisibility();
+	bool visible = _parent->_frameState.Visible(_frameIndex);
 	if (visible || !_trackingMotion->_trackingOffWhenHidden)
 	{
 		if ((_trackingType & TRACKING_MOUSE) && _parent->_appConfig->_mouseTrackingEnabled)
@@ -5582,24 +6007,6 @@ bool LayerManager::LayerInfo::DrawGUI(ImGuiStyle& style, int layerID)
 
 	bool allowContinue = true;
 
-	std::vector<int> toRemove;
-	for (int l = 0; l < _folderContents.size(); l++)
-	{
-		auto* layer = _parent->GetLayer(_folderContents[l]);
-		if (layer != nullptr)
-		{
-			layer->_lastHeaderPos = { -1,-1 };
-			layer->_lastHeaderScreenPos = { -1,-1 };
-			layer->_lastHeaderSize = { 0,0 };
-		}
-		else
-			toRemove.insert(toRemove.begin(), l);
-	}
-	for (int rem : toRemove)
-	{
-		_folderContents.erase(_folderContents.begin() + rem);
-	}
-
 
 	ImGui::PushID((_id).c_str()); {
 
@@ -5640,7 +6047,8 @@ bool LayerManager::LayerInfo::DrawGUI(ImGuiStyle& style, int layerID)
 
 		float nameEnd = ImGui::CalcTextSize(name.c_str()).x + UIUnit;
 
-		if (ImGui::CollapsingHeader(ANSIToUTF8(name).c_str(), ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_AllowOverlap))
+		_guiOpen = ImGui::CollapsingHeader(ANSIToUTF8(name).c_str(), ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_AllowOverlap);
+		if (_guiOpen)
 		{
 			if (_scrollToHere)
 			{
@@ -5656,36 +6064,9 @@ bool LayerManager::LayerInfo::DrawGUI(ImGuiStyle& style, int layerID)
 
 			if (_isFolder)
 			{
+				// the contents are drawn by the layer list, under this header
 				ImGui::PopStyleVar(2);
 				ImGui::PopStyleColor();
-
-				bool anyFiltered = false;
-				for (auto& filter : _parent->_tagFilters)
-					anyFiltered |= filter.second;
-
-
-				for (int l = 0; l < _folderContents.size(); l++)
-				{
-					int layerIdx = 0;
-					auto* layer = _parent->GetLayer(_folderContents[l], &layerIdx);
-					if (layer != nullptr)
-					{
-						bool filtered = false;
-						if (anyFiltered)
-						{
-							filtered = true;
-							for (auto& t : layer->_tags)
-								if (_parent->_tagFilters[t] == true)
-									filtered = false;
-						}
-
-						if (filtered)
-							continue;
-
-						layer->DrawGUI(style, layerIdx);
-					}
-						
-				}
 			}
 			else
 			{
@@ -5828,6 +6209,10 @@ bool LayerManager::LayerInfo::DrawGUI(ImGuiStyle& style, int layerID)
 				ImGui::Checkbox("Use Talk Sprite", &_swapWhenTalking);
 				ToolTip("Swap to the 'talk' sprite when Talk Threshold is reached", &_parent->_appConfig->_hoverTimer);
 
+				ImGui::SameLine();
+				ImGui::Checkbox("Talk on Voice", &_talkOnVoice);
+				ToolTip("Talk whenever the voice gate hears a voice, instead of when the Talk Threshold is reached.\nA layer listening to one channel uses that channel's gate. The gate is set up in the audio settings.", &_parent->_appConfig->_hoverTimer);
+
 				if (ImGui::BeginTable("smoothinputtable", 2, ImGuiTableFlags_SizingFixedFit))
 				{
 					ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed);
@@ -5845,6 +6230,24 @@ bool LayerManager::LayerInfo::DrawGUI(ImGuiStyle& style, int layerID)
 					ImGui::EndTable();
 				}
 
+				if (_parent->GetAudioChannels() != nullptr || _audioChannel != -1)
+				{
+					std::string channelName = _audioChannel < 0 ? "Mix" : "Channel " + std::to_string(_audioChannel + 1);
+					if (ImGui::BeginCombo("Audio Channel", channelName.c_str()))
+					{
+						if (ImGui::Selectable("Mix", _audioChannel < 0))
+							_audioChannel = -1;
+
+						for (int c = 0; c < ChannelAnalyser::MaxChannels; c++)
+						{
+							if (ImGui::Selectable(("Channel " + std::to_string(c + 1)).c_str(), _audioChannel == c))
+								_audioChannel = c;
+						}
+						ImGui::EndCombo();
+					}
+					ToolTip("Listen to a single input channel instead of the mix.\nNeeds 'Separate Channels' in the audio settings.", &_parent->_appConfig->_hoverTimer);
+				}
+
 				if (LesserCollapsingHeader("More Talk settings..."))
 				{
 					BetterIndent(indentSize, _id + "talk");
@@ -7302,6 +7705,7 @@ void LayerManager::LayerInfo::DrawRenamePopupGUI()
 			if (ImGui::Button(tagLabel.c_str()))
 			{
 				_tags.erase(tag);
+				_parent->_layerListDirty = true;
 			}
 			tagCount++;
 		}
@@ -7322,6 +7726,7 @@ void LayerManager::LayerInfo::DrawRenamePopupGUI()
 			{
 				_addingTag = false;
 				_tags.insert(tagBuf);
+				_parent->_layerListDirty = true;
 				_parent->_tagList[tagBuf] = true;
 				_parent->_tagDefaults[tagBuf] = true;
 				_parent->_tagFilters[tagBuf] = false;
@@ -7344,6 +7749,7 @@ void LayerManager::LayerInfo::DrawRenamePopupGUI()
 					{
 						if (ImGui::Selectable(t.first.c_str(), false)) {
 							_tags.insert(t.first);
+							_parent->_layerListDirty = true;
 							_addingTag = false;
 						}
 					}
@@ -7455,13 +7861,17 @@ void LayerManager::LayerInfo::ImageBrowsePreviewBtn(bool& openFlag, const char*
 {
 	bool emptyTex = !sprite->HasTexture();
 	sf::Color btnCol = emptyTex ? toSFColor(ImGui::GetStyleColorVec4(ImGuiCol_Text)) : sf::Color::White;
-	sf::Texture* btnIcon = emptyTex ? _emptyIcon : sprite->getTexture();
+	sf::Sprite btnIcon;
+	if (emptyTex)
+		btnIcon = *_emptyIcon;
+	else if (sprite->getTexture() != nullptr)
+		btnIcon.setTexture(*sprite->getTexture(), true);
 
 	bool reloading = false;
-	if (btnIcon == nullptr)
+	if (btnIcon.getTexture() == nullptr)
 	{
 		reloading = true;
-		btnIcon = _reloadIcon;
+		btnIcon = *_reloadIcon;
 	}
 
 	static imgui_ext::file_browser_modal fileBrowserIdle("Import Sprite");
@@ -7471,7 +7881,7 @@ void LayerManager::LayerInfo::ImageBrowsePreviewBtn(bool& openFlag, const char*
 		fileBrowserIdle.SetStartingDir(fileBrowserIdle.GetLastChosenDir());
 
 	ImGui::BeginDisabled(reloading);
-	openFlag = ImGui::ImageButton(btnname, *btnIcon, { imgBtnWidth,imgBtnWidth }, sf::Color::Transparent, btnCol);
+	openFlag = ImGui::ImageButton(btnname, btnIcon, { imgBtnWidth,imgBtnWidth }, sf::Color::Transparent, btnCol);
 
 	std::error_code ec;
 	fs::path browsePath = path;
@@ -7577,6 +7987,14 @@ void LayerManager::LayerInfo::AnimPopup(SpriteSheet& anim, bool& open, bool& old
 
 		ImGui::Separator();
 
+		if (anim.IsStreamed())
+		{
+			ImGui::PushStyleColor(ImGuiCol_Text, { 0.4,0.4,0.4,1 });
+			ImGui::TextWrapped("This is an animated image, it plays its own frames at their own speed. The grid and FPS only apply if it's replaced with a sprite sheet.");
+			ImGui::PopStyleColor();
+			ImGui::Separator();
+		}
+
 		ImGui::PushItemWidth(120 * uiScale);
 
 		AddResetButton("gridreset", _animGrid, std::vector<int>( anim.GridSize().x, anim.GridSize().y ), _parent->_appConfig);
@@ -7789,102 +8207,44 @@ LayerManager::CropInfo LayerManager::LayerInfo::CropTextureTransparency(sf::Text
 		return found->second;
 	}
 
-	logFmtToFile(_parent->_appConfig, "Cropping %s...", imgpath.c_str());
-
-	sf::Image croppedImg;
-	CropInfo cropInfo;
-
+	// the export workers have already cropped and re-saved the file, and kept the premultiplied pixels
+	ExportPipeline::Result* exported = _parent->_export.GetResult(imgpath);
+	if (exported == nullptr || !exported->cropped)
 	{
-		sf::Image srcImg;
-		srcImg.loadFromFile(imgpath);
-		auto pxPtr = srcImg.getPixelsPtr();
-
-		sf::Vector2u srcSize = srcImg.getSize();
-
-		sf::Vector2u maxContent = { 0,0 };
-		sf::Vector2u minContent = srcSize;
-		int numpixels = srcSize.x * srcSize.y;
-
-		for (unsigned int y = 0; y < srcSize.y; y++)
-			for (unsigned int x = 0; x < srcSize.x; x++)
-			{
-				int fwdPix = (y * srcSize.x + x) * 4;
-				if (pxPtr[fwdPix + 3] != 0)
-				{
-					maxContent.x = Max(x, maxContent.x);
-					maxContent.y = Max(y, maxContent.y);
-
-					minContent.x = Min(x, minContent.x);
-					minContent.y = Min(y, minContent.y);
-				}
-			}
-
-		minContent = Clamp(minContent, { 0,0 }, srcSize);
-		maxContent = Clamp(maxContent, minContent, srcSize);
-
-		sf::IntRect cropLocation(minContent.x, minContent.y, maxContent.x - minContent.x, maxContent.y - minContent.y);
-		const auto cropSize = cropLocation.getSize();
-
-		logFmtToFile(_parent->_appConfig, "Img Offset: %d, %d - new size: %d, %d", minContent.x, minContent.y, cropSize.x, cropSize.y);
-
-		croppedImg.create(cropSize.x, cropSize.y, sf::Color(0, 0, 0, 0));
-		croppedImg.copy(srcImg, 0, 0, cropLocation);
-		cropInfo = { srcSize, cropLocation };
-
-		//end scope to destroy the src image in case it's holding onto the file handle
+		logFmtToFile(_parent->_appConfig, "ERROR: No cropped image for %s", imgpath.c_str());
+		const sf::Vector2u size = srcTex->getSize();
+		return { size, sf::IntRect(0, 0, size.x, size.y) };
 	}
 
-	// try removing it first, if we can't, then something's wrong
-	std::error_code ec;
-	std::filesystem::remove(imgpath, ec);
-	if (ec)
-	{
-		logFmtToFile(_parent->_appConfig, "ERROR: Failed to remove %s - %s", imgpath.c_str(), ec.message().c_str());
-	}
+	CropInfo cropInfo = { exported->origSize, exported->cropRect };
+	const auto cropSize = cropInfo.cropRect.getSize();
 
-	if (croppedImg.saveToFile(imgpath))
-	{
-		_parent->_croppedImages[imgpath] = cropInfo;
-		logFmtToFile(_parent->_appConfig, "Saved %s", imgpath.c_str());
-	}
-	else
-	{
-		logFmtToFile(_parent->_appConfig, "ERROR: Failed to save %s", imgpath.c_str());
-	}
+	logFmtToFile(_parent->_appConfig, "Img Offset: %d, %d - new size: %d, %d", cropInfo.cropRect.left, cropInfo.cropRect.top, cropSize.x, cropSize.y);
 
+	if (srcTex->create(cropSize.x, cropSize.y))
+		srcTex->update(exported->premultiplied.data());
 
-	// alpha premult on cropped image
-	const auto imgSize = croppedImg.getSize();
-	int channels = 4;
-	const uint32_t pixelCount = imgSize.x * imgSize.y;
+	_parent->_croppedImages[imgpath] = cropInfo;
 
-	int x = 0, y = 0;
-	for (uint32_t i = 0u; i < pixelCount; i++)
-	{
-		auto pix = croppedImg.getPixel(x, y);
-		if (pix.a > 0)
-		{
-			pix.r = (sf::Uint8)((float)pix.r * ((float)pix.a / 255));
-			pix.g = (sf::Uint8)((float)pix.g * ((float)pix.a / 255));
-			pix.b = (sf::Uint8)((float)pix.b * ((float)pix.a / 255));
+	return cropInfo;
+}
 
-			croppedImg.setPixel(x, y, pix);
-		}
-		else
-			croppedImg.setPixel(x, y, sf::Color(0, 0, 0, 0));
+LayerManager::LayerInfo LayerManager::LayerInfo::DeepCopy() const
+{
+	LayerInfo copy(*this);
 
-		x++;
-		if (x >= imgSize.x)
-		{
-			x = 0;
-			y++;
-		}
+	for (auto& sp : _sprites)
+		copy._sprites[sp.first] = sp.second.Copy();
 
-	}
+	copy._uniqueTracking = std::make_shared<TrackingSettings>(*_uniqueTracking);
+	copy._uniqueTrackingMotion = std::make_shared<TrackingMotion>(*_uniqueTrackingMotion);
 
-	srcTex->loadFromImage(croppedImg);
+	if (_trackingSettings == _uniqueTracking.get())
+		copy._trackingSettings = copy._uniqueTracking.get();
+	if (_trackingMotion == _uniqueTrackingMotion.get())
+		copy._trackingMotion = copy._uniqueTrackingMotion.get();
 
-	return cropInfo;
+	return copy;
 }
 
 LayerManager::SpriteInfo LayerManager::SpriteInfo::Copy() const
@@ -7896,6 +8256,7 @@ LayerManager::SpriteInfo LayerManager::SpriteInfo::Copy() const
 	copy.path = path;
 	copy.tint = tint;
 	copy.sprite = std::make_shared<SpriteSheet>(*sprite);
+	copy.sprite->UnshareStream();
 
 	return std::move(copy);
 }
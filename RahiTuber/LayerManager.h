@@ -17,6 +17,11 @@
 #include "Config.h"
 
 #include "TextureManager.h"
+#include "PhysicsIntegrator.h"
+#include "LayerFrameState.h"
+#include "ExportPipeline.h"
+#include "LayerSetSaver.h"
+#include "FileWatcher.h"
 
 #include "Shaders.h"
 #include "Gamepad.h"
@@ -233,7 +238,7 @@ public:
 		float _blinkDuration = 0.2;
 		float _blinkDelay = 6.0;
 		float _blinkVariation = 4.0;
-		sf::Clock _blinkTimer;
+		FrameTimer _blinkTimer;
 		bool _isBlinking = false;
 		float _blinkVarDelay = 0;
 
@@ -266,8 +271,8 @@ public:
 
 		float _motionX = 0;
 		float _motionY = 0;
-		sf::Clock _motionTimer;
-		sf::Clock _bounceTimer;
+		FrameTimer _motionTimer;
+		FrameTimer _bounceTimer;
 
 		bool _scream = false;
 		float _screamThreshold = 0.85;
@@ -276,7 +281,7 @@ public:
 		float _screamVibrateAmount = 5;
 		float _screamVibrateSpeed = 1;
 		float _minScreamTime = 0.2;
-		sf::Clock _screamTimer;
+		FrameTimer _screamTimer;
 
 		std::map<SpriteType, SpriteInfo> _sprites;
 
@@ -333,15 +338,18 @@ public:
 
 		bool EvaluateLayerVisibility();
 
-		void DoIndividualMotion(bool talking, bool screaming, float talkAmount, double& rot, sf::Vector2<double>& motionScale, ImVec4& activeSpriteCol, sf::Vector2<double>& motionPos, bool becameVisible);
+		// Follows a link to another layer using this frame's resolved indices. Only valid during Draw.
+		LayerInfo* FrameLink(LayerFrameState::Link link) const;
 
-		void CalculateInheritedMotion(sf::Vector2<double>& motionScale, sf::Vector2<double>& motionPos, double& motionRot, double& motionParentRot, ImVec4& motionTint, sf::Vector2<double>& physicsPos, bool becameVisible, SpriteSheet* lastActiveSprite, float timeMult);
+		void DoIndividualMotion(const FrameTime& frame, bool talking, bool screaming, float talkAmount, double& rot, sf::Vector2<double>& motionScale, ImVec4& activeSpriteCol, sf::Vector2<double>& motionPos, bool becameVisible);
+
+		void CalculateInheritedMotion(const FrameTime& frame, sf::Vector2<double>& motionScale, sf::Vector2<double>& motionPos, double& motionRot, double& motionParentRot, ImVec4& motionTint, bool becameVisible, SpriteSheet* lastActiveSprite, float frameSeconds);
 
 		void DoConstantMotion(sf::Time& frameTime, sf::Vector2<double>& mpScale, sf::Vector2<double>& mpPos, double& mpRot);
 
-		void CalculateDraw(float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask);
+		void CalculateDraw(const FrameTime& frame, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask);
 
-		void DetermineVisibleSprites(bool talking, bool screaming, ImVec4& activeSpriteCol, float& talkAmount, PhonemeMask phMask);
+		void DetermineVisibleSprites(const FrameTime& frame, bool talking, bool screaming, ImVec4& activeSpriteCol, float& talkAmount, PhonemeMask phMask);
 
 		void AddTrackingMovement(sf::Vector2<double>& mpPos, double& mpRot, sf::Vector2<double>& mpScale);
 
@@ -374,9 +382,13 @@ public:
 
 		void OptimiseSprites();
 
+		// A copy with its own sprites and tracking settings, nothing shared with this layer
+		LayerInfo DeepCopy() const;
+
 		LayerManager::CropInfo CropTextureTransparency(sf::Texture* srcTex, std::string& imgpath);
 
 		int _lastCalculatedDepth = 0;
+		int _frameIndex = -1;
 		std::string _motionParent = "";
 		float _motionDelay = 0;
 		struct MotionLinkData
@@ -384,7 +396,6 @@ public:
 			sf::Time _frameTime;
 			sf::Vector2<double>  _scale = { 1.f, 1.f };
 			sf::Vector2<double>  _pos = { 0,0 };
-			sf::Vector2<double>  _physicsPos = { 0,0 };
 			ImVec4 _tint;
 			double _rot = 0.0;
 			double _parentRot = 0.0;
@@ -396,7 +407,7 @@ public:
 		float _motionSpring = 0.f;
 		float _distanceLimit = -1.f;
 		float _rotationEffect = 0.f;
-		sf::Vector2<double> _lastAccel = { 0.f, 0.f };
+		int _physicsSlot = -1;
 		bool _allowIndividualMotion = false;
 		bool _physicsIgnorePivots = false;
 		MotionStretchType _motionStretch = MS_None;
@@ -413,14 +424,20 @@ public:
 		bool _smoothTalkFactor = false;
 		float _smoothTalkFactorSize = 5;
 		float _talkRunningAverage = 0.0;
+		int _audioChannel = -1;		// an input channel to listen to instead of the mix, when channels are separated
+		bool _talkOnVoice = false;		// talk while the noise gate is open, rather than above the threshold
 
-		sf::Clock _frameTimer;
-		sf::Clock _physicsTimer;
+		FrameTimer _frameTimer;
+		FrameTimer _physicsTimer;
 
 		sf::Vector2f _lastHeaderScreenPos;
 		sf::Vector2f _lastHeaderPos;
 		sf::Vector2f _lastHeaderSize;
 
+		// the height of this layer's UI when it was last drawn, so the list can skip it while it's scrolled out of view
+		float _lastGuiHeight = 0;
+		bool _guiOpen = false;
+
 		sf::Vector2f _constantScale = { 1.f, 1.f };
 		sf::Vector2f _constantPos = { 0,0 };
 		double _constantRot = 0;
@@ -545,17 +562,15 @@ public:
 		std::string _webRequest = "";
 
 
-		sf::Clock _timer;
+		FrameTimer _timer;
 	};
 
-	void Draw(sf::RenderTarget* target, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask = PH_NONE);
+	void Draw(const FrameTime& frame, sf::RenderTarget* target, float windowHeight, float windowWidth, float talkLevel, float talkMax, PhonemeMask phMask = PH_NONE);
 
 	void DrawOldLayerSetUI();
 
 	void UpdateWindowTitle();
 
-	void CopyFileAndUpdatePath(std::string& filePath, std::filesystem::path targetFolder, std::filesystem::copy_options copyOpts);
-
 	void ResolveAbsolutePath(std::filesystem::path& fsFilePath);
 
 	void DoMenuBarLogic();
@@ -587,6 +602,26 @@ public:
 		return _loadingFinished == false;
 	}
 
+	// Whether any layer was drawn differently last frame than the frame before
+	inline bool IsAnimating() const { return _animating; }
+
+	// Whether any visible layer was talking in the last Draw
+	bool IsTalking() const;
+
+	// The main avatar names the window, takes the HTTP state requests and does the once-per-frame
+	// upkeep of the shared texture cache. Co-hosts (see CoHostAvatar.h) leave those to it.
+	inline void SetPrimary(bool primary) { _primary = primary; }
+	inline bool IsPrimary() const { return _primary; }
+
+	// Separated input channels, for layers bound to one of them. nullptr while only the mix is captured.
+	inline void SetAudioChannels(const ChannelAnalyser* channels) { _audioChannels = channels; }
+	inline const ChannelAnalyser* GetAudioChannels() const { return _audioChannels; }
+
+	// Whether the noise gate hears a voice, for layers that talk when it does. A layer bound to a
+	// channel asks for that channel's gate.
+	inline void SetVoiceActive(bool active) { _voiceActive = active; }
+	bool VoiceActive(int channel = -1) const;
+
 	LayerInfo* AddLayer(const LayerInfo* toCopy = nullptr, bool isFolder = false, int insertPosition = -1);
 	void GenerateGuid(std::string& guid);
 	void RemoveLayer(int toRemove);
@@ -603,7 +638,12 @@ public:
 
 	void MakePortablePath(std::string& path, bool xmlRelative = false, fs::path xmlPath = fs::path());
 
+	// With makePortable and copyImages, the images are exported in the background and the XML is written once they're done
 	bool SaveLayers(const std::string& settingsFileName, bool makePortable = false, bool copyImages = false, bool optimise = false);
+	void UpdateExport(bool wait = false);
+	void UpdateSaves();
+	void UpdateHotReload();
+	void ReleaseTextures();
 	bool LoadLayers(const std::string& settingsFileName);
 
 	void SetUnloadingTimer(int timer);
@@ -719,6 +759,10 @@ private:
 	float _lastTalkLevel = 0.0;
 	float _lastTalkMax = 1.0;
 
+	// what the visible layers looked like last frame, to tell whether anything is moving
+	uint64_t _drawnHash = 0;
+	bool _animating = false;
+
 	AppConfig* _appConfig = nullptr;
 	UIConfig* _uiConfig = nullptr;
 
@@ -726,11 +770,27 @@ private:
 	std::deque<StatesInfo> _states;
 
 	std::deque<LayerInfo> _layers;
+	LayerFrameState _frameState;
+
+	void BeginFrameState();
+	void FinishFrameState();
 
 	std::map<std::string, bool> _tagList;
 	std::map<std::string, bool> _tagDefaults;
 	std::map<std::string, bool> _tagFilters;
 
+	struct LayerListRow
+	{
+		int layer = 0;
+		bool inFolder = false;
+	};
+
+	// The rows of the editor's layer list after folders and tag filters, rebuilt when layers or filters change
+	std::vector<LayerListRow> _layerListRows;
+	bool _layerListDirty = true;
+	size_t _layerListCount = 0;
+	void RebuildLayerList();
+
 	bool _tagDeleteOpen = false;
 	std::string deleteTag = "";
 
@@ -748,9 +808,14 @@ private:
 	bool _blendingShaderLoaded = false;
 
 	TextureManager* _textureMan = nullptr;
+	bool _primary = true;
+	const ChannelAnalyser* _audioChannels = nullptr;
+	bool _voiceActive = false;
 
 	EffectManager* _effectMan = nullptr;
 
+	PhysicsIntegrator _physics;
+
 	bool _statesPassThrough = false;
 	bool _statesHideUnaffected = false;
 	bool _statesIgnoreStick = false;
@@ -817,6 +882,42 @@ private:
 
 	std::deque<GlobalPreset> _globalPresets;
 	int _currentGlobalPreset = -1;
+
+	// Everything a layer set file holds, copied so the saver thread never touches the live layers
+	struct SaveSnapshot
+	{
+		std::string path = "";
+		bool xmlRelative = false;
+
+		std::deque<LayerInfo> layers;
+		std::deque<StatesInfo> states;
+		std::map<std::string, bool> tagDefaults;
+
+		sf::Vector2f globalScale = { 1.f, 1.f };
+		sf::Vector2f globalPos = { 0.f,0.f };
+		float globalRot = 0.0;
+
+		bool statesPassThrough = false;
+		bool statesHideUnaffected = false;
+		bool statesIgnoreStick = false;
+		bool undoRotationEffectFix = false;
+
+		LayerInfo::TrackingSettings globalTracking;
+		LayerInfo::TrackingMotion globalTrackingMotion;
+
+		std::deque<GlobalPreset> globalPresets;
+		int currentGlobalPreset = -1;
+	};
+
+	std::shared_ptr<const SaveSnapshot> TakeSaveSnapshot(const std::string& path, bool xmlRelative);
+	void QueueSave(const std::string& path, bool xmlRelative);
+	bool SerializeLayerSet(const SaveSnapshot& snap, std::string& contents, std::string& error);
+
+	LayerSetSaver _saver;
+	sf::Clock _autosaveTimer;
+
+	FileWatcher _imageWatcher;
+	sf::Clock _imageWatchTimer;
 	bool _canvasPresetMenuOpen = false;
 	bool _canvasPresetMenuFirstOpen = true;
 
@@ -856,6 +957,11 @@ private:
 	std::vector<std::string> _hoveredLayers;
 
 	std::map<std::string, LayerManager::CropInfo> _croppedImages;
+
+	ExportPipeline _export;
+	std::string _exportXMLPath = "";
+	bool _exportOptimise = false;
+	sf::Clock _exportTimer;
 	bool _storePreCropPivot = false;
 
 	void AppendStateToOrder(StatesInfo* state)
@@ -980,37 +1086,37 @@ private:
 
 };
 
-static sf::Texture* _resetIcon = nullptr;
-static sf::Texture* _emptyIcon = nullptr;
-static sf::Texture* _animIcon = nullptr;
-static sf::Texture* _upIcon = nullptr;
-static sf::Texture* _dnIcon = nullptr;
-static sf::Texture* _editIcon = nullptr;
-static sf::Texture* _delIcon = nullptr;
-static sf::Texture* _dupeIcon = nullptr;
-static sf::Texture* _newFileIcon = nullptr;
-static sf::Texture* _openFileIcon = nullptr;
-static sf::Texture* _saveIcon = nullptr;
-static sf::Texture* _saveAsIcon = nullptr;
-static sf::Texture* _makePortableIcon = nullptr;
-static sf::Texture* _reloadIcon = nullptr;
-static sf::Texture* _newLayerIcon = nullptr;
-static sf::Texture* _newFolderIcon = nullptr;
-static sf::Texture* _statesIcon = nullptr;
-static sf::Texture* _plusIcon = nullptr;
-static sf::Texture* _moveIcon = nullptr;
-static sf::Texture* _dropIcon = nullptr;
-
-static sf::Texture* _filterOnIcon = nullptr;
-static sf::Texture* _filterOffIcon = nullptr;
-
-static sf::Texture* _lockOpenIcon = nullptr;
-static sf::Texture* _lockClosedIcon = nullptr;
-static sf::Texture* _eyeOpenIcon = nullptr;
-static sf::Texture* _eyeClosedIcon = nullptr;
-
-static sf::Texture* _pinIcon = nullptr;
-static sf::Texture* _pinOffIcon = nullptr;
+static const sf::Sprite* _resetIcon = nullptr;
+static const sf::Sprite* _emptyIcon = nullptr;
+static const sf::Sprite* _animIcon = nullptr;
+static const sf::Sprite* _upIcon = nullptr;
+static const sf::Sprite* _dnIcon = nullptr;
+static const sf::Sprite* _editIcon = nullptr;
+static const sf::Sprite* _delIcon = nullptr;
+static const sf::Sprite* _dupeIcon = nullptr;
+static const sf::Sprite* _newFileIcon = nullptr;
+static const sf::Sprite* _openFileIcon = nullptr;
+static const sf::Sprite* _saveIcon = nullptr;
+static const sf::Sprite* _saveAsIcon = nullptr;
+static const sf::Sprite* _makePortableIcon = nullptr;
+static const sf::Sprite* _reloadIcon = nullptr;
+static const sf::Sprite* _newLayerIcon = nullptr;
+static const sf::Sprite* _newFolderIcon = nullptr;
+static const sf::Sprite* _statesIcon = nullptr;
+static const sf::Sprite* _plusIcon = nullptr;
+static const sf::Sprite* _moveIcon = nullptr;
+static const sf::Sprite* _dropIcon = nullptr;
+
+static const sf::Sprite* _filterOnIcon = nullptr;
+static const sf::Sprite* _filterOffIcon = nullptr;
+
+static const sf::Sprite* _lockOpenIcon = nullptr;
+static const sf::Sprite* _lockClosedIcon = nullptr;
+static const sf::Sprite* _eyeOpenIcon = nullptr;
+static const sf::Sprite* _eyeClosedIcon = nullptr;
+
+static const sf::Sprite* _pinIcon = nullptr;
+static const sf::Sprite* _pinOffIcon = nullptr;
 
 
 inline float GetRandom01()
@@ -0,0 +1,152 @@
+#include "LayerSetSaver.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+void LayerSetSaver::Save(const std::string& path, Serializer serialize)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// replaces a save of the same file that hasn't started yet
+	if (_pending.count(path))
+		_skipped++;
+	_pending[path] = serialize;
+
+	if (!_thread.joinable())
+	{
+		_stopping = false;
+		_thread = std::thread([this]() { ThreadLoop(); });
+	}
+
+	_wake.notify_one();
+}
+
+void LayerSetSaver::Flush()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_idle.wait(lock, [this]() { return _pending.empty() && !_busy; });
+}
+
+void LayerSetSaver::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_wake.notify_one();
+
+	if (_thread.joinable())
+		_thread.join();
+}
+
+std::vector<LayerSetSaver::Result> LayerSetSaver::TakeResults()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<Result> out;
+	out.swap(_results);
+	return out;
+}
+
+void LayerSetSaver::ThreadLoop()
+{
+	while (true)
+	{
+		std::string path;
+		Serializer serialize;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wake.wait(lock, [this]() { return _stopping || !_pending.empty(); });
+
+			// queued saves are still written when stopping
+			if (_pending.empty())
+				return;
+
+			path = _pending.begin()->first;
+			serialize = _pending.begin()->second;
+			_pending.erase(_pending.begin());
+			_busy = true;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		Result result;
+		result.path = path;
+
+		std::string contents;
+		result.ok = serialize(contents, result.error);
+
+		if (result.ok)
+		{
+			size_t hash = std::hash<std::string>()(contents);
+			bool unchanged = false;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				auto found = _lastWrittenHash.find(path);
+				unchanged = found != _lastWrittenHash.end() && found->second == hash;
+			}
+
+			std::error_code ec;
+			if (unchanged && fs::exists(path, ec))
+			{
+				result.unchanged = true;
+			}
+			else
+			{
+				result.ok = WriteFileAtomic(path, contents, result.error);
+
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (result.ok)
+					_lastWrittenHash[path] = hash;
+				else
+					_lastWrittenHash.erase(path);
+			}
+		}
+
+		result.ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_results.push_back(result);
+			_busy = false;
+		}
+		_idle.notify_all();
+	}
+}
+
+bool LayerSetSaver::WriteFileAtomic(const std::string& path, const std::string& contents, std::string& error)
+{
+	std::string tmpPath = path + ".tmp";
+	{
+		std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			error = "Failed to open " + tmpPath;
+			return false;
+		}
+
+		file.write(contents.data(), contents.size());
+		file.flush();
+		if (!file)
+		{
+			error = "Failed to write " + tmpPath;
+			file.close();
+			std::error_code ec;
+			fs::remove(tmpPath, ec);
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	fs::rename(tmpPath, path, ec);
+	if (ec)
+	{
+		error = "Failed to replace " + path + ": " + ec.message();
+		fs::remove(tmpPath, ec);
+		return false;
+	}
+
+	return true;
+}
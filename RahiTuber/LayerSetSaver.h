@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Writes layer set files on a background thread.
+// Saves are queued per file: if a file is saved again before the previous save was written, only the newest
+// one is serialised. Files are written next to the target and renamed over it, so a crash mid-save never
+// leaves a truncated layer set, and contents identical to the last write are not written again.
+class LayerSetSaver
+{
+public:
+
+	// Runs on the saver thread. Fills contents with the whole file, or error and returns false.
+	typedef std::function<bool(std::string& contents, std::string& error)> Serializer;
+
+	struct Result
+	{
+		std::string path = "";
+		bool ok = false;
+		bool unchanged = false;
+		std::string error = "";
+		float ms = 0.f;
+	};
+
+	~LayerSetSaver() { Stop(); }
+
+	void Save(const std::string& path, Serializer serialize);
+
+	// Blocks until everything queued so far has been written
+	void Flush();
+
+	// Flushes, then stops the thread
+	void Stop();
+
+	// Finished saves since the last call, for logging and error messages on the main thread
+	std::vector<Result> TakeResults();
+
+	inline int WritesSkipped() const { return _skipped; }
+
+	static bool WriteFileAtomic(const std::string& path, const std::string& contents, std::string& error);
+
+private:
+
+	void ThreadLoop();
+
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	std::condition_variable _idle;
+	bool _stopping = false;
+	bool _busy = false;
+
+	std::map<std::string, Serializer> _pending;
+	std::map<std::string, size_t> _lastWrittenHash;
+	std::vector<Result> _results;
+	int _skipped = 0;
+};
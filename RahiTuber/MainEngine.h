@@ -30,12 +30,21 @@
 #include "CrashHandler.h"
 
 #pragma comment (lib, "Dwmapi.lib")
+#else
+#include "SharedFrameSink.h"
 #endif
 
 #include "Config.h"
 #include "xmlConfig.h"
 
 #include "LayerManager.h"
+#include "CoHostAvatar.h"
+#include "file_browser_modal.h"
+#include "FrameRecorder.h"
+#include "MenuRefresh.h"
+#include "FramePacer.h"
+#include "AudioSupervisor.h"
+#include "StartupOrchestrator.h"
 
 #include "Gamepad.h"
 
@@ -109,7 +118,10 @@ int recordCallback(const void* inputBuffer, void* outputBuffer,
 {
 	int checkSize = framesPerBuffer;
 
-	int numChannels = g_audioConfig->_params.channelCount;
+	// the supervisor passes the format the stream was opened with
+	int numChannels = g_audioConfig->_numChannels;
+	if (userData != nullptr)
+		numChannels = ((const AudioStreamFormat*)userData)->channels;
 
 	//Erase old frames, leave enough in the vector for 2 checkSizes
 	{ //lock for frequency data
@@ -120,17 +132,58 @@ int recordCallback(const void* inputBuffer, void* outputBuffer,
 
 	SAMPLE* rptr = (SAMPLE*)inputBuffer;
 
+	double adcTime = LatencyTracker::Now();
+	if (timeInfo != nullptr)
+		adcTime = LatencyTracker::FromStreamTime(timeInfo->inputBufferAdcTime, timeInfo->currentTime);
+
+	// the latency test only runs on the device's stream, not on audio fed in directly
+	bool latencyTest = g_audioConfig->_latencyTest && userData != nullptr;
+	bool impulse = false;
+	if (latencyTest)
+	{
+		int impulseBlocks = g_audioConfig->_impulseBlocks;
+		if (impulseBlocks > 0)
+		{
+			impulse = true;
+			if (g_audioConfig->_impulseTime < 0)
+				g_audioConfig->_impulseTime = adcTime;
+			g_audioConfig->_impulseBlocks = impulseBlocks - 1;
+		}
+	}
+
+	float sampleRate = g_audioConfig->_currentSampleRate;
+	if (userData != nullptr)
+		sampleRate = ((const AudioStreamFormat*)userData)->sampleRate;
+
+	// every channel is kept apart too, for layers listening to just one of them
+	if (g_audioConfig->_separateChannels && !latencyTest)
+		g_audioConfig->_channels.Push(rptr, framesPerBuffer, numChannels, sampleRate);
+
+	static unsigned int impulseNoise = 1;
+
 	int s = 0;
+	double sumSquares = 0;
 
+	// the mix is still the first two channels
 	while (s < checkSize)
 	{
-		SAMPLE splLeft = (*rptr++);
+		SAMPLE splLeft = rptr[0];
 		SAMPLE splRight = splLeft;
-		if (numChannels == 2)
-			splRight = (*rptr++);
+		if (numChannels >= 2)
+			splRight = rptr[1];
+		rptr += numChannels;
 
 		SAMPLE spl = (splLeft + splRight) / 2.f;
 
+		// white noise, loud enough for any layer to talk
+		if (impulse)
+		{
+			impulseNoise = impulseNoise * 1664525u + 1013904223u;
+			spl = 0.9f * ((impulseNoise >> 8) / 8388608.f - 1.f);
+		}
+		else if (latencyTest)
+			spl = 0;
+
 		spl = spl * spl;
 
 		{ //lock for frequency data
@@ -139,9 +192,15 @@ int recordCallback(const void* inputBuffer, void* outputBuffer,
 			g_audioConfig->_frames.push_back(fabs(spl));
 		}
 
+		sumSquares += spl;
 		s++;
 	}
 
+	if (checkSize > 0)
+		g_audioConfig->_gate.Process(sqrtf(sumSquares / checkSize), checkSize / sampleRate);
+
+	g_audioConfig->_capturedFrames += framesPerBuffer;
+	g_audioConfig->_lastAdcTime = adcTime;
 	g_audioConfig->_processedNew = true;
 
 	return paContinue;
@@ -155,12 +214,42 @@ public:
 	UIConfig* uiConfig = nullptr;
 	LayerManager* layerMan = nullptr;
 
+	// other avatars drawn alongside layerMan, one for each of appConfig->_coHosts
+	std::vector<std::unique_ptr<CoHostAvatar>> _coHosts;
+	int _coHostBrowseIdx = -1;
+	std::string _coHostBrowsePath = "";
+
+	// the latency test, see UpdateLatencyTest
+	double _analysedAt = 0;
+	sf::Clock _latencyTestTimer;
+	bool _impulseWaiting = false;
+	int _impulseMisses = 0;
+
 #ifdef _WIN32
 	Spout* spout = nullptr;
+#else
+	SharedFrameSink* shmSink = nullptr;
 #endif
 
 	Shader _FXAAShader;
 
+	FrameRecorder _recorder;
+
+	FramePacer _pacer;
+
+	StartupOrchestrator _startup;
+
+	// set by the audio startup thread, read after it's joined
+	bool _audioStarted = false;
+	std::string _audioStartError;
+
+	AudioSupervisor _audioSupervisor{ std::make_unique<PortAudioBackend>(recordCallback, PA_SAMPLE_TYPE, FRAMES_PER_BUFFER) };
+	unsigned int _audioDevicesVersion = 0;
+
+	MenuRefresh _menuRefresh;
+	bool _menuCached = false;			// this frame may leave the last menu frame where it is
+	bool _menuWindowRedrawn = false;
+
 	void LoadCustomFont()
 	{
 		ImGuiIO& io = ImGui::GetIO();
@@ -178,6 +267,10 @@ public:
 
 		io.Fonts->Clear();
 
+		// the icons copied into the old atlas go back to their own until they're copied into the new one,
+		// so they still draw if the font fails to load
+		appConfig->_textureMan.UseStandaloneIcons();
+
 		io.Fonts->AddFontDefault();
 
 		uiConfig->_fontReloadNeeded = false;
@@ -193,6 +286,9 @@ public:
 		if (result == nullptr)
 			return;
 
+		// icons share the font texture, so they batch with the button frames and text around them
+		appConfig->_textureMan.AddIconsToFontAtlas(io.Fonts);
+
 		io.FontDefault = result;
 
 		if (!io.Fonts->IsBuilt())
@@ -207,6 +303,7 @@ public:
 			unsigned char* tex_pixels = NULL;
 			int tex_width, tex_height, bpp;
 			io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_width, &tex_height, &bpp);
+			appConfig->_textureMan.CopyIconsToFontAtlas(io.Fonts, tex_pixels, tex_width, &uiConfig->fontTex);
 
 			uiConfig->fontimg.create(tex_width, tex_height, tex_pixels);
 			uiConfig->fontTex.loadFromImage(uiConfig->fontimg);
@@ -395,6 +492,7 @@ public:
 		}
 
 		appConfig->_menuRT.create(appConfig->_scrW, appConfig->_scrH, settings);
+		_menuRefresh.Invalidate();
 		appConfig->_layersRT.create(appConfig->_scrW, appConfig->_scrH, settings);
 
 		float cornerGrabSize = 20 * appConfig->mainWindowScaling;
@@ -417,7 +515,7 @@ public:
 
 		appConfig->_wasFullScreen = appConfig->_isFullScreen;
         appConfig->_window.setVerticalSyncEnabled(appConfig->_enableVSync);
-		appConfig->_window.setFramerateLimit(appConfig->_enableVSync ? 0 : appConfig->_fpsLimit);
+		appConfig->_window.setFramerateLimit(appConfig->_enableVSync || appConfig->_precisePacing ? 0 : appConfig->_fpsLimit);
 
 #ifdef _WIN32
 		HWND hwnd = appConfig->_window.getSystemHandle();
@@ -896,6 +994,45 @@ public:
 					ImGui::EndTable();
 				}
 
+				ImGui::Separator();
+				ImGui::Checkbox("Spectral Detection", &audioConfig->_spectralPhonemes);
+				ToolTip("Detect phonemes from the shape of your voice (MFCCs and formants)\ninstead of the band splits above.\nNeeds calibrating before it takes over.", &appConfig->_hoverTimer);
+
+				if (audioConfig->_spectralPhonemes)
+				{
+					auto& classifier = audioConfig->_phonemeClassifier;
+					if (!classifier.IsCalibrated())
+						ImGui::TextWrapped("Not calibrated yet. Record Silence and at least one sound.");
+
+					const char* classNames[PhonemeClassifier::NumClasses] = { "Silence", "A", "E", "S", "P", "oo" };
+					if (ImGui::BeginTable("Calibration", 3, ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp))
+					{
+						for (int c = 0; c < PhonemeClassifier::NumClasses; c++)
+						{
+							int ph = PhonemeClassifier::ClassPhoneme(c);
+							auto& centroid = classifier.GetCentroid(ph);
+
+							ImGui::TableNextColumn();
+							ImGui::Button(("Hold: " + std::string(classNames[c])).c_str(), { -1, 0 });
+							if (ImGui::IsItemActive())
+								classifier.StartCalibration(ph);
+							ToolTip("Hold this button while making the sound (or staying quiet, for Silence).", &appConfig->_hoverTimer);
+
+							ImGui::TableNextColumn();
+							ImGui::AlignTextToFramePadding();
+							ImGui::Text("%d samples", centroid.count);
+
+							ImGui::TableNextColumn();
+							if (ImGui::Button(("Clear##calib" + std::to_string(c)).c_str()))
+								classifier.ClearCalibration(ph);
+						}
+
+						ImGui::EndTable();
+					}
+
+					ImGui::Text("F1: %d Hz  F2: %d Hz", (int)classifier.FormantF1(), (int)classifier.FormantF2());
+				}
+
 				ImGui::EndTabItem();
 			}
 			else
@@ -907,6 +1044,39 @@ public:
 		}
 	}
 
+	void StartRecording()
+	{
+		time_t timeNow = time(0);
+		tm timeStruct;
+#ifdef _WIN32
+		localtime_s(&timeStruct, &timeNow);
+#else
+		localtime_r(&timeNow, &timeStruct);
+#endif
+		char folderName[64];
+		std::strftime(folderName, sizeof(folderName), "%Y-%m-%d_%H-%M-%S", &timeStruct);
+
+		fs::path folder = fs::u8path(appConfig->_appLocation + "recordings/" + folderName);
+
+		// leave a core or two for rendering and audio
+		int workers = std::max(1, std::min(4, (int)std::thread::hardware_concurrency() / 2));
+
+		if (_recorder.Start(folder, (FrameRecorder::Format)appConfig->_recordFormat, workers, 8))
+			logToFile(appConfig, "Recording to " + folder.u8string());
+		else
+			logToFile(appConfig, "Recording failed: " + _recorder.GetError());
+	}
+
+	void StopRecording()
+	{
+		if (_recorder.IsRecording() == false)
+			return;
+
+		_recorder.Stop(&appConfig->_layersRT);
+		logFmtToFile(appConfig, "Recording finished: %llu frames written, %llu dropped by readback, %llu dropped by the encoder queue, %llu failed",
+			_recorder.FramesWritten(), _recorder.FramesDropped() - _recorder.FramesDroppedByQueue(), _recorder.FramesDroppedByQueue(), _recorder.WriteFailures());
+	}
+
 	void menuAdvancedIntegrationTab(bool& rowTop, float UIUnit)
 	{
 		std::string tooltipMsg = "Settings related to integration with other software";
@@ -987,11 +1157,48 @@ public:
 					ImGui::Checkbox("Dedicated GamePad Thread", &appConfig->_gamepadThreaded);
 					ToolTip("Handle GamePad inputs on a separate thread.\nNOTE: Applies on restart. Can improve application smoothness\nbut some reports of losing input while out of focus.", &appConfig->_hoverTimer);
 
+#else
+					ImGui::TableNextColumn();
+					ImGui::Checkbox("Shared memory output", &appConfig->_useSharedMemorySender);
+					std::string shmTip = "Publish premultiplied RGBA frames to shared memory (" + appConfig->_sharedMemoryName + ")\nfor local capture tools. See RahiTuber_FrameReader.";
+					if (shmSink != nullptr)
+						shmTip += "\n" + std::to_string(shmSink->FramesPublished()) + " frames sent, " + std::to_string(shmSink->FramesDropped()) + " dropped";
+					ToolTip(shmTip.c_str(), &appConfig->_hoverTimer);
 #endif
 
+					ImGui::TableNextColumn();
+					bool recording = _recorder.IsRecording();
+					if (ImGui::Checkbox("Record frames", &recording))
+					{
+						if (recording)
+							StartRecording();
+						else
+							StopRecording();
+					}
+					std::string recordTip = "Save every frame with transparency to a numbered image sequence in\n" + (appConfig->_appLocation + "recordings/");
+					if (_recorder.FramesCaptured() > 0)
+						recordTip += "\n" + std::to_string(_recorder.FramesWritten()) + " frames written, " + std::to_string(_recorder.FramesDropped()) + " dropped";
+					ToolTip(recordTip.c_str(), &appConfig->_hoverTimer);
+
+					ImGui::TableNextColumn();
+					ImGui::BeginDisabled(recording);
+					ImGui::SetNextItemWidth(ImGui::CalcTextSize("QOI (fast)").x + UIUnit * 2);
+					if (ImGui::BeginCombo("Record format", FrameRecorder::FormatName(appConfig->_recordFormat)))
+					{
+						for (int fmt = 0; fmt < FrameRecorder::FORMAT_END; fmt++)
+							if (ImGui::Selectable(FrameRecorder::FormatName(fmt), appConfig->_recordFormat == fmt))
+								appConfig->_recordFormat = fmt;
+
+						ImGui::EndCombo();
+					}
+					ToolTip("PNG is widely supported.\nQOI is lossless and several times faster to encode, so fewer frames are dropped.", &appConfig->_hoverTimer);
+					ImGui::EndDisabled();
+
 					ImGui::EndTable();
 				}
 
+				menuCoHosts(UIUnit);
+
 				ImGui::EndTabItem();
 			}
 			else
@@ -1003,6 +1210,139 @@ public:
 		}
 	}
 
+	void menuCoHosts(float UIUnit)
+	{
+		ImGui::SeparatorText("Co-hosts");
+
+		int removeIdx = -1;
+		bool browseOpen = false;
+		for (int c = 0; c < (int)_coHosts.size(); c++)
+		{
+			CoHostSettings& settings = appConfig->_coHosts[c];
+			CoHostAvatar* coHost = _coHosts[c].get();
+			bool changed = false;
+
+			ImGui::PushID(c);
+
+			const sf::RenderTexture& preview = coHost->GetRenderTexture();
+			float previewHeight = UIUnit * 3.f;
+			float previewWidth = previewHeight * preview.getSize().x / std::max(1u, preview.getSize().y);
+			ImGui::Image(preview, sf::Vector2f(previewWidth, previewHeight), sf::Color::White, sf::Color(128, 128, 128));
+
+			ImGui::SameLine();
+			ImGui::BeginGroup();
+
+			char nameBuf[64] = {};
+			settings.name.copy(nameBuf, sizeof(nameBuf) - 1);
+			ImGui::SetNextItemWidth(UIUnit * 8);
+			if (ImGui::InputText("Name", nameBuf, sizeof(nameBuf)))
+				settings.name = nameBuf;
+			changed |= ImGui::IsItemDeactivatedAfterEdit();
+			ToolTip(("Frames are sent out as \"" + coHost->OutputName() + "\",\nthrough Spout2 or shared memory, whichever is on for the main avatar.").c_str(), &appConfig->_hoverTimer);
+
+			std::string setName = settings.layerSet.empty() ? "(none)" : fs::path(settings.layerSet).stem().string();
+			if (ImGui::Button((setName + "##layerSet").c_str(), { UIUnit * 8, ImGui::GetFrameHeight() }))
+			{
+				browseOpen = true;
+				_coHostBrowseIdx = c;
+				_coHostBrowsePath = settings.layerSet;
+			}
+			ImGui::SameLine();
+			ImGui::Text("Layer set");
+			ToolTip(settings.layerSet.c_str(), &appConfig->_hoverTimer);
+
+			int size[2] = { settings.width, settings.height };
+			ImGui::SetNextItemWidth(UIUnit * 8);
+			if (ImGui::InputInt2("Size", size))
+			{
+				settings.width = std::max(16, size[0]);
+				settings.height = std::max(16, size[1]);
+			}
+			changed |= ImGui::IsItemDeactivatedAfterEdit();
+
+			std::string channelName = settings.audioChannel < 0 ? "Mix" : "Channel " + std::to_string(settings.audioChannel + 1);
+			ImGui::SetNextItemWidth(UIUnit * 8);
+			if (ImGui::BeginCombo("Audio", channelName.c_str()))
+			{
+				for (int ch = -1; ch < ChannelAnalyser::MaxChannels; ch++)
+				{
+					std::string name = ch < 0 ? "Mix" : "Channel " + std::to_string(ch + 1);
+					if (ImGui::Selectable(name.c_str(), settings.audioChannel == ch))
+					{
+						settings.audioChannel = ch;
+						changed = true;
+					}
+				}
+				ImGui::EndCombo();
+			}
+			ToolTip("The input channel this avatar talks with.\nNeeds 'Separate Channels' in the audio settings, otherwise it follows the mix.", &appConfig->_hoverTimer);
+
+			ImGui::EndGroup();
+
+			ImGui::SameLine();
+			if (ImGui::Button("Remove", { -1, ImGui::GetFrameHeight() }))
+				removeIdx = c;
+
+			if (coHost->GetLayerManager()->IsLoading())
+				ImGui::TextDisabled("Loading...");
+			else if (coHost->GetError().empty() == false)
+				ImGui::TextColored({ 1, 0.4f, 0.4f, 1 }, "%s", coHost->GetError().c_str());
+			else
+				ImGui::TextDisabled("%.2fms per frame", coHost->DrawMs());
+
+			if (changed)
+				coHost->Apply(settings);
+
+			ImGui::PopID();
+		}
+
+		if (removeIdx != -1)
+		{
+			_coHosts.erase(_coHosts.begin() + removeIdx);
+			appConfig->_coHosts.erase(appConfig->_coHosts.begin() + removeIdx);
+		}
+
+		static imgui_ext::file_browser_modal coHostBrowser("Co-host Layer Set");
+		coHostBrowser._acceptedExt = { ".xml" };
+		if (browseOpen && _coHostBrowsePath.empty() == false)
+			coHostBrowser.SetStartingDir(fs::path(_coHostBrowsePath).parent_path());
+		if (coHostBrowser.render(browseOpen, _coHostBrowsePath, false) && _coHostBrowseIdx >= 0 && _coHostBrowseIdx < (int)_coHosts.size())
+		{
+			appConfig->_coHosts[_coHostBrowseIdx].layerSet = fs::absolute(_coHostBrowsePath).string();
+			_coHosts[_coHostBrowseIdx]->Apply(appConfig->_coHosts[_coHostBrowseIdx]);
+		}
+
+		if (ImGui::Button("Add Co-host", { -1, ImGui::GetFrameHeight() }))
+		{
+			CoHostSettings settings;
+			settings.name = "Co-host " + std::to_string(_coHosts.size() + 1);
+			appConfig->_coHosts.push_back(settings);
+			SyncCoHosts();
+		}
+		ToolTip("Run another avatar with its own layer set and output, sharing images and audio with this one.", &appConfig->_hoverTimer);
+
+		float coHostMs = 0;
+		for (auto& coHost : _coHosts)
+			coHostMs += coHost->DrawMs();
+
+		ImGui::Text("%d avatars: CPU %.0f%%, memory %.0fMB, co-hosts %.2fms per frame", (int)_coHosts.size() + 1, _pacer.CpuPercent(),
+			FramePacer::ProcessMemoryBytes() / (1024.f * 1024.f), coHostMs);
+		ToolTip("For the whole app, CPU measured over the last second with 100% being one core.\nTo compare against separate processes, run each avatar in its own RahiTuber\nand add up the CPU and memory of each.", &appConfig->_hoverTimer);
+	}
+
+	// Creates or removes co-hosts to match their settings, and applies the settings to each
+	void SyncCoHosts()
+	{
+		while (_coHosts.size() > appConfig->_coHosts.size())
+			_coHosts.pop_back();
+
+		while (_coHosts.size() < appConfig->_coHosts.size())
+			_coHosts.push_back(std::make_unique<CoHostAvatar>(appConfig, uiConfig));
+
+		for (size_t c = 0; c < _coHosts.size(); c++)
+			_coHosts[c]->Apply(appConfig->_coHosts[c]);
+	}
+
 	void menuAdvancedAppearanceTab(bool& rowTop, float UIUnit)
 	{
 		std::string tooltipMsg = "Settings related to appearance and rendering";
@@ -1230,6 +1570,20 @@ public:
 				ToolTip("Set the FPS limit for the application.", &appConfig->_hoverTimer);
 				ImGui::EndDisabled();
 
+				ImGui::TableNextColumn();
+				if (ImGui::Checkbox("Precise frame pacing", &appConfig->_precisePacing))
+				{
+					initWindow();
+				}
+				ToolTip("Time each frame against a precise deadline for smoother motion.\nTurn off to use the system's frame limiter instead.", &appConfig->_hoverTimer);
+
+				ImGui::TableNextColumn();
+				ImGui::BeginDisabled(appConfig->_enableVSync || !appConfig->_precisePacing);
+				ImGui::InputInt("Idle FPS", &appConfig->_idleFpsLimit, 5, 15);
+				appConfig->_idleFpsLimit = std::max(0, appConfig->_idleFpsLimit);
+				ToolTip("Frame rate to drop to when nothing is talking, moving or being used.\nSet to 0 to always run at the FPS limit.", &appConfig->_hoverTimer);
+				ImGui::EndDisabled();
+
 				ImGui::TableNextColumn();
 				if (ImGui::Checkbox("Name windows separately", &appConfig->_nameWindowWithSet))
 				{
@@ -1246,6 +1600,34 @@ public:
 
 				ImGui::EndTable();
 
+				ImGui::Text("%.0f FPS%s, frame time jitter %.2fms, CPU %.0f%% (%.0f%% spent waiting)", _pacer.SmoothedFps(), _pacer.IsIdle() ? " (idle)" : "",
+					_pacer.JitterMs(), _pacer.CpuPercent(), _pacer.SpinPercent());
+				ToolTip("Measured over the last second. CPU is for the whole app, 100% being one core.", &appConfig->_hoverTimer);
+
+				for (int src = 0; src < LatencyTracker::SourceCount; src++)
+				{
+					auto stats = appConfig->_latency.GetStats((LatencyTracker::Source)src);
+					if (stats.count == 0)
+						continue;
+
+					ImGui::Text("Latency, %s: %.1fms median, %.1fms p95, %.1fms max (handled %.1fms, drawn %.1fms)", LatencyTracker::SourceName((LatencyTracker::Source)src),
+						stats.p50Ms, stats.p95Ms, stats.maxMs, stats.stageMeanMs[LatencyTracker::StageHandled], stats.stageMeanMs[LatencyTracker::StageDrawn]);
+				}
+
+				bool latencyTest = audioConfig->_latencyTest;
+				if (ImGui::Checkbox("Latency Test", &latencyTest))
+				{
+					audioConfig->_latencyTest = latencyTest;
+					_impulseMisses = 0;
+					_latencyTestTimer.restart();
+				}
+				ToolTip("Replace the audio input with silence and a burst of noise every second,\nand time how long it takes for a layer to start talking on screen.\nAlso served as JSON at http://127.0.0.1:<HTTP port>/latency", &appConfig->_hoverTimer);
+				if (audioConfig->_latencyTest && _impulseMisses > 0)
+				{
+					ImGui::SameLine();
+					ImGui::TextDisabled("%d impulses didn't make a layer talk", _impulseMisses);
+				}
+
 				ImGui::EndTabItem();
 			}
 			else
@@ -1328,6 +1710,55 @@ public:
 						ToolTip("Set how long to wait before unloading an image.\n  If you set this to less than any\n  frequent states/blinks, expect stutter!", &appConfig->_hoverTimer);
 					}
 
+					ImGui::Checkbox("Cache layer set images", &appConfig->_layerSetCache);
+					ToolTip("Keep a decoded copy of the images next to the layer set (.rtcache)\nso it opens much faster next time.\nThe cache is rebuilt automatically when an image changes.", &appConfig->_hoverTimer);
+
+					ImGui::DragInt("Autosave interval", &appConfig->_autosaveInterval, 0.5f, 0, 600, appConfig->_autosaveInterval > 0 ? "%d s" : "Off");
+					ToolTip("Periodically save the current layers to lastLayers.xml in the background.\nNothing is written if nothing has changed. Set to 0 to turn it off.", &appConfig->_hoverTimer);
+
+					ImGui::Checkbox("Reload images when they change", &appConfig->_hotReloadImages);
+					ToolTip("Watch the layer set's image files and swap in new versions\nas soon as they're saved, without reloading the layer set.", &appConfig->_hoverTimer);
+
+					ImGui::Checkbox("Store scaled-down images smaller", &appConfig->_textureVariants);
+					ToolTip("Smooth-filtered images that are always shown well below their full size\nare kept on the GPU at 1/2, 1/4... of it instead, filtered in the background.\nSaves video memory and looks cleaner. Zooming back in brings\nthe detail back a moment later.", &appConfig->_hoverTimer);
+					if (appConfig->_textureVariants)
+					{
+						auto scaleStats = appConfig->_textureMan.GetScaleStats();
+						ImGui::Text("%d images stored smaller: %.1f MB instead of %.1f MB", scaleStats.count,
+							scaleStats.storedBytes / (1024.f * 1024.f), scaleStats.fullBytes / (1024.f * 1024.f));
+						ImGui::Text("%d pending, %.1fms to filter", scaleStats.pending, scaleStats.buildMs);
+					}
+
+					int sharedImages = 0;
+					size_t sharedBytes = appConfig->_textureMan.GetSharedBytes(&sharedImages);
+					if (sharedImages > 0)
+					{
+						ImGui::Text("%d duplicate images shared, %.1f MB of video memory saved", sharedImages, sharedBytes / (1024.f * 1024.f));
+						ToolTip("Identical image files used by this layer set are only loaded once,\neven when they're in different folders.", &appConfig->_hoverTimer);
+					}
+
+					int tiledImages = 0;
+					int loadedTiles = 0;
+					size_t tiledBytes = appConfig->_textureMan.GetTiledBytes(&tiledImages, &loadedTiles);
+					if (tiledImages > 0)
+					{
+						ImGui::Text("%d oversized images, %d tiles in use (%.1f MB)", tiledImages, loadedTiles, tiledBytes / (1024.f * 1024.f));
+						ToolTip("Images larger than your GPU's maximum texture size are split into tiles,\nand only the tiles holding frames being shown are uploaded.", &appConfig->_hoverTimer);
+					}
+
+					ImGui::Checkbox("Only redraw the menu when it changes", &appConfig->_menuRedrawOnChange);
+					ToolTip("Update the menu at full speed only while you're using it,\nand reuse the last drawn menu when nothing on it has changed.\nMeters and previews still refresh 20 times a second.", &appConfig->_hoverTimer);
+					if (appConfig->_menuRedrawOnChange)
+					{
+						unsigned long long menuPasses = _menuRefresh.PassesRun() + _menuRefresh.PassesSkipped();
+						float skippedPercent = menuPasses > 0 ? 100.f * _menuRefresh.PassesSkipped() / menuPasses : 0.f;
+						ImGui::Text("Menu updates skipped: %.0f%%, %llu unchanged redraws, ~%.1fs of UI time saved", skippedPercent,
+							_menuRefresh.RendersSkipped(), _menuRefresh.SecondsSaved());
+					}
+
+					ImGui::SliderInt("Physics substeps", &appConfig->_physicsSubsteps, 1, 8);
+					ToolTip("How many times per 1/60s layer physics (drag & spring) are calculated.\nHigher values are smoother and more stable with strong springs.", &appConfig->_hoverTimer);
+
 					//ImGui::Checkbox("Disable Rotation Effect Fix", &appConfig->_undoRotationEffectFix);
 					//ToolTip("Disable the fix for Rotation Effect on this Layer Set.", &appConfig->_hoverTimer);
 
@@ -1472,7 +1903,39 @@ public:
 			ImGui::Checkbox("Compression", &audioConfig->_compression);
 			ToolTip("Use a compression curve for audio levels\n(the difference in effect reduces as the volume nears maximum).", &appConfig->_hoverTimer);
 
+			ImGui::TableNextColumn();
+
+			if (ImGui::Checkbox("Separate Channels", &audioConfig->_separateChannels))
+			{
+				// the stream is reopened with more channels, or back to stereo
+				_audioSupervisor.SetMaxChannels(audioConfig->_separateChannels ? ChannelAnalyser::MaxChannels : 2);
+				if (audioConfig->_lastDeviceName != "")
+					_audioSupervisor.SelectDevice(audioConfig->_lastDeviceName);
+				else
+					_audioSupervisor.SelectDefaultDevice();
+			}
+			ToolTip("Capture every channel of the input device, so layers and co-hosts can follow just one of them.\nThe talk level is still the mix of the first two.", &appConfig->_hoverTimer);
+
+			ImGui::TableNextColumn();
+
+			ImGui::Checkbox("Voice Gate", &audioConfig->_voiceGate);
+			ToolTip("Skip the audio analysis while the input is only room noise, and keep the levels at zero.\nThe gate learns how loud the room is by itself.", &appConfig->_hoverTimer);
+
 			ImGui::EndTable();
+
+			if (audioConfig->_voiceGate)
+			{
+				ImGui::PushItemWidth(100);
+				ImGui::DragFloat("Gate Margin", &audioConfig->_gateMarginDb, 0.1, 0.0, 30.0, "%.1fdB");
+				ToolTip("How far above the room noise the input has to be to count as a voice.", &appConfig->_hoverTimer);
+				ImGui::SameLine();
+				ImGui::DragFloat("Hangover", &audioConfig->_gateHangover, 0.01, 0.0, 2.0, "%.2fs");
+				ToolTip("How long the gate stays open after the voice stops, to bridge the gaps between words.", &appConfig->_hoverTimer);
+				ImGui::PopItemWidth();
+
+				ImGui::TextDisabled("%s, noise floor %.0fdB. Analysis %.3fms with voice, %.3fms gated", audioConfig->_gate.IsOpen() ? "Voice" : "Gated",
+					20.f * log10f(audioConfig->_gate.Floor()), audioConfig->_analysisMsVoice, audioConfig->_analysisMsGated);
+			}
 		}
 
 		bool useDefaultDevice = audioConfig->_devIdx == -1;
@@ -1490,7 +1953,7 @@ public:
 			}
 			case 1:
 			{
-				int defInputIdx = Pa_GetDefaultInputDevice();
+				int defInputIdx = _audioSupervisor.DefaultDevice();
 				if (useDefaultDevice && audioConfig->_nDevices > 0)
 				{
 					//use the default input device
@@ -1515,23 +1978,14 @@ public:
 	{
 		logToFile(appConfig, "Switching to audio device: " + dev.first);
 
-		StopAudioStream();
-
-		auto info = Pa_GetDeviceInfo(dev.second);
-		float sRate;
-
+		// the stream is reopened on the supervisor thread, the levels reset once it's capturing
 		audioConfig->_lastDeviceName = dev.first;
 		audioConfig->_devIdx = dev.second;
-		audioConfig->_params.device = audioConfig->_devIdx;
-		audioConfig->_params.channelCount = Min(2, info->maxInputChannels);
-		audioConfig->_params.suggestedLatency = info->defaultLowInputLatency;
-		audioConfig->_params.hostApiSpecificStreamInfo = nullptr;
-		audioConfig->_currentSampleRate = info->defaultSampleRate;
-
-		PaError err = paNoError;
-
-		StartAudioStream(err);
+		_audioSupervisor.SelectDevice(dev.first);
+	}
 
+	void ResetAudioLevels()
+	{
 		audioConfig->_overallMax = audioConfig->_fixedMax; //audioConfig->_cutoff;
 		audioConfig->_overallHi = 0;
 		audioConfig->_overallSoftFall = 0;
@@ -1549,48 +2003,61 @@ public:
 		audioConfig->_trebleSoftFall = 0;
 	}
 
-	void StopAudioStream()
+	void ListAudioDevices(bool checkMissingOrChanged = false)
 	{
-		Pa_StopStream(audioConfig->_audioStr);
-		Pa_CloseStream(audioConfig->_audioStr);
+		// re-initialising the host to find new devices happens on the supervisor thread,
+		// the new list shows up here a few frames later
+		if (checkMissingOrChanged)
+			_audioSupervisor.RefreshDevices();
+
+		SyncAudioDevices();
 	}
 
-	void ListAudioDevices(bool checkMissingOrChanged = false)
+	// Copies the supervisor's device list when it has listed them again
+	void SyncAudioDevices()
 	{
-		if (checkMissingOrChanged)
-		{
-			Pa_Terminate();
-			Pa_Initialize();
-		}
+		unsigned int version = _audioSupervisor.DevicesVersion();
+		if (version == _audioDevicesVersion)
+			return;
+		_audioDevicesVersion = version;
 
 		int oldDevCount = audioConfig->_deviceList.size();
-		audioConfig->_nDevices = Pa_GetDeviceCount();
 		audioConfig->_deviceList.clear();
-		for (int dI = 0; dI < audioConfig->_nDevices; dI++)
-		{
-			auto info = Pa_GetDeviceInfo(dI);
-			if (info->hostApi == 0 && info->maxInputChannels > 0)
-				audioConfig->_deviceList.push_back({ info->name, dI });
-		}
+		for (auto& dev : _audioSupervisor.GetDevices())
+			audioConfig->_deviceList.push_back({ dev.name, dev.index });
+
+		audioConfig->_nDevices = audioConfig->_deviceList.size();
 		int newCount = audioConfig->_deviceList.size();
 
-		if (checkMissingOrChanged)
+		if (newCount != oldDevCount) logFmtToFile(appConfig, "Listed %d input devices (previous: %d)", newCount, oldDevCount);
+	}
+
+	// Picks up streams the supervisor opened or lost since the last frame
+	void HandleAudioStreamChanges()
+	{
+		AudioStreamChange change;
+		while (_audioSupervisor.TakeStreamChange(change))
 		{
-			if (newCount != oldDevCount) logFmtToFile(appConfig, "Listed %d input devices (previous: %d)", newCount, oldDevCount);
+			logToFile(appConfig, "PortAudio: " + change.message);
 
-			auto dev = audioConfig->GetAudioDevice(audioConfig->_lastDeviceName);
-			if (dev != nullptr)
+			if (change.connected)
 			{
-				SwitchAudioDevice(*dev);
-				if(newCount != oldDevCount) logToFile(appConfig, "Audio Devices changed, preserved choice: " + dev->first);
+				audioConfig->_devIdx = change.device.index;
+				audioConfig->_numChannels = change.channels;
+				audioConfig->_currentSampleRate = change.device.sampleRate;
+				audioConfig->_capturedFrames = 0;
+				audioConfig->_channels.Reset();
+				audioConfig->_gate.Reset();
+				ResetAudioLevels();
 			}
-			else
+			else if (change.lost && change.device.name == audioConfig->_lastDeviceName)
 			{
 				audioConfig->_devIdx = -1;
-				if (newCount != oldDevCount) logToFile(appConfig, "Audio Devices changed, lost connection to " + audioConfig->_lastDeviceName);
+				logToFile(appConfig, "Audio Devices changed, lost connection to " + audioConfig->_lastDeviceName);
 			}
-
 		}
+
+		SyncAudioDevices();
 	}
 
 	void menuPresets(ImGuiStyle& style)
@@ -1824,6 +2291,11 @@ public:
 		if(menuPoppedNow)
 			uiConfig->_lastTheme = "";
 
+		if (menuPoppedNow || menuUnpopped)
+			_menuRefresh.Invalidate();
+
+		sf::Clock passClock;
+
 		appConfig->_menuPopped = appConfig->_menuPopPending;
 
 		float lastScaleFactor = appConfig->scalingFactor;
@@ -1855,25 +2327,22 @@ public:
 
 		io.FontGlobalScale = appConfig->scalingFactor * 0.5;
 
-		if (appConfig->_menuWindow.isOpen())
-		{
-			appConfig->_menuWindow.clear(toSFColor(style.Colors[ImGuiCol_FrameBg]));
-		}
-
 		// Main menu window
 
 		float UIUnit = ImGui::GetFrameHeight();
 
+		// drawn under the docked menu once it's known to need rendering
+		sf::RectangleShape backdrop;
+
 		float windowHeight = appConfig->_scrH - 20;
 		if (appConfig->_menuPopped == false)
 		{
 			ImGui::SetNextWindowPos(ImVec2(10, 10));
 			ImGui::SetNextWindowSize({ UIUnit*25, windowHeight });
 
-			sf::RectangleShape backdrop({ UIUnit*25 - 4, windowHeight - 6 * appConfig->scalingFactor });
+			backdrop.setSize({ UIUnit*25 - 4, windowHeight - 6 * appConfig->scalingFactor });
 			backdrop.setPosition(13, 13);
 			backdrop.setFillColor(backdropCol);
-			appConfig->_menuRT.draw(backdrop);
 
 			ImGui::Begin("RahiTuber", 0, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollbar);
 
@@ -1976,12 +2445,21 @@ public:
 
 		bool popupOpen = ImGui::IsPopupOpen(ImGuiID(0), ImGuiPopupFlags_AnyPopup);
 
+		// dragging, holding a button or typing keeps the menu updating every frame
+		bool menuBusy = ImGui::IsAnyItemActive() || io.WantTextInput;
+
 		ImGui::End();
 
 		if (appConfig->_menuPopped)
 		{
 			ImGui::EndFrame();
-			ImGui::SFML::Render(appConfig->_menuWindow);
+			ImGui::Render();
+			_menuWindowRedrawn = _menuRefresh.NeedsRender(ImGui::GetDrawData(), _menuCached);
+			if (_menuWindowRedrawn)
+			{
+				appConfig->_menuWindow.clear(toSFColor(style.Colors[ImGuiCol_FrameBg]));
+				ImGui::SFML::Render(appConfig->_menuWindow);
+			}
 			ImGui::SFML::Update(appConfig->_window, appConfig->_timer.getElapsedTime());
 		}
 
@@ -1993,12 +2471,31 @@ public:
 
 			ImGui::Begin("move_tab", 0, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoScrollbar);
 			ImGui::SetCursorPos({ uiConfig->_moveTabSize.x / 2 - 12 * appConfig->mainWindowScaling,4 * appConfig->mainWindowScaling });
-			ImGui::Image(uiConfig->_moveIconSprite, sf::Vector2f(24 * appConfig->mainWindowScaling, 24 * appConfig->mainWindowScaling), toSFColor(style.Colors[ImGuiCol_Text]));
+			ImGui::Image(*appConfig->_textureMan.GetIcon(TextureManager::ICON_MOVE), sf::Vector2f(24 * appConfig->mainWindowScaling, 24 * appConfig->mainWindowScaling), toSFColor(style.Colors[ImGuiCol_Text]));
 			ImGui::End();
 		}
 
 		ImGui::EndFrame();
-		ImGui::SFML::Render(appConfig->_menuRT);
+		if (appConfig->_menuPopped)
+		{
+			ImGui::SFML::Render(appConfig->_menuRT);
+		}
+		else
+		{
+			// an unchanged menu is left in _menuRT as it was
+			ImGui::Render();
+			if (_menuRefresh.NeedsRender(ImGui::GetDrawData(), _menuCached))
+			{
+				if (_menuCached)
+				{
+					appConfig->_menuRT.clear(sf::Color(0, 0, 0, 0));
+					DrawMenuOutline();
+				}
+
+				appConfig->_menuRT.draw(backdrop);
+				ImGui::SFML::Render(appConfig->_menuRT);
+			}
+		}
 
 		if (appConfig->_updateAvailable && !popupOpen)
 		{
@@ -2045,12 +2542,46 @@ public:
 		}
 
 		uiConfig->_firstMenu = false;
+
+		_menuRefresh.PassFinished(appConfig->_frameClock.Now().time, passClock.getElapsedTime().asMicroseconds() * 0.001f, menuBusy);
+	}
+
+	void DrawMenuOutline()
+	{
+		if (!uiConfig->_menuShowing || appConfig->_isFullScreen)
+			return;
+
+		if (appConfig->_transparent)
+		{
+			uiConfig->_outlineBox.setSize({ appConfig->_scrW - 4, appConfig->_scrH - 4 });
+			appConfig->_menuRT.draw(uiConfig->_outlineBox);
+		}
+
+		appConfig->_menuRT.draw(uiConfig->_topLeftBox);
+		appConfig->_menuRT.draw(uiConfig->_bottomRightBox);
+	}
+
+	// Whether nothing else is drawn over the menu, so it can be left as it is between changes
+	bool MenuCanBeReused()
+	{
+		bool menuVisible = uiConfig->_menuShowing || appConfig->_menuWindow.isOpen();
+
+		return menuVisible
+			&& !uiConfig->_firstMenu
+			&& !uiConfig->_fontReloadNeeded
+			&& !appConfig->_updateAvailable
+			&& appConfig->_menuPopped == appConfig->_menuPopPending
+			&& !(uiConfig->_showFPS && (!uiConfig->_menuShowing || appConfig->_menuPopped))
+			&& !uiConfig->_showDebugBars
+			&& !uiConfig->_cornerGrabbed.first && !uiConfig->_cornerGrabbed.second
+			&& !(layerMan && layerMan->IsLoading());
 	}
 
 	void render()
 	{
 		auto dt = appConfig->_timer.restart();
-		appConfig->_fps = (1.0f / dt.asSeconds());
+		const FrameTime& frame = appConfig->_frameClock.Advance();
+		appConfig->_fps = _pacer.SmoothedFps();
 
 		if (appConfig->_transparent)
 		{
@@ -2071,19 +2602,45 @@ public:
 
 		}
 
-		appConfig->_menuRT.clear(sf::Color(0, 0, 0, 0));
+		// a menu nobody is using is only updated now and then, and only redrawn if it changed
+		bool wasCached = _menuCached;
+		_menuCached = appConfig->_menuRedrawOnChange && MenuCanBeReused();
+		if (_menuCached && !wasCached)
+			_menuRefresh.Invalidate();
+
+		bool menuPass = !_menuCached || _menuRefresh.NeedsUpdate(frame.time);
+		_menuWindowRedrawn = false;
+
+		// a docked menu that's being reused clears it itself, once it knows something changed
+		bool menuCleared = !_menuCached || (menuPass && appConfig->_menuPopped);
+		if (menuCleared)
+			appConfig->_menuRT.clear(sf::Color(0, 0, 0, 0));
 
 		float audioLevel = audioConfig->_midSoftFall;
 
 		if (audioConfig->_compression)
+			audioLevel = ChannelAnalyser::Compress(audioLevel);
+
+		PhonemeMask phMask = (PhonemeMask)audioConfig->_prevPhoneme;
+		const ChannelAnalyser* channels = audioConfig->_separateChannels ? &audioConfig->_channels : nullptr;
+		layerMan->SetAudioChannels(channels);
+		layerMan->SetVoiceActive(audioConfig->_gate.IsOpen());
+		layerMan->Draw(frame, &appConfig->_layersRT, appConfig->_scrH, appConfig->_scrW, audioLevel, audioConfig->_midMax, phMask);
+
+		// after the main avatar, which does the frame's upkeep of the texture cache they share
+		for (auto& coHost : _coHosts)
 		{
-			audioLevel = Clamp(audioLevel, 0.0, 1.0);
-			audioLevel = (1.0 - audioLevel) * sin(PI * 0.5 * audioLevel) + audioLevel * sin(PI * 0.5 * powf(audioLevel, 0.5));
-			audioLevel = Clamp(audioLevel, 0.0, 1.0);
+			float coHostLevel = audioLevel;
+			float coHostMax = audioConfig->_midMax;
+			PhonemeMask coHostPhoneme = phMask;
+			ChannelLevels(coHost->GetSettings().audioChannel, coHostLevel, coHostMax, coHostPhoneme);
+			coHost->GetLayerManager()->SetAudioChannels(channels);
+			coHost->GetLayerManager()->SetVoiceActive(ChannelVoiceActive(coHost->GetSettings().audioChannel));
+			coHost->Draw(frame, coHostLevel, coHostMax, coHostPhoneme);
 		}
 
-		PhonemeMask phMask = SelectPhoneme();
-		layerMan->Draw(&appConfig->_layersRT, appConfig->_scrH, appConfig->_scrW, audioLevel, audioConfig->_midMax, phMask);
+		UpdateLatencyTest();
+		appConfig->_latency.Mark(LatencyTracker::StageDrawn);
 
 		if (layerMan && layerMan->IsEmptyAndIdle())
 		{
@@ -2106,22 +2663,16 @@ public:
 
 		if (uiConfig->_menuShowing)
 		{
-			if (!appConfig->_isFullScreen)
-			{
-				if (appConfig->_transparent)
-				{
-					uiConfig->_outlineBox.setSize({ appConfig->_scrW - 4, appConfig->_scrH - 4 });
-					appConfig->_menuRT.draw(uiConfig->_outlineBox);
-				}
+			if (menuCleared)
+				DrawMenuOutline();
 
-				appConfig->_menuRT.draw(uiConfig->_topLeftBox);
-				appConfig->_menuRT.draw(uiConfig->_bottomRightBox);
-			}
-			menu();
+			if (menuPass)
+				menu();
 		}
 		else if (appConfig->_menuWindow.isOpen())
 		{
-			menu();
+			if (menuPass)
+				menu();
 		}
 		else if (layerMan && layerMan->IsLoading())
 		{
@@ -2286,8 +2837,33 @@ public:
 				logToFile(appConfig, "Spout2: Failed sending FBO");
 			}
 		}
+#else
+		if (appConfig->_useSharedMemorySender)
+		{
+			if (shmSink == nullptr)
+				shmSink = new SharedFrameSink();
+
+			shmSink->_name = appConfig->_sharedMemoryName;
+			if (shmSink->Submit(appConfig->_layersRT) == false)
+			{
+				logToFile(appConfig, "Shared memory output: " + shmSink->GetError());
+				appConfig->_useSharedMemorySender = false;
+			}
+		}
+		else if (shmSink != nullptr)
+		{
+			delete shmSink;
+			shmSink = nullptr;
+		}
 #endif
 
+		if (_recorder.IsRecording())
+		{
+			_recorder.Submit(appConfig->_layersRT);
+			if (_recorder.IsRecording() == false)
+				logToFile(appConfig, "Recording stopped: " + _recorder.GetError());
+		}
+
 		appConfig->_menuRT.display();
 #if _DEBUGRENDER
 		if (outputMenuDbg)
@@ -2312,8 +2888,10 @@ public:
 #endif
 
 		appConfig->_window.display();
+		appConfig->_latency.FrameDisplayed();
 		
-		if (appConfig->_menuWindow.isOpen())
+		// a menu window that wasn't redrawn still shows its last frame
+		if (appConfig->_menuWindow.isOpen() && (_menuWindowRedrawn || !_menuCached))
 		{
 			appConfig->_menuWindow.display();
 		}
@@ -2437,7 +3015,7 @@ public:
 
 	}
 
-	PhonemeMask SelectPhoneme()
+	PhonemeMask SelectPhoneme(double audioTime)
 	{
 		PhonemeMask phMask = PH_NONE;
 
@@ -2469,47 +3047,43 @@ public:
 			phMask = PH_W;
 		}
 
-		auto& lastPh = audioConfig->_lastPhonemes;
-
-		lastPh.push_back(phMask);
-		while (lastPh.size() > appConfig->_fps * 0.2)
-			lastPh.erase(lastPh.begin());
+		auto& classifier = audioConfig->_phonemeClassifier;
+		if (audioConfig->_spectralPhonemes && classifier.IsCalibrated())
+			phMask = (PhonemeMask)audioConfig->_spectralPhoneme;
 
-		int countA = 0;
-		int countE = 0;
-		int countS = 0;
-		int countP = 0;
-		int countW = 0;
+		auto& votes = audioConfig->_phonemeVotes;
 
-		for (int ph : lastPh)
+		if (audioTime < audioConfig->phLastSwitched)
 		{
-			countA += ph == PH_A ? 1 : 0;
-			countE += ph == PH_E ? 1 : 0;
-			countS += ph == PH_S ? 1 : 0;
-			countP += ph == PH_P ? 1 : 0;
-			countW += ph == PH_W ? 1 : 0;
-
+			// audio timeline restarted (stream was reopened)
+			votes.Clear();
+			audioConfig->phLastSwitched = audioTime;
 		}
 
+		votes.Expire(audioTime - audioConfig->phVoteWindow);
+		votes.Push(audioTime, phMask);
+
+		int numVotes = votes.Size();
+
 		phMask = (PhonemeMask)audioConfig->_prevPhoneme;
 
-		if (audioConfig->phSinceChanged.getElapsedTime().asSeconds() > audioConfig->phSwitchDelay)
+		if (audioTime - audioConfig->phLastSwitched > audioConfig->phSwitchDelay)
 		{
-			audioConfig->phSinceChanged.restart();
+			audioConfig->phLastSwitched = audioTime;
 
-			if (audioConfig->AConfidenceBoost*countA > lastPh.size())
+			if (audioConfig->AConfidenceBoost * votes.Count(PH_A) > numVotes)
 				phMask = PH_A;
 
-			if (audioConfig->EConfidenceBoost*countE > lastPh.size())
+			if (audioConfig->EConfidenceBoost * votes.Count(PH_E) > numVotes)
 				phMask = PH_E;
 
-			if (audioConfig->SConfidenceBoost*countS > lastPh.size())
+			if (audioConfig->SConfidenceBoost * votes.Count(PH_S) > numVotes)
 				phMask = PH_S;
 
-			if (audioConfig->PConfidenceBoost*countP > lastPh.size())
+			if (audioConfig->PConfidenceBoost * votes.Count(PH_P) > numVotes)
 				phMask = PH_P;
 
-			if (audioConfig->WConfidenceBoost*countW > lastPh.size())
+			if (audioConfig->WConfidenceBoost * votes.Count(PH_W) > numVotes)
 				phMask = PH_W;
 		}
 
@@ -2577,6 +3151,11 @@ public:
 		{
 			while (appConfig->_menuWindow.pollEvent(menuEvt))
 			{
+				if (menuEvt.type == menuEvt.Resized)
+					_menuRefresh.Invalidate();
+				else
+					_menuRefresh.Wake();
+				_pacer.MarkActive();
 
 				int retFlag;
 				RecordHotkey(menuEvt, retFlag);
@@ -2660,6 +3239,12 @@ public:
 		sf::Event evt;
 		while (appConfig->_window.isOpen() && appConfig->_window.pollEvent(evt))
 		{
+			if (evt.type == evt.Resized)
+				_menuRefresh.Invalidate();
+			else
+				_menuRefresh.Wake();
+			_pacer.MarkActive();
+
 			if (evt.type == evt.KeyPressed || evt.type == evt.MouseButtonPressed)
 			{
 				appConfig->_window.requestFocus();
@@ -2840,6 +3425,12 @@ public:
 
 	void doAudioAnalysis()
 	{
+		bool newAudio = audioConfig->_processedNew;
+
+		audioConfig->_gate.SetMarginDb(audioConfig->_gateMarginDb);
+		audioConfig->_gate.SetHangover(audioConfig->_gateHangover);
+		audioConfig->_channels.SetGate(audioConfig->_gateMarginDb, audioConfig->_gateHangover);
+
 		if (audioConfig->_processedNew)
 		{
 			audioConfig->_recordTimer.restart();
@@ -2853,55 +3444,51 @@ public:
 			audioConfig->_trebleHi = 0;
 			audioConfig->_overallHi = 0;
 
-			//Do fourier transform
-			{ //lock for frequency data
-				std::lock_guard<std::mutex> guard(audioConfig->_freqDataMutex);
-				if (audioConfig->_frames.size() >= (FRAMES_PER_BUFFER * 2))
-					audioConfig->_fftData = RealArray1D(audioConfig->_frames.begin(), audioConfig->_frames.begin() + (FRAMES_PER_BUFFER * 2));
-			} //end lock
+			// no voice: the levels stay at zero, and so does the spectrum
+			bool gated = audioConfig->_voiceGate && audioConfig->_gate.IsOpen() == false;
+			sf::Clock analysisTimer;
 
-			auto FFTsize = audioConfig->_fftData.size();
-
-			audioConfig->_frequencyData.clear();
-			audioConfig->_frequencyData.resize(FFTsize);
-
-			const char* error_description = 0;
-			simple_fft::FFT(audioConfig->_fftData, audioConfig->_frequencyData, FFTsize, error_description);
-
-			float factor = 50;
-
-			for (unsigned int it = 0; it < audioConfig->_frequencyData.size(); it++)
+			if (gated)
 			{
-				auto re = audioConfig->_frequencyData[it].real();
-				auto im = audioConfig->_frequencyData[it].imag();
-				auto magnitude = std::sqrt(re * re + im * im);
-
-				////Try to flatten the FFT graph
-				float point = it / 20 + 0.3f;
-				magnitude = magnitude * pow(atan(point),2);
-				if (it == 0) magnitude *= 0.7f;
-
-				//magnitude = pow(10, (magnitude / 20));
-
-				////Store the magnitude
-				//audioConfig->_frequencyData.push_back(magnitude);
-
-				//store data for bass and treble
-				if (it > 1 && it < FFTsize / audioConfig->_subSplit && magnitude > audioConfig->_subHi)
-					audioConfig->_subHi = magnitude;
-
-				if (it > FFTsize / audioConfig->_subSplit && it < FFTsize / audioConfig->_bassSplit && magnitude > audioConfig->_bassHi)
-					audioConfig->_bassHi = magnitude;
+				std::fill(audioConfig->_frequencyData.begin(), audioConfig->_frequencyData.end(), complex_type(0));
+				std::fill(audioConfig->_powerSpectrum.begin(), audioConfig->_powerSpectrum.end(), 0.f);
+				audioConfig->_spectralPhoneme = 0;
+			}
+			else
+			{
+				//Do fourier transform
+				{ //lock for frequency data
+					std::lock_guard<std::mutex> guard(audioConfig->_freqDataMutex);
+					if (audioConfig->_frames.size() >= (FRAMES_PER_BUFFER * 2))
+						audioConfig->_fftData = RealArray1D(audioConfig->_frames.begin(), audioConfig->_frames.begin() + (FRAMES_PER_BUFFER * 2));
+				} //end lock
+
+				ChannelAnalyser::Bands bands;
+				ChannelAnalyser::MeasureBands(audioConfig->_fftData, AudioBandSplits(), bands, audioConfig->_frequencyData, audioConfig->_powerSpectrum);
+
+				audioConfig->_subHi = bands.sub;
+				audioConfig->_bassHi = bands.bass;
+				audioConfig->_midHi = bands.mid;
+				audioConfig->_trebleHi = bands.treble;
+				audioConfig->_overallHi = bands.overall;
+
+				auto FFTsize = audioConfig->_fftData.size();
+
+				if (audioConfig->_spectralPhonemes && FFTsize > 0)
+					audioConfig->_spectralPhoneme = audioConfig->_phonemeClassifier.Process(audioConfig->_powerSpectrum.data(), FFTsize, audioConfig->_currentSampleRate);
+			}
 
-				if (it > FFTsize / audioConfig->_bassSplit && it < FFTsize / audioConfig->_midSplit && magnitude > audioConfig->_midHi)
-					audioConfig->_midHi = magnitude;
+			float analysisMs = analysisTimer.getElapsedTime().asMicroseconds() * 0.001f;
+			float& smoothedMs = gated ? audioConfig->_analysisMsGated : audioConfig->_analysisMsVoice;
+			smoothedMs += (analysisMs - smoothedMs) * 0.05f;
 
-				if (it > FFTsize / audioConfig->_midSplit && it < FFTsize / audioConfig->_trebleSplit && magnitude > audioConfig->_trebleHi)
-					audioConfig->_trebleHi = magnitude;
+			// from the newest block's ADC time to this analysis
+			_analysedAt = LatencyTracker::Now();
+			if (audioConfig->_latencyTest == false)
+				appConfig->_latency.Begin(LatencyTracker::SourceAudio, audioConfig->_lastAdcTime, _analysedAt);
 
-				if (magnitude > audioConfig->_overallHi && it < FFTsize / audioConfig->_trebleSplit)
-					audioConfig->_overallHi = magnitude;
-			}
+			// the menu re-arms calibration every frame while a calibrate button is held
+			audioConfig->_phonemeClassifier.StopCalibration();
 		}
 		else if (audioConfig->_muted == false && audioConfig->_recordTimer.getElapsedTime().asSeconds() > audioConfig->_muteWaitSeconds)
 		{
@@ -2913,29 +3500,18 @@ public:
 			audioConfig->_overallHi = 0;
 
 			audioConfig->_muted = true;
+			audioConfig->_channels.Silence();
 
 			logToFile(appConfig, "No audio input data. Device muted?");
 		}
 
+		// if muted, the supervisor reopens the stream in case it got disconnected, backing off while it stays silent
 		if (audioConfig->_devIdx != -1 && audioConfig->_muted && audioConfig->_recordTimer.getElapsedTime().asSeconds() > 1)
-		{
-			PaError err = paNoError;
-			// if muted, attempt to restart the stream each second in case it got disconnected
-			logToFile(appConfig, "Attempting reconnection of audio device...");
-			
-			audioConfig->_recordTimer.restart();
-			StopAudioStream();
-
-			Pa_Terminate();
-			err = Pa_Initialize();
-			if (err != paNoError)
-			{
-				logToFile(appConfig, Pa_GetErrorText(err));
-				exit(1);
-			}
+			_audioSupervisor.ReportSilence();
+		else
+			_audioSupervisor.ReportAudio();
 
-			StartAudioStream(err);
-		}
+		HandleAudioStreamChanges();
 
 
 		if (appConfig->_fps != 0)
@@ -3067,7 +3643,104 @@ public:
 
 		}
 
-		
+		// classify once per analysed audio buffer, timestamped by the amount of audio captured so far
+		if (newAudio)
+			SelectPhoneme(audioConfig->_capturedFrames / (double)audioConfig->_currentSampleRate);
+
+		if (audioConfig->_separateChannels)
+			audioConfig->_channels.Analyse(ChannelSettings());
+	}
+
+	ChannelAnalyser::BandSplits AudioBandSplits() const
+	{
+		ChannelAnalyser::BandSplits splits;
+		splits.sub = audioConfig->_subSplit;
+		splits.bass = audioConfig->_bassSplit;
+		splits.mid = audioConfig->_midSplit;
+		splits.treble = audioConfig->_trebleSplit;
+		return splits;
+	}
+
+	// The latency test swaps an impulse in for the input every second or so. Its latency is taken at
+	// the first frame displayed with a layer talking, from the ADC time of the block it replaced.
+	void UpdateLatencyTest()
+	{
+		if (audioConfig->_latencyTest == false)
+		{
+			_impulseWaiting = false;
+			return;
+		}
+
+		if (_impulseWaiting)
+		{
+			double impulseTime = audioConfig->_impulseTime;
+			if (impulseTime >= 0 && layerMan->IsTalking())
+			{
+				appConfig->_latency.Begin(LatencyTracker::SourceLoopback, impulseTime, _analysedAt);
+				_impulseWaiting = false;
+				_latencyTestTimer.restart();
+			}
+			else if (_latencyTestTimer.getElapsedTime().asSeconds() > 2)
+			{
+				// no layer talked, or no audio is arriving
+				_impulseMisses++;
+				_impulseWaiting = false;
+				_latencyTestTimer.restart();
+			}
+		}
+		else if (_latencyTestTimer.getElapsedTime().asSeconds() > 1 && layerMan->IsTalking() == false)
+		{
+			audioConfig->_impulseTime = -1;
+			audioConfig->_impulseBlocks = 3;
+			_impulseWaiting = true;
+			_latencyTestTimer.restart();
+		}
+	}
+
+	// The levels of one input channel, if it's being captured. Otherwise the mix's are left as they are.
+	void ChannelLevels(int channel, float& level, float& max, PhonemeMask& phoneme) const
+	{
+		if (channel < 0 || !audioConfig->_separateChannels || channel >= audioConfig->_channels.Channels())
+			return;
+
+		auto levels = audioConfig->_channels.GetLevels(channel);
+		level = levels.talk;
+		max = levels.max;
+		phoneme = (PhonemeMask)levels.phoneme;
+	}
+
+	// The gate of a channel, or the mix's when the channel isn't being listened to
+	bool ChannelVoiceActive(int channel) const
+	{
+		if (channel < 0 || !audioConfig->_separateChannels || channel >= audioConfig->_channels.Channels())
+			return audioConfig->_gate.IsOpen();
+
+		return audioConfig->_channels.VoiceActive(channel);
+	}
+
+	// Each channel is analysed with the mix's settings
+	ChannelAnalyser::Settings ChannelSettings() const
+	{
+		ChannelAnalyser::Settings settings;
+		settings.splits = AudioBandSplits();
+		settings.softFallAmount = audioConfig->_softFallAmount;
+		settings.fixedMax = audioConfig->_fixedMax;
+		settings.softMaximum = audioConfig->_softMaximum;
+		settings.filtering = audioConfig->_doFiltering;
+		settings.compression = audioConfig->_compression;
+		settings.sampleRate = audioConfig->_currentSampleRate;
+
+		if (audioConfig->_spectralPhonemes && audioConfig->_phonemeClassifier.IsCalibrated())
+			settings.classifier = &audioConfig->_phonemeClassifier;
+
+		settings.switchDelay = audioConfig->phSwitchDelay;
+		settings.voteWindow = audioConfig->phVoteWindow;
+		settings.confidenceBoost[0] = audioConfig->AConfidenceBoost;
+		settings.confidenceBoost[1] = audioConfig->EConfidenceBoost;
+		settings.confidenceBoost[2] = audioConfig->SConfidenceBoost;
+		settings.confidenceBoost[3] = audioConfig->PConfidenceBoost;
+		settings.confidenceBoost[4] = audioConfig->WConfidenceBoost;
+		return settings;
 	}
 
 	void CheckUpdates()
@@ -3222,17 +3895,13 @@ If you accept, please click the Accept button.
 		uiConfig->_lastTheme = "";
 	}
 
-	void InitializePortAudio()
+	// Runs on a startup thread, so a failure goes back to the main thread to be dealt with
+	bool InitializePortAudio(std::string& error)
 	{
-		PaError err = paNoError;
 		logToFile(appConfig, "Initializing PortAudio");
 		//initialise PortAudio
-		err = Pa_Initialize();
-		if (err != paNoError)
-		{
-			printf(Pa_GetErrorText(err));
-			exit(1);
-		}
+		if (_audioSupervisor.Initialize(error) == false)
+			return false;
 
 		int apiCount = Pa_GetHostApiCount();
 		if (apiCount <= 0)
@@ -3248,17 +3917,16 @@ If you accept, please click the Accept button.
 
 		ListAudioDevices();
 
-		audioConfig->_params.sampleFormat = PA_SAMPLE_TYPE;
-		
-
 		logToFile(appConfig, "PortAudio found " + std::to_string(audioConfig->_deviceList.size()) + " input devices");
 		
+		std::string deviceName = "";
 		if (audioConfig->_lastDeviceName != "")
 		{
 			auto dev = audioConfig->GetAudioDevice(audioConfig->_lastDeviceName);
 			if (dev != nullptr)
 			{
-				SwitchAudioDevice(*dev);
+				deviceName = dev->first;
+				audioConfig->_devIdx = dev->second;
 				logToFile(appConfig, "PortAudio: Using device read from name in config.xml: " + dev->first);
 			}
 			else
@@ -3269,45 +3937,19 @@ If you accept, please click the Accept button.
 			auto dev = audioConfig->GetAudioDevice(audioConfig->_devIdx);
 			if (dev != nullptr)
 			{
-				SwitchAudioDevice(*dev);
+				deviceName = dev->first;
+				audioConfig->_lastDeviceName = dev->first;
 				logToFile(appConfig, "PortAudio: Using device read from index in config.xml: " + dev->first);
 			}
 			else
 				audioConfig->_devIdx = -1;
 		}
 
-	}
-
-	void StartAudioStream(PaError& err)
-	{
-		auto info = Pa_GetDeviceInfo(audioConfig->_devIdx);
-
-		// check that the name of the device still matches the one we expect
-		if (audioConfig->_deviceList.size() > audioConfig->_devIdx)
-		{
-			std::string deviceName = audioConfig->_deviceList[audioConfig->_devIdx].first;
+		_audioSupervisor.SetMaxChannels(audioConfig->_separateChannels ? ChannelAnalyser::MaxChannels : 2);
 
-			if (deviceName != info->name)
-				return;
-		}
-		else
-		{
-			// idx is outside known list, return
-		}
-
-		logToFile(appConfig, "PortAudio opening stream on device " + std::to_string(audioConfig->_params.device) + ": " + info->name);
-		err = Pa_OpenStream(&audioConfig->_audioStr, &audioConfig->_params, nullptr, audioConfig->_currentSampleRate, FRAMES_PER_BUFFER, paClipOff, recordCallback, audioConfig->_streamData);
-		if (err != paNoError)
-		{
-			std::string errorMsg = Pa_GetErrorText(err);
-			logToFile(appConfig, "PortAudio: Error opening stream: " + errorMsg);
-		}
-		err = Pa_StartStream(audioConfig->_audioStr);
-		if (err != paNoError)
-		{
-			std::string errorMsg = Pa_GetErrorText(err);
-			logToFile(appConfig, "PortAudio: Error starting stream: " + errorMsg);
-		}
+		// the saved device is kept even when it's missing, so it opens if it gets plugged in
+		_audioSupervisor.Start(deviceName != "" ? deviceName : audioConfig->_lastDeviceName);
+		return true;
 	}
 
 	void InitializeEngine()
@@ -3367,10 +4009,13 @@ If you accept, please click the Accept button.
 		audioConfig = new AudioConfig();
 		g_audioConfig = audioConfig;
 
-		logToFile(appConfig, "Creating LayerManager");
-		layerMan = new LayerManager();
-		logToFile(appConfig, "Initialising LayerManager");
-		layerMan->Init(appConfig, uiConfig);
+		{
+			auto phase = _startup.Time("Layer manager and icons");
+			logToFile(appConfig, "Creating LayerManager");
+			layerMan = new LayerManager();
+			logToFile(appConfig, "Initialising LayerManager");
+			layerMan->Init(appConfig, uiConfig);
+		}
 
 		//kbdTrack = new KeyboardTracker();
 		//kbdTrack->_layerMan = layerMan;
@@ -3380,6 +4025,7 @@ If you accept, please click the Accept button.
 		logToFile(appConfig, "Creating XML loader");
 		appConfig->_loader = new xmlConfigLoader(appConfig, uiConfig, audioConfig, appConfig->_appLocation + "config.xml");
 
+		auto settingsPhase = _startup.Time("Load settings");
 		bool retry = true;
 		while (retry)
 		{
@@ -3456,6 +4102,8 @@ If you accept, please click the Accept button.
 						spout->ReleaseSender();
 						delete spout;
 					}
+#else
+					delete shmSink;
 #endif
 					//delete kbdTrack;
 					return;
@@ -3463,7 +4111,10 @@ If you accept, please click the Accept button.
 			}
 		}
 
-		InitializePortAudio();
+		settingsPhase.End();
+
+		// the audio host lists every device on every host API, which takes a while and needs none of the rest
+		_startup.Launch("Audio devices", [this]() { _audioStarted = InitializePortAudio(_audioStartError); });
 
 		if (appConfig->_unloadTimeoutEnabled)
 			appConfig->_unloadTimeout = appConfig->_unloadTimeoutSetting;
@@ -3471,6 +4122,7 @@ If you accept, please click the Accept button.
 			appConfig->_unloadTimeout = 0;
 
 		{ // scope to destruct verFile when finished
+			auto phase = _startup.Time("Check version");
 			logToFile(appConfig, "Checking Version");
 			std::ifstream verFile;
 			verFile.open(appConfig->_appLocation + "buildnumber.txt");
@@ -3497,9 +4149,13 @@ If you accept, please click the Accept button.
 			}
 		}
 
+		auto windowPhase = _startup.Time("Create windows");
 		logToFile(appConfig, "Initialising app windows");
 		initWindow(true);
+		windowPhase.End();
 
+		// layers load on their own thread, the first avatar frame shows once they're done
+		auto layersPhase = _startup.Time("Start loading layers");
 		if (appConfig->_lastLayerSet.empty())
 		{
 			layerMan->LoadLayers(appConfig->lastLayerSettingsFile);
@@ -3510,6 +4166,9 @@ If you accept, please click the Accept button.
 		if (appConfig->_lastLayerSet.empty() == false)
 			layerMan->LoadLayers(appConfig->_lastLayerSet);
 
+		SyncCoHosts();
+		layersPhase.End();
+
 		//kbdTrack->SetHook(appConfig->_useKeyboardHooks);
 
 		uiConfig->_menuShowing = uiConfig->_showMenuOnStart;
@@ -3517,12 +4176,10 @@ If you accept, please click the Accept button.
 		if (appConfig->_startMaximised)
 			appConfig->_isFullScreen = true;
 
+		auto uiPhase = _startup.Time("UI and fonts");
 		uiConfig->_ico.loadFromFile(appConfig->_appLocation + "res/icon.png");
 		uiConfig->_settingsFileBoxName.resize(30);
 
-		uiConfig->_moveIcon.loadFromFile(appConfig->_appLocation + "res/move.png");
-		uiConfig->_moveIcon.setSmooth(true);
-		uiConfig->_moveIconSprite.setTexture(uiConfig->_moveIcon, true);
 
 		ImGui::SFML::Init(appConfig->_window);
 		ImGui::SFML::Init(appConfig->_menuWindow);
@@ -3537,6 +4194,16 @@ If you accept, please click the Accept button.
 		ImGui::SFML::SetCurrentWindow(appConfig->_window);
 		logToFile(appConfig, "Loading font in main window.");
 		LoadCustomFont();
+		uiPhase.End();
+
+		// the capture callback writes to the frames from here on
+		_startup.Join("Audio devices");
+		if (!_audioStarted)
+		{
+			logToFile(appConfig, "PortAudio failed to initialize: " + _audioStartError);
+			std::cerr << "PortAudio failed to initialize: " << _audioStartError << std::endl;
+			exit(1);
+		}
 
 		//setup debug bars
 		audioConfig->_frames.resize(FRAMES_PER_BUFFER * 3);
@@ -3596,6 +4263,7 @@ If you accept, please click the Accept button.
 
 		appConfig->_webSocket = new WebSocket();
 		appConfig->_webSocket->_logFunction = [&](const std::string& msg) { logToFile(appConfig, msg); };
+		appConfig->_webSocket->_latencyStatsFnc = [&]() { return appConfig->_latency.StatsJson(); };
 		if (appConfig->_listenHTTP)
 			appConfig->_webSocket->Start(appConfig->_httpPort);
 
@@ -3637,11 +4305,29 @@ If you accept, please click the Accept button.
 
 			render();
 
+			if (_startup.MarkFirstFrame(layerMan->IsLoading() == false))
+			{
+				for (auto& line : _startup.Report())
+					logToFile(appConfig, line);
+			}
+
 			if (appConfig->_pendingNameChange)
 			{
 				appConfig->_window.setTitle(appConfig->windowName);
 				appConfig->_pendingNameChange = false;
 			}
+
+			// the frame rate only drops once nothing has moved for a while
+			bool animating = layerMan->IsAnimating();
+			for (auto& coHost : _coHosts)
+				animating |= coHost->GetLayerManager()->IsAnimating();
+
+			if (animating || _recorder.IsRecording())
+				_pacer.MarkActive();
+
+			bool pacing = appConfig->_precisePacing && !appConfig->_enableVSync;
+			_pacer.SetRates(pacing ? appConfig->_fpsLimit : 0, pacing ? appConfig->_idleFpsLimit : 0);
+			_pacer.Wait();
 		}
 
 		if (gamepadUpdateThread.joinable())
@@ -3655,11 +4341,7 @@ If you accept, please click the Accept button.
 		//kbdTrack->SetHook(false);
 
 		if (audioConfig)
-		{
-			Pa_StopStream(audioConfig->_audioStr);
-			Pa_CloseStream(audioConfig->_audioStr);
-			Pa_Terminate();
-		}
+			_audioSupervisor.Stop();
 		
 
 		if (appConfig->_checkUpdateThread != nullptr)
@@ -3671,6 +4353,8 @@ If you accept, please click the Accept button.
 			appConfig->_checkUpdateThread = nullptr;
 		}
 
+		_coHosts.clear();
+
 		if (layerMan)
 		{
 			appConfig->_lastLayerSet = layerMan->LastUsedLayerSet();
@@ -3683,6 +4367,8 @@ If you accept, please click the Accept button.
 		}
 		
 
+		StopRecording();
+
 		ImGui::SFML::Shutdown();
 
 		if (appConfig->_window.isOpen())
@@ -3705,6 +4391,8 @@ If you accept, please click the Accept button.
 			spout->ReleaseSender();
 			delete spout;
 		}
+#else
+		delete shmSink;
 #endif
 		//delete kbdTrack;
 	}
@@ -0,0 +1,106 @@
+#include "MenuRefresh.h"
+
+#include "imgui.h"
+
+#include <cstring>
+
+static uint64_t HashMix(uint64_t h, const void* data, size_t size)
+{
+	// each 8 byte step is reversible, so any one changed word changes the result
+	const uint64_t m = 0x87c37b91114253d5ull;
+	const uint8_t* bytes = (const uint8_t*)data;
+
+	size_t words = size / 8;
+	for (size_t w = 0; w < words; w++)
+	{
+		uint64_t v;
+		memcpy(&v, bytes + w * 8, 8);
+		h = (h ^ v) * m;
+		h ^= h >> 29;
+	}
+
+	uint64_t tail = 0;
+	memcpy(&tail, bytes + words * 8, size % 8);
+	h = (h ^ tail ^ ((uint64_t)size << 56)) * m;
+	h ^= h >> 29;
+
+	return h;
+}
+
+bool MenuRefresh::NeedsUpdate(double time)
+{
+	if (_woken)
+	{
+		_woken = false;
+		_lastWake = time;
+	}
+
+	bool needed = _busy
+		|| _lastPass < 0
+		|| (_lastWake >= 0 && time - _lastWake < AwakeTime)
+		|| time - _lastPass >= IdleInterval;
+
+	if (!needed)
+		_passesSkipped++;
+
+	return needed;
+}
+
+void MenuRefresh::PassFinished(double time, float passMs, bool busy)
+{
+	_lastPass = time;
+	_busy = busy;
+
+	if (_passesRun == 0)
+		_averagePassMs = passMs;
+	else
+		_averagePassMs += (passMs - _averagePassMs) * 0.05;
+
+	_passesRun++;
+}
+
+bool MenuRefresh::NeedsRender(const ImDrawData* drawData, bool canReuse)
+{
+	uint64_t hash = HashDrawData(drawData);
+	if (canReuse && hash != 0 && hash == _lastHash)
+	{
+		_rendersSkipped++;
+		return false;
+	}
+
+	_lastHash = hash;
+	return true;
+}
+
+uint64_t MenuRefresh::HashDrawData(const ImDrawData* drawData)
+{
+	if (drawData == nullptr || drawData->Valid == false)
+		return 0;
+
+	uint64_t h = 0x9e3779b97f4a7c15ull;
+	h = HashMix(h, &drawData->DisplayPos, sizeof(ImVec2));
+	h = HashMix(h, &drawData->DisplaySize, sizeof(ImVec2));
+	h = HashMix(h, &drawData->FramebufferScale, sizeof(ImVec2));
+
+	for (const ImDrawList* list : drawData->CmdLists)
+	{
+		h = HashMix(h, list->VtxBuffer.Data, list->VtxBuffer.size_in_bytes());
+		h = HashMix(h, list->IdxBuffer.Data, list->IdxBuffer.size_in_bytes());
+
+		for (const ImDrawCmd& cmd : list->CmdBuffer)
+		{
+			ImTextureID texId = cmd.GetTexID();
+			h = HashMix(h, &texId, sizeof(texId));
+			h = HashMix(h, &cmd.ClipRect, sizeof(ImVec4));
+
+			unsigned int counts[3] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+			h = HashMix(h, counts, sizeof(counts));
+
+			if (cmd.UserCallback != nullptr)
+				h = HashMix(h, &cmd.UserCallback, sizeof(cmd.UserCallback));
+		}
+	}
+
+	// 0 is kept for "nothing rendered yet"
+	return h == 0 ? 1 : h;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+struct ImDrawData;
+
+// Decides when the menu's ImGui pass needs to run again. Input wakes it, and it keeps running for
+// a moment afterwards while the UI settles, or for as long as something is being dragged or typed.
+// Otherwise it only refreshes often enough for the live meters and tooltips, and the last frame of
+// the menu stays on screen. Draw lists are hashed as well, so a pass that drew exactly what's
+// already showing doesn't have to be rendered again.
+class MenuRefresh
+{
+public:
+
+	static constexpr double AwakeTime = 0.25;		// seconds of full rate updates after any input
+	static constexpr double IdleInterval = 1.0 / 20;	// seconds between updates with no input
+
+	// Input or anything else that changes what the menu shows
+	inline void Wake() { _woken = true; }
+
+	// Forgets the last frame, so the next pass is always run and rendered
+	inline void Invalidate() { _woken = true; _lastHash = 0; }
+
+	// Whether the pass should run this frame. A skipped pass is counted.
+	bool NeedsUpdate(double time);
+
+	// After a pass, busy if an item is active or text is being typed
+	void PassFinished(double time, float passMs, bool busy);
+
+	// Whether drawData has to be rendered. Always true unless canReuse, where the last frame rendered
+	// is still showing and only an unchanged frame can skip it.
+	bool NeedsRender(const ImDrawData* drawData, bool canReuse);
+
+	static uint64_t HashDrawData(const ImDrawData* drawData);
+
+	inline unsigned long long PassesRun() const { return _passesRun; }
+	inline unsigned long long PassesSkipped() const { return _passesSkipped; }
+	inline unsigned long long RendersSkipped() const { return _rendersSkipped; }
+
+	// Estimated from the average time of the passes that did run
+	inline double SecondsSaved() const { return _passesSkipped * _averagePassMs * 0.001; }
+
+private:
+
+	bool _woken = true;
+	bool _busy = false;
+	double _lastWake = -1;
+	double _lastPass = -1;
+
+	uint64_t _lastHash = 0;
+
+	unsigned long long _passesRun = 0;
+	unsigned long long _passesSkipped = 0;
+	unsigned long long _rendersSkipped = 0;
+	double _averagePassMs = 0;
+};
@@ -0,0 +1,63 @@
+#include "NoiseGate.h"
+
+#include <algorithm>
+#include <cmath>
+
+bool NoiseGate::Process(float rms, float seconds)
+{
+	if (_resetPending.exchange(false))
+		ClearFloor();
+
+	rms = std::max(rms, MinFloor);
+	_level = rms;
+
+	if (_slotSeconds >= FloorWindowSeconds / FloorSlots)
+	{
+		_slot = (_slot + 1) % FloorSlots;
+		_slotMin[_slot] = rms;
+		_slotSeconds = 0.f;
+	}
+	else if (_slotMin[_slot] < 0 || rms < _slotMin[_slot])
+		_slotMin[_slot] = rms;
+	_slotSeconds += seconds;
+
+	float floor = rms;
+	for (float slotMin : _slotMin)
+	{
+		if (slotMin >= 0)
+			floor = std::min(floor, slotMin);
+	}
+	_floor = floor;
+
+	float openLevel = OpenLevel();
+	float closeLevel = openLevel * std::pow(10.f, -CloseHysteresisDb / 20.f);
+
+	if (rms > openLevel || (_open && rms > closeLevel))
+	{
+		_open = true;
+		_sinceVoice = 0.f;
+	}
+	else if (_open)
+	{
+		_sinceVoice += seconds;
+		if (_sinceVoice > _hangover)
+			_open = false;
+	}
+
+	return _open;
+}
+
+float NoiseGate::OpenLevel() const
+{
+	return std::max(MinOpenLevel, _floor * std::pow(10.f, _marginDb / 20.f));
+}
+
+void NoiseGate::ClearFloor()
+{
+	_slotMin.fill(-1.f);
+	_slot = 0;
+	_slotSeconds = 0.f;
+	_sinceVoice = 0.f;
+	_floor = MinFloor;
+	_open = false;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+// Time-domain voice activity detection, run on the audio callback for every block.
+// The block's RMS level is compared with a noise floor that follows the room: the floor is the
+// quietest block of the last few seconds, so the pauses in speech keep it down while a fan or
+// traffic coming on is learned once it has been going for that long. The gate opens a margin
+// above the floor and closes a few dB lower, after a hangover so the gaps between words don't close it.
+// While the gate is closed there's no voice to measure, so the FFT is skipped.
+class NoiseGate
+{
+public:
+
+	static constexpr float MinFloor = 0.00001f;		// -100dBFS, so digital silence has a floor to be above
+	static constexpr float MinOpenLevel = 0.001f;	// -60dBFS, nothing quieter opens the gate whatever the floor
+	static constexpr float CloseHysteresisDb = 3.f;
+	static constexpr float FloorWindowSeconds = 3.f;
+	static constexpr int FloorSlots = 8;			// the window's minimum is kept in slots, the oldest dropped as it goes
+
+	NoiseGate() { ClearFloor(); }
+
+	// Audio callback. Feeds one block's RMS level, returns whether the gate is open.
+	bool Process(float rms, float seconds);
+
+	// Forgets the floor, for a new stream
+	inline void Reset() { _resetPending = true; }
+
+	// Settings, from the render thread
+	inline void SetMarginDb(float marginDb) { _marginDb = marginDb; }
+	inline void SetHangover(float seconds) { _hangover = seconds; }
+
+	inline bool IsOpen() const { return _open; }
+	inline float Floor() const { return _floor; }
+	inline float Level() const { return _level; }
+
+	// The level the gate opens at
+	float OpenLevel() const;
+
+private:
+
+	void ClearFloor();
+
+	std::atomic<float> _marginDb = 9.f;
+	std::atomic<float> _hangover = 0.3f;
+	std::atomic<bool> _resetPending = false;
+
+	// written by the audio callback only
+	std::atomic<bool> _open = false;
+	std::atomic<float> _floor = MinFloor;
+	std::atomic<float> _level = 0.f;
+
+	std::array<float, FloorSlots> _slotMin;		// negative until a block lands in the slot
+	int _slot = 0;
+	float _slotSeconds = 0.f;
+	float _sinceVoice = 0.f;
+};
@@ -0,0 +1,206 @@
+#include "PhonemeClassifier.h"
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+static float HzToMel(float hz) { return 2595.f * std::log10(1.f + hz / 700.f); }
+static float MelToHz(float mel) { return 700.f * (std::pow(10.f, mel / 2595.f) - 1.f); }
+
+// The capture callback squares each sample before the FFT, which moves the spectral envelope
+// up by roughly 2x. All frequency ranges below are given for the original voice and scaled here.
+static const float c_spectrumStretch = 2.f;
+
+static const float c_melMinHz = 80.f;
+static const float c_melMaxHz = 8000.f;
+
+int PhonemeClassifier::ClassIndex(int phoneme)
+{
+	int idx = 0;
+	while (phoneme != 0 && idx < NumClasses - 1)
+	{
+		phoneme >>= 1;
+		idx++;
+	}
+	return idx;
+}
+
+void PhonemeClassifier::Init(int spectrumSize, float sampleRate)
+{
+	_spectrumSize = spectrumSize;
+	_sampleRate = sampleRate;
+	_binHz = sampleRate / spectrumSize;
+
+	int usableBins = spectrumSize / 2;
+	_logSpectrum.assign(usableBins, 0.f);
+
+	// triangular filters evenly spaced on the mel scale, stored as a start bin and a dense run of weights
+	float melMin = HzToMel(c_melMinHz);
+	float melMax = HzToMel(c_melMaxHz);
+
+	float edges[NumMelBands + 2];
+	for (int e = 0; e < NumMelBands + 2; e++)
+	{
+		float hz = MelToHz(melMin + (melMax - melMin) * e / (NumMelBands + 1));
+		edges[e] = hz * c_spectrumStretch / _binHz;
+	}
+
+	_melFilters.clear();
+	_melFilters.resize(NumMelBands);
+	for (int m = 0; m < NumMelBands; m++)
+	{
+		float lo = edges[m];
+		float mid = edges[m + 1];
+		float hi = edges[m + 2];
+
+		int startBin = std::max(1, (int)std::ceil(lo));
+		int endBin = std::min(usableBins - 1, (int)std::floor(hi));
+
+		auto& filter = _melFilters[m];
+		filter.startBin = startBin;
+		for (int b = startBin; b <= endBin; b++)
+		{
+			float w = b < mid ? (b - lo) / std::max(mid - lo, 1e-3f) : (hi - b) / std::max(hi - mid, 1e-3f);
+			filter.weights.push_back(std::max(0.f, w));
+		}
+
+		// very narrow low filters can miss every bin, give them the nearest one
+		if (filter.weights.empty())
+		{
+			filter.startBin = std::min(usableBins - 1, std::max(1, (int)std::round(mid)));
+			filter.weights.push_back(1.f);
+		}
+	}
+
+	// DCT-II table, row-major by coefficient
+	const float pi = 3.14159265358979f;
+	for (int c = 0; c < NumCoeffs; c++)
+		for (int m = 0; m < NumMelBands; m++)
+			_dct[c * NumMelBands + m] = std::cos(pi * c * (m + 0.5f) / NumMelBands);
+}
+
+void PhonemeClassifier::ComputeFeatures(const float* powerSpectrum)
+{
+	const float floor = 1e-10f;
+
+	// mel energies: each filter is a contiguous dot product so the compiler can vectorise it
+	for (int m = 0; m < NumMelBands; m++)
+	{
+		const auto& filter = _melFilters[m];
+		const float* p = powerSpectrum + filter.startBin;
+		const float* w = filter.weights.data();
+		int n = (int)filter.weights.size();
+
+		float sum = 0;
+		for (int i = 0; i < n; i++)
+			sum += p[i] * w[i];
+
+		_melEnergies[m] = std::log(sum + floor);
+	}
+
+	// MFCCs
+	for (int c = 0; c < NumCoeffs; c++)
+	{
+		const float* row = &_dct[c * NumMelBands];
+		float sum = 0;
+		for (int m = 0; m < NumMelBands; m++)
+			sum += row[m] * _melEnergies[m];
+		_features[c] = sum;
+	}
+	_features[0] *= _energyWeight;
+
+	// rough formants: strongest peak in the usual F1 and F2 ranges
+	int usableBins = (int)_logSpectrum.size();
+	for (int b = 0; b < usableBins; b++)
+		_logSpectrum[b] = std::log(powerSpectrum[b] + floor);
+
+	_f1 = FindPeakHz(_logSpectrum.data(), 250.f, 900.f);
+	_f2 = FindPeakHz(_logSpectrum.data(), 900.f, 2800.f);
+
+	_features[NumCoeffs] = _f1 * 0.001f * _formantWeight;
+	_features[NumCoeffs + 1] = _f2 * 0.001f * _formantWeight;
+}
+
+float PhonemeClassifier::FindPeakHz(const float* logSpectrum, float minHz, float maxHz) const
+{
+	int usableBins = (int)_logSpectrum.size();
+	int lo = std::max(1, (int)(minHz * c_spectrumStretch / _binHz));
+	int hi = std::min(usableBins - 2, (int)(maxHz * c_spectrumStretch / _binHz));
+
+	int best = lo;
+	float bestVal = -std::numeric_limits<float>::max();
+	for (int b = lo; b <= hi; b++)
+	{
+		// light 3-tap smoothing so single-bin harmonics don't win over the envelope
+		float v = logSpectrum[b - 1] + 2.f * logSpectrum[b] + logSpectrum[b + 1];
+		if (v > bestVal)
+		{
+			bestVal = v;
+			best = b;
+		}
+	}
+
+	return best * _binHz / c_spectrumStretch;
+}
+
+int PhonemeClassifier::Process(const float* powerSpectrum, int spectrumSize, float sampleRate)
+{
+	if (spectrumSize < 4)
+		return 0;
+
+	if (spectrumSize != _spectrumSize || sampleRate != _sampleRate)
+		Init(spectrumSize, sampleRate);
+
+	ComputeFeatures(powerSpectrum);
+
+	if (_calibrating != -1)
+	{
+		// running mean of everything heard while this phoneme is being held
+		auto& centroid = _centroids[ClassIndex(_calibrating)];
+		centroid.count++;
+		float inv = 1.f / centroid.count;
+		for (int f = 0; f < NumFeatures; f++)
+			centroid.mean[f] += (_features[f] - centroid.mean[f]) * inv;
+
+		return _calibrating;
+	}
+
+	int bestClass = 0;
+	float bestDist = std::numeric_limits<float>::max();
+	for (int c = 0; c < NumClasses; c++)
+	{
+		const auto& centroid = _centroids[c];
+		if (centroid.count == 0)
+			continue;
+
+		float dist = 0;
+		for (int f = 0; f < NumFeatures; f++)
+		{
+			float d = _features[f] - centroid.mean[f];
+			dist += d * d;
+		}
+
+		if (dist < bestDist)
+		{
+			bestDist = dist;
+			bestClass = c;
+		}
+	}
+
+	return ClassPhoneme(bestClass);
+}
+
+void PhonemeClassifier::ClearCalibration(int phoneme)
+{
+	_centroids[ClassIndex(phoneme)] = Centroid();
+}
+
+bool PhonemeClassifier::IsCalibrated() const
+{
+	// silence plus at least one sound is enough to make a decision
+	int calibrated = 0;
+	for (int c = 1; c < NumClasses; c++)
+		calibrated += _centroids[c].count > 0 ? 1 : 0;
+
+	return _centroids[0].count > 0 && calibrated > 0;
+}
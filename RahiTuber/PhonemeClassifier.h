@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <array>
+
+// Spectral phoneme detection.
+// Turns one block's power spectrum into a small feature vector (MFCCs plus rough F1/F2 formants)
+// and picks the nearest calibrated phoneme centroid. Centroids are recorded by the user
+// holding each sound while calibration is active.
+class PhonemeClassifier
+{
+public:
+
+	static const int NumMelBands = 26;
+	static const int NumCoeffs = 13;
+	static const int NumFeatures = NumCoeffs + 2;
+	static const int NumClasses = 6; // none, A, E, S, P, W
+
+	struct Centroid
+	{
+		std::array<float, NumFeatures> mean = {};
+		int count = 0;
+	};
+
+	// Rebuilds the mel filterbank and DCT tables. Called automatically when the spectrum size or rate changes.
+	void Init(int spectrumSize, float sampleRate);
+
+	// powerSpectrum holds spectrumSize bins from the FFT (only the lower half is used).
+	// Returns the detected PhonemeMask, or the calibration target while calibrating.
+	int Process(const float* powerSpectrum, int spectrumSize, float sampleRate);
+
+	void StartCalibration(int phoneme) { _calibrating = phoneme; }
+	void StopCalibration() { _calibrating = -1; }
+	bool IsCalibrating() const { return _calibrating != -1; }
+
+	void ClearCalibration(int phoneme);
+	bool IsCalibrated() const;
+
+	Centroid& GetCentroid(int phoneme) { return _centroids[ClassIndex(phoneme)]; }
+	static int ClassPhoneme(int classIdx) { return classIdx == 0 ? 0 : 1 << (classIdx - 1); }
+	static int ClassIndex(int phoneme);
+
+	inline const std::array<float, NumFeatures>& Features() const { return _features; }
+	inline float FormantF1() const { return _f1; }
+	inline float FormantF2() const { return _f2; }
+
+	// weights applied to the formant features (in kHz) relative to the MFCCs
+	float _formantWeight = 4.f;
+	// c0 tracks loudness, so it is weighted down to stop volume dominating the distance
+	float _energyWeight = 0.25f;
+
+private:
+
+	void ComputeFeatures(const float* powerSpectrum);
+	float FindPeakHz(const float* logSpectrum, float minHz, float maxHz) const;
+
+	struct MelFilter
+	{
+		int startBin = 0;
+		std::vector<float> weights;
+	};
+
+	int _spectrumSize = 0;
+	float _sampleRate = 0;
+	float _binHz = 0;
+
+	std::vector<MelFilter> _melFilters;
+	std::array<float, NumCoeffs * NumMelBands> _dct = {};
+
+	std::vector<float> _logSpectrum;
+	std::array<float, NumMelBands> _melEnergies = {};
+	std::array<float, NumFeatures> _features = {};
+	float _f1 = 0;
+	float _f2 = 0;
+
+	std::array<Centroid, NumClasses> _centroids;
+	int _calibrating = -1;
+};
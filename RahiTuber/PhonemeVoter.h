@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+
+// Fixed-size history of timestamped phoneme votes.
+// Keeps a running count per phoneme so adding and expiring votes is O(1),
+// and the voting window is measured in seconds rather than in frames.
+class PhonemeVoter
+{
+public:
+	static const int Capacity = 128;
+
+	void Push(double time, int phoneme)
+	{
+		if (_size == Capacity)
+			PopOldest();
+
+		Vote& v = _votes[(_start + _size) % Capacity];
+		v.time = time;
+		v.phoneme = phoneme;
+		_size++;
+
+		_counts[ClassIndex(phoneme)]++;
+	}
+
+	// Drop all votes older than the given time
+	void Expire(double before)
+	{
+		while (_size > 0 && _votes[_start].time < before)
+			PopOldest();
+	}
+
+	int Count(int phoneme) const { return _counts[ClassIndex(phoneme)]; }
+
+	int Size() const { return _size; }
+
+	void Clear()
+	{
+		_start = 0;
+		_size = 0;
+		_counts.fill(0);
+	}
+
+private:
+
+	struct Vote
+	{
+		double time = 0;
+		int phoneme = 0;
+	};
+
+	// PhonemeMask values are single bits, map them to 0 (none) .. NumClasses-1
+	static int ClassIndex(int phoneme)
+	{
+		int idx = 0;
+		while (phoneme != 0 && idx < NumClasses - 1)
+		{
+			phoneme >>= 1;
+			idx++;
+		}
+		return idx;
+	}
+
+	void PopOldest()
+	{
+		_counts[ClassIndex(_votes[_start].phoneme)]--;
+		_start = (_start + 1) % Capacity;
+		_size--;
+	}
+
+	static const int NumClasses = 6;
+
+	std::array<Vote, Capacity> _votes;
+	std::array<int, NumClasses> _counts = {};
+	int _start = 0;
+	int _size = 0;
+};
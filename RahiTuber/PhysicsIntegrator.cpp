@@ -0,0 +1,93 @@
+#include "PhysicsIntegrator.h"
+
+#include <algorithm>
+#include <cmath>
+
+PhysicsIntegrator::Body* PhysicsIntegrator::Acquire(const void* owner, int& slot)
+{
+	if (slot >= 0 && slot < (int)_bodies.size() && _bodies[slot].owner == owner)
+	{
+		_bodies[slot].touched = true;
+		return &_bodies[slot];
+	}
+
+	if (!_freeSlots.empty())
+	{
+		slot = _freeSlots.back();
+		_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = (int)_bodies.size();
+		_bodies.emplace_back();
+	}
+
+	Body& body = _bodies[slot];
+	body = Body();
+	body.owner = owner;
+	body.touched = true;
+	return &body;
+}
+
+void PhysicsIntegrator::Reset(Body& body, const sf::Vector2<double>& pos)
+{
+	body.pos = pos;
+	body.prevPos = pos;
+	body.target = pos;
+	body.accel = { 0, 0 };
+	body.accumulator = 0;
+	body.initialised = true;
+}
+
+sf::Vector2<double> PhysicsIntegrator::Advance(Body& body, const sf::Vector2<double>& target, double dt, double drag, double spring)
+{
+	int substeps = std::max(1, _substeps);
+	double step = 1.0 / (ReferenceRate * substeps);
+
+	// spread the response of one reference step across the substeps
+	double follow = 1.0 - std::pow(std::clamp(spring, 0.0, 1.0), 1.0 / substeps);
+	double move = (1.0 - drag) / substeps;
+
+	dt = std::clamp(dt, 0.0, MaxFrameTime);
+
+	sf::Vector2<double> frameStartTarget = body.target;
+	body.target = target;
+
+	// time into this frame at which the next step lands, used to slide the target along with it
+	double stepTime = step - body.accumulator;
+	body.accumulator += dt;
+
+	while (body.accumulator >= step)
+	{
+		double t = dt > 0 ? std::min(stepTime / dt, 1.0) : 1.0;
+		sf::Vector2<double> stepTarget = frameStartTarget + (target - frameStartTarget) * t;
+
+		body.prevPos = body.pos;
+		body.accel += (stepTarget - body.pos - body.accel) * follow;
+		body.pos += body.accel * move;
+
+		body.accumulator -= step;
+		stepTime += step;
+	}
+
+	double alpha = body.accumulator / step;
+	return body.prevPos + (body.pos - body.prevPos) * alpha;
+}
+
+void PhysicsIntegrator::ReleaseUntouched()
+{
+	for (int b = 0; b < (int)_bodies.size(); b++)
+	{
+		Body& body = _bodies[b];
+		if (body.owner == nullptr)
+			continue;
+
+		if (!body.touched)
+		{
+			body.owner = nullptr;
+			_freeSlots.push_back(b);
+		}
+
+		body.touched = false;
+	}
+}
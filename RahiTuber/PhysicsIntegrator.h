@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+// Fixed-timestep integrator for the layer spring/drag physics.
+// Bodies live in one contiguous array and are stepped at a fixed rate regardless of the render
+// framerate; the rendered position is interpolated between the last two steps.
+class PhysicsIntegrator
+{
+public:
+
+	// the rate the drag and spring values were originally tuned at (one step per frame at 60fps)
+	static constexpr double ReferenceRate = 60.0;
+
+	// never try to catch up on more than this much time in one frame
+	static constexpr double MaxFrameTime = 0.25;
+
+	struct Body
+	{
+		sf::Vector2<double> pos;			// position after the latest step
+		sf::Vector2<double> prevPos;		// position after the step before that
+		sf::Vector2<double> accel;			// carried movement per reference step
+		sf::Vector2<double> target;			// target at the end of the latest frame
+		double accumulator = 0;
+
+		const void* owner = nullptr;
+		bool touched = false;
+		bool initialised = false;
+	};
+
+	// Returns the body belonging to owner, allocating one if slot is unset or was reused by another owner.
+	Body* Acquire(const void* owner, int& slot);
+
+	// Places a body at rest on pos
+	void Reset(Body& body, const sf::Vector2<double>& pos);
+
+	// Moves the body towards target over dt seconds, in fixed steps. Returns the interpolated position to draw.
+	sf::Vector2<double> Advance(Body& body, const sf::Vector2<double>& target, double dt, double drag, double spring);
+
+	// Frees bodies that were not advanced since the last call, eg. for hidden or deleted layers
+	void ReleaseUntouched();
+
+	inline int ActiveBodies() const { return (int)(_bodies.size() - _freeSlots.size()); }
+
+	int _substeps = 1;
+
+private:
+
+	std::vector<Body> _bodies;
+	std::vector<int> _freeSlots;
+};
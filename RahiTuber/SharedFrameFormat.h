@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <time.h>
+
+// Layout of the shared-memory frame output, shared between RahiTuber and any local consumer.
+//
+// The segment is a Header followed by SlotCount slots, each a SlotHeader followed
+// by width*height premultiplied RGBA8 pixels, top row first. Slots are written round-robin and
+// guarded by a seqlock: the writer makes seq odd, writes, then makes it even again. A reader copies
+// the slot and retries if seq was odd or changed while it was copying.
+//
+// If the size changes the writer marks the old segment closed and unlinks it, so readers should
+// reopen by name when they see closed != 0.
+namespace SharedFrame
+{
+	static const uint32_t Magic = 0x52544652; // 'RTFR'
+	static const uint32_t Version = 1;
+	static const uint32_t SlotCount = 3;
+	static const char* const DefaultName = "/rahituber";
+
+	static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared frame atomics must be lock free");
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared frame atomics must be lock free");
+
+	struct alignas(64) Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t width;
+		uint32_t height;
+		uint32_t stride;			// bytes per row
+		uint32_t slotCount;
+		uint64_t slotBytes;			// size of one slot including its SlotHeader
+
+		std::atomic<uint64_t> latestFrame;	// frame number of the newest complete slot, 0 before the first frame
+		std::atomic<uint32_t> closed;
+	};
+
+	struct alignas(64) SlotHeader
+	{
+		std::atomic<uint32_t> seq;
+		uint32_t pad;
+		uint64_t frame;				// increments by one per rendered frame, gaps mean the writer dropped frames
+		uint64_t renderTimeNs;		// CLOCK_MONOTONIC when the frame was rendered
+		uint64_t publishTimeNs;		// CLOCK_MONOTONIC when the pixels were finished in shared memory
+	};
+
+	// CLOCK_MONOTONIC in nanoseconds, comparable between processes on the same machine
+	inline uint64_t NowNs()
+	{
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	}
+
+	inline uint64_t SlotBytes(uint32_t width, uint32_t height)
+	{
+		uint64_t bytes = sizeof(SlotHeader) + (uint64_t)width * height * 4;
+		return (bytes + 63) & ~(uint64_t)63;
+	}
+
+	inline uint64_t SegmentBytes(uint32_t width, uint32_t height)
+	{
+		return sizeof(Header) + SlotBytes(width, height) * SlotCount;
+	}
+
+	inline SlotHeader* GetSlot(Header* header, uint32_t slot)
+	{
+		return (SlotHeader*)((uint8_t*)header + sizeof(Header) + header->slotBytes * slot);
+	}
+
+	inline uint8_t* SlotPixels(SlotHeader* slot)
+	{
+		return (uint8_t*)slot + sizeof(SlotHeader);
+	}
+}
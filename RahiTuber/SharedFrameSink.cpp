@@ -0,0 +1,149 @@
+#include "SharedFrameSink.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+bool SharedFrameSink::Submit(sf::RenderTexture& source)
+{
+	if (!source.setActive(true))
+	{
+		_error = "Couldn't activate the render texture for readback";
+		return false;
+	}
+
+	auto size = source.getSize();
+	if (size.x != _width || size.y != _height || _openName != _name)
+	{
+		// anything still in flight is the old size
+		_readback.Release();
+		CloseSegment();
+
+		_width = size.x;
+		_height = size.y;
+		if (!OpenSegment(size.x, size.y))
+			return false;
+	}
+
+	_readback.Collect([this](const AsyncReadback::Frame& frame) { Publish(frame); });
+
+	_frame++;
+	if (!_readback.Start(source, _frame, SharedFrame::NowNs()))
+	{
+		if (_readback.GetError() != "")
+		{
+			_error = _readback.GetError();
+			return false;
+		}
+		_dropped++;
+	}
+
+	return true;
+}
+
+void SharedFrameSink::Publish(const AsyncReadback::Frame& frame)
+{
+	if (frame.width != _width || frame.height != _height)
+		return;
+
+	SharedFrame::SlotHeader* slot = SharedFrame::GetSlot(_segment, frame.frame % SharedFrame::SlotCount);
+	uint8_t* dst = SharedFrame::SlotPixels(slot);
+
+	// seqlock: odd while writing
+	uint32_t seq = slot->seq.load(std::memory_order_relaxed);
+	slot->seq.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot->frame = frame.frame;
+	slot->renderTimeNs = frame.time;
+
+	AsyncReadback::CopyFlipped(frame.pixels, dst, _width, _height);
+
+	slot->publishTimeNs = SharedFrame::NowNs();
+
+	slot->seq.store(seq + 2, std::memory_order_release);
+	_segment->latestFrame.store(frame.frame, std::memory_order_release);
+
+	_published++;
+}
+
+bool SharedFrameSink::OpenSegment(unsigned int width, unsigned int height)
+{
+	size_t bytes = SharedFrame::SegmentBytes(width, height);
+
+	// never resize a segment someone may still have mapped, start a fresh one under the same name
+	shm_unlink(_name.c_str());
+	int fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (fd == -1)
+	{
+		_error = "Couldn't open shared memory " + _name + ": " + strerror(errno);
+		return false;
+	}
+
+	if (ftruncate(fd, bytes) != 0)
+	{
+		_error = "Couldn't size shared memory " + _name + ": " + strerror(errno);
+		close(fd);
+		shm_unlink(_name.c_str());
+		return false;
+	}
+
+	void* mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (mem == MAP_FAILED)
+	{
+		_error = "Couldn't map shared memory " + _name + ": " + strerror(errno);
+		shm_unlink(_name.c_str());
+		return false;
+	}
+
+	memset(mem, 0, sizeof(SharedFrame::Header));
+
+	_segment = (SharedFrame::Header*)mem;
+	_segmentBytes = bytes;
+	_openName = _name;
+
+	_segment->version = SharedFrame::Version;
+	_segment->width = width;
+	_segment->height = height;
+	_segment->stride = width * 4;
+	_segment->slotCount = SharedFrame::SlotCount;
+	_segment->slotBytes = SharedFrame::SlotBytes(width, height);
+	_segment->latestFrame.store(0, std::memory_order_relaxed);
+	_segment->closed.store(0, std::memory_order_relaxed);
+
+	for (uint32_t s = 0; s < SharedFrame::SlotCount; s++)
+		SharedFrame::GetSlot(_segment, s)->seq.store(0, std::memory_order_relaxed);
+
+	// readers check the magic last, so publish it after everything else is in place
+	std::atomic_thread_fence(std::memory_order_release);
+	_segment->magic = SharedFrame::Magic;
+
+	return true;
+}
+
+void SharedFrameSink::CloseSegment()
+{
+	if (_segment == nullptr)
+		return;
+
+	_segment->closed.store(1, std::memory_order_release);
+	munmap(_segment, _segmentBytes);
+	shm_unlink(_openName.c_str());
+
+	_segment = nullptr;
+	_segmentBytes = 0;
+	_openName = "";
+}
+
+void SharedFrameSink::Close()
+{
+	_readback.Release();
+	CloseSegment();
+
+	_width = 0;
+	_height = 0;
+}
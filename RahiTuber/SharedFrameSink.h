@@ -0,0 +1,52 @@
+#pragma once
+
+#include "SharedFrameFormat.h"
+
+#include "AsyncReadback.h"
+
+#include <string>
+
+// Linux frame output: reads the render texture back asynchronously and publishes completed
+// frames into a POSIX shared-memory segment (see SharedFrameFormat.h).
+class SharedFrameSink
+{
+public:
+
+	~SharedFrameSink() { Close(); }
+
+	// Call once per frame after source.display(). Starts a readback of this frame and publishes
+	// any earlier readbacks that have finished. The layers are drawn premultiplied, so the pixels are published as they are.
+	// Returns false if the output could not be set up.
+	bool Submit(sf::RenderTexture& source);
+
+	void Close();
+
+	inline const std::string& GetError() const { return _error; }
+
+	inline unsigned long long FramesPublished() const { return _published; }
+	inline unsigned long long FramesDropped() const { return _dropped; }
+
+	std::string _name = SharedFrame::DefaultName;
+
+private:
+
+	bool OpenSegment(unsigned int width, unsigned int height);
+	void CloseSegment();
+
+	void Publish(const AsyncReadback::Frame& frame);
+
+	AsyncReadback _readback;
+
+	SharedFrame::Header* _segment = nullptr;
+	size_t _segmentBytes = 0;
+	std::string _openName = "";
+
+	unsigned int _width = 0;
+	unsigned int _height = 0;
+
+	unsigned long long _frame = 0;
+	unsigned long long _published = 0;
+	unsigned long long _dropped = 0;
+
+	std::string _error = "";
+};
@@ -1,17 +1,26 @@
 #include "SpriteSheet.h"
 
-void SpriteSheet::Draw(sf::RenderTarget* target, const sf::RenderStates& states)
+#include <cmath>
+
+void SpriteSheet::Draw(const FrameTime& frame, sf::RenderTarget* target, const sf::RenderStates& states)
 {
-	sf::Time dt = _timer.getElapsedTime();
+	if (_frameStart < 0)
+		_frameStart = frame.time;
+
+	double dt = frame.time - _frameStart;
+
+	float frametime = 1.0f / _fps;
 
-	const float frametime = 1.0f / _fps;
+	// animated files carry their own delay for every frame
+	if (_stream && _stream->IsOpen() && _currentFrame < _stream->FrameCount())
+		frametime = _stream->FrameDelay(_currentFrame);
 
 	if (_playing || _synced)
 	{
-		if (!_synced && (frametime < dt.asSeconds()))
+		if (!_synced && (frametime < dt))
 		{
 			_currentFrame++;
-			_timer.restart();
+			_frameStart = frame.time;
 			for (SpriteSheet* spr : _syncChildren)
 				spr->AdvanceFrame();
 		}
@@ -37,25 +46,121 @@ void SpriteSheet::Draw(sf::RenderTarget* target, const sf::RenderStates& states)
 
 		if (_spriteLoadFinished)
 		{
-			target->draw(_sprite, states);
+			if (_stream)
+			{
+				// closed while the sprite was unloaded
+				if (!_stream->IsOpen())
+					OpenStream();
+
+				// the decoder gave up on it
+				if (_stream && _stream->Failed())
+					StopStream();
+
+				// until the frame is decoded the last one shown stays up
+				if (_stream)
+				{
+					if (sf::Texture* frameTex = _stream->GetFrame(_currentFrame))
+						_sprite.setTexture(*frameTex, false);
+				}
+			}
+
+			DrawSprite(target, states);
 		}
 
-		_loadTimer.restart();
+		_lastVisibleTime = frame.time;
 	}
-	else if (_loadTimeout > 0)
+	else
 	{
-		if (_loadTimeout < _loadTimer.getElapsedTime().asSeconds())
+		Tick(frame);
+	}
+}
+
+void SpriteSheet::DrawSprite(sf::RenderTarget* target, const sf::RenderStates& states)
+{
+	// too big for one texture, the frame comes from whichever tile holds it. Frames larger than
+	// a tile, like a huge single image, are drawn in tile-sized pieces.
+	if (_tiled != nullptr)
+	{
+		const sf::IntRect rect = _sprite.getTextureRect();
+		const int maxTile = (int)_tiled->MaxTileSize();
+
+		for (int y = 0; y < rect.height; y += maxTile)
 		{
-			UnloadTexture();
+			for (int x = 0; x < rect.width; x += maxTile)
+			{
+				sf::IntRect piece(rect.left + x, rect.top + y, std::min(maxTile, rect.width - x), std::min(maxTile, rect.height - y));
+				sf::IntRect tileRect;
+				sf::Texture* tile = _tiled->GetTile(piece, tileRect);
+				if (tile == nullptr)
+					continue;
+
+				sf::Sprite part(*tile, tileRect);
+				part.setColor(_sprite.getColor());
+				part.setPosition(_sprite.getPosition());
+				part.setRotation(_sprite.getRotation());
+				part.setScale(_sprite.getScale());
+				part.setOrigin(_sprite.getOrigin() - sf::Vector2f((float)x, (float)y));
+
+				target->draw(part, states);
+			}
 		}
+		return;
 	}
+
+	if (_texMan != nullptr && _tex != nullptr && _stream == nullptr)
+	{
+		// pixel art keeps nearest filtering on the full image, and asks for it so nothing sharing it shrinks it
+		int level = 0;
+		if (_texSmooth)
+		{
+			// texels to screen pixels, including every parent transform
+			const float* m = (states.transform * _sprite.getTransform()).getMatrix();
+			float screenScale = std::max(std::hypot(m[0], m[1]), std::hypot(m[4], m[5]));
+
+			_scaleLevel = TextureManager::ChooseScaleLevel(screenScale, _scaleLevel);
+			level = _scaleLevel;
+		}
+
+		// a sheet's frames only get the levels that keep them apart
+		sf::Vector2i cell = _frameRects.size() > 1 ? sf::Vector2i(_frameRects[0].width, _frameRects[0].height) : sf::Vector2i();
+
+		// the texture may be stored smaller than the image, the frame is cut from it and scaled back up
+		if (_texMan->UseScaledLevel(_texPath, level, cell) > 0)
+		{
+			const sf::Vector2u fullSize = _texMan->GetFullSize(_tex);
+			const sf::Vector2u storedSize = _tex->getSize();
+			const sf::IntRect rect = _sprite.getTextureRect();
+			if (fullSize.x > 0 && fullSize.y > 0 && rect.width != 0 && rect.height != 0)
+			{
+				const float ratioX = (float)storedSize.x / fullSize.x;
+				const float ratioY = (float)storedSize.y / fullSize.y;
+				const int left = (int)std::round(rect.left * ratioX);
+				const int top = (int)std::round(rect.top * ratioY);
+				const sf::IntRect small(left, top, (int)std::round((rect.left + rect.width) * ratioX) - left, (int)std::round((rect.top + rect.height) * ratioY) - top);
+
+				const sf::Vector2f shrink((float)small.width / rect.width, (float)small.height / rect.height);
+				sf::Sprite scaled(_sprite);
+				scaled.setTextureRect(small);
+				scaled.setOrigin(_sprite.getOrigin().x * shrink.x, _sprite.getOrigin().y * shrink.y);
+				scaled.setScale(_sprite.getScale().x / shrink.x, _sprite.getScale().y / shrink.y);
+
+				target->draw(scaled, states);
+				return;
+			}
+		}
+	}
+
+	target->draw(_sprite, states);
 }
 
-void SpriteSheet::Tick()
+void SpriteSheet::Tick(const FrameTime& frame)
 {
+	if (_lastVisibleTime < 0)
+		_lastVisibleTime = frame.time;
+
 	if (_loadTimeout > 0 && _spriteUnloaded == false)
 	{
-		if (_loadTimeout < _loadTimer.getElapsedTime().asSeconds())
+		if (_loadTimeout < frame.time - _lastVisibleTime)
 		{
 			UnloadTexture();
 		}
@@ -74,9 +179,20 @@ void SpriteSheet::LoadFromTexture(TextureManager* texMan, const std::string& tex
 		return;
 
 	_tex = tex;
+	_tiled = texMan->GetTiled(texPath);
 	_texMan = texMan;
 	_texPath = texPath;
 
+	// the texture is the first frame, the rest are decoded as they're played
+	_stream.reset();
+	if (_tiled == nullptr && AnimationDecoder::IsAnimatedFile(texPath))
+	{
+		std::string error;
+		_stream = texMan->GetStream(texPath, error);
+		if (_stream)
+			_stream->SetSmooth(_texSmooth);
+	}
+
 	if(autoSize)
 		_sprite.setTexture(*tex, true);
 
@@ -99,30 +215,41 @@ void SpriteSheet::SetAttributes(int frameCount, int gridX, int gridY, float fps,
 	_gridSize = { gridX, gridY };
 	sf::Vector2f frameSize(size);
 
-	if (frameSize == sf::Vector2f(-1, -1))
+	if (_stream && _stream->IsOpen())
 	{
-		if (_sprite.getTexture() == nullptr)
-			return;
-
-		sf::Vector2u texSize = _sprite.getTexture()->getSize();
-		frameSize = sf::Vector2f((float)texSize.x / gridX, (float)texSize.y / gridY);
+		// every frame of an animated file covers the whole canvas, whatever the grid says
+		const sf::Vector2u canvas = _stream->Size();
+		frameSize = sf::Vector2f((float)canvas.x, (float)canvas.y);
+		_frameRects.assign(_stream->FrameCount(), sf::IntRect(0, 0, canvas.x, canvas.y));
 	}
+	else
+	{
+		if (frameSize == sf::Vector2f(-1, -1))
+		{
+			if (_sprite.getTexture() == nullptr)
+				return;
+
+			// the full image, even if it's stored smaller right now
+			sf::Vector2u texSize = _tiled ? _tiled->Size() : _texMan ? _texMan->GetFullSize(_sprite.getTexture()) : _sprite.getTexture()->getSize();
+			frameSize = sf::Vector2f((float)texSize.x / gridX, (float)texSize.y / gridY);
+		}
 
-	_frameRects.clear();
+		_frameRects.clear();
 
-	int fCount = 0;
-	for (int y = 0; y < gridY && fCount < frameCount; y++)
-	{
-		for (int x = 0; x < gridX && fCount < frameCount; x++)
+		int fCount = 0;
+		for (int y = 0; y < gridY && fCount < frameCount; y++)
 		{
-			_frameRects.push_back(sf::IntRect(x * frameSize.x, y * frameSize.y, frameSize.x, frameSize.y));
-			fCount++;
+			for (int x = 0; x < gridX && fCount < frameCount; x++)
+			{
+				_frameRects.push_back(sf::IntRect(x * frameSize.x, y * frameSize.y, frameSize.x, frameSize.y));
+				fCount++;
+			}
 		}
 	}
 
 	_sprite.setTextureRect(_frameRects[0]);
 	_currentFrame = 0;
-	_timer.restart();
+	_frameStart = -1;
 	_maxFrame = _frameRects.size() - 1;
 	_spriteSize = frameSize;
 
@@ -149,7 +276,12 @@ void SpriteSheet::UnloadTexture()
 
 	_visible = false;
 	_tex = nullptr;
-	_sprite.setTexture(*_texMan->GetIcon(TextureManager::ICON_EMPTY));
+	_tiled = nullptr;
+	_sprite.setTexture(*_texMan->GetEmptyTexture());
+
+	// frees this sprite's ring of frames, it's asked for again when this one is next drawn
+	if (_stream)
+		_stream = std::make_shared<AnimationStream>();
 	_texMan->UnloadTexture(_texPath, (void*)this);
 	
 
@@ -166,6 +298,9 @@ void SpriteSheet::ReloadTexture()
 
 			auto tex = _texMan->GetTexture(_texPath, (void*)this);
 			_tex = tex;
+			_tiled = _texMan->GetTiled(_texPath);
+			if (_tiled)
+				_tiled->SetSmooth(_texSmooth);
 			_tex->setSmooth(_texSmooth);
 			_sprite.setTexture(*tex);
 			_spriteLoadFinished = true;
@@ -173,6 +308,77 @@ void SpriteSheet::ReloadTexture()
 		});
 }
 
+void SpriteSheet::SwapTexture(sf::Texture* tex, const sf::Vector2u& oldSize)
+{
+	if (tex == nullptr || _tex == nullptr || _spriteUnloaded)
+		return;
+
+	_tex = tex;
+	_sprite.setTexture(*tex, false);
+
+	// the frames are read again when it's next drawn
+	if (_stream || AnimationDecoder::IsAnimatedFile(_texPath))
+	{
+		_stream = std::make_shared<AnimationStream>();
+		return;
+	}
+
+	if (tex->getSize() == oldSize || _frameRects.empty())
+		return;
+
+	// frames that were cut from the whole image are cut from the new one, otherwise the frame size stays
+	sf::Vector2u cutSize((unsigned int)std::round(_spriteSize.x * _gridSize.x), (unsigned int)std::round(_spriteSize.y * _gridSize.y));
+	sf::Vector2f frameSize = cutSize == oldSize ? sf::Vector2f(-1, -1) : _spriteSize;
+
+	int currentFrame = _currentFrame;
+	double frameStart = _frameStart;
+	bool playing = _playing;
+
+	SetAttributes(FrameCount(), _gridSize.x, _gridSize.y, _fps, frameSize);
+
+	_currentFrame = std::min(currentFrame, _maxFrame);
+	_frameStart = frameStart;
+	_playing = playing;
+	_sprite.setTextureRect(_frameRects[_currentFrame]);
+}
+
+void SpriteSheet::OpenStream()
+{
+	std::string error;
+	std::shared_ptr<AnimationStream> stream = _texMan ? _texMan->GetStream(_texPath, error) : nullptr;
+	if (stream == nullptr)
+	{
+		// no longer animated
+		StopStream();
+		return;
+	}
+
+	_stream = stream;
+
+	_stream->SetSmooth(_texSmooth);
+
+	const sf::Vector2u canvas = _stream->Size();
+	if (FrameCount() != _stream->FrameCount() || _spriteSize != sf::Vector2f((float)canvas.x, (float)canvas.y))
+	{
+		int currentFrame = _currentFrame;
+		bool playing = _playing;
+
+		SetAttributes(_stream->FrameCount(), _gridSize.x, _gridSize.y, _fps);
+
+		_currentFrame = std::min(currentFrame, _maxFrame);
+		_playing = playing;
+	}
+}
+
+void SpriteSheet::StopStream()
+{
+	// carries on as a still image of the first frame
+	_stream.reset();
+	if (_tex)
+		_sprite.setTexture(*_tex, false);
+	SetAttributes(1, 1, 1, _fps);
+}
+
 bool SpriteSheet::HasTexture()
 {
 	if (_tex != nullptr)
@@ -188,6 +394,8 @@ void SpriteSheet::Clear()
 {
 	_texPath = "";
 	_tex = nullptr;
+	_tiled = nullptr;
+	_stream.reset();
 	_spriteSize = { 0,0 };
 	_gridSize = { 1,1 };
 	
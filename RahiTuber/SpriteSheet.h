@@ -6,14 +6,17 @@
 
 #include "imgui.h"
 #include "TextureManager.h"
+#include "AnimatedImage.h"
+#include "FrameClock.h"
+#include <memory>
 #include <thread>
 
 class SpriteSheet
 {
 public:
 
-	void Draw(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default);
-	void Tick();
+	void Draw(const FrameTime& frame, sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default);
+	void Tick(const FrameTime& frame);
 
 
 	void LoadFromTexture(TextureManager* texMan, const std::string& texPath, int frameCount, int gridX, int gridY, float fps, const sf::Vector2f& frameSize = { -1, -1 }, std::string* errorMsg = nullptr);
@@ -24,6 +27,19 @@ public:
 	void ReloadTexture();
 	bool HasTexture();
 
+	// Points at a texture reloaded from disk, keeping the current frame and animation timing
+	void SwapTexture(sf::Texture* tex, const sf::Vector2u& oldSize);
+
+	// Animated GIFs and APNGs play from a stream of their own rather than a sprite sheet grid
+	inline bool IsStreamed() const { return _stream != nullptr; }
+
+	// For a copied sprite, so it plays from its own stream rather than the original's. It's opened when first drawn.
+	inline void UnshareStream()
+	{
+		if (_stream)
+			_stream = std::make_shared<AnimationStream>();
+	}
+
 	void Clear();
 
 	inline void setPosition(const sf::Vector2f& pos) { _sprite.setPosition(pos); }
@@ -35,8 +51,10 @@ public:
 	inline sf::Vector2f getOrigin() const { return _sprite.getOrigin(); }
 	inline float getRotation() const { return _sprite.getRotation(); }
 	inline sf::Vector2f getScale() const { return _sprite.getScale(); }
+	inline sf::Color getColor() const { return _sprite.getColor(); }
 
 	inline sf::Texture* getTexture() { return _tex; }
+	inline const std::string& TexturePath() const { return _texPath; }
 
 	inline void SetColor(const ImVec4& col) { _sprite.setColor({ sf::Uint8(255 * col.x), sf::Uint8(255 * col.y),sf::Uint8(255 * col.z),sf::Uint8(255 * col.w) }); }
 	inline void SetColor(const std::vector<float>& col) { _sprite.setColor({ sf::Uint8(255 * col[0]), sf::Uint8(255 * col[1]),sf::Uint8(255 * col[2]),sf::Uint8(255 * col[3]) }); }
@@ -46,6 +64,7 @@ public:
 	inline sf::Vector2f Size() const { return _spriteSize; }
 	inline sf::Vector2i GridSize() const { return _gridSize; }
 	inline int FrameCount() const { return _frameRects.size(); }
+	inline int CurrentFrame() const { return _currentFrame; }
 	inline float FPS() const { return _fps; }
 
 	sf::Vector2f _frameSizeSetting;
@@ -63,7 +82,7 @@ public:
 	{ 
 		Stop(); 
 		Play();
-		_timer.restart();
+		_frameStart = -1;
 		for (SpriteSheet* c : _syncChildren)
 			c->Restart();
 	}
@@ -129,6 +148,10 @@ public:
 	{ 
 		if (_tex) 
 			_tex->setSmooth(smooth); 
+		if (_tiled)
+			_tiled->SetSmooth(smooth);
+		if (_stream)
+			_stream->SetSmooth(smooth);
 		_texSmooth = smooth;
 	}
 
@@ -140,6 +163,10 @@ public:
 
 private:
 
+	void DrawSprite(sf::RenderTarget* target, const sf::RenderStates& states);
+	void OpenStream();
+	void StopStream();
+
 	sf::Sprite _sprite;
 
 	sf::Vector2f _spriteSize = { 0,0 };
@@ -152,17 +179,21 @@ private:
 
 	bool _playing = false;
 
-	sf::Clock _timer;
+	// frame clock time the current animation frame started, -1 to start on the next Draw
+	double _frameStart = -1;
 
 	bool _synced = false;
 
 	std::vector<SpriteSheet*> _syncChildren;
 
 	sf::Texture* _tex = nullptr;
+	TiledTexture* _tiled = nullptr;
+	std::shared_ptr<AnimationStream> _stream;
 	bool _texSmooth = false;
+	int _scaleLevel = 0;
 	TextureManager* _texMan = nullptr;
 	std::string _texPath = "";
-	sf::Clock _loadTimer;
+	double _lastVisibleTime = -1;
 	int _loadTimeout = 0;
 	bool _spriteUnloaded = false;
 	bool _spriteLoadFinished = false;
@@ -0,0 +1,102 @@
+#include "StartupOrchestrator.h"
+
+#include <algorithm>
+#include <cstdio>
+
+void StartupOrchestrator::Launch(const std::string& name, std::function<void()> fn)
+{
+	std::thread worker([this, name, fn]()
+		{
+			double start = Now();
+			fn();
+			AddPhase(name, start, Now() - start, true);
+		});
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_running[name] = std::move(worker);
+}
+
+void StartupOrchestrator::Join(const std::string& name)
+{
+	std::thread worker;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _running.find(name);
+		if (it == _running.end())
+			return;
+
+		worker = std::move(it->second);
+		_running.erase(it);
+	}
+
+	double start = Now();
+	if (worker.joinable())
+		worker.join();
+
+	// anything under a tenth of a millisecond means it was already done
+	double waited = Now() - start;
+	if (waited > 0.0001)
+		AddPhase("Waiting for " + name, start, waited, false);
+}
+
+void StartupOrchestrator::JoinAll()
+{
+	std::vector<std::string> names;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto& run : _running)
+			names.push_back(run.first);
+	}
+
+	for (auto& name : names)
+		Join(name);
+}
+
+bool StartupOrchestrator::MarkFirstFrame(bool avatarShown)
+{
+	if (_firstFrame >= 0 || avatarShown == false)
+		return false;
+
+	_firstFrame = Now();
+	return true;
+}
+
+std::vector<StartupOrchestrator::Phase> StartupOrchestrator::GetPhases() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _phases;
+}
+
+std::vector<std::string> StartupOrchestrator::Report() const
+{
+	auto phases = GetPhases();
+	std::sort(phases.begin(), phases.end(), [](const Phase& a, const Phase& b) { return a.start < b.start; });
+
+	std::vector<std::string> lines;
+	char buf[256];
+	for (auto& phase : phases)
+	{
+		snprintf(buf, sizeof(buf), "Startup: %-28s %8.1fms at %7.1fms%s", phase.name.c_str(), phase.seconds * 1000, phase.start * 1000, phase.background ? " (background)" : "");
+		lines.push_back(buf);
+	}
+
+	if (_firstFrame >= 0)
+	{
+		snprintf(buf, sizeof(buf), "Startup: cold start to first avatar frame %.1fms", _firstFrame * 1000);
+		lines.push_back(buf);
+	}
+
+	return lines;
+}
+
+void StartupOrchestrator::AddPhase(const std::string& name, double start, double seconds, bool background)
+{
+	Phase phase;
+	phase.name = name;
+	phase.start = start;
+	phase.seconds = seconds;
+	phase.background = background;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_phases.push_back(phase);
+}
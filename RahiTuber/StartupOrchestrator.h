@@ -0,0 +1,82 @@
+#pragma once
+
+#include "SFML/System/Clock.hpp"
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Times every phase of startup from the moment the engine is created, and runs the ones that don't
+// depend on each other on threads of their own. The headline is the cold start: how long until the
+// first frame with the avatar on it.
+class StartupOrchestrator
+{
+public:
+
+	struct Phase
+	{
+		std::string name = "";
+		double start = 0;			// seconds since the engine was created
+		double seconds = 0;
+		bool background = false;
+	};
+
+	// Times the enclosing scope as a phase on the calling thread
+	class ScopedPhase
+	{
+	public:
+		ScopedPhase(StartupOrchestrator* owner, const std::string& name) : _owner(owner), _name(name), _start(owner->Now()) {}
+		~ScopedPhase() { End(); }
+
+		// Ends the phase before the scope does
+		void End()
+		{
+			if (_owner != nullptr)
+				_owner->AddPhase(_name, _start, _owner->Now() - _start, false);
+			_owner = nullptr;
+		}
+
+	private:
+		StartupOrchestrator* _owner;
+		std::string _name;
+		double _start;
+	};
+
+	~StartupOrchestrator() { JoinAll(); }
+
+	inline ScopedPhase Time(const std::string& name) { return ScopedPhase(this, name); }
+
+	// Starts fn on a thread of its own, timed as a background phase
+	void Launch(const std::string& name, std::function<void()> fn);
+
+	// Waits for a launched phase to finish. The wait is recorded as a phase too, if there was one.
+	void Join(const std::string& name);
+	void JoinAll();
+
+	// Call after every frame until it returns true, which it does once the avatar is on screen
+	bool MarkFirstFrame(bool avatarShown);
+	inline bool FirstFrameShown() const { return _firstFrame >= 0; }
+	inline double FirstFrameSeconds() const { return _firstFrame; }
+
+	std::vector<Phase> GetPhases() const;
+
+	// One line per phase in the order they started, then the total
+	std::vector<std::string> Report() const;
+
+	inline double Now() const { return _clock.getElapsedTime().asMicroseconds() * 0.000001; }
+
+private:
+
+	void AddPhase(const std::string& name, double start, double seconds, bool background);
+
+	sf::Clock _clock;
+
+	mutable std::mutex _mutex;
+	std::vector<Phase> _phases;
+	std::map<std::string, std::thread> _running;
+
+	double _firstFrame = -1;
+};
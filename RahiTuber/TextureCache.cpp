@@ -0,0 +1,459 @@
+#include "TextureCache.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static const char c_cacheMagic[8] = { 'R', 'T', 'C', 'A', 'C', 'H', 'E', 0 };
+static const uint64_t c_blobAlign = 64;
+
+static int64_t GetModifiedTime(const std::string& path)
+{
+	std::error_code ec;
+	auto time = fs::last_write_time(path, ec);
+	if (ec)
+		return 0;
+	return (int64_t)time.time_since_epoch().count();
+}
+
+static bool ReadWholeFile(const std::string& path, std::vector<uint8_t>& out)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+		return false;
+
+	out.resize((size_t)file.tellg());
+	file.seekg(0);
+	file.read((char*)out.data(), out.size());
+	return file.good();
+}
+
+uint64_t TextureCache::HashBytes(const uint8_t* data, size_t size)
+{
+	// 8 bytes per step multiply/rotate hash, plenty to tell image files apart
+	const uint64_t m1 = 0x87c37b91114253d5ull;
+	const uint64_t m2 = 0x4cf5ad432745937full;
+
+	uint64_t h = 0x9e3779b97f4a7c15ull ^ size;
+	size_t words = size / 8;
+	for (size_t w = 0; w < words; w++)
+	{
+		uint64_t v;
+		memcpy(&v, data + w * 8, 8);
+		h ^= v * m1;
+		h = ((h << 31) | (h >> 33)) * m2;
+	}
+
+	uint64_t tail = 0;
+	for (size_t b = words * 8; b < size; b++)
+		tail = (tail << 8) | data[b];
+	h ^= tail * m1;
+
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+	return h;
+}
+
+void TextureCache::Begin(const fs::path& cachePath)
+{
+	std::scoped_lock lock(_mutex);
+
+	Close();
+
+	_path = cachePath;
+	_active = true;
+	_hits = 0;
+	_misses = 0;
+
+	Map(cachePath);
+}
+
+const TextureCache::Entry* TextureCache::FindValidEntry(const std::string& sourcePath)
+{
+	if (!_active || _data == nullptr)
+		return nullptr;
+
+	auto found = _lookup.find(sourcePath);
+	if (found == _lookup.end())
+		return nullptr;
+
+	const Header* header = (const Header*)_data;
+	const Entry* entry = (const Entry*)(_data + header->indexOffset + sizeof(Entry) * found->second);
+
+	// already checked this session
+	if (_used.count(found->second))
+		return entry;
+
+	int64_t mtime = 0;
+	if (!IsEntryValid(*entry, sourcePath, mtime))
+	{
+		_stale = true;
+		return nullptr;
+	}
+
+	if (mtime != entry->mtime)
+		_stale = true;
+
+	_used[found->second] = mtime;
+	return entry;
+}
+
+bool TextureCache::GetHash(const std::string& sourcePath, uint64_t& hash)
+{
+	std::scoped_lock lock(_mutex);
+
+	const Entry* entry = FindValidEntry(sourcePath);
+	if (entry == nullptr)
+		return false;
+
+	hash = entry->hash;
+	return true;
+}
+
+bool TextureCache::LoadInto(const std::string& sourcePath, sf::Texture& tex)
+{
+	std::scoped_lock lock(_mutex);
+
+	const Entry* entry = FindValidEntry(sourcePath);
+	if (entry == nullptr)
+		return false;
+
+	if (!tex.create(entry->width, entry->height))
+		return false;
+
+	tex.update(_data + entry->pixelOffset);
+
+	_hits++;
+	return true;
+}
+
+bool TextureCache::CopyPixels(const std::string& sourcePath, uint64_t sourceHash, std::vector<uint8_t>& pixels, sf::Vector2u& size)
+{
+	std::scoped_lock lock(_mutex);
+
+	const Entry* entry = FindValidEntry(sourcePath);
+	if (entry == nullptr || entry->hash != sourceHash)
+		return false;
+
+	size = { entry->width, entry->height };
+	pixels.assign(_data + entry->pixelOffset, _data + entry->pixelOffset + (size_t)entry->width * entry->height * 4);
+	return true;
+}
+
+bool TextureCache::IsEntryValid(const Entry& entry, const std::string& sourcePath, int64_t& mtime)
+{
+	std::error_code ec;
+	uint64_t fileSize = fs::file_size(sourcePath, ec);
+	if (ec || fileSize != entry.fileSize)
+		return false;
+
+	mtime = GetModifiedTime(sourcePath);
+	if (mtime == entry.mtime)
+		return true;
+
+	// touched or copied without changing, eg. by a sync tool. Only trust it if the contents match
+	std::vector<uint8_t> contents;
+	if (!ReadWholeFile(sourcePath, contents))
+		return false;
+
+	return HashBytes(contents.data(), contents.size()) == entry.hash;
+}
+
+void TextureCache::Store(const std::string& sourcePath, uint64_t sourceHash, unsigned int width, unsigned int height, const uint8_t* pixels)
+{
+	std::scoped_lock lock(_mutex);
+
+	if (!_active || _stored.count(sourcePath))
+		return;
+
+	_misses++;
+
+	if (!OpenBuilder())
+		return;
+
+	Entry entry = {};
+	entry.width = width;
+	entry.height = height;
+	std::error_code ec;
+	entry.fileSize = fs::file_size(sourcePath, ec);
+	entry.mtime = GetModifiedTime(sourcePath);
+	entry.hash = sourceHash;
+
+	AppendEntry(sourcePath, entry, pixels);
+}
+
+bool TextureCache::OpenBuilder()
+{
+	if (_builder.is_open())
+		return true;
+
+	fs::path tmpPath = _path;
+	tmpPath += ".tmp";
+
+	_builder.open(tmpPath, std::ios::binary | std::ios::trunc);
+	if (!_builder)
+		return false;
+
+	// header is written last, once the index is known
+	Header header = {};
+	_builder.write((const char*)&header, sizeof(Header));
+	_builderOffset = sizeof(Header);
+	_builderEntries.clear();
+	_builderStrings.clear();
+	_stored.clear();
+
+	return _builder.good();
+}
+
+bool TextureCache::AppendEntry(const std::string& sourcePath, Entry entry, const uint8_t* pixels)
+{
+	uint64_t padding = (c_blobAlign - _builderOffset % c_blobAlign) % c_blobAlign;
+	static const char zeros[c_blobAlign] = {};
+	_builder.write(zeros, padding);
+	_builderOffset += padding;
+
+	uint64_t bytes = (uint64_t)entry.width * entry.height * 4;
+	entry.pixelOffset = _builderOffset;
+	entry.pathOffset = _builderStrings.size();
+	entry.pathLen = (uint32_t)sourcePath.size();
+
+	_builder.write((const char*)pixels, bytes);
+	_builderOffset += bytes;
+
+	_builderStrings += sourcePath;
+	_builderEntries.push_back(entry);
+	_stored[sourcePath] = true;
+
+	return _builder.good();
+}
+
+bool TextureCache::Finish()
+{
+	std::scoped_lock lock(_mutex);
+
+	if (!_active || _finished)
+		return true;
+
+	bool ok = Write(false);
+
+	// start over against what's on disk now, so later loads are checked against the new entries
+	_used.clear();
+	_stored.clear();
+	_stale = false;
+	Map(_path);
+
+	_finished = true;
+	return ok;
+}
+
+bool TextureCache::Write(bool keepUnused)
+{
+	int mappedEntries = _data != nullptr ? (int)((const Header*)_data)->entryCount : 0;
+	bool unused = (int)_used.size() != mappedEntries && !keepUnused;
+
+	if (!_builder.is_open() && !_stale && !unused)
+		return true;
+
+	if (!OpenBuilder())
+		return false;
+
+	// carry over the entries that are still in use, or all of them when adding to a finished set
+	const Header* header = (const Header*)_data;
+	for (int e = 0; e < mappedEntries; e++)
+	{
+		auto used = _used.find(e);
+		if (used == _used.end() && !keepUnused)
+			continue;
+
+		Entry entry;
+		memcpy(&entry, _data + header->indexOffset + sizeof(Entry) * e, sizeof(Entry));
+
+		std::string sourcePath((const char*)_data + header->stringsOffset + entry.pathOffset, entry.pathLen);
+		if (_stored.count(sourcePath))
+			continue;
+
+		if (used != _used.end())
+			entry.mtime = used->second;
+		AppendEntry(sourcePath, entry, _data + entry.pixelOffset);
+	}
+
+	// the index is read in place, keep it aligned for its 64 bit fields
+	uint64_t indexPadding = (8 - _builderOffset % 8) % 8;
+	static const char zeros[8] = {};
+	_builder.write(zeros, indexPadding);
+	_builderOffset += indexPadding;
+
+	Header newHeader = {};
+	memcpy(newHeader.magic, c_cacheMagic, sizeof(c_cacheMagic));
+	newHeader.version = Version;
+	newHeader.entryCount = (uint32_t)_builderEntries.size();
+	newHeader.indexOffset = _builderOffset;
+	newHeader.stringsOffset = _builderOffset + sizeof(Entry) * _builderEntries.size();
+
+	_builder.write((const char*)_builderEntries.data(), sizeof(Entry) * _builderEntries.size());
+	_builder.write(_builderStrings.data(), _builderStrings.size());
+	_builder.seekp(0);
+	_builder.write((const char*)&newHeader, sizeof(Header));
+
+	bool ok = _builder.good();
+	_builder.close();
+
+	fs::path tmpPath = _path;
+	tmpPath += ".tmp";
+	std::error_code ec;
+
+	if (!ok)
+	{
+		fs::remove(tmpPath, ec);
+		return false;
+	}
+
+	// the old file can't be replaced while it's mapped on Windows
+	Unmap();
+	fs::rename(tmpPath, _path, ec);
+	if (ec)
+		fs::remove(tmpPath, ec);
+
+	return !ec;
+}
+
+void TextureCache::Close()
+{
+	std::scoped_lock lock(_mutex);
+
+	if (_finished && _builder.is_open())
+		Write(true);
+
+	if (_builder.is_open())
+	{
+		_builder.close();
+
+		fs::path tmpPath = _path;
+		tmpPath += ".tmp";
+		std::error_code ec;
+		fs::remove(tmpPath, ec);
+	}
+
+	Unmap();
+
+	_builderEntries.clear();
+	_builderStrings.clear();
+	_stored.clear();
+	_used.clear();
+	_stale = false;
+	_active = false;
+	_finished = false;
+}
+
+bool TextureCache::Map(const fs::path& path)
+{
+	Unmap();
+
+	std::error_code ec;
+	if (!fs::exists(path, ec))
+		return false;
+
+#ifdef _WIN32
+	HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(Header))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr)
+		return false;
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	_data = (const uint8_t*)view;
+	_size = (size_t)fileSize.QuadPart;
+	_mapHandle = mapping;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header))
+	{
+		close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return false;
+
+	_data = (const uint8_t*)view;
+	_size = (size_t)st.st_size;
+#endif
+
+	// validate everything up front so lookups can trust the offsets
+	const Header* header = (const Header*)_data;
+	bool valid = memcmp(header->magic, c_cacheMagic, sizeof(c_cacheMagic)) == 0
+		&& header->version == Version
+		&& header->indexOffset % 8 == 0
+		&& header->indexOffset + sizeof(Entry) * (uint64_t)header->entryCount <= _size
+		&& header->stringsOffset <= _size;
+
+	for (uint32_t e = 0; valid && e < header->entryCount; e++)
+	{
+		Entry entry;
+		memcpy(&entry, _data + header->indexOffset + sizeof(Entry) * e, sizeof(Entry));
+
+		valid = entry.pixelOffset + (uint64_t)entry.width * entry.height * 4 <= _size
+			&& header->stringsOffset + entry.pathOffset + entry.pathLen <= _size;
+
+		if (valid)
+			_lookup[std::string((const char*)_data + header->stringsOffset + entry.pathOffset, entry.pathLen)] = e;
+	}
+
+	if (!valid)
+	{
+		Unmap();
+		return false;
+	}
+
+	return true;
+}
+
+void TextureCache::Unmap()
+{
+	if (_data != nullptr)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(_data);
+		CloseHandle((HANDLE)_mapHandle);
+#else
+		munmap((void*)_data, _size);
+#endif
+	}
+
+	_data = nullptr;
+	_size = 0;
+	_mapHandle = nullptr;
+	_lookup.clear();
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "SFML/Graphics/Texture.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Compiled image cache kept next to a layer set's XML (<name>.rtcache).
+// Holds the premultiplied RGBA pixels of every image the set uses, so opening the set again skips
+// PNG decoding and premultiplying. The layer set's XML itself is still parsed on every load.
+// The file is memory-mapped, and each entry is checked against the source image's size and
+// modification time, falling back to a content hash if only the time changed.
+class TextureCache
+{
+public:
+
+	static const uint32_t Version = 1;
+
+	~TextureCache() { Close(); }
+
+	// Maps the existing cache at cachePath, if it's valid, and starts tracking which images get used
+	void Begin(const std::filesystem::path& cachePath);
+
+	// Gets the content hash stored for the source image, if its entry is still valid
+	bool GetHash(const std::string& sourcePath, uint64_t& hash);
+
+	// Creates tex from the cached pixels if there is a valid entry for the source image
+	bool LoadInto(const std::string& sourcePath, sf::Texture& tex);
+
+	// Copies the cached pixels out if there is a valid entry whose source hash is sourceHash. Safe from any thread.
+	bool CopyPixels(const std::string& sourcePath, uint64_t sourceHash, std::vector<uint8_t>& pixels, sf::Vector2u& size);
+
+	// Adds freshly decoded, premultiplied pixels. sourceHash is HashBytes() of the source file.
+	void Store(const std::string& sourcePath, uint64_t sourceHash, unsigned int width, unsigned int height, const uint8_t* pixels);
+
+	// Rewrites the cache if images were added, changed or are no longer used, then maps the new one.
+	// The session stays open: textures loaded again later read from it, and images decoded after
+	// this, eg. by a hot reload, are added when the session is closed.
+	// Returns false if the new cache couldn't be written, the old one is kept in that case.
+	bool Finish();
+
+	// Ends the session. Images stored after Finish are written first, anything else unfinished is thrown away.
+	void Close();
+
+	inline bool IsActive() const { return _active; }
+	inline int Hits() const { return _hits; }
+	inline int Misses() const { return _misses; }
+
+	static uint64_t HashBytes(const uint8_t* data, size_t size);
+
+private:
+
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t entryCount;
+		uint64_t indexOffset;
+		uint64_t stringsOffset;
+		uint8_t pad[32];
+	};
+
+	struct Entry
+	{
+		uint64_t pathOffset;
+		uint32_t pathLen;
+		uint32_t width;
+		uint32_t height;
+		uint32_t pad;
+		uint64_t fileSize;
+		int64_t mtime;
+		uint64_t hash;
+		uint64_t pixelOffset;
+	};
+
+	bool Map(const std::filesystem::path& path);
+	void Unmap();
+
+	bool IsEntryValid(const Entry& entry, const std::string& sourcePath, int64_t& mtime);
+	const Entry* FindValidEntry(const std::string& sourcePath);
+
+	// keepUnused carries over every mapped entry, for images stored after the set finished loading
+	bool Write(bool keepUnused);
+
+	bool OpenBuilder();
+	bool AppendEntry(const std::string& sourcePath, Entry entry, const uint8_t* pixels);
+
+	std::recursive_mutex _mutex;
+
+	std::filesystem::path _path;
+	bool _active = false;
+	bool _finished = false;
+
+	// the mapped cache
+	const uint8_t* _data = nullptr;
+	size_t _size = 0;
+	void* _mapHandle = nullptr;
+	std::unordered_map<std::string, int> _lookup;
+
+	// entries from the mapped cache that were used, with their source's current mtime
+	std::map<int, int64_t> _used;
+	bool _stale = false;
+
+	// the replacement cache being written alongside
+	std::ofstream _builder;
+	std::vector<Entry> _builderEntries;
+	std::string _builderStrings;
+	uint64_t _builderOffset = 0;
+	std::map<std::string, bool> _stored;
+
+	int _hits = 0;
+	int _misses = 0;
+};
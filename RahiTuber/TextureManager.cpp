@@ -1,83 +1,172 @@
 #include "TextureManager.h"
+#include "AnimatedImage.h"
+#include "IconAtlas.h"
 
 #include "file_browser_modal.h"
+#include "imgui.h"
+#include <SFML/OpenGL.hpp>
+#include "GL/glext.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <set>
 #include <thread>
 
+TextureManager::~TextureManager()
+{
+	if (_reloadThread.joinable())
+		_reloadThread.join();
+
+	{
+		std::scoped_lock scaleLock(_scaleMutex);
+		_scaleQueue.clear();
+	}
+	if (_scaleThread.joinable())
+		_scaleThread.join();
+}
+
+static const std::vector<std::pair<TextureManager::IconID, std::string>> IconFiles = {
+	{ TextureManager::ICON_ANIM, "anim.png" },
+	{ TextureManager::ICON_EMPTY, "empty.png" },
+	{ TextureManager::ICON_UP, "arrowup.png" },
+	{ TextureManager::ICON_DN, "arrowdn.png" },
+	{ TextureManager::ICON_EDIT, "edit.png" },
+	{ TextureManager::ICON_DEL, "delete.png" },
+	{ TextureManager::ICON_DUPE, "duplicate.png" },
+	{ TextureManager::ICON_NEWFILE, "new_file.png" },
+	{ TextureManager::ICON_OPEN, "open.png" },
+	{ TextureManager::ICON_SAVE, "save.png" },
+	{ TextureManager::ICON_SAVEAS, "save_as.png" },
+	{ TextureManager::ICON_MAKEPORTABLE, "make_portable.png" },
+	{ TextureManager::ICON_RELOAD, "reload.png" },
+	{ TextureManager::ICON_NEWLAYER, "new_layer.png" },
+	{ TextureManager::ICON_NEWFOLDER, "new_folder.png" },
+	{ TextureManager::ICON_STATES, "states.png" },
+	{ TextureManager::ICON_RESET, "reset.png" },
+	{ TextureManager::ICON_PLUS, "plus.png" },
+	{ TextureManager::ICON_LOCK_OPEN, "lock_open.png" },
+	{ TextureManager::ICON_LOCK_CLOSED, "lock_closed.png" },
+	{ TextureManager::ICON_EYE_OPEN, "eye_open.png" },
+	{ TextureManager::ICON_EYE_CLOSED, "eye_closed.png" },
+	{ TextureManager::ICON_PIN, "pin.png" },
+	{ TextureManager::ICON_PIN_OFF, "pin_off.png" },
+	{ TextureManager::ICON_REFRESH, "refresh.png" },
+	{ TextureManager::ICON_MOVE, "move.png" },
+	{ TextureManager::ICON_DROP, "drop.png" },
+	{ TextureManager::ICON_FILTER_ON, "filter_on.png" },
+	{ TextureManager::ICON_FILTER_OFF, "filter_off.png" },
+	{ TextureManager::ICON_TAG, "tag.png" },
+};
+
 void TextureManager::LoadIcons(const std::string& appLocation)
 {
-	if (_icons.count(ICON_ANIM) == 0)
-		LoadIcon(appLocation + "res/anim.png", _icons[ICON_ANIM]);
-	if (_icons.count(ICON_EMPTY) == 0)
-		LoadIcon(appLocation + "res/empty.png", _icons[ICON_EMPTY]);
-	if (_icons.count(ICON_UP) == 0)
-		LoadIcon(appLocation + "res/arrowup.png", _icons[ICON_UP]);
-	if (_icons.count(ICON_DN) == 0)
-		LoadIcon(appLocation + "res/arrowdn.png", _icons[ICON_DN]);
-	if (_icons.count(ICON_EDIT) == 0)
-		LoadIcon(appLocation + "res/edit.png", _icons[ICON_EDIT]);
-	if (_icons.count(ICON_DEL) == 0)
-		LoadIcon(appLocation + "res/delete.png", _icons[ICON_DEL]);
-	if (_icons.count(ICON_DUPE) == 0)
-		LoadIcon(appLocation + "res/duplicate.png", _icons[ICON_DUPE]);
-	if (_icons.count(ICON_NEWFILE) == 0)
-		LoadIcon(appLocation + "res/new_file.png", _icons[ICON_NEWFILE]);
-	if (_icons.count(ICON_OPEN) == 0)
-		LoadIcon(appLocation + "res/open.png", _icons[ICON_OPEN]);
-	if (_icons.count(ICON_SAVE) == 0)
-		LoadIcon(appLocation + "res/save.png", _icons[ICON_SAVE]);
-	if (_icons.count(ICON_SAVEAS) == 0)
-		LoadIcon(appLocation + "res/save_as.png", _icons[ICON_SAVEAS]);
-	if (_icons.count(ICON_MAKEPORTABLE) == 0)
-		LoadIcon(appLocation + "res/make_portable.png", _icons[ICON_MAKEPORTABLE]);
-	if (_icons.count(ICON_RELOAD) == 0)
-		LoadIcon(appLocation + "res/reload.png", _icons[ICON_RELOAD]);
-	if (_icons.count(ICON_NEWLAYER) == 0)
-		LoadIcon(appLocation + "res/new_layer.png", _icons[ICON_NEWLAYER]);
-	if (_icons.count(ICON_NEWFOLDER) == 0)
-		LoadIcon(appLocation + "res/new_folder.png", _icons[ICON_NEWFOLDER]);
-	if (_icons.count(ICON_STATES) == 0)
-		LoadIcon(appLocation + "res/states.png", _icons[ICON_STATES]);
-	if (_icons.count(ICON_RESET) == 0)
-		LoadIcon(appLocation + "res/reset.png", _icons[ICON_RESET]);
-	if (_icons.count(ICON_PLUS) == 0)
-		LoadIcon(appLocation + "res/plus.png", _icons[ICON_PLUS]);
-	if (_icons.count(ICON_LOCK_OPEN) == 0)
-		LoadIcon(appLocation + "res/lock_open.png", _icons[ICON_LOCK_OPEN]);
-	if (_icons.count(ICON_LOCK_CLOSED) == 0)
-		LoadIcon(appLocation + "res/lock_closed.png", _icons[ICON_LOCK_CLOSED]);
-	if (_icons.count(ICON_EYE_OPEN) == 0)
-		LoadIcon(appLocation + "res/eye_open.png", _icons[ICON_EYE_OPEN]);
-	if (_icons.count(ICON_EYE_CLOSED) == 0)
-		LoadIcon(appLocation + "res/eye_closed.png", _icons[ICON_EYE_CLOSED]);
-	if (_icons.count(ICON_PIN) == 0)
-		LoadIcon(appLocation + "res/pin.png", _icons[ICON_PIN]);
-	if (_icons.count(ICON_PIN_OFF) == 0)
-		LoadIcon(appLocation + "res/pin_off.png", _icons[ICON_PIN_OFF]);
-	if (_icons.count(ICON_REFRESH) == 0)
-		LoadIcon(appLocation + "res/refresh.png", _icons[ICON_REFRESH]);
-	if (_icons.count(ICON_MOVE) == 0)
-		LoadIcon(appLocation + "res/move.png", _icons[ICON_MOVE]);
-	if (_icons.count(ICON_DROP) == 0)
-		LoadIcon(appLocation + "res/drop.png", _icons[ICON_DROP]);
-	if (_icons.count(ICON_FILTER_ON) == 0)
-		LoadIcon(appLocation + "res/filter_on.png", _icons[ICON_FILTER_ON]);
-	if (_icons.count(ICON_FILTER_OFF) == 0)
-		LoadIcon(appLocation + "res/filter_off.png", _icons[ICON_FILTER_OFF]);
-	if (_icons.count(ICON_TAG) == 0)
-		LoadIcon(appLocation + "res/tag.png", _icons[ICON_TAG]);
-
-	for (auto& ic : _icons)
-		ic.second->setSmooth(true);
-}
-
-sf::Texture* TextureManager::GetTexture(const std::string& path, void* caller, std::string* errString)
+	if (!_iconAtlasRects.empty())
+		return;
+
+	// the atlas is compiled in and decoded in one go. One with the same layout in res/ replaces it,
+	// so the icons can be changed without a rebuild, see res/pack_icons.py
+	sf::Image atlas;
+	const std::string overridePath = appLocation + "res/icons.png";
+	std::error_code ec;
+	bool loaded = fs::exists(overridePath, ec) && atlas.loadFromFile(overridePath)
+		&& atlas.getSize() == sf::Vector2u(IconAtlasWidth, IconAtlasHeight);
+	if (!loaded)
+		loaded = atlas.loadFromMemory(IconAtlasPng, sizeof(IconAtlasPng));
+	if (!loaded)
+		return;
+
+	for (auto& icon : IconFiles)
+	{
+		for (auto& rect : IconAtlasRects)
+		{
+			if (icon.second != rect.file)
+				continue;
+
+			sf::IntRect region(rect.left, rect.top, rect.width, rect.height);
+			_iconAtlasRects[icon.first] = region;
+
+			// kept for copying into the font atlas
+			sf::Image& img = _iconImages[icon.first];
+			img.create(region.width, region.height);
+			img.copy(atlas, 0, 0, region);
+		}
+	}
+
+	if (_iconImages.count(ICON_EMPTY))
+		_emptyTexture.loadFromImage(_iconImages[ICON_EMPTY]);
+
+	_iconAtlas.loadFromImage(atlas);
+	_iconAtlas.setSmooth(true);
+	_emptyTexture.setSmooth(true);
+
+	UseStandaloneIcons();
+}
+
+void TextureManager::UseStandaloneIcons()
+{
+	for (auto& rect : _iconAtlasRects)
+		_icons[rect.first] = sf::Sprite(_iconAtlas, rect.second);
+}
+
+void TextureManager::AddIconsToFontAtlas(ImFontAtlas* atlas)
+{
+	_iconFontRects.clear();
+	for (auto& icon : _iconImages)
+	{
+		sf::Vector2u size = icon.second.getSize();
+		if (size.x > 0 && size.y > 0)
+			_iconFontRects[icon.first] = atlas->AddCustomRectRegular(size.x + IconFontPadding * 2, size.y + IconFontPadding * 2);
+	}
+}
+
+void TextureManager::CopyWithEdges(const uint8_t* src, int width, int height, uint8_t* dst, int dstWidth, int x, int y, int pad)
+{
+	for (int row = -pad; row < height + pad; row++)
+	{
+		const uint8_t* srcRow = src + (size_t)std::clamp(row, 0, height - 1) * width * 4;
+		uint8_t* dstRow = dst + ((size_t)(y + row) * dstWidth + x) * 4;
+
+		memcpy(dstRow, srcRow, (size_t)width * 4);
+		for (int p = 1; p <= pad; p++)
+		{
+			memcpy(dstRow - p * 4, srcRow, 4);
+			memcpy(dstRow + (width - 1 + p) * 4, srcRow + (width - 1) * 4, 4);
+		}
+	}
+}
+
+void TextureManager::CopyIconsToFontAtlas(ImFontAtlas* atlas, unsigned char* rgbaPixels, int width, const sf::Texture* fontTexture)
+{
+	for (auto& fontRect : _iconFontRects)
+	{
+		const ImFontAtlasCustomRect* rect = atlas->GetCustomRectByIndex(fontRect.second);
+		if (rect == nullptr || rect->IsPacked() == false)
+			continue;
+
+		const sf::Image& img = _iconImages[fontRect.first];
+		const sf::Vector2i size(rect->Width - IconFontPadding * 2, rect->Height - IconFontPadding * 2);
+		if (sf::Vector2u(size) != img.getSize())
+			continue;
+
+		const int x = rect->X + IconFontPadding;
+		const int y = rect->Y + IconFontPadding;
+		CopyWithEdges(img.getPixelsPtr(), size.x, size.y, rgbaPixels, width, x, y, IconFontPadding);
+
+		_icons[fontRect.first] = sf::Sprite(*fontTexture, sf::IntRect(x, y, size.x, size.y));
+	}
+}
+
+sf::Texture* TextureManager::GetTexture(const std::string& rawPath, void* caller, std::string* errString)
 {
 	if(errString != nullptr)
 		*errString = "";
 
-	if (path.empty())
+	if (rawPath.empty())
 		return nullptr;
 
+	const std::string path = NormalisePath(rawPath);
+
 	sf::Texture* out = nullptr;
 
 	while (_textures.count(path) && _textures[path].busyLoading)
@@ -107,37 +196,88 @@ sf::Texture* TextureManager::GetTexture(const std::string& path, void* caller, s
 	return out;
 }
 
-bool TextureManager::LoadIcon(const std::string& path, sf::Texture*& storage)
+static bool ReadFileBytes(const std::string& path, std::vector<uint8_t>& out)
 {
-	storage = new sf::Texture();
-	int tries = 5;
-	while (tries > 0)
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+		return false;
+
+	out.resize((size_t)file.tellg());
+	file.seekg(0);
+	file.read((char*)out.data(), out.size());
+	return file.good() && !out.empty();
+}
+
+std::string TextureManager::NormalisePath(const std::string& path)
+{
+	std::scoped_lock loadLock(_loadMutex);
+
+	auto found = _normalisedPaths.find(path);
+	if (found != _normalisedPaths.end())
+		return found->second;
+
+	// resolves "..", "." and symlinks, so every spelling of one file ends up with the same key
+	std::error_code ec;
+	fs::path canonical = fs::weakly_canonical(path, ec);
+	std::string normalised = ec ? fs::path(path).lexically_normal().string() : canonical.string();
+
+	_normalisedPaths[path] = normalised;
+	return normalised;
+}
+
+// premultiplied RGBA, ready to upload
+static bool DecodePixels(const std::vector<uint8_t>& fileData, std::vector<uint8_t>& pixels, sf::Vector2u& size)
+{
+	sf::Image loadingImg;
+	if (!loadingImg.loadFromMemory(fileData.data(), fileData.size()))
+		return false;
+
+	size = loadingImg.getSize();
+	pixels.resize((size_t)size.x * size.y * 4);
+	TextureManager::Premultiply(loadingImg.getPixelsPtr(), pixels.data(), (size_t)size.x * size.y);
+
+	return true;
+}
+
+bool TextureManager::DecodeTexture(const std::string& path, const std::vector<uint8_t>& fileData, uint64_t hash, sf::Texture& tex, std::shared_ptr<TiledTexture>& tiled)
+{
+	std::vector<uint8_t> pixels;
+	sf::Vector2u imgSize;
+	if (!DecodePixels(fileData, pixels, imgSize))
+		return false;
+
+	const unsigned int maxSize = sf::Texture::getMaximumSize();
+	if (imgSize.x > maxSize || imgSize.y > maxSize)
 	{
-		bool success = false;
-		std::string err = "";
-		try
+		// the texture is only a preview for the UI, sprites draw their frames from tiles
+		std::vector<uint8_t> preview = pixels;
+		std::vector<uint8_t> half;
+		sf::Vector2u previewSize = imgSize;
+		while (previewSize.x > PreviewSize || previewSize.y > PreviewSize)
 		{
-			success = storage->loadFromFile(path);
-		}
-		catch (const std::exception& exc)
-		{
-			err = ": " + std::string(exc.what());
+			HalveImage(preview, previewSize, half, previewSize);
+			preview.swap(half);
 		}
 
-		if (success)
-		{
-			return true;
-		}
+		if (!tex.create(previewSize.x, previewSize.y))
+			return false;
 
-		tries--;
+		tex.update(preview.data());
+		tiled = std::make_shared<TiledTexture>(std::move(pixels), imgSize, std::min(maxSize, (unsigned int)MaxTileSize));
+		return true;
 	}
 
-	return false;
+	if (!tex.create(imgSize.x, imgSize.y))
+		return false;
+
+	tex.update(pixels.data());
+	_cache.Store(path, hash, imgSize.x, imgSize.y, pixels.data());
+	return true;
 }
 
 bool TextureManager::LoadTexture(const std::string& path, void* caller, std::string* errString)
 {
-	auto loadingTex = std::make_unique<sf::Texture>();
+	std::shared_ptr<sf::Texture> loadingTex;
 	int tries = 5;
 	while (tries > 0)
 	{
@@ -145,44 +285,48 @@ bool TextureManager::LoadTexture(const std::string& path, void* caller, std::str
 		std::string err = "";
 		try
 		{
-			sf::Image loadingImg;
-			loadingImg.loadFromFile(path);
-			const auto imgSize = loadingImg.getSize();
-			int channels = 4;
-			const uint32_t pixelCount = imgSize.x * imgSize.y;
-
-			int x = 0, y = 0;
-			for (uint32_t i = 0u; i < pixelCount ; i++)
+			// the cache already knows the hash of unchanged files, otherwise hash the bytes we're about to decode
+			loadingTex = nullptr;
+			std::shared_ptr<TiledTexture> tiled;
+			uint64_t hash = 0;
+			std::vector<uint8_t> fileData;
+			if (!_cache.GetHash(path, hash) && ReadFileBytes(path, fileData))
+				hash = TextureCache::HashBytes(fileData.data(), fileData.size());
+
+			// the same image under another path, eg. a copy made by Make Portable
 			{
-				auto pix = loadingImg.getPixel(x, y);
-				if (pix.a > 0)
-				{
-					pix.r = (sf::Uint8)((float)pix.r * ((float)pix.a / 255));
-					pix.g = (sf::Uint8)((float)pix.g * ((float)pix.a / 255));
-					pix.b = (sf::Uint8)((float)pix.b * ((float)pix.a / 255));
+				std::scoped_lock loadLock(_loadMutex);
+				auto found = _texturesByHash.find(hash);
+				if (hash != 0 && found != _texturesByHash.end())
+					loadingTex = found->second.lock();
+			}
 
-					loadingImg.setPixel(x, y, pix);
-				}
-				else
-					loadingImg.setPixel(x, y, sf::Color(0,0,0,0));
-				
-				x++;
-				if (x >= imgSize.x)
-				{
-					x = 0;
-					y++;
-				}
+			success = loadingTex != nullptr;
 
+			if (!success)
+			{
+				loadingTex = std::make_shared<sf::Texture>();
+				success = _cache.LoadInto(path, *loadingTex);
 			}
 
-			success = loadingTex->loadFromImage(loadingImg);
-			//success = loadingTex->loadFromFile(path);
+			if (!success && (!fileData.empty() || ReadFileBytes(path, fileData)))
+			{
+				if (hash == 0)
+					hash = TextureCache::HashBytes(fileData.data(), fileData.size());
+				success = DecodeTexture(path, fileData, hash, *loadingTex, tiled);
+			}
 
 			if (success)
 			{
 				std::scoped_lock loadLock(_loadMutex);
 				_textures[path].refHolders[caller] = true;
-				_textures[path].tex = std::move(loadingTex);
+				_textures[path].tex = loadingTex;
+				_textures[path].hash = hash;
+				_textures[path].tiled = tiled;
+
+				// a preview can't stand in for the full image
+				if (hash != 0 && tiled == nullptr)
+					_texturesByHash[hash] = loadingTex;
 			}
 		}
 		catch (const std::exception& exc)
@@ -227,8 +371,10 @@ bool TextureManager::LoadTexture(const std::string& path, void* caller, std::str
 	return false;
 }
 
-void TextureManager::UnloadTexture(const std::string& path, void* caller)
+void TextureManager::UnloadTexture(const std::string& rawPath, void* caller)
 {
+	const std::string path = NormalisePath(rawPath);
+
 	if (_textures.count(path) != 0)
 	{
 		if (_textures[path].refHolders.size() <= 1)
@@ -253,12 +399,677 @@ void TextureManager::Reset()
 		(*it).second.tex = nullptr;
 	}
 	_textures.clear();
+	_texturesByHash.clear();
+	_normalisedPaths.clear();
+
+	_scaled.clear();
+	_scaleStats = ScaleStats();
+
+	std::scoped_lock reloadLock(_reloadMutex, _streamMutex, _scaleMutex);
+	_reloadQueue.clear();
+	_reloadDecoded.clear();
+	_animations.clear();
+	_scaleQueue.clear();
+	_scaleDone.clear();
+}
+
+void TextureManager::Release(const std::set<void*>& callers)
+{
+	std::scoped_lock loadLock(_loadMutex);
+	for (auto it = _textures.begin(); it != _textures.end();)
+	{
+		for (void* caller : callers)
+			it->second.refHolders.erase(caller);
+
+		if (it->second.refHolders.empty() && it->second.busyLoading == false)
+		{
+			it->second.tex = nullptr;
+			it = _textures.erase(it);
+		}
+		else
+			it++;
+	}
+}
+
+size_t TextureManager::GetSharedBytes(int* sharedCount)
+{
+	std::scoped_lock loadLock(_loadMutex);
+
+	size_t totalBytes = 0;
+	size_t uniqueBytes = 0;
+	int shared = 0;
+	std::set<sf::Texture*> seen;
+	for (auto& item : _textures)
+	{
+		if (item.second.tex == nullptr)
+			continue;
+
+		auto size = item.second.tex->getSize();
+		size_t bytes = (size_t)size.x * size.y * 4;
+		totalBytes += bytes;
+		if (seen.insert(item.second.tex.get()).second)
+			uniqueBytes += bytes;
+		else
+			shared++;
+	}
+
+	if (sharedCount != nullptr)
+		*sharedCount = shared;
+
+	return totalBytes - uniqueBytes;
+}
+
+void TextureManager::QueueReload(const std::vector<std::string>& paths)
+{
+	std::scoped_lock reloadLock(_reloadMutex);
+
+	for (auto& path : paths)
+	{
+		if (std::find(_reloadQueue.begin(), _reloadQueue.end(), path) == _reloadQueue.end())
+			_reloadQueue.push_back(path);
+	}
+
+	if (_reloadBusy || _reloadQueue.empty())
+		return;
+
+	if (_reloadThread.joinable())
+		_reloadThread.join();
+
+	_reloadBusy = true;
+	_reloadThread = std::thread([this]() { ReloadLoop(); });
+}
+
+void TextureManager::ReloadLoop()
+{
+	while (true)
+	{
+		std::string path;
+		{
+			std::scoped_lock reloadLock(_reloadMutex);
+			if (_reloadQueue.empty())
+			{
+				_reloadBusy = false;
+				return;
+			}
+
+			path = _reloadQueue.front();
+			_reloadQueue.erase(_reloadQueue.begin());
+		}
+
+		DecodedImage img;
+		img.path = path;
+
+		std::vector<uint8_t> fileData;
+		if (!ReadFileBytes(path, fileData) || !DecodePixels(fileData, img.pixels, img.size))
+			continue;
+
+		img.hash = TextureCache::HashBytes(fileData.data(), fileData.size());
+
+		std::scoped_lock reloadLock(_reloadMutex);
+		_reloadDecoded.push_back(std::move(img));
+	}
+}
+
+std::vector<TextureManager::ReloadedTexture> TextureManager::ApplyReloads()
+{
+	std::vector<DecodedImage> decoded;
+	{
+		std::scoped_lock reloadLock(_reloadMutex);
+		decoded.swap(_reloadDecoded);
+	}
+
+	std::vector<ReloadedTexture> reloaded;
+
+	std::scoped_lock loadLock(_loadMutex);
+	for (auto& img : decoded)
+	{
+		// not loaded right now, it'll be read fresh from disk when it is
+		auto found = _textures.find(img.path);
+		if (found == _textures.end() || found->second.tex == nullptr || found->second.busyLoading)
+			continue;
+
+		TextureItem& item = found->second;
+		if (img.hash == item.hash)
+			continue;
+
+		// tiled images are picked up on the next load
+		const unsigned int maxSize = sf::Texture::getMaximumSize();
+		if (item.tiled != nullptr || img.size.x > maxSize || img.size.y > maxSize)
+			continue;
+
+		ReloadedTexture result;
+		result.path = img.path;
+		result.oldSize = FullSizeLocked(item.tex.get());
+
+		bool shared = false;
+		for (auto& other : _textures)
+		{
+			if (&other.second != &item && other.second.tex == item.tex)
+				shared = true;
+		}
+
+		std::shared_ptr<sf::Texture> tex = item.tex;
+		if (shared)
+		{
+			tex = std::make_shared<sf::Texture>();
+			tex->setSmooth(item.tex->isSmooth());
+		}
+
+		if (tex->getSize() != img.size && !tex->create(img.size.x, img.size.y))
+			continue;
+
+		tex->update(img.pixels.data());
+		_scaled.erase(tex.get());
+
+		// the old contents are no longer this hash's texture, unless other paths still use it
+		auto oldHash = _texturesByHash.find(item.hash);
+		if (!shared && oldHash != _texturesByHash.end() && oldHash->second.lock() == item.tex)
+			_texturesByHash.erase(oldHash);
+
+		item.tex = tex;
+		item.hash = img.hash;
+		_texturesByHash[img.hash] = tex;
+
+		result.tex = tex.get();
+		reloaded.push_back(result);
+
+		// sprites still playing the old file keep it until they ask again
+		std::scoped_lock streamLock(_streamMutex);
+		_animations.erase(img.path);
+	}
+
+	_lastReloads = reloaded;
+	return reloaded;
+}
+
+int TextureManager::ChooseScaleLevel(float screenScale, int currentLevel)
+{
+	const float hysteresis = 0.15f;
+
+	if (screenScale <= 0)
+		return currentLevel;
+
+	// keep the current level while it's neither clearly too small nor clearly more than needed
+	float levelScale = 1.f / (1 << currentLevel);
+	bool tooSmall = currentLevel > 0 && screenScale > levelScale * (1.f + hysteresis);
+	bool tooLarge = currentLevel < MaxScaleLevel && screenScale < levelScale * 0.5f * (1.f - hysteresis);
+	if (!tooSmall && !tooLarge)
+		return currentLevel;
+
+	int level = (int)std::floor(std::log2(1.f / screenScale));
+	return std::clamp(level, 0, MaxScaleLevel);
+}
+
+void TextureManager::Premultiply(const uint8_t* src, uint8_t* dst, size_t pixelCount)
+{
+	for (size_t i = 0; i < pixelCount * 4; i += 4)
+	{
+		const uint8_t a = src[i + 3];
+		const float alpha = (float)a / 255;
+		dst[i] = (sf::Uint8)((float)src[i] * alpha);
+		dst[i + 1] = (sf::Uint8)((float)src[i + 1] * alpha);
+		dst[i + 2] = (sf::Uint8)((float)src[i + 2] * alpha);
+		dst[i + 3] = a;
+	}
+}
+
+void TextureManager::Unpremultiply(uint8_t* pixels, size_t pixelCount)
+{
+	for (size_t i = 0; i < pixelCount * 4; i += 4)
+	{
+		const unsigned int a = pixels[i + 3];
+		if (a == 255)
+			continue;
+
+		for (int c = 0; c < 3; c++)
+			pixels[i + c] = a == 0 ? 0 : (uint8_t)std::min(255u, (pixels[i + c] * 255 + a / 2) / a);
+	}
+}
+
+void TextureManager::HalveImage(const std::vector<uint8_t>& src, const sf::Vector2u& srcSize, std::vector<uint8_t>& dst, sf::Vector2u& dstSize)
+{
+	dstSize = { (srcSize.x + 1) / 2, (srcSize.y + 1) / 2 };
+	dst.resize((size_t)dstSize.x * dstSize.y * 4);
+
+	for (unsigned int y = 0; y < dstSize.y; y++)
+	{
+		// the last row and column of odd sizes are averaged with themselves
+		const uint8_t* row0 = src.data() + (size_t)(y * 2) * srcSize.x * 4;
+		const uint8_t* row1 = src.data() + (size_t)std::min(y * 2 + 1, srcSize.y - 1) * srcSize.x * 4;
+		uint8_t* out = dst.data() + (size_t)y * dstSize.x * 4;
+
+		for (unsigned int x = 0; x < dstSize.x; x++)
+		{
+			size_t x0 = (size_t)x * 2 * 4;
+			size_t x1 = (size_t)std::min(x * 2 + 1, srcSize.x - 1) * 4;
+			for (int c = 0; c < 4; c++)
+				out[x * 4 + c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
+		}
+	}
+}
+
+static double Lanczos3(double x)
+{
+	if (x == 0)
+		return 1;
+	if (x <= -3 || x >= 3)
+		return 0;
+
+	const double px = 3.14159265358979323846 * x;
+	return 3 * std::sin(px) * std::sin(px / 3) / (px * px);
+}
+
+typedef std::vector<std::pair<unsigned int, float>> FilterTaps;
+
+// The source pixels, and their weights, that each output pixel along one axis is made from.
+// Taps past the edge of the output pixel's cell repeat the edge instead.
+static void BuildFilter(unsigned int srcSize, unsigned int dstSize, int cell, int level, std::vector<FilterTaps>& taps)
+{
+	const unsigned int srcCell = cell > 0 ? (unsigned int)cell : srcSize;
+	const unsigned int dstCell = cell > 0 ? (unsigned int)cell >> level : dstSize;
+	const double scale = (double)srcCell / dstCell;
+	const double support = 3 * scale;
+
+	taps.assign(dstSize, {});
+	for (unsigned int d = 0; d < dstSize; d++)
+	{
+		const int cellStart = (int)((d / dstCell) * srcCell);
+		const int cellEnd = (int)std::min(cellStart + srcCell, srcSize);
+		const double center = cellStart + ((d % dstCell) + 0.5) * scale;
+
+		double total = 0;
+		for (int s = (int)std::floor(center - support); s <= (int)std::ceil(center + support); s++)
+		{
+			const double weight = Lanczos3((s + 0.5 - center) / scale);
+			if (weight == 0)
+				continue;
+
+			taps[d].push_back({ (unsigned int)std::clamp(s, cellStart, cellEnd - 1), (float)weight });
+			total += weight;
+		}
+
+		for (auto& tap : taps[d])
+			tap.second = (float)(tap.second / total);
+	}
+}
+
+void TextureManager::DownscaleImage(const std::vector<uint8_t>& src, const sf::Vector2u& srcSize, int level, const sf::Vector2i& cell, std::vector<uint8_t>& dst, sf::Vector2u& dstSize)
+{
+	const unsigned int roundUp = (1u << level) - 1;
+	dstSize = { (srcSize.x + roundUp) >> level, (srcSize.y + roundUp) >> level };
+	dst.resize((size_t)dstSize.x * dstSize.y * 4);
+
+	std::vector<FilterTaps> tapsX;
+	std::vector<FilterTaps> tapsY;
+	BuildFilter(srcSize.x, dstSize.x, cell.x, level, tapsX);
+	BuildFilter(srcSize.y, dstSize.y, cell.y, level, tapsY);
+
+	// a row at a time: the source rows it's made from are filtered into one, then that's filtered across
+	std::vector<float> filteredRow((size_t)srcSize.x * 4);
+	for (unsigned int y = 0; y < dstSize.y; y++)
+	{
+		std::fill(filteredRow.begin(), filteredRow.end(), 0.f);
+		for (auto& tap : tapsY[y])
+		{
+			const uint8_t* row = src.data() + (size_t)tap.first * srcSize.x * 4;
+			for (size_t i = 0; i < filteredRow.size(); i++)
+				filteredRow[i] += row[i] * tap.second;
+		}
+
+		uint8_t* out = dst.data() + (size_t)y * dstSize.x * 4;
+		for (unsigned int x = 0; x < dstSize.x; x++)
+		{
+			float sum[4] = {};
+			for (auto& tap : tapsX[x])
+			{
+				for (int c = 0; c < 4; c++)
+					sum[c] += filteredRow[(size_t)tap.first * 4 + c] * tap.second;
+			}
+
+			// the filter rings a little around hard edges, and a premultiplied colour can't be brighter than its alpha
+			const float alpha = std::clamp(sum[3], 0.f, 255.f);
+			out[x * 4 + 3] = (uint8_t)(alpha + 0.5f);
+			for (int c = 0; c < 3; c++)
+				out[x * 4 + c] = (uint8_t)(std::clamp(sum[c], 0.f, alpha) + 0.5f);
+		}
+	}
+}
+
+int TextureManager::MaxScaleLevelForFrame(const sf::Vector2i& frameSize)
+{
+	int level = 0;
+	while (level < MaxScaleLevel && frameSize.x > 0 && frameSize.y > 0
+		&& frameSize.x % (2 << level) == 0 && frameSize.y % (2 << level) == 0)
+		level++;
+
+	return level;
+}
+
+int TextureManager::UseScaledLevel(const std::string& rawPath, int level, const sf::Vector2i& cell)
+{
+	const std::string path = NormalisePath(rawPath);
+
+	std::scoped_lock loadLock(_loadMutex);
+
+	auto found = _textures.find(path);
+	if (found == _textures.end() || found->second.tex == nullptr || found->second.hash == 0 || found->second.tiled != nullptr)
+		return 0;
+
+	const std::shared_ptr<sf::Texture>& tex = found->second.tex;
+	ScaledItem& item = _scaled[tex.get()];
+	if (item.tex.lock() != tex || item.hash != found->second.hash || tex->getSize() != item.storedSize)
+	{
+		// new, reloaded, or replaced from outside like a crop: what's on the GPU now is the full image
+		item = ScaledItem();
+		item.tex = tex;
+		item.path = path;
+		item.hash = found->second.hash;
+		item.fullSize = tex->getSize();
+		item.storedSize = item.fullSize;
+	}
+
+	// sprites cutting the image into different frames keep to the edges their frames have in common
+	if (cell.x > 0 && cell.y > 0)
+		item.cell = item.cell.x > 0 ? sf::Vector2i(std::gcd(item.cell.x, cell.x), std::gcd(item.cell.y, cell.y)) : cell;
+
+	const int maxLevel = item.cell.x > 0 ? MaxScaleLevelForFrame(item.cell) : MaxScaleLevel;
+	level = std::clamp(std::min(level, maxLevel), 0, MaxScaleLevel);
+
+	// not worth it for small images
+	while (level > 0 && ((item.fullSize.x >> level) < 16 || (item.fullSize.y >> level) < 16))
+		level--;
+
+	item.frameLevel = item.lastUsedFrame == _scaleFrame ? std::min(item.frameLevel, level) : level;
+	item.lastUsedFrame = _scaleFrame;
+
+	return item.level;
+}
+
+sf::Vector2u TextureManager::FullSizeLocked(const sf::Texture* tex)
+{
+	auto found = _scaled.find(tex);
+	if (found != _scaled.end() && found->second.level > 0 && found->second.storedSize == tex->getSize())
+		return found->second.fullSize;
+
+	return tex->getSize();
+}
+
+sf::Vector2u TextureManager::GetFullSize(const sf::Texture* tex)
+{
+	if (tex == nullptr)
+		return {};
+
+	std::scoped_lock loadLock(_loadMutex);
+	return FullSizeLocked(tex);
+}
+
+void TextureManager::QueueScale(ScaledItem& item, const sf::Texture* key, int level)
+{
+	item.pending = level;
+	item.settleFrames = 0;
+
+	ScaleJob job;
+	job.key = key;
+	job.path = item.path;
+	job.hash = item.hash;
+	job.level = level;
+	job.fullSize = item.fullSize;
+	job.cell = item.cell;
+
+	std::scoped_lock scaleLock(_scaleMutex);
+
+	// a level for the same texture that hasn't started yet isn't wanted any more
+	_scaleQueue.erase(std::remove_if(_scaleQueue.begin(), _scaleQueue.end(), [key](const ScaleJob& queued) { return queued.key == key; }), _scaleQueue.end());
+	_scaleQueue.push_back(std::move(job));
+
+	if (_scaleBusy)
+		return;
+
+	if (_scaleThread.joinable())
+		_scaleThread.join();
+
+	_scaleBusy = true;
+	_scaleThread = std::thread([this]() { ScaleLoop(); });
+}
+
+void TextureManager::ScaleLoop()
+{
+	while (true)
+	{
+		ScaleJob job;
+		{
+			std::scoped_lock scaleLock(_scaleMutex);
+			if (_scaleQueue.empty())
+			{
+				_scaleBusy = false;
+				return;
+			}
+
+			job = std::move(_scaleQueue.front());
+			_scaleQueue.erase(_scaleQueue.begin());
+		}
+
+		sf::Clock timer;
+
+		// the full image comes from the layer set's cache if it's there, otherwise from the file,
+		// as long as it's still the image on the GPU
+		std::vector<uint8_t> full;
+		sf::Vector2u fullSize;
+		bool read = _cache.CopyPixels(job.path, job.hash, full, fullSize);
+		if (!read)
+		{
+			std::vector<uint8_t> fileData;
+			read = ReadFileBytes(job.path, fileData) && TextureCache::HashBytes(fileData.data(), fileData.size()) == job.hash
+				&& DecodePixels(fileData, full, fullSize);
+		}
+
+		if (read && fullSize == job.fullSize)
+		{
+			if (job.level > 0)
+			{
+				DownscaleImage(full, fullSize, job.level, job.cell, job.pixels, job.size);
+			}
+			else
+			{
+				job.pixels.swap(full);
+				job.size = fullSize;
+			}
+		}
+		job.ms = timer.getElapsedTime().asMicroseconds() / 1000.f;
+
+		std::scoped_lock scaleLock(_scaleMutex);
+		_scaleDone.push_back(std::move(job));
+	}
+}
+
+void TextureManager::UpdateScaledTextures(bool enabled)
+{
+	std::vector<ScaleJob> done;
+	{
+		std::scoped_lock scaleLock(_scaleMutex);
+		done.swap(_scaleDone);
+	}
+
+	std::scoped_lock loadLock(_loadMutex);
+
+	for (auto& job : done)
+	{
+		auto found = _scaled.find(job.key);
+		if (found == _scaled.end())
+			continue;
+
+		// dropped, reloaded or asked for another level since this was started
+		ScaledItem& item = found->second;
+		std::shared_ptr<sf::Texture> tex = item.tex.lock();
+		if (tex == nullptr || item.hash != job.hash || item.pending != job.level || tex->getSize() != item.storedSize)
+			continue;
+
+		item.pending = -1;
+
+		// the file changed or went away, the hot reload brings in the new one
+		if (job.pixels.empty())
+		{
+			item.failed = true;
+			continue;
+		}
+
+		// in place, so every sprite holding the texture draws the new level
+		if (!tex->create(job.size.x, job.size.y))
+		{
+			item.failed = true;
+			continue;
+		}
+
+		tex->update(job.pixels.data());
+		item.level = job.level;
+		item.storedSize = job.size;
+
+		_scaleStats.built++;
+		_scaleStats.buildMs += (job.ms - _scaleStats.buildMs) / _scaleStats.built;
+	}
+
+	const int drawnFrame = _scaleFrame;
+	_scaleFrame++;
+
+	_scaleStats.count = 0;
+	_scaleStats.fullBytes = 0;
+	_scaleStats.storedBytes = 0;
+	_scaleStats.pending = 0;
+
+	for (auto it = _scaled.begin(); it != _scaled.end();)
+	{
+		ScaledItem& item = it->second;
+		const bool drawn = item.lastUsedFrame == drawnFrame;
+
+		// gone, or at full size and not drawn for a while, so there's nothing to keep track of
+		if (item.tex.expired() || (item.level == 0 && item.pending == -1 && drawnFrame - item.lastUsedFrame > ScaleSettleFrames))
+		{
+			it = _scaled.erase(it);
+			continue;
+		}
+
+		// images nobody is drawing stay at the level they're at, as do ones that couldn't be read until a reload replaces them
+		int wanted = item.level;
+		if (item.failed)
+			wanted = item.level;
+		else if (!enabled)
+			wanted = 0;
+		else if (drawn)
+			wanted = item.frameLevel;
+
+		if (wanted < item.level)
+		{
+			// a sprite needs more detail: start now, and draw the current level meanwhile
+			if (item.pending != wanted)
+				QueueScale(item, it->first, wanted);
+		}
+		else if (wanted > item.level)
+		{
+			// only go smaller once every sprite has kept it small for a while
+			item.settleLevel = item.settleFrames == 0 ? wanted : std::min(item.settleLevel, wanted);
+			item.settleFrames++;
+			if (item.settleFrames >= ScaleSettleFrames && item.pending != item.settleLevel)
+				QueueScale(item, it->first, item.settleLevel);
+		}
+		else
+		{
+			// back to the level it's at, anything on its way isn't wanted
+			item.settleFrames = 0;
+			item.pending = -1;
+		}
+
+		if (item.level > 0)
+		{
+			_scaleStats.count++;
+			_scaleStats.fullBytes += (size_t)item.fullSize.x * item.fullSize.y * 4;
+			_scaleStats.storedBytes += (size_t)item.storedSize.x * item.storedSize.y * 4;
+		}
+		if (item.pending != -1)
+			_scaleStats.pending++;
+
+		it++;
+	}
+}
+
+std::shared_ptr<AnimationStream> TextureManager::GetStream(const std::string& rawPath, std::string& error)
+{
+	const std::string path = NormalisePath(rawPath);
+
+	std::scoped_lock streamLock(_streamMutex);
+
+	std::shared_ptr<const AnimationDecoder> source;
+	auto found = _animations.find(path);
+	if (found != _animations.end())
+		source = found->second.lock();
+
+	if (source == nullptr)
+	{
+		source = AnimationStream::Load(path, error);
+		if (source == nullptr)
+		{
+			_animations.erase(path);
+			return nullptr;
+		}
+		_animations[path] = source;
+	}
+
+	// the stream's copy of the decoder holds the file for as long as it plays
+	auto stream = std::make_shared<AnimationStream>();
+	stream->Open(source);
+	return stream;
+}
+
+TiledTexture* TextureManager::GetTiled(const std::string& rawPath)
+{
+	const std::string path = NormalisePath(rawPath);
+
+	std::scoped_lock loadLock(_loadMutex);
+	auto found = _textures.find(path);
+	if (found == _textures.end())
+		return nullptr;
+
+	return found->second.tiled.get();
+}
+
+void TextureManager::ReleaseUnusedTiles()
+{
+	std::scoped_lock loadLock(_loadMutex);
+	for (auto& item : _textures)
+	{
+		if (item.second.tiled != nullptr)
+			item.second.tiled->ReleaseUnused(3.f);
+	}
+}
+
+size_t TextureManager::GetTiledBytes(int* tiledImages, int* loadedTiles)
+{
+	std::scoped_lock loadLock(_loadMutex);
+
+	size_t bytes = 0;
+	int images = 0;
+	int tiles = 0;
+	for (auto& item : _textures)
+	{
+		if (item.second.tiled == nullptr)
+			continue;
+
+		images++;
+		tiles += item.second.tiled->LoadedTiles();
+		bytes += item.second.tiled->LoadedBytes();
+	}
+
+	if (tiledImages != nullptr)
+		*tiledImages = images;
+	if (loadedTiles != nullptr)
+		*loadedTiles = tiles;
+
+	return bytes;
 }
 
-sf::Texture* TextureManager::GetIcon(IconID id)
+const sf::Sprite* TextureManager::GetIcon(IconID id)
 {
 	if (_icons.count(id))
-		return _icons[id];
+		return &_icons[id];
 
 	return nullptr;
 }
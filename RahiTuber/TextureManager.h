@@ -4,17 +4,26 @@
 #include "SFML/Main.hpp"
 #include "SFML/System.hpp"
 
+#include "TextureCache.h"
+#include "TiledTexture.h"
+
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <thread>
 
 #ifndef _WIN32
 typedef  __uint32_t uint32_t;
 typedef  __uint8_t uint8_t;
 #endif
 
+struct ImFontAtlas;
+class AnimationDecoder;
+class AnimationStream;
+
 static uint32_t _ntohl(uint32_t const net) {
 	uint8_t data[4] = {};
     std::memcpy(&data, &net, sizeof(data));
@@ -29,6 +38,8 @@ class TextureManager
 {
 public:
 
+	~TextureManager();
+
 	enum IconID {
 		ICON_EMPTY,
 		ICON_ANIM,
@@ -62,34 +73,248 @@ public:
 		ICON_TAG
 	};
 
+	// Uploads the editor icons, pre-packed into one texture by res/pack_icons.py
 	void LoadIcons(const std::string& appLocation);
 
-	sf::Texture* GetTexture(const std::string& path, void* caller, std::string* errString = nullptr);
+	sf::Texture* GetTexture(const std::string& rawPath, void* caller, std::string* errString = nullptr);
 
 
 	bool LoadTexture(const std::string& path, void* caller, std::string* errString = nullptr);
-	bool LoadIcon(const std::string& path, sf::Texture*& storage);
 
-	void UnloadTexture(const std::string& path, void* caller);
+	void UnloadTexture(const std::string& rawPath, void* caller);
 
 	void Reset();
 
-	sf::Texture* GetIcon(IconID id);
+	// Layer managers drawing from this cache. While there's more than one, a layer manager loading a
+	// new set releases its own textures rather than resetting everyone's.
+	inline void AddUser() { _users++; }
+	inline void RemoveUser() { _users--; }
+	inline int Users() const { return _users; }
+
+	// Drops these callers' holds, and frees the textures no one else is holding
+	void Release(const std::set<void*>& callers);
+
+	// The icon's region of the atlas, for the sf::Sprite overloads of ImGui::Image and ImageButton
+	const sf::Sprite* GetIcon(IconID id);
+
+	// A texture of its own, for sprites with no image loaded
+	sf::Texture* GetEmptyTexture() { return &_emptyTexture; }
+
+	// ImGui batches by texture, and every button frame and label uses the font texture, so the icons
+	// are packed into the font atlas as well. Space is reserved before the atlas is built, and once it
+	// is built the icons are copied in and pointed at the font texture.
+	// Each icon's edge is repeated into a pixel around it, so smooth filtering doesn't pick up the glyphs next to it.
+	static constexpr int IconFontPadding = 1;
+	void AddIconsToFontAtlas(ImFontAtlas* atlas);
+	void CopyIconsToFontAtlas(ImFontAtlas* atlas, unsigned char* rgbaPixels, int width, const sf::Texture* fontTexture);
+
+	// Points the icons back at their own atlas, for when the font atlas couldn't be built
+	void UseStandaloneIcons();
+
+	// Copies width x height RGBA pixels to dst at (x, y), repeating the edge rows and columns pad pixels out
+	static void CopyWithEdges(const uint8_t* src, int width, int height, uint8_t* dst, int dstWidth, int x, int y, int pad);
+
+	// Decoded images are read from and added to this cache between BeginCache and FinishCache
+	void BeginCache(const std::filesystem::path& cachePath) { _cache.Begin(cachePath); }
+	bool FinishCache() { return _cache.Finish(); }
+	void CloseCache() { _cache.Close(); }
+	const TextureCache& GetCache() const { return _cache; }
+
+	// Video memory not spent thanks to identical images sharing one texture
+	size_t GetSharedBytes(int* sharedCount = nullptr);
+
+	// Key used for a path, the same for every spelling of one file
+	std::string NormalisePath(const std::string& path);
+
+	struct ReloadedTexture
+	{
+		std::string path = "";
+		sf::Texture* tex = nullptr;
+		sf::Vector2u oldSize = {};
+	};
+
+	// Decodes changed image files in the background...
+	void QueueReload(const std::vector<std::string>& paths);
+
+	// ...and swaps them in on the render thread. A texture only used by this path is updated in place,
+	// one shared with other identical images gets a new texture, so anything drawing the path must be
+	// pointed at the returned texture. Unchanged files are skipped.
+	std::vector<ReloadedTexture> ApplyReloads();
+
+	// What the last ApplyReloads swapped in, for other layer managers drawing the same paths
+	inline const std::vector<ReloadedTexture>& LastReloads() const { return _lastReloads; }
+
+	// Smooth-filtered images that every sprite draws well below their full size are stored on the GPU
+	// at a smaller level (1/2, 1/4...) in place of the full image. Level L is 1/2^L of the full resolution.
+	static constexpr int MaxScaleLevel = 4;
+
+	// How many frames in a row an image must be drawn small before it's swapped for a smaller level.
+	// Going back up to a larger level is started as soon as a sprite asks for it.
+	static constexpr int ScaleSettleFrames = 120;
+
+	// Oversized images: the largest tile uploaded at once, and the size of their preview texture
+	static constexpr int MaxTileSize = 4096;
+	static constexpr int PreviewSize = 2048;
+
+	// Picks a level for a sprite's on-screen scale, staying on the current one until the scale is clearly past it
+	static int ChooseScaleLevel(float screenScale, int currentLevel);
+
+	// Straight RGBA to premultiplied, for pixelCount pixels. src and dst may be the same buffer.
+	static void Premultiply(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+	// Premultiplied RGBA back to straight, in place. Fully transparent pixels become transparent black.
+	static void Unpremultiply(uint8_t* pixels, size_t pixelCount);
+
+	// Box-filters premultiplied RGBA to half size, rounding odd sizes up
+	static void HalveImage(const std::vector<uint8_t>& src, const sf::Vector2u& srcSize, std::vector<uint8_t>& dst, sf::Vector2u& dstSize);
+
+	// Lanczos-3 filters premultiplied RGBA down to 1/2^level, rounding sizes up. A sprite sheet passes its
+	// frame size as cell, which must be a multiple of 2^level, so no frame picks up its neighbours' edges.
+	// A cell of 0 filters the image as one.
+	static void DownscaleImage(const std::vector<uint8_t>& src, const sf::Vector2u& srcSize, int level, const sf::Vector2i& cell, std::vector<uint8_t>& dst, sf::Vector2u& dstSize);
+
+	// The deepest level a sprite sheet can use without its frames bleeding into each other:
+	// each texel of level L covers 2^L pixels, so the frame size must be a multiple of that.
+	static int MaxScaleLevelForFrame(const sf::Vector2i& frameSize);
+
+	// A sprite draws the texture at level this frame, 0 for full size. cell is its sheet's frame size, 0 for
+	// a single image. Returns the level the texture is stored at right now, which the sprite must scale its
+	// texture rect by. Images drawn at a smaller level for ScaleSettleFrames are rebuilt at that level on a
+	// worker and replace the full-size upload.
+	int UseScaledLevel(const std::string& rawPath, int level, const sf::Vector2i& cell);
+
+	// The size of the image a texture holds, whatever level it's stored at
+	sf::Vector2u GetFullSize(const sf::Texture* tex);
+
+	// Once per frame before drawing: swaps in the levels the worker has finished and starts new ones.
+	// When disabled every image goes back to full size.
+	void UpdateScaledTextures(bool enabled);
+
+	struct ScaleStats
+	{
+		int count = 0;					// images stored below full size
+		size_t fullBytes = 0;			// what those images take at full size...
+		size_t storedBytes = 0;			// ...and what they take now
+		int pending = 0;
+		int built = 0;
+		float buildMs = 0.f;			// worker time per level, on average
+	};
+
+	ScaleStats GetScaleStats() const { return _scaleStats; }
+
+	// Set for images larger than the maximum texture size, which are drawn from tiles instead of the texture
+	TiledTexture* GetTiled(const std::string& rawPath);
+
+	// Animated GIFs and APNGs: a new stream for each sprite, all playing the one copy of the file.
+	// nullptr if the file doesn't open as an animation. A reload reads the file again for the next caller.
+	std::shared_ptr<AnimationStream> GetStream(const std::string& rawPath, std::string& error);
+
+	// Once per frame: frees tiles that haven't been drawn for a few seconds
+	void ReleaseUnusedTiles();
+
+	// Video memory used by tiles, and how many images are tiled
+	size_t GetTiledBytes(int* tiledImages = nullptr, int* loadedTiles = nullptr);
 
 private:
 
 	struct TextureItem {
-		std::unique_ptr<sf::Texture> tex;
+		std::shared_ptr<sf::Texture> tex;
 		std::map<void*, bool> refHolders;
 		bool busyLoading = false;
+		uint64_t hash = 0;
+
+		// images larger than the GPU allows: tex is a scaled-down preview and frames are drawn from tiles
+		std::shared_ptr<TiledTexture> tiled;
 	};
 
+	// keyed by normalised path
 	std::map<std::string, TextureItem> _textures;
+	std::unordered_map<uint64_t, std::weak_ptr<sf::Texture>> _texturesByHash;
+	std::unordered_map<std::string, std::string> _normalisedPaths;
+
+	int _users = 0;
 
-	std::map<IconID, sf::Texture*> _icons;
+	bool DecodeTexture(const std::string& path, const std::vector<uint8_t>& fileData, uint64_t hash, sf::Texture& tex, std::shared_ptr<TiledTexture>& tiled);
+
+	std::map<IconID, sf::Sprite> _icons;
+	std::map<IconID, sf::Image> _iconImages;
+	std::map<IconID, int> _iconFontRects;		// custom rect index in the font atlas
+	std::map<IconID, sf::IntRect> _iconAtlasRects;	// in _iconAtlas
+	sf::Texture _iconAtlas;
+	sf::Texture _emptyTexture;
 
 	std::mutex _loadMutex;
 
+	TextureCache _cache;
+
+	struct DecodedImage
+	{
+		std::string path = "";
+		uint64_t hash = 0;
+		sf::Vector2u size = {};
+		std::vector<uint8_t> pixels;
+	};
+
+	void ReloadLoop();
+
+	std::thread _reloadThread;
+	std::mutex _reloadMutex;
+	std::vector<std::string> _reloadQueue;
+	std::vector<DecodedImage> _reloadDecoded;
+	bool _reloadBusy = false;
+	std::vector<ReloadedTexture> _lastReloads;
+
+	std::mutex _streamMutex;
+	std::map<std::string, std::weak_ptr<const AnimationDecoder>> _animations;
+
+	struct ScaledItem
+	{
+		std::weak_ptr<sf::Texture> tex;
+		std::string path = "";
+		uint64_t hash = 0;				// a reload in place puts the full image back, and changes this
+		sf::Vector2u fullSize = {};
+		sf::Vector2u storedSize = {};	// anything else on the GPU means the texture was replaced from outside
+		sf::Vector2i cell = {};
+		int level = 0;
+		int pending = -1;				// level being built on the worker
+		bool failed = false;
+
+		int lastUsedFrame = -1;
+		int frameLevel = 0;				// the lowest level any sprite drew it at this frame, the sharpest one wins
+		int settleLevel = 0;			// the lowest level it has been drawn at while settling
+		int settleFrames = 0;
+	};
+
+	struct ScaleJob
+	{
+		const sf::Texture* key = nullptr;
+		std::string path = "";
+		uint64_t hash = 0;
+		int level = 0;
+		sf::Vector2u fullSize = {};
+		sf::Vector2i cell = {};
+
+		// filled in by the worker, empty if the image couldn't be read
+		sf::Vector2u size = {};
+		std::vector<uint8_t> pixels;
+		float ms = 0.f;
+	};
+
+	sf::Vector2u FullSizeLocked(const sf::Texture* tex);
+	void QueueScale(ScaledItem& item, const sf::Texture* key, int level);
+	void ScaleLoop();
+
+	// keyed by texture, so identical images share them
+	std::map<const sf::Texture*, ScaledItem> _scaled;
+	int _scaleFrame = 0;
+	ScaleStats _scaleStats;
+
+	std::thread _scaleThread;
+	std::mutex _scaleMutex;
+	std::vector<ScaleJob> _scaleQueue;
+	std::vector<ScaleJob> _scaleDone;
+	bool _scaleBusy = false;
+
 	sf::Vector2i GetDimensions(const char* path) 
 	{
 		std::ifstream in(path);
@@ -0,0 +1,100 @@
+#include "TiledTexture.h"
+
+#include <algorithm>
+#include <cstring>
+
+TiledTexture::TiledTexture(std::vector<uint8_t>&& pixels, const sf::Vector2u& size, unsigned int maxTileSize)
+	: _pixels(std::move(pixels)), _size(size), _maxTileSize(maxTileSize)
+{
+}
+
+sf::IntRect TiledTexture::TileArea(const sf::IntRect& rect) const
+{
+	const int maxTile = (int)_maxTileSize;
+	const int width = (int)_size.x;
+	const int height = (int)_size.y;
+
+	// as many whole frames as fit, starting from a multiple of that block, so neighbouring frames share the tile
+	int cols = std::max(1, maxTile / rect.width);
+	int rows = std::max(1, maxTile / rect.height);
+	int blockW = rect.width * cols;
+	int blockH = rect.height * rows;
+
+	sf::IntRect area((rect.left / blockW) * blockW, (rect.top / blockH) * blockH, 0, 0);
+	area.width = std::min(blockW, width - area.left);
+	area.height = std::min(blockH, height - area.top);
+
+	// frames that aren't on a whole-pixel grid can straddle blocks, they get a tile starting at their own corner
+	if (rect.left + rect.width > area.left + area.width || rect.top + rect.height > area.top + area.height)
+	{
+		area = sf::IntRect(rect.left, rect.top, std::min(maxTile, width - rect.left), std::min(maxTile, height - rect.top));
+	}
+
+	return area;
+}
+
+sf::Texture* TiledTexture::GetTile(const sf::IntRect& rect, sf::IntRect& localRect)
+{
+	if (rect.width <= 0 || rect.height <= 0 || rect.left < 0 || rect.top < 0
+		|| rect.left + rect.width > (int)_size.x || rect.top + rect.height > (int)_size.y
+		|| rect.width > (int)_maxTileSize || rect.height > (int)_maxTileSize)
+		return nullptr;
+
+	const sf::IntRect area = TileArea(rect);
+	Tile& tile = _tiles[{ area.left, area.top, area.width, area.height }];
+
+	if (tile.tex == nullptr)
+	{
+		auto tex = std::make_unique<sf::Texture>();
+		if (!tex->create(area.width, area.height))
+		{
+			_tiles.erase({ area.left, area.top, area.width, area.height });
+			return nullptr;
+		}
+
+		std::vector<uint8_t> tilePixels((size_t)area.width * area.height * 4);
+		for (int y = 0; y < area.height; y++)
+		{
+			const uint8_t* src = _pixels.data() + ((size_t)(area.top + y) * _size.x + area.left) * 4;
+			std::memcpy(tilePixels.data() + (size_t)y * area.width * 4, src, (size_t)area.width * 4);
+		}
+
+		tex->update(tilePixels.data());
+		tex->setSmooth(_smooth);
+
+		tile.area = area;
+		tile.tex = std::move(tex);
+		_uploads++;
+	}
+
+	tile.lastUsed.restart();
+
+	localRect = sf::IntRect(rect.left - area.left, rect.top - area.top, rect.width, rect.height);
+	return tile.tex.get();
+}
+
+void TiledTexture::SetSmooth(bool smooth)
+{
+	_smooth = smooth;
+	for (auto& tile : _tiles)
+		tile.second.tex->setSmooth(smooth);
+}
+
+void TiledTexture::ReleaseUnused(float seconds)
+{
+	for (auto it = _tiles.begin(); it != _tiles.end();)
+	{
+		if (it->second.lastUsed.getElapsedTime().asSeconds() >= seconds)
+			it = _tiles.erase(it);
+		else
+			it++;
+	}
+}
+
+size_t TiledTexture::LoadedBytes() const
+{
+	size_t bytes = 0;
+	for (auto& tile : _tiles)
+		bytes += (size_t)tile.second.area.width * tile.second.area.height * 4;
+	return bytes;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "SFML/Graphics/Rect.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/System/Clock.hpp"
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+// An image too large for one GPU texture, kept in RAM and uploaded in tiles as they're drawn.
+// Tiles are cut along the frame grid of whatever is drawn from them, so a sprite sheet frame
+// always sits inside a single tile and only the parts of a long animation in use take up video memory.
+class TiledTexture
+{
+public:
+
+	// Pixels are premultiplied RGBA
+	TiledTexture(std::vector<uint8_t>&& pixels, const sf::Vector2u& size, unsigned int maxTileSize);
+
+	inline sf::Vector2u Size() const { return _size; }
+	inline unsigned int MaxTileSize() const { return _maxTileSize; }
+
+	// The tile holding rect, uploading it if needed, with rect relative to the tile in localRect.
+	// nullptr if rect is empty, outside the image, or larger than a tile can be.
+	sf::Texture* GetTile(const sf::IntRect& rect, sf::IntRect& localRect);
+
+	void SetSmooth(bool smooth);
+
+	// Frees tiles that haven't been drawn for this long
+	void ReleaseUnused(float seconds);
+
+	inline int LoadedTiles() const { return (int)_tiles.size(); }
+	size_t LoadedBytes() const;
+	inline int Uploads() const { return _uploads; }
+
+private:
+
+	struct Tile
+	{
+		sf::IntRect area = sf::IntRect(0, 0, 0, 0);
+		std::unique_ptr<sf::Texture> tex;
+		sf::Clock lastUsed;
+	};
+
+	sf::IntRect TileArea(const sf::IntRect& rect) const;
+
+	std::vector<uint8_t> _pixels;
+	sf::Vector2u _size;
+	unsigned int _maxTileSize = 0;
+	bool _smooth = false;
+	int _uploads = 0;
+
+	// keyed by tile area
+	std::map<std::tuple<int, int, int, int>, Tile> _tiles;
+};
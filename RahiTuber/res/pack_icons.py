@@ -0,0 +1,118 @@
+# Packs the editor icons into one PNG and writes it into IconAtlas.h, so they're compiled into the
+# binary and decoded in one go at startup. Run it again after changing or adding an icon:
+#
+#   python pack_icons.py                 writes ../IconAtlas.h
+#   python pack_icons.py --png icons.png also writes the atlas out, to edit and drop into res/ as an override
+#
+# Needs Pillow. The icons are listed in IconFiles in TextureManager.cpp, by file name.
+
+import argparse
+import io
+import os
+import sys
+
+from PIL import Image
+
+ICONS = [
+	"anim.png", "empty.png", "arrowup.png", "arrowdn.png", "edit.png", "delete.png", "duplicate.png",
+	"new_file.png", "open.png", "save.png", "save_as.png", "make_portable.png", "reload.png",
+	"new_layer.png", "new_folder.png", "states.png", "reset.png", "plus.png", "lock_open.png",
+	"lock_closed.png", "eye_open.png", "eye_closed.png", "pin.png", "pin_off.png", "refresh.png",
+	"move.png", "drop.png", "filter_on.png", "filter_off.png", "tag.png",
+]
+
+# space between icons, and how far each icon's edge is repeated into it so smooth filtering doesn't
+# pick up the neighbours
+PADDING = 2
+EDGE = 1
+
+
+def pack(sizes, padding):
+	# rows, tallest first, in a power of two wide atlas that comes out roughly square
+	area = sum((w + padding) * (h + padding) for w, h in sizes)
+	widest = max(w + padding * 2 for w, h in sizes)
+	width = 1
+	while width < widest or width * width < area:
+		width *= 2
+
+	order = sorted(range(len(sizes)), key=lambda i: -sizes[i][1])
+	positions = [None] * len(sizes)
+	x = y = padding
+	row_height = 0
+	for i in order:
+		w, h = sizes[i]
+		if x + w + padding > width:
+			x = padding
+			y += row_height + padding
+			row_height = 0
+		positions[i] = (x, y)
+		x += w + padding
+		row_height = max(row_height, h)
+
+	return positions, (width, y + row_height + padding)
+
+
+def main():
+	here = os.path.dirname(os.path.abspath(__file__))
+	parser = argparse.ArgumentParser()
+	parser.add_argument("--header", default=os.path.join(here, "..", "IconAtlas.h"))
+	parser.add_argument("--png")
+	args = parser.parse_args()
+
+	images = [Image.open(os.path.join(here, name)).convert("RGBA") for name in ICONS]
+	positions, size = pack([img.size for img in images], PADDING)
+
+	atlas = Image.new("RGBA", size, (0, 0, 0, 0))
+	for img, (x, y) in zip(images, positions):
+		w, h = img.size
+		atlas.paste(img, (x, y))
+		for p in range(1, EDGE + 1):
+			atlas.paste(img.crop((0, 0, w, 1)), (x, y - p))
+			atlas.paste(img.crop((0, h - 1, w, h)), (x, y + h - 1 + p))
+		for p in range(1, EDGE + 1):
+			atlas.paste(atlas.crop((x, y - EDGE, x + 1, y + h + EDGE)), (x - p, y - EDGE))
+			atlas.paste(atlas.crop((x + w - 1, y - EDGE, x + w, y + h + EDGE)), (x + w - 1 + p, y - EDGE))
+
+	png = io.BytesIO()
+	atlas.save(png, "PNG", optimize=True)
+	data = png.getvalue()
+
+	if args.png:
+		with open(args.png, "wb") as f:
+			f.write(data)
+
+	lines = [
+		"#pragma once",
+		"",
+		"// Generated by res/pack_icons.py from the icons in res/, don't edit it by hand.",
+		"// The editor icons packed into one PNG, %d pixels apart, each with its edge repeated %d pixel out." % (PADDING, EDGE),
+		"",
+		"static constexpr unsigned int IconAtlasWidth = %d;" % size[0],
+		"static constexpr unsigned int IconAtlasHeight = %d;" % size[1],
+		"",
+		"struct IconAtlasRect",
+		"{",
+		"\tconst char* file;",
+		"\tint left, top, width, height;",
+		"};",
+		"",
+		"static const IconAtlasRect IconAtlasRects[] = {",
+	]
+	for name, img, (x, y) in zip(ICONS, images, positions):
+		lines.append("\t{ \"%s\", %d, %d, %d, %d }," % (name, x, y, img.size[0], img.size[1]))
+	lines.append("};")
+	lines.append("")
+	lines.append("static const unsigned char IconAtlasPng[] = {")
+	for start in range(0, len(data), 24):
+		lines.append("\t" + ",".join(str(b) for b in data[start:start + 24]) + ",")
+	lines.append("};")
+	lines.append("")
+
+	with open(args.header, "w", newline="\n") as f:
+		f.write("\n".join(lines))
+
+	print("%dx%d atlas, %d bytes" % (size[0], size[1], len(data)))
+
+
+if __name__ == "__main__":
+	sys.exit(main())
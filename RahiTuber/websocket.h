@@ -2,6 +2,7 @@
 #include <iostream>
 
 #include "mongoose.h"
+#include "LatencyTracker.h"
 
 #include <deque>
 #include <thread>
@@ -18,6 +19,7 @@ public:
 	struct QueueItem {
 		std::string stateId;
 		int activeState;
+		double receivedTime = 0;	// LatencyTracker::Now()
 	};
 
 	void Start(int port = 8000)
@@ -105,6 +107,9 @@ public:
 
 	std::function<void(const std::string&)> _getStateFnc;
 
+	// the JSON served at /latency
+	std::function<std::string()> _latencyStatsFnc;
+
 private:
 
 	struct mg_mgr _eventManager = {};
@@ -163,7 +168,18 @@ inline void ev_handler(struct mg_connection* c, int ev, void* ev_data)
 
 			webSocket->_logFunction("State change added to queue: " + stateID + " = " + std::to_string(stateActive));
 
-			webSocket->AddQueueItem({ stateID, int(stateActive) });
+			webSocket->AddQueueItem({ stateID, int(stateActive), LatencyTracker::Now() });
+		}
+		else if (mg_match(hm->uri, mg_str("/latency"), NULL) && webSocket->_latencyStatsFnc)
+		{
+			try
+			{
+				mg_http_reply(c, 200, "Content-Type: application/json\r\n", "%s\n", webSocket->_latencyStatsFnc().c_str());
+			}
+			catch (...)
+			{
+				webSocket->_logFunction("HTTP reply failed");
+			}
 		}
 		else
 		{
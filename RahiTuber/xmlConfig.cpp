@@ -83,6 +83,11 @@ bool xmlConfigLoader::loadCommon()
 	common->QueryAttribute("FXAA", &_appConfig->_FXAA);
 
 	common->QueryBoolAttribute("useSpout2", &_appConfig->_useSpout2Sender);
+	common->QueryBoolAttribute("useSharedMemory", &_appConfig->_useSharedMemorySender);
+	const char* shmName = common->Attribute("sharedMemoryName");
+	if (shmName != NULL)
+		_appConfig->_sharedMemoryName = shmName;
+	common->QueryIntAttribute("recordFormat", &_appConfig->_recordFormat);
 	common->QueryBoolAttribute("nameWindowsSeperately", &_appConfig->_nameWindowWithSet);
 
 	common->QueryBoolAttribute("createMinimal", &_appConfig->_createMinimalLayers);
@@ -94,6 +99,11 @@ bool xmlConfigLoader::loadCommon()
 
 	common->QueryBoolAttribute("unloadTimeoutEnabled", &_appConfig->_unloadTimeoutEnabled);
 	common->QueryIntAttribute("unloadTimeout", &_appConfig->_unloadTimeoutSetting);
+	common->QueryBoolAttribute("layerSetCache", &_appConfig->_layerSetCache);
+	common->QueryIntAttribute("autosaveInterval", &_appConfig->_autosaveInterval);
+	common->QueryBoolAttribute("hotReloadImages", &_appConfig->_hotReloadImages);
+	common->QueryBoolAttribute("textureVariants", &_appConfig->_textureVariants);
+	common->QueryBoolAttribute("menuRedrawOnChange", &_appConfig->_menuRedrawOnChange);
 
 	if (_appConfig->_unloadTimeoutEnabled)
 		_appConfig->_unloadTimeout = _appConfig->_unloadTimeoutSetting;
@@ -128,9 +138,16 @@ bool xmlConfigLoader::loadCommon()
 	common->QueryAttribute("audioFilter", &_audioConfig->_doFiltering);
 
 	common->QueryAttribute("compression", &_audioConfig->_compression);
+	common->QueryAttribute("separateChannels", &_audioConfig->_separateChannels);
+	common->QueryAttribute("voiceGate", &_audioConfig->_voiceGate);
+	common->QueryAttribute("gateMargin", &_audioConfig->_gateMarginDb);
+	common->QueryAttribute("gateHangover", &_audioConfig->_gateHangover);
 
 	common->QueryBoolAttribute("vsync", &_appConfig->_enableVSync);
 	common->QueryAttribute("fpsLimit", &_appConfig->_fpsLimit);
+	common->QueryAttribute("idleFpsLimit", &_appConfig->_idleFpsLimit);
+	common->QueryBoolAttribute("precisePacing", &_appConfig->_precisePacing);
+	common->QueryAttribute("physicsSubsteps", &_appConfig->_physicsSubsteps);
 
 	common->QueryAttribute("gamepadAPI", &_appConfig->_gamepadAPI);
 	common->QueryAttribute("gamepadThreaded", &_appConfig->_gamepadThreaded);
@@ -168,6 +185,30 @@ bool xmlConfigLoader::loadCommon()
 	if (theme != NULL && _uiConfig->_themes.count(theme) != 0)
 		_uiConfig->_theme = theme;
 
+	_appConfig->_coHosts.clear();
+	auto coHostElmt = common->FirstChildElement("CoHost");
+
+	while (coHostElmt)
+	{
+		CoHostSettings coHost;
+
+		const char* coHostName = coHostElmt->Attribute("name");
+		if (coHostName != NULL)
+			coHost.name = coHostName;
+
+		const char* layerSet = coHostElmt->Attribute("layerSet");
+		if (layerSet != NULL)
+			coHost.layerSet = layerSet;
+
+		coHostElmt->QueryAttribute("audioChannel", &coHost.audioChannel);
+		coHostElmt->QueryAttribute("width", &coHost.width);
+		coHostElmt->QueryAttribute("height", &coHost.height);
+
+		_appConfig->_coHosts.push_back(coHost);
+
+		coHostElmt = coHostElmt->NextSiblingElement("CoHost");
+	}
+
 	auto PhonemeCfg = common->FirstChildElement("PhonemeConfig");
 	if (PhonemeCfg) {
 		PhonemeCfg->QueryAttribute("subSplit", &_audioConfig->_subSplit);
@@ -184,6 +225,23 @@ bool xmlConfigLoader::loadCommon()
 		PhonemeCfg->QueryAttribute("SConfidenceBoost", &_audioConfig->SConfidenceBoost);
 		PhonemeCfg->QueryAttribute("PConfidenceBoost", &_audioConfig->PConfidenceBoost);
 		PhonemeCfg->QueryAttribute("WConfidenceBoost", &_audioConfig->WConfidenceBoost);
+		PhonemeCfg->QueryAttribute("spectralDetection", &_audioConfig->_spectralPhonemes);
+
+		auto centroidElmt = PhonemeCfg->FirstChildElement("Centroid");
+		while (centroidElmt)
+		{
+			int ph = -1;
+			centroidElmt->QueryAttribute("phoneme", &ph);
+			if (ph >= 0)
+			{
+				auto& centroid = _audioConfig->_phonemeClassifier.GetCentroid(ph);
+				centroidElmt->QueryAttribute("count", &centroid.count);
+				for (int f = 0; f < PhonemeClassifier::NumFeatures; f++)
+					centroidElmt->QueryAttribute(("f" + std::to_string(f)).c_str(), &centroid.mean[f]);
+			}
+
+			centroidElmt = centroidElmt->NextSiblingElement("Centroid");
+		}
 	}
 
 
@@ -233,6 +291,9 @@ bool xmlConfigLoader::saveCommon()
 			common->SetAttribute("FXAA", _appConfig->_FXAA);
 
 			common->SetAttribute("useSpout2", _appConfig->_useSpout2Sender);
+			common->SetAttribute("useSharedMemory", _appConfig->_useSharedMemorySender);
+			common->SetAttribute("sharedMemoryName", _appConfig->_sharedMemoryName.c_str());
+			common->SetAttribute("recordFormat", _appConfig->_recordFormat);
 			common->SetAttribute("nameWindowsSeperately", _appConfig->_nameWindowWithSet);
 
 			common->SetAttribute("createMinimal", _appConfig->_createMinimalLayers);
@@ -240,6 +301,11 @@ bool xmlConfigLoader::saveCommon()
 
 			common->SetAttribute("unloadTimeoutEnabled", _appConfig->_unloadTimeoutEnabled);
 			common->SetAttribute("unloadTimeout", _appConfig->_unloadTimeoutSetting);
+			common->SetAttribute("layerSetCache", _appConfig->_layerSetCache);
+			common->SetAttribute("autosaveInterval", _appConfig->_autosaveInterval);
+			common->SetAttribute("hotReloadImages", _appConfig->_hotReloadImages);
+			common->SetAttribute("textureVariants", _appConfig->_textureVariants);
+			common->SetAttribute("menuRedrawOnChange", _appConfig->_menuRedrawOnChange);
 
 			common->SetAttribute("trackMouse", _appConfig->_mouseTrackingEnabled);
 			common->SetAttribute("trackController", _appConfig->_controllerTrackingEnabled);
@@ -264,11 +330,18 @@ bool xmlConfigLoader::saveCommon()
 			common->SetAttribute("audioFilter", _audioConfig->_doFiltering);
 
 			common->SetAttribute("compression", _audioConfig->_compression);
+			common->SetAttribute("separateChannels", _audioConfig->_separateChannels);
+			common->SetAttribute("voiceGate", _audioConfig->_voiceGate);
+			common->SetAttribute("gateMargin", _audioConfig->_gateMarginDb);
+			common->SetAttribute("gateHangover", _audioConfig->_gateHangover);
 
 			common->SetAttribute("theme", _uiConfig->_theme.c_str());
 
 			common->SetAttribute("vsync", _appConfig->_enableVSync);
 			common->SetAttribute("fpsLimit", _appConfig->_fpsLimit);
+			common->SetAttribute("idleFpsLimit", _appConfig->_idleFpsLimit);
+			common->SetAttribute("precisePacing", _appConfig->_precisePacing);
+			common->SetAttribute("physicsSubsteps", _appConfig->_physicsSubsteps);
 
 			common->SetAttribute("gamepadAPI", _appConfig->_gamepadAPI);
 			common->SetAttribute("gamepadThreaded", _appConfig->_gamepadThreaded);
@@ -299,6 +372,24 @@ bool xmlConfigLoader::saveCommon()
 				themeElmt->SetAttribute("fontSize", theme.second.fontSize);
 			}
 
+			auto coHostElmt = common->FirstChildElement("CoHost");
+
+			while (coHostElmt)
+			{
+				common->DeleteChild(coHostElmt);
+				coHostElmt = common->FirstChildElement("CoHost");
+			}
+
+			for (auto& coHost : _appConfig->_coHosts)
+			{
+				auto coHostElmt = common->InsertEndChild(doc.NewElement("CoHost"))->ToElement();
+				coHostElmt->SetAttribute("name", coHost.name.c_str());
+				coHostElmt->SetAttribute("layerSet", coHost.layerSet.c_str());
+				coHostElmt->SetAttribute("audioChannel", coHost.audioChannel);
+				coHostElmt->SetAttribute("width", coHost.width);
+				coHostElmt->SetAttribute("height", coHost.height);
+			}
+
 
 			auto PhonemeCfg = common->FirstChildElement("PhonemeConfig");
 			if (!PhonemeCfg) PhonemeCfg = common->InsertNewChildElement("PhonemeConfig");
@@ -318,6 +409,28 @@ bool xmlConfigLoader::saveCommon()
 			PhonemeCfg->SetAttribute("SConfidenceBoost", _audioConfig->SConfidenceBoost);
 			PhonemeCfg->SetAttribute("PConfidenceBoost", _audioConfig->PConfidenceBoost);
 			PhonemeCfg->SetAttribute("WConfidenceBoost", _audioConfig->WConfidenceBoost);
+			PhonemeCfg->SetAttribute("spectralDetection", _audioConfig->_spectralPhonemes);
+
+			auto centroidElmt = PhonemeCfg->FirstChildElement("Centroid");
+			while (centroidElmt)
+			{
+				PhonemeCfg->DeleteChild(centroidElmt);
+				centroidElmt = PhonemeCfg->FirstChildElement("Centroid");
+			}
+
+			for (int c = 0; c < PhonemeClassifier::NumClasses; c++)
+			{
+				int ph = PhonemeClassifier::ClassPhoneme(c);
+				auto& centroid = _audioConfig->_phonemeClassifier.GetCentroid(ph);
+				if (centroid.count == 0)
+					continue;
+
+				centroidElmt = PhonemeCfg->InsertNewChildElement("Centroid");
+				centroidElmt->SetAttribute("phoneme", ph);
+				centroidElmt->SetAttribute("count", centroid.count);
+				for (int f = 0; f < PhonemeClassifier::NumFeatures; f++)
+					centroidElmt->SetAttribute(("f" + std::to_string(f)).c_str(), centroid.mean[f]);
+			}
 
 		}
 	}
@@ -0,0 +1,198 @@
+// Reference consumer for RahiTuber's shared-memory frame output on Linux.
+// Maps the segment, copies every new frame out under the seqlock, and reports
+// frame rate, latency and dropped frames once per second.
+//
+// Usage: RahiTuber_FrameReader [name] [seconds]
+
+#include "SharedFrameFormat.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// a torn read means the writer is mid-copy, it's worth a few quick retries but not a spin
+static const int ReadAttempts = 3;
+
+struct Segment
+{
+	SharedFrame::Header* header = nullptr;
+	size_t bytes = 0;
+};
+
+static bool OpenSegment(const char* name, Segment& seg)
+{
+	int fd = shm_open(name, O_RDONLY, 0);
+	if (fd == -1)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SharedFrame::Header))
+	{
+		close(fd);
+		return false;
+	}
+
+	void* mem = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (mem == MAP_FAILED)
+		return false;
+
+	// the writer sets the magic last
+	auto* header = (SharedFrame::Header*)mem;
+	bool valid = header->magic == SharedFrame::Magic;
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	if (!valid || header->version != SharedFrame::Version
+		|| SharedFrame::SegmentBytes(header->width, header->height) > (uint64_t)st.st_size)
+	{
+		munmap(mem, st.st_size);
+		return false;
+	}
+
+	seg.header = header;
+	seg.bytes = st.st_size;
+	return true;
+}
+
+static void CloseSegment(Segment& seg)
+{
+	if (seg.header != nullptr)
+		munmap(seg.header, seg.bytes);
+	seg = Segment();
+}
+
+// Copies one slot out. Returns false if the writer was in the middle of it, so the caller can retry.
+static bool ReadSlot(SharedFrame::Header* header, uint32_t slotIdx, std::vector<uint8_t>& pixels, SharedFrame::SlotHeader& meta)
+{
+	auto* slot = SharedFrame::GetSlot(header, slotIdx);
+
+	uint32_t seq = slot->seq.load(std::memory_order_acquire);
+	if (seq & 1)
+		return false;
+
+	meta.frame = slot->frame;
+	meta.renderTimeNs = slot->renderTimeNs;
+	meta.publishTimeNs = slot->publishTimeNs;
+
+	size_t bytes = (size_t)header->stride * header->height;
+	pixels.resize(bytes);
+	memcpy(pixels.data(), SharedFrame::SlotPixels(slot), bytes);
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return slot->seq.load(std::memory_order_relaxed) == seq;
+}
+
+int main(int argc, char** argv)
+{
+	const char* name = argc > 1 ? argv[1] : SharedFrame::DefaultName;
+	double seconds = argc > 2 ? atof(argv[2]) : 0;
+
+	Segment seg;
+	std::vector<uint8_t> pixels;
+	SharedFrame::SlotHeader meta;
+
+	uint64_t lastFrame = 0;
+	uint64_t start = SharedFrame::NowNs();
+	uint64_t reportStart = start;
+
+	unsigned long long frames = 0, dropped = 0, torn = 0;
+	unsigned long long totalFrames = 0, totalDropped = 0;
+	double latencySum = 0, latencyMax = 0, publishSum = 0;
+
+	printf("Waiting for %s...\n", name);
+
+	while (seconds <= 0 || (SharedFrame::NowNs() - start) * 1e-9 < seconds)
+	{
+		if (seg.header == nullptr || seg.header->closed.load(std::memory_order_acquire))
+		{
+			if (seg.header != nullptr)
+				printf("Segment closed, reopening\n");
+
+			CloseSegment(seg);
+			lastFrame = 0;
+			if (!OpenSegment(name, seg))
+			{
+				usleep(100000);
+				continue;
+			}
+			printf("Opened %s: %ux%u, %u slots\n", name, seg.header->width, seg.header->height, seg.header->slotCount);
+		}
+
+		uint64_t latest = seg.header->latestFrame.load(std::memory_order_acquire);
+		if (latest != 0 && latest != lastFrame)
+		{
+			bool read = false;
+			for (int attempt = 0; attempt < ReadAttempts && !read; attempt++)
+			{
+				if (attempt > 0)
+				{
+					torn++;
+					sched_yield();
+				}
+				read = ReadSlot(seg.header, latest % seg.header->slotCount, pixels, meta) && meta.frame == latest;
+			}
+
+			if (read)
+			{
+				uint64_t now = SharedFrame::NowNs();
+				double latency = (now - meta.renderTimeNs) * 1e-6;
+				latencySum += latency;
+				latencyMax = std::max(latencyMax, latency);
+				publishSum += (meta.publishTimeNs - meta.renderTimeNs) * 1e-6;
+
+				// frame numbers count every rendered frame, so a gap is a frame nobody saw
+				if (lastFrame != 0 && latest > lastFrame + 1)
+					dropped += latest - lastFrame - 1;
+
+				lastFrame = latest;
+				frames++;
+			}
+			else
+			{
+				// the writer kept the slot busy, count the frame as dropped and wait for the next one
+				torn++;
+				if (lastFrame != 0 && latest > lastFrame)
+					dropped += latest - lastFrame;
+				else
+					dropped++;
+				lastFrame = latest;
+			}
+		}
+
+		uint64_t now = SharedFrame::NowNs();
+		if (now - reportStart >= 1000000000ull)
+		{
+			double elapsed = (now - reportStart) * 1e-9;
+			if (frames > 0)
+			{
+				printf("%.1f fps, latency avg %.2fms max %.2fms (render to publish %.2fms), dropped %llu, torn reads %llu\n",
+					frames / elapsed, latencySum / frames, latencyMax, publishSum / frames, dropped, torn);
+			}
+			else
+			{
+				printf("no frames\n");
+			}
+
+			totalFrames += frames;
+			totalDropped += dropped;
+			frames = dropped = torn = 0;
+			latencySum = latencyMax = publishSum = 0;
+			reportStart = now;
+		}
+
+		usleep(500);
+	}
+
+	printf("Total: %llu frames read, %llu dropped\n", totalFrames + frames, totalDropped + dropped);
+
+	CloseSegment(seg);
+	return 0;
+}
@@ -0,0 +1,299 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "AnimatedImage.h"
+#include "TextureManager.h"
+
+#include <map>
+
+using AnimationStreamTest = TempFolderTest;
+
+TEST_F(AnimationStreamTest, DecodesGifFramesAhead) {
+
+	// a 4x4 GIF: a red frame, a green 2x2 square in the corner, then the square cleared to the background
+	const uint8_t palette[12] = { 255,0,0, 0,255,0, 0,0,255, 0,0,0 };
+	std::vector<uint8_t> gif = { 'G','I','F','8','9','a', 4,0, 4,0, 0xF1, 0, 0 };
+	gif.insert(gif.end(), palette, palette + 12);
+
+	auto addFrame = [&](int x, int y, int w, int h, uint8_t colour, int disposal, int delayCs)
+	{
+		const uint8_t gce[] = { 0x21, 0xF9, 4, (uint8_t)(disposal << 2), (uint8_t)delayCs, 0, 0, 0 };
+		gif.insert(gif.end(), gce, gce + sizeof(gce));
+		const uint8_t desc[] = { 0x2C, (uint8_t)x, 0, (uint8_t)y, 0, (uint8_t)w, 0, (uint8_t)h, 0, 0 };
+		gif.insert(gif.end(), desc, desc + sizeof(desc));
+
+		// 3 bit codes, a clear before every pixel so the dictionary never grows
+		std::vector<int> codes;
+		for (int p = 0; p < w * h; p++)
+		{
+			codes.push_back(4);
+			codes.push_back(colour);
+		}
+		codes.push_back(5);
+
+		std::vector<uint8_t> packed;
+		uint32_t bits = 0;
+		int bitCount = 0;
+		for (int code : codes)
+		{
+			bits |= code << bitCount;
+			bitCount += 3;
+			while (bitCount >= 8)
+			{
+				packed.push_back((uint8_t)bits);
+				bits >>= 8;
+				bitCount -= 8;
+			}
+		}
+		if (bitCount > 0)
+			packed.push_back((uint8_t)bits);
+
+		gif.push_back(2);
+		gif.push_back((uint8_t)packed.size());
+		gif.insert(gif.end(), packed.begin(), packed.end());
+		gif.push_back(0);
+	};
+
+	addFrame(0, 0, 4, 4, 0, 0, 1);
+	addFrame(2, 2, 2, 2, 1, 2, 20);
+	addFrame(0, 0, 1, 1, 2, 0, 20);
+	gif.push_back(0x3B);
+
+	AnimationDecoder decoder;
+	std::string error;
+	ASSERT_TRUE(decoder.Open(std::vector<uint8_t>(gif), error)) << error;
+	EXPECT_EQ(decoder.FrameCount(), 3);
+	EXPECT_EQ(decoder.Size(), sf::Vector2u(4, 4));
+
+	// tiny delays play at 10fps like they do in browsers
+	EXPECT_EQ(decoder.FrameDelayMs(0), 100);
+	EXPECT_EQ(decoder.FrameDelayMs(1), 200);
+
+	std::vector<uint8_t> rgba;
+	auto pixel = [&](int x, int y) { return sf::Color(rgba[(y * 4 + x) * 4], rgba[(y * 4 + x) * 4 + 1], rgba[(y * 4 + x) * 4 + 2], rgba[(y * 4 + x) * 4 + 3]); };
+
+	ASSERT_TRUE(decoder.NextFrame(&rgba));
+	EXPECT_EQ(pixel(3, 3), sf::Color::Red);
+	ASSERT_TRUE(decoder.NextFrame(&rgba));
+	EXPECT_EQ(pixel(3, 3), sf::Color::Green);
+	EXPECT_EQ(pixel(0, 0), sf::Color::Red);
+	ASSERT_TRUE(decoder.NextFrame(&rgba));
+	EXPECT_EQ(pixel(3, 3), sf::Color::Transparent);
+	EXPECT_EQ(pixel(0, 0), sf::Color::Blue);
+	EXPECT_EQ(decoder.NextIndex(), 0);
+
+	// a canvas larger than the GPU takes doesn't open, a frame larger than it is skipped
+	EXPECT_FALSE(AnimationDecoder().Open(std::vector<uint8_t>(gif), error, 3));
+
+	std::vector<uint8_t> smallCanvas = gif;
+	smallCanvas[6] = 2;
+	smallCanvas[8] = 2;
+	AnimationDecoder bounded;
+	ASSERT_TRUE(bounded.Open(std::move(smallCanvas), error, 2)) << error;
+	EXPECT_FALSE(bounded.NextFrame(&rgba));
+	EXPECT_TRUE(bounded.NextFrame(&rgba));
+	EXPECT_EQ(rgba.size(), 2u * 2 * 4);
+
+	std::string path = (folder / "anim.gif").string();
+	{
+		std::ofstream file(path, std::ios::binary);
+		file.write((const char*)gif.data(), gif.size());
+	}
+	EXPECT_TRUE(AnimationDecoder::IsAnimatedFile(path));
+
+	AnimationStream stream;
+	ASSERT_TRUE(stream.Open(path, error)) << error;
+
+	// the worker decodes ahead, each frame is uploaded once when it's shown
+	for (int f = 0; f < 3; f++)
+	{
+		sf::Texture* tex = nullptr;
+		for (int tries = 0; tries < 200 && tex == nullptr; tries++)
+		{
+			tex = stream.GetFrame(f);
+			if (tex == nullptr)
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+		ASSERT_NE(tex, nullptr);
+		EXPECT_EQ(tex->getSize(), sf::Vector2u(4, 4));
+		EXPECT_EQ(tex->copyToImage().getPixel(3, 3), f == 0 ? sf::Color::Red : f == 1 ? sf::Color::Green : sf::Color::Transparent);
+		EXPECT_EQ(stream.GetFrame(f), tex);
+	}
+	EXPECT_EQ(stream.Uploads(), 3);
+
+	stream.Close();
+	EXPECT_FALSE(stream.IsOpen());
+
+	// each sprite gets its own stream over one copy of the file, so two playing out of phase don't seek
+	// each other back to the start or draw over each other's frames
+	TextureManager texMan;
+	auto first = texMan.GetStream(path, error);
+	ASSERT_NE(first, nullptr) << error;
+	auto second = texMan.GetStream(path, error);
+	ASSERT_NE(second, nullptr) << error;
+	EXPECT_NE(first, second);
+
+	auto waitFrame = [](AnimationStream& s, int f)
+	{
+		sf::Texture* tex = nullptr;
+		for (int tries = 0; tries < 200 && tex == nullptr; tries++)
+		{
+			tex = s.GetFrame(f);
+			if (tex == nullptr)
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+		return tex;
+	};
+
+	sf::Texture* firstTex = waitFrame(*first, 0);
+	ASSERT_NE(firstTex, nullptr);
+	for (int round = 0; round < 3; round++)
+	{
+		sf::Texture* secondTex = waitFrame(*second, 2);
+		ASSERT_NE(secondTex, nullptr);
+		EXPECT_NE(secondTex, firstTex);
+		EXPECT_EQ(secondTex->copyToImage().getPixel(3, 3), sf::Color::Transparent);
+		EXPECT_EQ(secondTex->copyToImage().getPixel(0, 0), sf::Color::Blue);
+
+		EXPECT_EQ(waitFrame(*first, 0), firstTex);
+		EXPECT_EQ(firstTex->copyToImage().getPixel(3, 3), sf::Color::Red);
+	}
+	EXPECT_EQ(first->Uploads(), 1);
+	EXPECT_EQ(second->Uploads(), 1);
+
+	// and smoothing one doesn't smooth the other
+	second->SetSmooth(true);
+	EXPECT_TRUE(second->GetFrame(2)->isSmooth());
+	EXPECT_FALSE(first->GetFrame(0)->isSmooth());
+
+	// the file is read again once no stream holds it
+	first.reset();
+	second.reset();
+	EXPECT_NE(texMan.GetStream(path, error), nullptr);
+}
+
+TEST_F(AnimationStreamTest, DecodesLzwCompressedGif) {
+
+	// A GIF encoder's LZW: the dictionary grows with every code, the code size goes up as it passes
+	// each power of two, and a full dictionary is cleared and starts again
+	auto encodeLzw = [](const std::vector<uint8_t>& indices, int minCodeSize)
+	{
+		const int clearCode = 1 << minCodeSize;
+		const int endCode = clearCode + 1;
+
+		std::vector<uint8_t> packed;
+		uint32_t bits = 0;
+		int bitCount = 0;
+		int codeSize = minCodeSize + 1;
+		auto emit = [&](int code)
+		{
+			bits |= (uint32_t)code << bitCount;
+			bitCount += codeSize;
+			while (bitCount >= 8)
+			{
+				packed.push_back((uint8_t)bits);
+				bits >>= 8;
+				bitCount -= 8;
+			}
+		};
+
+		std::map<std::pair<int, int>, int> dictionary;
+		int nextCode = endCode + 1;
+		emit(clearCode);
+
+		int prefix = indices[0];
+		for (size_t i = 1; i < indices.size(); i++)
+		{
+			auto found = dictionary.find({ prefix, indices[i] });
+			if (found != dictionary.end())
+			{
+				prefix = found->second;
+				continue;
+			}
+
+			emit(prefix);
+			if (nextCode < 4096)
+			{
+				dictionary[{ prefix, indices[i] }] = nextCode++;
+				if (nextCode - 1 == (1 << codeSize) && codeSize < 12)
+					codeSize++;
+			}
+			else
+			{
+				emit(clearCode);
+				dictionary.clear();
+				nextCode = endCode + 1;
+				codeSize = minCodeSize + 1;
+			}
+			prefix = indices[i];
+		}
+		emit(prefix);
+		emit(endCode);
+		if (bitCount > 0)
+			packed.push_back((uint8_t)bits);
+
+		// in sub-blocks of up to 255 bytes
+		std::vector<uint8_t> data = { (uint8_t)minCodeSize };
+		for (size_t at = 0; at < packed.size(); at += 255)
+		{
+			const size_t len = std::min<size_t>(255, packed.size() - at);
+			data.push_back((uint8_t)len);
+			data.insert(data.end(), packed.begin() + at, packed.begin() + at + len);
+		}
+		data.push_back(0);
+		return data;
+	};
+
+	// 128x128 with a 4 colour palette
+	const int size = 128;
+	std::vector<uint8_t> gif = { 'G','I','F','8','9','a', (uint8_t)size,0, (uint8_t)size,0, 0xF1, 0, 0 };
+	const uint8_t palette[12] = { 255,0,0, 0,255,0, 0,0,255, 255,255,255 };
+	gif.insert(gif.end(), palette, palette + 12);
+
+	std::vector<std::vector<uint8_t>> frames(2, std::vector<uint8_t>((size_t)size * size));
+
+	// noise, which fills the dictionary and clears it a few times over...
+	uint32_t seed = 12345;
+	for (auto& index : frames[0])
+	{
+		seed = seed * 1664525 + 1013904223;
+		index = (uint8_t)(seed >> 30);
+	}
+
+	// ...then long runs of one colour, where each new code is sent straight after it's made (KwKwK)
+	for (size_t i = 0; i < frames[1].size(); i++)
+		frames[1][i] = (uint8_t)(i / 5000);
+
+	for (auto& frame : frames)
+	{
+		const uint8_t gce[] = { 0x21, 0xF9, 4, 0, 10, 0, 0, 0 };
+		gif.insert(gif.end(), gce, gce + sizeof(gce));
+		const uint8_t desc[] = { 0x2C, 0, 0, 0, 0, (uint8_t)size, 0, (uint8_t)size, 0, 0 };
+		gif.insert(gif.end(), desc, desc + sizeof(desc));
+
+		std::vector<uint8_t> data = encodeLzw(frame, 2);
+		gif.insert(gif.end(), data.begin(), data.end());
+	}
+	gif.push_back(0x3B);
+
+	AnimationDecoder decoder;
+	std::string error;
+	ASSERT_TRUE(decoder.Open(std::vector<uint8_t>(gif), error)) << error;
+	ASSERT_EQ(decoder.FrameCount(), 2);
+
+	std::vector<uint8_t> rgba;
+	for (auto& frame : frames)
+	{
+		ASSERT_TRUE(decoder.NextFrame(&rgba));
+		ASSERT_EQ(rgba.size(), frame.size() * 4);
+
+		int wrong = 0;
+		for (size_t i = 0; i < frame.size(); i++)
+		{
+			const uint8_t* expected = palette + frame[i] * 3;
+			if (rgba[i * 4] != expected[0] || rgba[i * 4 + 1] != expected[1] || rgba[i * 4 + 2] != expected[2] || rgba[i * 4 + 3] != 255)
+				wrong++;
+		}
+		EXPECT_EQ(wrong, 0);
+	}
+}
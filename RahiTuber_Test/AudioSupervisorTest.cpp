@@ -0,0 +1,157 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "AudioSupervisor.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// Stands in for PortAudio with one device that can be unplugged, and a host that is slow to start
+class FakeAudioBackend : public AudioBackend
+{
+public:
+	struct Host
+	{
+		std::mutex mutex;
+		bool plugged = true;
+		int initializes = 0;
+	};
+
+	FakeAudioBackend(std::shared_ptr<Host> host) : _host(host) {}
+
+	bool Initialize(std::string& error) override
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		std::lock_guard<std::mutex> lock(_host->mutex);
+		_host->initializes++;
+		return true;
+	}
+
+	void Terminate() override {}
+
+	void ListInputs(std::vector<AudioDevice>& devices, int& defaultDevice) override
+	{
+		std::lock_guard<std::mutex> lock(_host->mutex);
+		devices.clear();
+		defaultDevice = -1;
+		if (_host->plugged)
+		{
+			AudioDevice mic;
+			mic.name = "Mic";
+			mic.index = 0;
+			mic.maxChannels = 1;
+			devices.push_back(mic);
+			defaultDevice = 0;
+		}
+	}
+
+	void* OpenStream(const AudioDevice& device, const AudioStreamFormat* format, std::string& error) override
+	{
+		std::lock_guard<std::mutex> lock(_host->mutex);
+		if (_host->plugged == false)
+		{
+			error = "Device unavailable";
+			return nullptr;
+		}
+		return &_stream;
+	}
+
+	void CloseStream(void* stream) override {}
+
+private:
+	std::shared_ptr<Host> _host;
+	int _stream = 0;
+};
+
+TEST(AudioSupervisorTest, ReconnectsWithoutStallingFrames) {
+
+	// the retry delays run on this clock, moved on by hand
+	std::atomic<double> now = 0;
+
+	auto host = std::make_shared<FakeAudioBackend::Host>();
+	AudioSupervisor supervisor(std::make_unique<FakeAudioBackend>(host), [&]() { return now.load(); });
+
+	std::string error;
+	ASSERT_TRUE(supervisor.Initialize(error));
+	ASSERT_EQ(supervisor.GetDevices().size(), 1u);
+	supervisor.Start("Mic");
+
+	// a render frame, timing only its own work
+	double worstFrameMs = 0;
+	bool connected = false;
+	auto frame = [&](bool silent)
+	{
+		sf::Clock frameClock;
+		if (silent)
+			supervisor.ReportSilence();
+		else
+			supervisor.ReportAudio();
+
+		AudioStreamChange change;
+		while (supervisor.TakeStreamChange(change))
+			connected |= change.connected;
+		supervisor.GetDevices();
+
+		worstFrameMs = std::max(worstFrameMs, frameClock.getElapsedTime().asMicroseconds() * 0.001);
+	};
+
+	// frames until the supervisor has had a whole look at the clock and the silence since the call
+	auto settle = [&](bool silent)
+	{
+		frame(silent);
+		const unsigned int polls = supervisor.Polls();
+		while (supervisor.Polls() < polls + 2)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			frame(silent);
+		}
+		frame(silent);
+	};
+	auto setPlugged = [&](bool plugged)
+	{
+		std::lock_guard<std::mutex> lock(host->mutex);
+		host->plugged = plugged;
+	};
+
+	settle(false);
+	EXPECT_TRUE(connected);
+	EXPECT_TRUE(supervisor.IsStreaming());
+
+	// unplugged: the first attempt is straight away, then one second later, then two seconds after that
+	setPlugged(false);
+	settle(true);
+	EXPECT_EQ(supervisor.ReconnectAttempts(), 1);
+	EXPECT_FALSE(supervisor.IsStreaming());
+
+	const double schedule[][2] = { { 0.9, 1 }, { 1.0, 2 }, { 2.9, 2 }, { 3.0, 3 }, { 6.9, 3 } };
+	for (auto& step : schedule)
+	{
+		now = step[0];
+		settle(true);
+		EXPECT_EQ(supervisor.ReconnectAttempts(), (int)step[1]) << "at " << step[0] << "s";
+	}
+
+	// plugged back in, picked up by the next attempt four seconds after the last
+	setPlugged(true);
+	connected = false;
+	settle(true);
+	EXPECT_FALSE(connected);
+	now = 7.0;
+	settle(true);
+	EXPECT_EQ(supervisor.ReconnectAttempts(), 4);
+	EXPECT_TRUE(connected);
+	EXPECT_TRUE(supervisor.IsStreaming());
+
+	// audio coming back starts the schedule over, so the next loss is retried straight away
+	settle(false);
+	setPlugged(false);
+	settle(true);
+	EXPECT_EQ(supervisor.ReconnectAttempts(), 5);
+
+	// each host start takes 200ms, none of which the frames should see
+	EXPECT_LT(worstFrameMs, 100);
+
+	supervisor.Stop();
+	EXPECT_FALSE(supervisor.IsStreaming());
+}
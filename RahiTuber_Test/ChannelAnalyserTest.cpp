@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "ChannelAnalyser.h"
+
+#include <cmath>
+#include <random>
+
+// A buffer with a voice on channel 0, a quieter one on the other even channels, and nothing on the odd ones
+static std::vector<float> MakeChannelVoices(int channels, unsigned long long firstFrame, int buffer, float sampleRate)
+{
+	std::vector<float> interleaved(buffer * channels, 0.f);
+	for (int f = 0; f < buffer; f++)
+	{
+		float t = (firstFrame + f) / sampleRate;
+		for (int c = 0; c < channels; c += 2)
+			interleaved[f * channels + c] = std::sin(2.f * 3.14159265f * 700.f * t) * (c == 0 ? 0.8f : 0.3f);
+	}
+	return interleaved;
+}
+
+TEST(ChannelAnalyserTest, MeasuresEachChannelSeparately) {
+
+	const float sampleRate = 44100;
+	const int buffer = 512;
+
+	// every channel count splits back into what went in, including the frames after the last group of 4
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<float> noise(-1.f, 1.f);
+	for (int channels = 1; channels <= ChannelAnalyser::MaxChannels; channels++)
+	{
+		const size_t frames = 1027;
+		std::vector<float> interleaved(frames * channels);
+		for (auto& spl : interleaved)
+			spl = noise(rng);
+
+		std::vector<std::vector<float>> split(channels, std::vector<float>(frames));
+		std::vector<float*> out;
+		for (auto& ch : split)
+			out.push_back(ch.data());
+
+		ChannelAnalyser::Deinterleave(interleaved.data(), frames, channels, out.data());
+
+		for (size_t f = 0; f < frames; f++)
+			for (int c = 0; c < channels; c++)
+				ASSERT_EQ(split[c][f], interleaved[f * channels + c]) << channels << " channels, frame " << f;
+	}
+
+	ChannelAnalyser::Settings settings;
+	settings.sampleRate = sampleRate;
+
+	{
+		ChannelAnalyser analyser;
+
+		// a quiet room first, so each gate has a floor below the voices
+		std::vector<float> quiet(buffer * 4, 0.f);
+		analyser.Push(quiet.data(), buffer, 4, sampleRate);
+		EXPECT_FALSE(analyser.VoiceActive(0));
+
+		for (int b = 0; b < 8; b++)
+		{
+			auto interleaved = MakeChannelVoices(4, (unsigned long long)b * buffer, buffer, sampleRate);
+			analyser.Push(interleaved.data(), buffer, 4, sampleRate);
+			analyser.Analyse(settings);
+		}
+
+		ASSERT_EQ(analyser.Channels(), 4);
+		EXPECT_GT(analyser.GetLevels(0).talk, analyser.GetLevels(2).talk);
+		EXPECT_GT(analyser.GetLevels(2).talk, 0.f);
+		EXPECT_EQ(analyser.GetLevels(1).talk, 0.f);
+		EXPECT_EQ(analyser.GetLevels(3).talk, 0.f);
+
+		// each channel is gated on its own voice
+		EXPECT_TRUE(analyser.VoiceActive(0));
+		EXPECT_FALSE(analyser.VoiceActive(1));
+		EXPECT_TRUE(analyser.VoiceActive(2));
+		EXPECT_FALSE(analyser.VoiceActive(3));
+		EXPECT_FALSE(analyser.VoiceActive(4));
+
+		analyser.Reset();
+		EXPECT_FALSE(analyser.VoiceActive(0));
+	}
+}
+
+TEST(ChannelAnalyserTest, DISABLED_BenchmarkChannels) {
+
+	const float sampleRate = 44100;
+	const int buffer = 512;
+
+	ChannelAnalyser::Settings settings;
+	settings.sampleRate = sampleRate;
+
+	// the cost of each extra channel, with a new buffer before every analysis as in the app
+	const int iterations = 300;
+	double oneChannelMs = 0;
+	for (int channels : { 1, 2, 4, 8 })
+	{
+		ChannelAnalyser analyser;
+		sf::Clock clock;
+		double analyseMs = 0;
+		for (int i = 0; i < iterations; i++)
+		{
+			auto interleaved = MakeChannelVoices(channels, (unsigned long long)i * buffer, buffer, sampleRate);
+			clock.restart();
+			analyser.Push(interleaved.data(), buffer, channels, sampleRate);
+			analyser.Analyse(settings);
+			analyseMs += clock.getElapsedTime().asMicroseconds() * 0.001;
+		}
+		analyseMs /= iterations;
+		EXPECT_EQ(analyser.Channels(), channels);
+
+		if (channels == 1)
+			oneChannelMs = analyseMs;
+		else
+			std::cout << channels << " channels: " << analyseMs << "ms per buffer, " << (analyseMs - oneChannelMs) / (channels - 1) << "ms per extra channel" << std::endl;
+	}
+	std::cout << "1 channel: " << oneChannelMs << "ms per buffer" << std::endl;
+}
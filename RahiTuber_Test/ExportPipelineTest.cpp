@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "ExportPipeline.h"
+
+#include <algorithm>
+
+class ExportPipelineTest : public TempFolderTest {
+protected:
+	static constexpr int Border = 40;
+
+	// Images with a transparent border to crop off, each a pixel wider on the left than the last (wrapping at 10)
+	std::vector<fs::path> WriteSources(int numImages, unsigned int size)
+	{
+		std::vector<fs::path> sources;
+		for (int i = 0; i < numImages; i++)
+		{
+			sources.push_back(WriteImage(fs::path("src") / ("img" + std::to_string(i) + ".png"), size, size, [i, size](unsigned int x, unsigned int y) {
+				bool inside = x >= (unsigned int)(Border + i % 10) && y >= (unsigned int)Border && x < size - Border && y < size - Border;
+				return inside ? sf::Color((sf::Uint8)x, (sf::Uint8)y, (sf::Uint8)i, 200) : sf::Color::Transparent;
+				}));
+		}
+		return sources;
+	}
+
+	// Exports the images into target on a number of workers, checking the crop. Returns the time taken.
+	float RunExport(const std::vector<fs::path>& sources, const fs::path& target, int workers)
+	{
+		fs::create_directories(target);
+
+		ExportPipeline pipeline;
+		for (auto& src : sources)
+			pipeline.Add(src, target / src.filename(), true);
+
+		// a second sprite using the same image is only processed once
+		pipeline.Add(sources[0], target / sources[0].filename(), false);
+		EXPECT_EQ(pipeline.JobCount(), (int)sources.size());
+
+		sf::Clock timer;
+		pipeline.Start(workers);
+		pipeline.Wait();
+		float ms = timer.getElapsedTime().asMicroseconds() / 1000.f;
+
+		EXPECT_EQ(pipeline.Failures(), 0);
+		ExportPipeline::Result* result = pipeline.GetResult((target / "img3.png").string());
+		EXPECT_NE(result, nullptr);
+		if (result != nullptr)
+		{
+			EXPECT_TRUE(result->cropped);
+			EXPECT_EQ(result->cropRect.left, Border + 3);
+			EXPECT_EQ(result->cropRect.top, Border);
+			EXPECT_EQ(result->premultiplied.size(), (size_t)result->cropRect.width * result->cropRect.height * 4);
+		}
+		return ms;
+	}
+};
+
+TEST_F(ExportPipelineTest, CropsEachImageOnce) {
+
+	auto sources = WriteSources(10, 128);
+
+	RunExport(sources, folder / "serial", 1);
+	RunExport(sources, folder / "parallel", std::max(2, (int)std::thread::hardware_concurrency() - 1));
+}
+
+TEST_F(ExportPipelineTest, DISABLED_BenchmarkParallelCrop) {
+
+	const int numImages = 100;
+	auto sources = WriteSources(numImages, 256);
+
+	int workers = std::max(2, (int)std::thread::hardware_concurrency() - 1);
+	float serialMs = RunExport(sources, folder / "serial", 1);
+	float parallelMs = RunExport(sources, folder / "parallel", workers);
+
+	std::cout << "ExportPipeline: " << numImages << " images, 1 thread " << serialMs << "ms, "
+		<< workers << " threads " << parallelMs << "ms" << std::endl;
+}
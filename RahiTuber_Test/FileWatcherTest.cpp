@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "FileWatcher.h"
+
+using FileWatcherTest = TempFolderTest;
+
+TEST_F(FileWatcherTest, DebouncesMultiStepWrites) {
+
+	std::string path = fs::weakly_canonical(folder / "image.png").string();
+	std::string other = fs::weakly_canonical(folder / "other.png").string();
+	std::ofstream(path, std::ios::binary) << "original";
+	std::ofstream(other, std::ios::binary) << "untouched";
+
+	auto waitForChanges = [](FileWatcher& watcher, int timeoutMs)
+	{
+		std::vector<std::string> changed;
+		sf::Clock timer;
+		while (timer.getElapsedTime().asMilliseconds() < timeoutMs)
+		{
+			auto batch = watcher.TakeChanged();
+			changed.insert(changed.end(), batch.begin(), batch.end());
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		}
+		return changed;
+	};
+
+	for (bool forcePolling : { false, true })
+	{
+		FileWatcher watcher;
+		watcher.Start(200, forcePolling);
+		watcher.SetFiles({ path, other });
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+		// an editor writing in several steps, then replacing the file by renaming over it
+		{
+			std::ofstream out(path, std::ios::binary | std::ios::trunc);
+			out << "half";
+			out.flush();
+			std::this_thread::sleep_for(std::chrono::milliseconds(60));
+			out << " and the rest";
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(60));
+		std::ofstream(path + ".new", std::ios::binary) << "final contents" << forcePolling;
+		fs::rename(path + ".new", path);
+
+		auto changed = waitForChanges(watcher, 1500);
+		ASSERT_EQ(changed.size(), 1) << (forcePolling ? "polling" : "native");
+		EXPECT_EQ(changed[0], path);
+
+		// nothing else happened
+		EXPECT_TRUE(waitForChanges(watcher, 500).empty());
+		watcher.Stop();
+	}
+}
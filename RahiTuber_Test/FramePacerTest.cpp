@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "FramePacer.h"
+
+#include <cmath>
+
+// The mean and standard deviation of the gaps between frame times, in ms
+static double FrameTimeDeviation(const std::vector<double>& times, double& meanMs)
+{
+	double sum = 0, sumSq = 0;
+	for (size_t f = 1; f < times.size(); f++)
+	{
+		double dt = times[f] - times[f - 1];
+		sum += dt;
+		sumSq += dt * dt;
+	}
+	double n = (double)(times.size() - 1);
+	meanMs = sum / n * 1000;
+	return std::sqrt(std::max(0.0, sumSq / n - (sum / n) * (sum / n))) * 1000;
+}
+
+TEST(FramePacerTest, HoldsSteadyFrameTimes) {
+
+	const int fps = 100;
+	const int frames = 60;
+	const double period = 1.0 / fps;
+
+	FramePacer pacer;
+	pacer.SetRates(fps, 0);
+	std::vector<double> times;
+	for (int f = 0; f < frames; f++)
+	{
+		pacer.Wait();
+		times.push_back(pacer.Now());
+	}
+	double pacerMean = 0;
+	FrameTimeDeviation(times, pacerMean);
+
+	EXPECT_NEAR(pacerMean, period * 1000, 0.5);
+	EXPECT_GT(pacer.SmoothedFps(), fps * 0.9f);
+	EXPECT_LT(pacer.SmoothedFps(), fps * 1.1f);
+
+	// nothing going on, so it drops to the idle rate until something happens
+	pacer.SetRates(fps, 20);
+	pacer.Wait();
+	double idleStart = pacer.Now();
+	for (int f = 0; f < 5; f++)
+		pacer.Wait();
+	EXPECT_TRUE(pacer.IsIdle());
+	EXPECT_NEAR(pacer.Now() - idleStart, 5 * 0.05, 0.05);
+
+	pacer.MarkActive();
+	pacer.Wait();
+	EXPECT_FALSE(pacer.IsIdle());
+}
+
+TEST(FramePacerTest, DISABLED_BenchmarkAgainstSleep) {
+
+	const int fps = 100;
+	const int frames = 60;
+	const double period = 1.0 / fps;
+
+	// the old way, sleeping off whatever is left of the frame like setFramerateLimit does
+	std::vector<double> times;
+	sf::Clock clock;
+	sf::Clock frameClock;
+	double cpuStart = FramePacer::ProcessCpuSeconds();
+	for (int f = 0; f < frames; f++)
+	{
+		sf::sleep(sf::seconds(period) - frameClock.getElapsedTime());
+		frameClock.restart();
+		times.push_back(clock.getElapsedTime().asMicroseconds() * 0.000001);
+	}
+	double sleepCpu = FramePacer::ProcessCpuSeconds() - cpuStart;
+	double sleepMean = 0;
+	double sleepJitter = FrameTimeDeviation(times, sleepMean);
+
+	FramePacer pacer;
+	pacer.SetRates(fps, 0);
+	times.clear();
+	cpuStart = FramePacer::ProcessCpuSeconds();
+	for (int f = 0; f < frames; f++)
+	{
+		pacer.Wait();
+		times.push_back(pacer.Now());
+	}
+	double pacerCpu = FramePacer::ProcessCpuSeconds() - cpuStart;
+	double pacerMean = 0;
+	double pacerJitter = FrameTimeDeviation(times, pacerMean);
+
+	std::cout << "Sleep limiter: " << sleepMean << "ms mean, " << sleepJitter << "ms jitter, " << sleepCpu * 1000 << "ms CPU" << std::endl;
+	std::cout << "Frame pacer:   " << pacerMean << "ms mean, " << pacerJitter << "ms jitter, " << pacerCpu * 1000 << "ms CPU" << std::endl;
+
+	EXPECT_NEAR(pacerMean, period * 1000, 0.5);
+}
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "FrameRecorder.h"
+#include "TextureManager.h"
+
+// Recordings go to the test's temp folder
+using FrameRecorderTest = TempFolderTest;
+
+// A soft-edged disc on a transparent background, roughly what an avatar frame looks like
+static std::vector<uint8_t> MakeAvatarFrame(unsigned int width, unsigned int height)
+{
+	std::vector<uint8_t> pixels(width * height * 4, 0);
+	for (unsigned int y = 0; y < height; y++)
+	{
+		for (unsigned int x = 0; x < width; x++)
+		{
+			float dist = Length(sf::Vector2f(x - width * 0.5f, y - height * 0.5f));
+			uint8_t* px = &pixels[(y * width + x) * 4];
+			px[0] = (uint8_t)(x / 3);
+			px[1] = (uint8_t)(y / 2);
+			px[2] = 120;
+			px[3] = (uint8_t)(255 * Clamp((150.f - dist) / 10.f));
+		}
+	}
+	return pixels;
+}
+
+TEST_F(FrameRecorderTest, QueueDropAccounting) {
+
+	const unsigned int width = 640;
+	const unsigned int height = 360;
+	const int numFrames = 60;
+
+	std::vector<uint8_t> pixels = MakeAvatarFrame(width, height);
+
+
+	FrameRecorder recorder;
+	ASSERT_TRUE(recorder.Start(folder, FrameRecorder::FORMAT_QOI, 1, 2));
+
+	// pushed far faster than one encoder can keep up with, so some frames must be dropped
+	for (int f = 1; f <= numFrames; f++)
+		recorder.PushFrame(pixels.data(), width, height, f, false);
+
+	recorder.Stop();
+
+	EXPECT_EQ(recorder.FramesCaptured(), (unsigned long long)numFrames);
+	EXPECT_EQ(recorder.FramesWritten() + recorder.FramesDroppedByQueue() + recorder.WriteFailures(), recorder.FramesCaptured());
+	EXPECT_GT(recorder.FramesWritten(), 0ull);
+
+	int files = 0;
+	for (auto& entry : fs::directory_iterator(folder))
+	{
+		std::ifstream file(entry.path(), std::ios::binary);
+		char magic[4] = {};
+		file.read(magic, 4);
+		EXPECT_EQ(std::string(magic, 4), "qoif");
+		files++;
+	}
+	EXPECT_EQ((unsigned long long)files, recorder.FramesWritten());
+}
+
+TEST_F(FrameRecorderTest, DISABLED_BenchmarkPush) {
+
+	const unsigned int width = 640;
+	const unsigned int height = 360;
+	const int numFrames = 60;
+
+	std::vector<uint8_t> pixels = MakeAvatarFrame(width, height);
+
+
+	FrameRecorder recorder;
+	ASSERT_TRUE(recorder.Start(folder, FrameRecorder::FORMAT_QOI, 1, 2));
+
+	// the time the render thread spends handing a frame over
+	sf::Clock timer;
+	for (int f = 1; f <= numFrames; f++)
+		recorder.PushFrame(pixels.data(), width, height, f, false);
+	float pushMicros = timer.getElapsedTime().asMicroseconds() / (float)numFrames;
+
+	recorder.Stop();
+
+	std::cout << "FrameRecorder: " << recorder.FramesWritten() << " written, " << recorder.FramesDroppedByQueue() << " dropped, "
+		<< pushMicros << "us per push" << std::endl;
+
+	EXPECT_EQ(recorder.FramesCaptured(), (unsigned long long)numFrames);
+}
+
+TEST_F(FrameRecorderTest, WritesStraightAlpha) {
+
+	// the render target holds premultiplied pixels, the files should hold the straight colours
+	std::vector<uint8_t> straight = {
+		200, 100, 50, 255,
+		200, 100, 50, 192,
+		200, 100, 50, 64,
+		200, 100, 50, 0,
+	};
+	std::vector<uint8_t> premultiplied(straight.size());
+	TextureManager::Premultiply(straight.data(), premultiplied.data(), 4);
+
+
+	FrameRecorder recorder;
+	ASSERT_TRUE(recorder.Start(folder, FrameRecorder::FORMAT_PNG, 1, 2));
+	ASSERT_TRUE(recorder.PushFrame(premultiplied.data(), 4, 1, 1, false));
+	recorder.Stop();
+	ASSERT_EQ(recorder.FramesWritten(), 1ull);
+
+	sf::Image img;
+	ASSERT_TRUE(img.loadFromFile((folder / "frame_000001.png").string()));
+	const uint8_t* written = img.getPixelsPtr();
+	for (int i = 0; i < 12; i += 4)
+	{
+		EXPECT_EQ(written[i + 3], straight[i + 3]);
+		for (int c = 0; c < 3; c++)
+			EXPECT_NEAR(written[i + c], straight[i + c], 2);
+	}
+	EXPECT_EQ(written[15], 0);
+}
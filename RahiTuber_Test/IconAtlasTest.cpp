@@ -0,0 +1,168 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "IconAtlas.h"
+#include "TextureManager.h"
+#include "imgui.h"
+
+// Draws rows shaped like the layer list header, a name then seven framed icon buttons, and counts draw calls
+static int CountLayerRowDrawCalls(int rows, const std::function<void(int icon, ImTextureID& tex, ImVec2& uv0, ImVec2& uv1)>& iconRegion)
+{
+	ImGuiContext* previous = ImGui::GetCurrentContext();
+	ImGuiContext* context = ImGui::CreateContext();
+	ImGui::SetCurrentContext(context);
+
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = { 600, 2000 };
+	io.DeltaTime = 1.f / 60;
+
+	std::vector<int> iconRects;
+	for (int i = 0; i < 7; i++)
+		iconRects.push_back(io.Fonts->AddCustomRectRegular(64, 64));
+
+	unsigned char* pixels = nullptr;
+	int width = 0, height = 0;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+	io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos({ 0, 0 });
+	ImGui::SetNextWindowSize(io.DisplaySize);
+	ImGui::Begin("Layers");
+	for (int r = 0; r < rows; r++)
+	{
+		ImGui::PushID(r);
+		ImGui::Text("Layer %d", r);
+		for (int i = 0; i < 7; i++)
+		{
+			ImTextureID tex = (ImTextureID)(intptr_t)1;
+			ImVec2 uv0, uv1;
+			io.Fonts->CalcCustomRectUV(io.Fonts->GetCustomRectByIndex(iconRects[i]), &uv0, &uv1);
+			iconRegion(i, tex, uv0, uv1);
+
+			ImGui::SameLine();
+			ImGui::PushID(i);
+			ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0, 0, 0, 0.25f));
+			ImGui::ImageButton("icon", tex, { 20, 20 }, uv0, uv1);
+			ImGui::PopStyleColor();
+			ImGui::PopID();
+		}
+		ImGui::PopID();
+	}
+	ImGui::End();
+	ImGui::Render();
+
+	int drawCalls = 0;
+	for (const ImDrawList* list : ImGui::GetDrawData()->CmdLists)
+		drawCalls += list->CmdBuffer.Size;
+
+	ImGui::DestroyContext(context);
+	ImGui::SetCurrentContext(previous);
+	return drawCalls;
+}
+
+using IconAtlasTest = TempFolderTest;
+
+TEST_F(IconAtlasTest, PacksIconsAndBatchesLayerRows) {
+
+	// the compiled in atlas keeps every icon inside it, with its repeated edge clear of the others
+	const size_t iconCount = sizeof(IconAtlasRects) / sizeof(IconAtlasRects[0]);
+	EXPECT_EQ(iconCount, (size_t)TextureManager::ICON_TAG + 1);
+	for (size_t a = 0; a < iconCount; a++)
+	{
+		const IconAtlasRect& icon = IconAtlasRects[a];
+		sf::IntRect rectA(icon.left - 1, icon.top - 1, icon.width + 2, icon.height + 2);
+		EXPECT_GE(rectA.left, 0);
+		EXPECT_GE(rectA.top, 0);
+		EXPECT_LE(rectA.left + rectA.width, (int)IconAtlasWidth);
+		EXPECT_LE(rectA.top + rectA.height, (int)IconAtlasHeight);
+
+		for (size_t b = a + 1; b < iconCount; b++)
+		{
+			const IconAtlasRect& other = IconAtlasRects[b];
+			sf::IntRect rectB(other.left - 1, other.top - 1, other.width + 2, other.height + 2);
+			EXPECT_FALSE(rectA.intersects(rectB)) << icon.file << " overlaps " << other.file;
+		}
+	}
+
+	sf::Image embedded;
+	ASSERT_TRUE(embedded.loadFromMemory(IconAtlasPng, sizeof(IconAtlasPng)));
+	EXPECT_EQ(embedded.getSize(), sf::Vector2u(IconAtlasWidth, IconAtlasHeight));
+
+	// without res/icons.png every icon comes from the compiled in atlas
+	fs::create_directories(folder / "res");
+	const std::string appLocation = folder.string() + "/";
+
+	auto iconPixel = [](TextureManager& texMan, TextureManager::IconID id)
+	{
+		const sf::Sprite* icon = texMan.GetIcon(id);
+		if (icon == nullptr || icon->getTexture() == nullptr)
+			return sf::Color::Transparent;
+		sf::IntRect rect = icon->getTextureRect();
+		return icon->getTexture()->copyToImage().getPixel(rect.left + rect.width / 2, rect.top + rect.height / 2);
+	};
+
+	{
+		TextureManager texMan;
+		texMan.LoadIcons(appLocation);
+		for (int id = 0; id <= TextureManager::ICON_TAG; id++)
+		{
+			const sf::Sprite* icon = texMan.GetIcon((TextureManager::IconID)id);
+			ASSERT_NE(icon, nullptr) << id;
+			EXPECT_GT(icon->getTextureRect().width, 0) << id;
+		}
+		sf::IntRect rect = texMan.GetIcon(TextureManager::ICON_TAG)->getTextureRect();
+		EXPECT_EQ(iconPixel(texMan, TextureManager::ICON_TAG), embedded.getPixel(rect.left + rect.width / 2, rect.top + rect.height / 2));
+	}
+
+	// one with the same layout replaces it, one that doesn't match is ignored
+	auto magenta = [](unsigned int x, unsigned int y) { return sf::Color::Magenta; };
+	WriteImage(fs::path("res") / "icons.png", IconAtlasWidth, IconAtlasHeight, magenta);
+	{
+		TextureManager texMan;
+		texMan.LoadIcons(appLocation);
+		EXPECT_EQ(iconPixel(texMan, TextureManager::ICON_TAG), sf::Color::Magenta);
+	}
+
+	WriteImage(fs::path("res") / "icons.png", 4, 4, magenta);
+	{
+		TextureManager texMan;
+		texMan.LoadIcons(appLocation);
+		EXPECT_NE(iconPixel(texMan, TextureManager::ICON_TAG), sf::Color::Magenta);
+	}
+
+	// in the font atlas, each icon's edge is repeated a pixel out
+	const uint8_t icon[2 * 2 * 4] = { 1,1,1,1, 2,2,2,2, 3,3,3,3, 4,4,4,4 };
+	std::vector<uint8_t> fontPixels(5 * 4 * 4, 0);
+	TextureManager::CopyWithEdges(icon, 2, 2, fontPixels.data(), 5, 1, 1, 1);
+	const uint8_t expected[4][5] = {
+		{ 1, 1, 2, 2, 0 },
+		{ 1, 1, 2, 2, 0 },
+		{ 3, 3, 4, 4, 0 },
+		{ 3, 3, 4, 4, 0 },
+	};
+	for (int y = 0; y < 4; y++)
+		for (int x = 0; x < 5; x++)
+			EXPECT_EQ(fontPixels[(y * 5 + x) * 4 + 3], expected[y][x]) << x << "," << y;
+
+	const int rows = 30;
+
+	// a texture per icon, the way the icons were loaded before
+	int separate = CountLayerRowDrawCalls(rows, [](int icon, ImTextureID& tex, ImVec2& uv0, ImVec2& uv1) {
+		tex = (ImTextureID)(intptr_t)(10 + icon);
+		uv0 = { 0, 0 };
+		uv1 = { 1, 1 };
+		});
+
+	// one icon atlas, but the button frames and labels still come from the font texture
+	int iconAtlas = CountLayerRowDrawCalls(rows, [](int icon, ImTextureID& tex, ImVec2& uv0, ImVec2& uv1) {
+		tex = (ImTextureID)(intptr_t)2;
+		});
+
+	// icons packed into the font atlas
+	int fontAtlas = CountLayerRowDrawCalls(rows, [](int icon, ImTextureID& tex, ImVec2& uv0, ImVec2& uv1) {});
+
+	EXPECT_GE(separate, rows * 7);
+	EXPECT_LT(fontAtlas * 10, separate) << rows << " layer rows: " << separate << " draw calls with separate icon textures, "
+		<< iconAtlas << " with an icon atlas, " << fontAtlas << " with the icons in the font atlas";
+}
@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "LatencyTracker.h"
+
+TEST(LatencyTrackerTest, FollowsInputsToTheDisplay) {
+
+	LatencyTracker latency;
+
+	// a frame: an input 20ms old is handled, drawn and displayed
+	double input = LatencyTracker::Now() - 0.02;
+	latency.Begin(LatencyTracker::SourceAudio, input);
+	latency.Mark(LatencyTracker::StageDrawn);
+
+	// one that arrives after the layers were drawn waits for the next frame
+	latency.Begin(LatencyTracker::SourceHTTP, LatencyTracker::Now());
+	latency.FrameDisplayed();
+
+	auto audio = latency.GetStats(LatencyTracker::SourceAudio);
+	ASSERT_EQ(audio.count, 1);
+	EXPECT_GE(audio.p50Ms, 20.f);
+	EXPECT_LE(audio.stageMeanMs[LatencyTracker::StageHandled], audio.stageMeanMs[LatencyTracker::StageDrawn]);
+	EXPECT_LE(audio.stageMeanMs[LatencyTracker::StageDrawn], audio.meanMs);
+	EXPECT_EQ(latency.GetStats(LatencyTracker::SourceHTTP).count, 0);
+
+	latency.Mark(LatencyTracker::StageDrawn);
+	latency.FrameDisplayed();
+	EXPECT_EQ(latency.GetStats(LatencyTracker::SourceHTTP).count, 1);
+
+	// only the last History samples count
+	for (int i = 0; i < LatencyTracker::History + 10; i++)
+	{
+		latency.Begin(LatencyTracker::SourceHotkey, LatencyTracker::Now() - 0.001 * (i % 10));
+		latency.Mark(LatencyTracker::StageDrawn);
+		latency.FrameDisplayed();
+	}
+	auto hotkey = latency.GetStats(LatencyTracker::SourceHotkey);
+	EXPECT_EQ(hotkey.count, LatencyTracker::History);
+	EXPECT_LE(hotkey.p50Ms, hotkey.p95Ms);
+	EXPECT_LE(hotkey.p95Ms, hotkey.maxMs);
+
+	EXPECT_NE(latency.StatsJson().find("\"hotkey\":{\"count\":256"), std::string::npos) << latency.StatsJson();
+
+	// ADC times come on the stream's clock
+	double now = LatencyTracker::Now();
+	EXPECT_NEAR(LatencyTracker::FromStreamTime(99.95, 100.0), now - 0.05, 0.01);
+	EXPECT_NEAR(LatencyTracker::FromStreamTime(0, 0), now, 0.01);
+}
@@ -0,0 +1,123 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "LayerFrameState.h"
+
+#include <algorithm>
+
+TEST(LayerFrameStateTest, ResolvesLinksAndVisibility) {
+
+	// 0 <- 1 <- 2 motion chain, 3 in folder 4, 5 clips to 2
+	LayerFrameState state;
+	state.Begin(6);
+	for (int l = 0; l < 6; l++)
+		state.SetId(l, "layer" + std::to_string(l));
+
+	state.SetLink(LayerFrameState::LinkMotionParent, 1, "layer0");
+	state.SetLink(LayerFrameState::LinkMotionParent, 2, "layer1");
+	state.SetLink(LayerFrameState::LinkFolder, 3, "layer4");
+	state.SetLink(LayerFrameState::LinkClip, 5, "layer2");
+	state.SetLink(LayerFrameState::LinkBlinkSync, 4, "missing");
+
+	state.SetOwnVisibility(0, false, true);
+	state.SetOwnVisibility(1, true, false);
+	state.SetOwnVisibility(2, true, true);
+	state.SetOwnVisibility(3, true, true);
+	state.SetOwnVisibility(4, false, true);
+	state.SetOwnVisibility(5, true, true);
+	state.Finish();
+
+	EXPECT_EQ(state.GetLink(LayerFrameState::LinkBlinkSync, 4), -1);
+	EXPECT_EQ(state.Depth(0), 0);
+	EXPECT_EQ(state.Depth(2), 2);
+
+	// 1 doesn't hide with its parent, so 2 stays visible even though 0 is hidden
+	EXPECT_TRUE(state.Visible(1));
+	EXPECT_TRUE(state.Visible(2));
+	EXPECT_FALSE(state.Visible(3));
+
+	EXPECT_TRUE(state.NeededByOthers(0));
+	EXPECT_TRUE(state.NeededByOthers(2));
+	EXPECT_FALSE(state.NeededByOthers(4));
+
+	// parents come before their children
+	auto& order = state.CalculateOrder();
+	auto pos = [&](int l) { return std::find(order.begin(), order.end(), l) - order.begin(); };
+	EXPECT_LT(pos(0), pos(1));
+	EXPECT_LT(pos(1), pos(2));
+}
+
+TEST(LayerFrameStateTest, DISABLED_BenchmarkRebuild) {
+
+	// 500 layers in chains of 5, each following the previous one in the chain
+	const int numLayers = 500;
+	const int numFrames = 200;
+
+	struct Layer
+	{
+		std::string id, motionParent, clip;
+		bool visible = true;
+	};
+	std::vector<Layer> layers(numLayers);
+	for (int l = 0; l < numLayers; l++)
+	{
+		layers[l].id = "layer" + std::to_string(l);
+		if (l % 5 != 0)
+			layers[l].motionParent = layers[l - 1].id;
+		layers[l].visible = (l % 7) != 0;
+	}
+
+	auto find = [&](const std::string& id) -> int {
+		if (id == "")
+			return -1;
+		for (int l = 0; l < numLayers; l++)
+			if (layers[l].id == id)
+				return l;
+		return -1;
+	};
+
+	// previous approach: search the layer list by id while walking parents, and scan every layer for dependents
+	int oldChecksum = 0;
+	sf::Clock timer;
+	for (int f = 0; f < numFrames; f++)
+	{
+		for (int l = 0; l < numLayers; l++)
+		{
+			bool visible = layers[l].visible;
+			for (int mp = find(layers[l].motionParent); mp != -1; mp = find(layers[mp].motionParent))
+				visible &= layers[mp].visible;
+
+			bool needed = false;
+			for (int o = 0; o < numLayers && !needed; o++)
+				needed = layers[o].motionParent == layers[l].id || layers[o].clip == layers[l].id;
+
+			oldChecksum += visible + needed;
+		}
+	}
+	float oldMicros = timer.getElapsedTime().asMicroseconds() / (float)numFrames;
+
+	LayerFrameState state;
+	int newChecksum = 0;
+	timer.restart();
+	for (int f = 0; f < numFrames; f++)
+	{
+		state.Begin(numLayers);
+		for (int l = 0; l < numLayers; l++)
+			state.SetId(l, layers[l].id);
+		for (int l = 0; l < numLayers; l++)
+		{
+			state.SetLink(LayerFrameState::LinkMotionParent, l, layers[l].motionParent);
+			state.SetLink(LayerFrameState::LinkClip, l, layers[l].clip);
+			state.SetOwnVisibility(l, layers[l].visible, true);
+		}
+		state.Finish();
+
+		for (int l = 0; l < numLayers; l++)
+			newChecksum += state.Visible(l) + state.NeededByOthers(l);
+	}
+	float newMicros = timer.getElapsedTime().asMicroseconds() / (float)numFrames;
+
+	std::cout << "LayerFrameState: " << numLayers << " layers, id search " << oldMicros << "us per frame, indexed " << newMicros << "us per frame" << std::endl;
+
+	EXPECT_EQ(oldChecksum, newChecksum);
+}
@@ -0,0 +1,70 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "LayerSetSaver.h"
+
+#include <atomic>
+#include <mutex>
+
+using LayerSetSaverTest = TempFolderTest;
+
+TEST_F(LayerSetSaverTest, CoalescesAndWritesAtomically) {
+
+	std::string path = (folder / "layers.xml").string();
+
+	LayerSetSaver saver;
+	std::atomic<int> serialized = 0;
+
+	// the first save blocks the thread until every later one is queued
+	std::mutex gate;
+	std::atomic<bool> started = false;
+	gate.lock();
+	saver.Save(path, [&](std::string& contents, std::string& error)
+		{
+			started = true;
+			std::lock_guard<std::mutex> lock(gate);
+			serialized++;
+			contents = "first";
+			return true;
+		});
+
+	while (!started)
+		std::this_thread::yield();
+
+	const int numSaves = 50;
+	for (int s = 0; s < numSaves; s++)
+	{
+		saver.Save(path, [&, s](std::string& contents, std::string& error)
+			{
+				serialized++;
+				contents = "save " + std::to_string(s);
+				return true;
+			});
+	}
+	gate.unlock();
+	saver.Flush();
+
+	// only the newest queued save is serialised
+	EXPECT_EQ(serialized, 2);
+	EXPECT_EQ(saver.WritesSkipped(), numSaves - 1);
+
+	std::ifstream file(path, std::ios::binary);
+	std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
+	EXPECT_EQ(written, "save " + std::to_string(numSaves - 1));
+	EXPECT_FALSE(fs::exists(path + ".tmp"));
+
+	// identical contents aren't written again, failures are reported
+	saver.Save(path, [](std::string& contents, std::string& error) { contents = "save 49"; return true; });
+	saver.Save((folder / "missing" / "layers.xml").string(), [](std::string& contents, std::string& error) { contents = "x"; return true; });
+	saver.Flush();
+
+	auto results = saver.TakeResults();
+	ASSERT_EQ(results.size(), 4);
+	EXPECT_TRUE(results[2].ok);
+	EXPECT_TRUE(results[2].unchanged);
+	EXPECT_FALSE(results[3].ok);
+	EXPECT_NE(results[3].error, "");
+
+	saver.Stop();
+}
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "MenuRefresh.h"
+#include "imgui.h"
+
+TEST(MenuRefreshTest, SkipsIdlePassesAndUnchangedFrames) {
+
+	MenuRefresh refresh;
+
+	// input runs every frame for a moment, then it drops to the idle rate
+	double time = 0;
+	int passes = 0;
+	refresh.Wake();
+	for (int f = 0; f < 600; f++, time += 1.0 / 60)
+	{
+		if (refresh.NeedsUpdate(time))
+		{
+			refresh.PassFinished(time, 2.f, false);
+			passes++;
+		}
+	}
+	EXPECT_GT(passes, 15 + 9 * 12) << "menu passes over 10s";
+	EXPECT_LT(passes, 15 + 10 * 20) << "menu passes over 10s";
+	EXPECT_EQ(refresh.PassesSkipped(), 600u - passes);
+	EXPECT_NEAR(refresh.SecondsSaved(), refresh.PassesSkipped() * 0.002, 1e-6);
+
+	// dragging a slider keeps it at full rate
+	refresh.PassFinished(time, 2.f, true);
+	EXPECT_TRUE(refresh.NeedsUpdate(time + 0.001));
+
+	ImDrawList list(nullptr);
+	ImDrawVert vert = {};
+	for (int v = 0; v < 4; v++)
+	{
+		vert.pos = ImVec2((float)v, 1.f);
+		list.VtxBuffer.push_back(vert);
+		list.IdxBuffer.push_back((ImDrawIdx)v);
+	}
+	ImDrawCmd cmd;
+	cmd.ClipRect = ImVec4(0, 0, 100, 100);
+	cmd.ElemCount = 4;
+	list.CmdBuffer.push_back(cmd);
+
+	ImDrawData drawData;
+	drawData.Valid = true;
+	drawData.DisplaySize = ImVec2(100, 100);
+	drawData.AddDrawList(&list);
+
+	// the first frame is always drawn, the same again can be left alone unless it can't be reused
+	EXPECT_TRUE(refresh.NeedsRender(&drawData, true));
+	EXPECT_FALSE(refresh.NeedsRender(&drawData, true));
+	EXPECT_TRUE(refresh.NeedsRender(&drawData, false));
+	EXPECT_EQ(refresh.RendersSkipped(), 1u);
+
+	// one vertex moving half a pixel is a different frame
+	list.VtxBuffer[2].pos.x += 0.5f;
+	EXPECT_TRUE(refresh.NeedsRender(&drawData, true));
+
+	refresh.Invalidate();
+	EXPECT_TRUE(refresh.NeedsRender(&drawData, true));
+}
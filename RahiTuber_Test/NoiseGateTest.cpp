@@ -0,0 +1,86 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "Config.h"
+#include "ChannelAnalyser.h"
+#include "NoiseGate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+TEST(NoiseGateTest, GatesRoomNoiseAndSkipsAnalysis) {
+
+	const float sampleRate = 44100;
+	const int buffer = 512;
+	const float blockSeconds = buffer / sampleRate;
+
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<float> noise(-1.f, 1.f);
+	unsigned long long frame = 0;
+
+	// words of 250ms with 100ms between them
+	auto makeBlock = [&](float noiseLevel, float voiceLevel)
+	{
+		std::vector<float> block(buffer);
+		for (auto& spl : block)
+		{
+			float t = frame++ / sampleRate;
+			bool inWord = std::fmod(t, 0.35f) < 0.25f;
+			spl = noise(rng) * noiseLevel + (inWord ? std::sin(2.f * 3.14159265f * 220.f * t) * voiceLevel : 0.f);
+		}
+		return block;
+	};
+
+	NoiseGate gate;
+	std::vector<real_type> window(FRAMES_PER_BUFFER * 2, 0.f);
+	ChannelAnalyser::Bands bands;
+	std::vector<complex_type> frequencyData;
+	std::vector<float> powerSpectrum;
+
+	// the callback's RMS, then the analysis doAudioAnalysis does with the voice gate on
+	auto run = [&](float seconds, float noiseLevel, float voiceLevel, float& openFraction)
+	{
+		int blocks = (int)(seconds / blockSeconds);
+		int open = 0;
+		for (int b = 0; b < blocks; b++)
+		{
+			auto block = makeBlock(noiseLevel, voiceLevel);
+
+			double sumSquares = 0;
+			for (float spl : block)
+				sumSquares += spl * spl;
+
+			if (gate.Process(std::sqrt(sumSquares / buffer), blockSeconds))
+			{
+				open++;
+				std::rotate(window.begin(), window.begin() + buffer, window.end());
+				for (int s = 0; s < buffer; s++)
+					window[window.size() - buffer + s] = block[s] * block[s];
+				ChannelAnalyser::MeasureBands(window, ChannelAnalyser::BandSplits(), bands, frequencyData, powerSpectrum);
+			}
+		}
+		openFraction = open / (float)blocks;
+	};
+
+	float openFraction = 0;
+
+	run(2.f, 0.003f, 0.f, openFraction);
+	EXPECT_EQ(openFraction, 0.f) << "room noise opened the gate";
+
+	// the pauses between words are shorter than the hangover
+	run(2.f, 0.003f, 0.1f, openFraction);
+	EXPECT_GT(openFraction, 0.95f) << "the voice didn't hold the gate open";
+
+	run(1.f, 0.003f, 0.f, openFraction);
+	EXPECT_FALSE(gate.IsOpen()) << "the gate didn't close after the hangover";
+
+	// a fan comes on, ten times louder than the room. Once it's been going for the floor's window it's learned.
+	run(NoiseGate::FloorWindowSeconds + 1.f, 0.03f, 0.f, openFraction);
+	EXPECT_FALSE(gate.IsOpen()) << "the floor didn't learn the fan";
+	EXPECT_GT(gate.Floor(), 0.01f);
+
+	// and a voice over the fan still opens it
+	run(1.f, 0.03f, 0.3f, openFraction);
+	EXPECT_GT(openFraction, 0.9f);
+}
@@ -0,0 +1,59 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "Config.h"
+#include "LayerManager.h"
+#include "PhonemeClassifier.h"
+
+#include <random>
+
+// Calibrates two fake "sounds" with different spectral tilt, enough for two classes. The spectrum is left as the second.
+static void CalibrateTwoSounds(PhonemeClassifier& classifier, std::vector<float>& spectrum)
+{
+	const int fftSize = (int)spectrum.size();
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+	for (int b = 0; b < fftSize; b++)
+		spectrum[b] = dist(rng) / (1 + b);
+	classifier.StartCalibration(PH_NONE);
+	classifier.Process(spectrum.data(), fftSize, SAMPLE_RATE);
+
+	for (int b = 0; b < fftSize; b++)
+		spectrum[b] = dist(rng) * b;
+	classifier.StartCalibration(PH_S);
+	classifier.Process(spectrum.data(), fftSize, SAMPLE_RATE);
+	classifier.StopCalibration();
+}
+
+TEST(PhonemeClassifierTest, ClassifiesCalibratedSounds) {
+
+	PhonemeClassifier classifier;
+
+	const int fftSize = FRAMES_PER_BUFFER * 2;
+	std::vector<float> spectrum(fftSize);
+	CalibrateTwoSounds(classifier, spectrum);
+
+	EXPECT_EQ(classifier.Process(spectrum.data(), fftSize, SAMPLE_RATE), PH_S);
+}
+
+TEST(PhonemeClassifierTest, DISABLED_BenchmarkProcess) {
+
+	PhonemeClassifier classifier;
+
+	const int fftSize = FRAMES_PER_BUFFER * 2;
+	std::vector<float> spectrum(fftSize);
+	CalibrateTwoSounds(classifier, spectrum);
+
+	const int iterations = 10000;
+	int detected = 0;
+	sf::Clock timer;
+	for (int i = 0; i < iterations; i++)
+		detected += classifier.Process(spectrum.data(), fftSize, SAMPLE_RATE);
+
+	float microsPerBlock = timer.getElapsedTime().asMicroseconds() / (float)iterations;
+	std::cout << "PhonemeClassifier::Process: " << microsPerBlock << "us per block" << std::endl;
+
+	EXPECT_EQ(detected, iterations * PH_S);
+	EXPECT_LT(microsPerBlock, 300.f);
+}
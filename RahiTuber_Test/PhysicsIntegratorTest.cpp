@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "PhysicsIntegrator.h"
+
+#include <cmath>
+
+// Runs one physics body after a moving target at the given framerate, sampling the drawn position at a fixed interval
+static std::vector<sf::Vector2<double>> RunPhysicsTrajectory(double fps, int substeps, double drag, double spring)
+{
+	auto target = [](double t) { return sf::Vector2<double>(60.0 * sin(t * 2.0), 40.0 * sin(t * 5.0)); };
+
+	const double duration = 3.0;
+	const double sampleInterval = 1.0 / 30.0;
+
+	PhysicsIntegrator physics;
+	physics._substeps = substeps;
+	int slot = -1;
+	auto body = physics.Acquire(&physics, slot);
+	physics.Reset(*body, target(0));
+
+	std::vector<sf::Vector2<double>> samples;
+	double dt = 1.0 / fps;
+	double nextSample = sampleInterval;
+	for (double t = dt; t < duration + 1e-9; t += dt)
+	{
+		auto pos = physics.Advance(*body, target(t), dt, drag, spring);
+		if (t >= nextSample - 1e-9)
+		{
+			samples.push_back(pos);
+			nextSample += sampleInterval;
+		}
+	}
+
+	return samples;
+}
+
+TEST(PhysicsIntegratorTest, FramerateIndependence) {
+
+	for (double spring : { 0.5, 0.9, 0.97 })
+	{
+		for (int substeps : { 1, 4 })
+		{
+			auto reference = RunPhysicsTrajectory(1920, substeps, 0.3, spring);
+			auto at30 = RunPhysicsTrajectory(30, substeps, 0.3, spring);
+			auto at240 = RunPhysicsTrajectory(240, substeps, 0.3, spring);
+
+			ASSERT_EQ(at30.size(), reference.size());
+			ASSERT_EQ(at240.size(), reference.size());
+
+			double maxError30 = 0;
+			double maxError240 = 0;
+			for (size_t s = 0; s < reference.size(); s++)
+			{
+				maxError30 = Max(maxError30, Length(at30[s] - reference[s]));
+				maxError240 = Max(maxError240, Length(at240[s] - reference[s]));
+			}
+
+			// the target moves up to 60px, the drawn path should be within 0.2px of the reference at any framerate
+			EXPECT_LT(maxError30, 0.2) << "spring " << spring << ", " << substeps << " substeps at 30fps";
+			EXPECT_LT(maxError240, 0.2) << "spring " << spring << ", " << substeps << " substeps at 240fps";
+		}
+	}
+}
+
+TEST(PhysicsIntegratorTest, DISABLED_BenchmarkStep) {
+
+	const int numBodies = 500;
+	const int numFrames = 600;
+
+	PhysicsIntegrator physics;
+	physics._substeps = 4;
+
+	std::vector<int> slots(numBodies, -1);
+	for (int b = 0; b < numBodies; b++)
+		physics.Reset(*physics.Acquire(&slots[b], slots[b]), { 0, 0 });
+
+	double checksum = 0;
+	sf::Clock timer;
+	for (int f = 0; f < numFrames; f++)
+	{
+		sf::Vector2<double> target(50.0 * sin(f * 0.1), 0);
+		for (int b = 0; b < numBodies; b++)
+			checksum += physics.Advance(*physics.Acquire(&slots[b], slots[b]), target, 1.0 / 144.0, 0.3, 0.9).x;
+		physics.ReleaseUntouched();
+	}
+
+	float microsPerFrame = timer.getElapsedTime().asMicroseconds() / (float)numFrames;
+	std::cout << "PhysicsIntegrator: " << microsPerFrame << "us per frame for " << numBodies << " bodies (checksum " << checksum << ")" << std::endl;
+
+	EXPECT_EQ(physics.ActiveBodies(), numBodies);
+}
@@ -0,0 +1,35 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "AsyncReadback.h"
+#include "TextureManager.h"
+
+TEST(SharedFrameSinkTest, PublishesPremultipliedPixelsUnchanged) {
+
+	// a 2x2 readback, bottom row first, of layers drawn premultiplied: half-alpha on the bottom row, opaque on top
+	std::vector<uint8_t> straight = {
+		200, 100, 50, 128,		40, 80, 160, 128,
+		200, 100, 50, 255,		40, 80, 160, 255,
+	};
+	std::vector<uint8_t> readback(straight.size());
+	TextureManager::Premultiply(straight.data(), readback.data(), 4);
+
+	std::vector<uint8_t> published(readback.size());
+	AsyncReadback::CopyFlipped(readback.data(), published.data(), 2, 2);
+
+	// flipped to top row first, with the pixels untouched
+	for (int i = 0; i < 8; i++)
+	{
+		EXPECT_EQ(published[i], readback[8 + i]);
+		EXPECT_EQ(published[8 + i], readback[i]);
+	}
+
+	// a reader dividing by alpha gets the original colours back
+	for (int i = 8; i < 16; i += 4)
+	{
+		float a = published[i + 3] / 255.f;
+		EXPECT_EQ(published[i + 3], 128);
+		for (int c = 0; c < 3; c++)
+			EXPECT_NEAR(published[i + c] / a, straight[i - 8 + c], 2.0);
+	}
+}
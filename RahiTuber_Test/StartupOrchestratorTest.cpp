@@ -0,0 +1,49 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "StartupOrchestrator.h"
+
+TEST(StartupOrchestratorTest, OverlapsIndependentPhases) {
+
+	StartupOrchestrator startup;
+	auto work = [](int ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); };
+
+	double start = startup.Now();
+	startup.Launch("Audio devices", [&]() { work(150); });
+	{
+		auto phase = startup.Time("Create windows");
+		work(100);
+	}
+	startup.Join("Audio devices");
+	auto ui = startup.Time("UI and fonts");
+	work(50);
+	ui.End();
+	double total = startup.Now() - start;
+
+	EXPECT_FALSE(startup.FirstFrameShown());
+	EXPECT_FALSE(startup.MarkFirstFrame(false));
+	EXPECT_TRUE(startup.MarkFirstFrame(true));
+	EXPECT_FALSE(startup.MarkFirstFrame(true));
+
+	// a line per phase, and the first frame
+	auto report = startup.Report();
+	ASSERT_EQ(report.size(), 5u);
+	EXPECT_NE(report.back().find("first avatar frame"), std::string::npos);
+
+	// run one after the other this would be 300ms
+	EXPECT_LT(total, 0.27);
+
+	auto phases = startup.GetPhases();
+	ASSERT_EQ(phases.size(), 4u);
+	int background = 0;
+	for (auto& phase : phases)
+	{
+		background += phase.background;
+		if (phase.name == "Waiting for Audio devices")
+		{
+			EXPECT_NEAR(phase.seconds, 0.05, 0.03);
+		}
+	}
+	EXPECT_EQ(background, 1);
+	EXPECT_GE(startup.FirstFrameSeconds(), total);
+}
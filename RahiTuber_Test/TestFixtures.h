@@ -0,0 +1,52 @@
+#pragma once
+
+#include "pch.h"
+#include "defines.h"
+
+#include "SFML/Graphics.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A folder of its own in the temp directory, emptied before each test and removed after it
+class TempFolderTest : public testing::Test {
+protected:
+	TempFolderTest()
+	{
+		const testing::TestInfo* test = testing::UnitTest::GetInstance()->current_test_info();
+		folder = fs::temp_directory_path() / (std::string("RahiTuber_") + test->test_case_name() + "_" + test->name());
+
+		std::error_code ec;
+		fs::remove_all(folder, ec);
+		fs::create_directories(folder);
+	}
+
+	~TempFolderTest()
+	{
+		std::error_code ec;
+		fs::remove_all(folder, ec);
+	}
+
+	// Saves a width x height image coloured by pixel(x, y) to name in the folder, and returns its path
+	std::string WriteImage(const fs::path& name, unsigned int width, unsigned int height, const std::function<sf::Color(unsigned int x, unsigned int y)>& pixel)
+	{
+		sf::Image img;
+		img.create(width, height);
+		for (unsigned int y = 0; y < height; y++)
+			for (unsigned int x = 0; x < width; x++)
+				img.setPixel(x, y, pixel(x, y));
+
+		fs::path path = folder / name;
+		fs::create_directories(path.parent_path());
+		EXPECT_TRUE(img.saveToFile(path.string())) << path;
+		return path.string();
+	}
+
+	fs::path folder;
+};
@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "TextureManager.h"
+
+#include <cstring>
+
+class TextureCacheTest : public TempFolderTest {
+protected:
+	static constexpr int NumImages = 12;
+	static constexpr unsigned int Size = 512;
+
+	TextureCacheTest()
+	{
+		for (int i = 0; i < NumImages; i++)
+		{
+			paths.push_back(WriteImage("layer" + std::to_string(i) + ".png", Size, Size, [i](unsigned int x, unsigned int y) {
+				return sf::Color((sf::Uint8)(x + i), (sf::Uint8)y, (sf::Uint8)(i * 20), (sf::Uint8)((x * y) >> 8));
+				}));
+		}
+		cachePath = folder / "set.rtcache";
+	}
+
+	// Loads the images through the set's cache, returning how long the textures took
+	float LoadThroughCache(TextureManager& texMan, const std::vector<std::string>& images)
+	{
+		sf::Clock timer;
+		texMan.BeginCache(cachePath);
+		for (auto& path : images)
+			EXPECT_NE(texMan.GetTexture(path, &caller), nullptr);
+		float ms = timer.getElapsedTime().asMicroseconds() / 1000.f;
+
+		EXPECT_TRUE(texMan.FinishCache());
+		return ms;
+	}
+
+	std::vector<std::string> paths;
+	fs::path cachePath;
+	int caller = 0;
+};
+
+TEST_F(TextureCacheTest, ColdAndWarmLoad) {
+
+	TextureManager cold;
+	LoadThroughCache(cold, paths);
+	sf::Image coldImage = cold.GetTexture(paths[0], &caller)->copyToImage();
+	EXPECT_EQ(cold.GetCache().Misses(), NumImages);
+	EXPECT_TRUE(fs::exists(cachePath));
+
+	TextureManager warm;
+	LoadThroughCache(warm, paths);
+	sf::Image warmImage = warm.GetTexture(paths[0], &caller)->copyToImage();
+	EXPECT_EQ(warm.GetCache().Hits(), NumImages);
+	EXPECT_EQ(warm.GetCache().Misses(), 0);
+
+	// cached pixels must be exactly what decoding produced
+	ASSERT_EQ(coldImage.getSize(), warmImage.getSize());
+	EXPECT_EQ(memcmp(coldImage.getPixelsPtr(), warmImage.getPixelsPtr(), Size * Size * 4), 0);
+
+	// the cache file can't be replaced while another manager has it mapped on Windows
+	cold.CloseCache();
+	warm.CloseCache();
+
+	// an edited image is decoded again, the rest still come from the cache
+	WriteImage("layer1.png", Size / 2, Size / 2, [](unsigned int x, unsigned int y) { return sf::Color::Red; });
+
+	TextureManager afterEdit;
+	LoadThroughCache(afterEdit, paths);
+	EXPECT_EQ(afterEdit.GetCache().Hits(), NumImages - 1);
+	EXPECT_EQ(afterEdit.GetCache().Misses(), 1);
+
+	// the session stays open after the set has loaded: images decoded later are added when it closes
+	EXPECT_TRUE(afterEdit.GetCache().IsActive());
+	std::string lateImage = WriteImage("late.png", Size / 2, Size / 2, [](unsigned int x, unsigned int y) { return sf::Color::Blue; });
+	EXPECT_NE(afterEdit.GetTexture(lateImage, &caller), nullptr);
+	EXPECT_EQ(afterEdit.GetCache().Misses(), 2);
+
+	afterEdit.CloseCache();
+	EXPECT_FALSE(fs::exists(folder / "set.rtcache.tmp"));
+
+	// a texture loaded again after Finish, eg. one unloaded while hidden, still comes from the cache
+	std::vector<std::string> withLate = paths;
+	withLate.push_back(lateImage);
+
+	TextureCache reload;
+	reload.Begin(cachePath);
+	sf::Texture tex;
+	for (auto& path : withLate)
+		EXPECT_TRUE(reload.LoadInto(path, tex));
+	EXPECT_TRUE(reload.Finish());
+	for (auto& path : withLate)
+		EXPECT_TRUE(reload.LoadInto(path, tex));
+	EXPECT_EQ(reload.Hits(), (NumImages + 1) * 2);
+	EXPECT_EQ(reload.Misses(), 0);
+	reload.Close();
+}
+
+TEST_F(TextureCacheTest, DISABLED_BenchmarkColdAndWarmLoad) {
+
+	TextureManager cold;
+	float coldMs = LoadThroughCache(cold, paths);
+
+	TextureManager warm;
+	float warmMs = LoadThroughCache(warm, paths);
+	EXPECT_EQ(warm.GetCache().Hits(), NumImages);
+
+	std::cout << "TextureCache: " << NumImages << " images, cold " << coldMs << "ms, warm " << warmMs << "ms" << std::endl;
+
+	cold.CloseCache();
+	warm.CloseCache();
+}
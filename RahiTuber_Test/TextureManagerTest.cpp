@@ -0,0 +1,51 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "TextureManager.h"
+
+using TextureManagerTest = TempFolderTest;
+
+TEST_F(TextureManagerTest, SharesIdenticalImages) {
+
+	WriteImage("face.png", 64, 64, [](unsigned int x, unsigned int y) { return sf::Color(200, 100, 50, 128); });
+	fs::create_directories(folder / "copy");
+	fs::copy_file(folder / "face.png", folder / "copy" / "face.png");
+
+	TextureManager texMan;
+	int callers[3] = {};
+	sf::Texture* original = texMan.GetTexture((folder / "face.png").string(), &callers[0]);
+	sf::Texture* respelled = texMan.GetTexture((folder / "copy" / ".." / "face.png").string(), &callers[1]);
+	sf::Texture* copied = texMan.GetTexture((folder / "copy" / "face.png").string(), &callers[2]);
+
+	ASSERT_NE(original, nullptr);
+	EXPECT_EQ(original, respelled);
+	EXPECT_EQ(original, copied);
+
+	int shared = 0;
+	EXPECT_EQ(texMan.GetSharedBytes(&shared), (size_t)64 * 64 * 4);
+	EXPECT_EQ(shared, 1);
+
+	// the copy keeps the texture alive after the original path is unloaded
+	texMan.UnloadTexture((folder / "face.png").string(), &callers[0]);
+	texMan.UnloadTexture((folder / "face.png").string(), &callers[1]);
+	EXPECT_EQ(copied->getSize().x, 64u);
+
+	texMan.Reset();
+}
+
+TEST_F(TextureManagerTest, PremultipliesInPlace) {
+
+	std::vector<uint8_t> pixels = {
+		200, 100, 50, 255,
+		200, 100, 50, 128,
+		200, 100, 50, 0,
+	};
+	TextureManager::Premultiply(pixels.data(), pixels.data(), 3);
+
+	std::vector<uint8_t> expected = {
+		200, 100, 50, 255,
+		100, 50, 25, 128,
+		0, 0, 0, 0,
+	};
+	EXPECT_EQ(pixels, expected);
+}
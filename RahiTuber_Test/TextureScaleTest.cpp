@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "TextureManager.h"
+
+#include <algorithm>
+
+TEST(TextureScaleTest, HalvesAndChoosesLevels) {
+
+	// box filter, odd sizes round up and reuse the last row and column
+	std::vector<uint8_t> src = {
+		0,0,0,0,  4,4,4,4,  100,100,100,100,
+		8,8,8,8,  12,12,12,12,  200,200,200,200,
+	};
+	std::vector<uint8_t> dst;
+	sf::Vector2u dstSize;
+	TextureManager::HalveImage(src, { 3, 2 }, dst, dstSize);
+	EXPECT_EQ(dstSize, sf::Vector2u(2, 1));
+	EXPECT_EQ(dst[0], 6);
+	EXPECT_EQ(dst[4], 150);
+
+	// the level follows the scale, but small wobbles around a boundary don't flip it
+	int level = 0;
+	level = TextureManager::ChooseScaleLevel(1.0f, level);
+	EXPECT_EQ(level, 0);
+	level = TextureManager::ChooseScaleLevel(0.45f, level);
+	EXPECT_EQ(level, 0);
+	level = TextureManager::ChooseScaleLevel(0.3f, level);
+	EXPECT_EQ(level, 1);
+	level = TextureManager::ChooseScaleLevel(0.55f, level);
+	EXPECT_EQ(level, 1);
+	level = TextureManager::ChooseScaleLevel(0.2f, level);
+	EXPECT_EQ(level, 2);
+	level = TextureManager::ChooseScaleLevel(0.01f, level);
+	EXPECT_EQ(level, TextureManager::MaxScaleLevel);
+	level = TextureManager::ChooseScaleLevel(0.9f, level);
+	EXPECT_EQ(level, 0);
+
+	// a sheet's frames stay apart: each level must divide the frame size evenly
+	EXPECT_EQ(TextureManager::MaxScaleLevelForFrame({ 96, 96 }), TextureManager::MaxScaleLevel);
+	EXPECT_EQ(TextureManager::MaxScaleLevelForFrame({ 96, 40 }), 3);
+	EXPECT_EQ(TextureManager::MaxScaleLevelForFrame({ 100, 128 }), 2);
+	EXPECT_EQ(TextureManager::MaxScaleLevelForFrame({ 101, 128 }), 0);
+	EXPECT_EQ(TextureManager::MaxScaleLevelForFrame({ 0, 0 }), 0);
+}
+
+TEST(TextureScaleTest, DownscalesWithoutBleeding) {
+
+	// a two frame sheet, an opaque red frame next to a half transparent blue one, premultiplied
+	const sf::Vector2u size(128, 64);
+	std::vector<uint8_t> sheet((size_t)size.x * size.y * 4);
+	for (unsigned int y = 0; y < size.y; y++)
+	{
+		for (unsigned int x = 0; x < size.x; x++)
+		{
+			uint8_t* p = &sheet[((size_t)y * size.x + x) * 4];
+			if (x < 64)
+				p[0] = 255, p[3] = 255;
+			else
+				p[2] = 128, p[3] = 128;
+		}
+	}
+
+	for (int level = 1; level <= 3; level++)
+	{
+		std::vector<uint8_t> small;
+		sf::Vector2u smallSize;
+		TextureManager::DownscaleImage(sheet, size, level, { 64, 64 }, small, smallSize);
+		ASSERT_EQ(smallSize, sf::Vector2u(size.x >> level, size.y >> level));
+
+		// flat frames stay flat right up to the frame edge
+		const unsigned int half = smallSize.x / 2;
+		for (unsigned int y = 0; y < smallSize.y; y++)
+		{
+			for (unsigned int x = 0; x < smallSize.x; x++)
+			{
+				const uint8_t* p = &small[((size_t)y * smallSize.x + x) * 4];
+				if (x < half)
+				{
+					EXPECT_EQ(p[0], 255);
+					EXPECT_EQ(p[2], 0);
+					EXPECT_EQ(p[3], 255);
+				}
+				else
+				{
+					EXPECT_EQ(p[0], 0);
+					EXPECT_EQ(p[2], 128);
+					EXPECT_EQ(p[3], 128);
+				}
+			}
+		}
+	}
+
+	// filtered as one image the edge blends, rings a little, and stays a valid premultiplied colour
+	std::vector<uint8_t> whole;
+	sf::Vector2u wholeSize;
+	TextureManager::DownscaleImage(sheet, size, 2, {}, whole, wholeSize);
+	bool blended = false;
+	for (size_t i = 0; i < whole.size(); i += 4)
+	{
+		for (int c = 0; c < 3; c++)
+			EXPECT_LE(whole[i + c], whole[i + 3]);
+		blended |= whole[i] != 0 && whole[i + 2] != 0;
+	}
+	EXPECT_TRUE(blended);
+
+	// odd sizes round up
+	std::vector<uint8_t> odd((size_t)33 * 17 * 4, 200);
+	std::vector<uint8_t> oddSmall;
+	sf::Vector2u oddSize;
+	TextureManager::DownscaleImage(odd, { 33, 17 }, 2, {}, oddSmall, oddSize);
+	EXPECT_EQ(oddSize, sf::Vector2u(9, 5));
+	for (uint8_t v : oddSmall)
+		EXPECT_EQ(v, 200);
+}
+
+TEST(TextureScaleTest, DISABLED_BenchmarkDownscale) {
+
+	// what the worker spends on each level of a large layer image, and the video memory it gives back
+	const sf::Vector2u size(2048, 2048);
+	std::vector<uint8_t> image((size_t)size.x * size.y * 4);
+	for (size_t i = 0; i < image.size(); i += 4)
+	{
+		image[i + 3] = (uint8_t)(i * 7 >> 4);
+		for (int c = 0; c < 3; c++)
+			image[i + c] = (uint8_t)std::min<size_t>(image[i + 3], (i >> c) & 0xff);
+	}
+
+	const float fullMB = image.size() / (1024.f * 1024.f);
+	for (int level = 1; level <= TextureManager::MaxScaleLevel; level++)
+	{
+		std::vector<uint8_t> small;
+		sf::Vector2u smallSize;
+		sf::Clock timer;
+		TextureManager::DownscaleImage(image, size, level, {}, small, smallSize);
+		float ms = timer.getElapsedTime().asMicroseconds() / 1000.f;
+
+		std::cout << "Level " << level << ": " << ms << "ms, " << fullMB << " MB stored as " << small.size() / (1024.f * 1024.f) << " MB" << std::endl;
+	}
+}
@@ -0,0 +1,49 @@
+#include "pch.h"
+#include "TestFixtures.h"
+
+#include "TiledTexture.h"
+
+TEST(TiledTextureTest, UploadsOnlyTilesInUse) {
+
+	// a 16 frame strip of 128px frames, with 256px tiles
+	const unsigned int frameSize = 128;
+	const unsigned int frames = 16;
+	sf::Vector2u size(frameSize * frames, frameSize);
+	std::vector<uint8_t> pixels((size_t)size.x * size.y * 4);
+	for (unsigned int f = 0; f < frames; f++)
+	{
+		for (unsigned int y = 0; y < frameSize; y++)
+		{
+			for (unsigned int x = 0; x < frameSize; x++)
+				pixels[((size_t)y * size.x + f * frameSize + x) * 4] = (uint8_t)f;
+		}
+	}
+
+	TiledTexture tiled(std::move(pixels), size, 256);
+
+	sf::IntRect local;
+	sf::Texture* first = tiled.GetTile(sf::IntRect(0, 0, frameSize, frameSize), local);
+	ASSERT_NE(first, nullptr);
+	EXPECT_EQ(first->getSize(), sf::Vector2u(256, 128));
+
+	// the next frame is in the same tile
+	EXPECT_EQ(tiled.GetTile(sf::IntRect(frameSize, 0, frameSize, frameSize), local), first);
+	EXPECT_EQ(local.left, (int)frameSize);
+	EXPECT_EQ(tiled.Uploads(), 1);
+
+	// a frame further along gets its own tile, holding the right pixels
+	sf::Texture* later = tiled.GetTile(sf::IntRect(frameSize * 11, 0, frameSize, frameSize), local);
+	ASSERT_NE(later, nullptr);
+	EXPECT_NE(later, first);
+	EXPECT_EQ(local.left, (int)frameSize);
+	EXPECT_EQ(later->copyToImage().getPixel(local.left, 0).r, 11);
+	EXPECT_EQ(tiled.LoadedTiles(), 2);
+	EXPECT_EQ(tiled.LoadedBytes(), (size_t)2 * 256 * 128 * 4);
+
+	// larger than a tile, or outside the image
+	EXPECT_EQ(tiled.GetTile(sf::IntRect(0, 0, 512, frameSize), local), nullptr);
+	EXPECT_EQ(tiled.GetTile(sf::IntRect(size.x - 64, 0, frameSize, frameSize), local), nullptr);
+
+	tiled.ReleaseUnused(0.f);
+	EXPECT_EQ(tiled.LoadedTiles(), 0);
+}
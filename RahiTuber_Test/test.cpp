@@ -2,6 +2,9 @@
 
 #include  "MainEngine.h"
 
+// Benchmarks print their timings and are disabled by default. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter=*.DISABLED_Benchmark*
+
 class MainEngineTest : public testing::Test {
 protected:
 	MainEngineTest() {
@@ -69,3 +72,483 @@ TEST_F(LayerSetTest, LayerSetLoading) {
 		}
 	}
 }
+
+// Draws the main avatar and every co-host for a number of frames, returning the time per frame
+static double DrawAvatarFrames(MainEngine& engine, FrameClock& clock, int frames)
+{
+	sf::Clock timer;
+	for (int f = 0; f < frames; f++)
+	{
+		const FrameTime& frame = clock.Advance();
+		engine.appConfig->_layersRT.clear(sf::Color(0, 0, 0, 0));
+		engine.layerMan->Draw(frame, &engine.appConfig->_layersRT, engine.appConfig->_scrH, engine.appConfig->_scrW, 0.5f, 1.f, (PhonemeMask)0);
+		for (auto& coHost : engine._coHosts)
+			coHost->Draw(frame, 0.5f, 1.f, (PhonemeMask)0);
+	}
+	return timer.getElapsedTime().asMicroseconds() * 0.001 / frames;
+}
+
+// Adds a co-host showing the main avatar's layer set, and waits for it to load
+static CoHostAvatar* AddTestCoHost(MainEngine& engine, FrameClock& clock, int n)
+{
+	CoHostSettings settings;
+	settings.name = "Test co-host " + std::to_string(n);
+	settings.layerSet = engine.appConfig->_lastLayerSet;
+	engine.appConfig->_coHosts.push_back(settings);
+	engine.SyncCoHosts();
+
+	// the set starts loading on the co-host's first frame
+	DrawAvatarFrames(engine, clock, 1);
+	while (engine._coHosts.back()->GetLayerManager()->IsLoading())
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	return engine._coHosts.back().get();
+}
+
+TEST_F(LayerSetTest, CoHostsShareTextures) {
+
+	while (engine.layerMan->IsLoading())
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	FrameClock clock;
+	DrawAvatarFrames(engine, clock, 60);
+
+	const auto& layers = engine.layerMan->GetLayers();
+
+	for (int n = 1; n <= 3; n++)
+	{
+		CoHostAvatar* coHost = AddTestCoHost(engine, clock, n);
+
+		// the same files are drawn from the same textures
+		const auto& coHostLayers = coHost->GetLayerManager()->GetLayers();
+		ASSERT_EQ(coHostLayers.size(), layers.size());
+		for (size_t l = 0; l < layers.size(); l++)
+		{
+			for (auto& sp : layers[l]._sprites)
+			{
+				if (sp.second.sprite->getTexture() != nullptr && coHostLayers[l]._sprites.count(sp.first))
+					EXPECT_EQ(coHostLayers[l]._sprites.at(sp.first).sprite->getTexture(), sp.second.sprite->getTexture());
+			}
+		}
+
+		DrawAvatarFrames(engine, clock, 60);
+	}
+
+	// removing the co-hosts leaves the main avatar's textures loaded
+	engine.appConfig->_coHosts.clear();
+	engine.SyncCoHosts();
+
+	int probe = 0;
+	for (auto& layer : layers)
+	{
+		for (auto& sp : layer._sprites)
+		{
+			sf::Texture* tex = sp.second.sprite->getTexture();
+			if (tex == nullptr || sp.second.sprite->TexturePath().empty())
+				continue;
+
+			EXPECT_EQ(engine.appConfig->_textureMan.GetTexture(sp.second.sprite->TexturePath(), &probe), tex);
+			engine.appConfig->_textureMan.UnloadTexture(sp.second.sprite->TexturePath(), &probe);
+		}
+	}
+}
+
+// Starts count copies of this test binary at once, each drawing the test avatar on its own, and returns
+// each one's frame time and memory. They're the separate processes co-hosts replace.
+static std::vector<std::pair<double, size_t>> RunAvatarProcesses(const std::string& appLocation, int count)
+{
+#ifdef _WIN32
+	const std::string command = "\"\"" + appLocation + "RahiTuber_Test.exe\" --gtest_also_run_disabled_tests --gtest_filter=LayerSetTest.DISABLED_BenchmarkOneAvatarProcess\"";
+	auto open = [](const std::string& cmd) { return _popen(cmd.c_str(), "r"); };
+	auto close = [](FILE* f) { return _pclose(f); };
+#else
+	const std::string command = "\"" + appLocation + "RahiTuber_Test\" --gtest_also_run_disabled_tests --gtest_filter=LayerSetTest.DISABLED_BenchmarkOneAvatarProcess";
+	auto open = [](const std::string& cmd) { return popen(cmd.c_str(), "r"); };
+	auto close = [](FILE* f) { return pclose(f); };
+#endif
+
+	std::vector<FILE*> processes;
+	for (int p = 0; p < count; p++)
+	{
+		if (FILE* process = open(command))
+			processes.push_back(process);
+	}
+
+	std::vector<std::pair<double, size_t>> results;
+	for (FILE* process : processes)
+	{
+		char line[256];
+		while (fgets(line, sizeof(line), process))
+		{
+			double ms = 0;
+			unsigned long long memory = 0;
+			if (sscanf(line, "avatar process: %lf %llu", &ms, &memory) == 2)
+				results.push_back({ ms, (size_t)memory });
+		}
+		close(process);
+	}
+	return results;
+}
+
+// Run by RunAvatarProcesses, in a process of its own
+TEST_F(LayerSetTest, DISABLED_BenchmarkOneAvatarProcess) {
+
+	while (engine.layerMan->IsLoading())
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	FrameClock clock;
+	DrawAvatarFrames(engine, clock, 60);
+	double ms = DrawAvatarFrames(engine, clock, 120);
+	std::cout << "avatar process: " << ms << " " << FramePacer::ProcessMemoryBytes() << std::endl;
+}
+
+TEST_F(LayerSetTest, DISABLED_BenchmarkCoHosts) {
+
+	while (engine.layerMan->IsLoading())
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	FrameClock clock;
+	const double MB = 1024.0 * 1024.0;
+	double mainMs = DrawAvatarFrames(engine, clock, 60);
+	size_t mainMemory = FramePacer::ProcessMemoryBytes();
+	std::cout << "1 avatar: " << mainMs << "ms per frame, " << mainMemory / MB << "MB" << std::endl;
+
+	for (int n = 1; n <= 3; n++)
+	{
+		AddTestCoHost(engine, clock, n);
+
+		double ms = DrawAvatarFrames(engine, clock, 60);
+		size_t memory = FramePacer::ProcessMemoryBytes();
+		std::cout << n + 1 << " avatars in one process: " << ms << "ms per frame, " << memory / MB << "MB, "
+			<< ((double)memory - (double)mainMemory) / n / MB << "MB per co-host" << std::endl;
+
+		// the same number of avatars as processes of their own, all running at once
+		auto processes = RunAvatarProcesses(engine.appConfig->_appLocation, n + 1);
+		ASSERT_EQ(processes.size(), (size_t)n + 1);
+
+		double slowestMs = 0;
+		size_t totalMemory = 0;
+		for (auto& process : processes)
+		{
+			slowestMs = std::max(slowestMs, process.first);
+			totalMemory += process.second;
+		}
+		std::cout << n + 1 << " avatars as processes: " << slowestMs << "ms per frame in the slowest, "
+			<< totalMemory / MB << "MB between them" << std::endl;
+	}
+
+	EXPECT_EQ(engine._coHosts.size(), 3u);
+
+	engine.appConfig->_coHosts.clear();
+	engine.SyncCoHosts();
+}
+
+TEST_F(MainEngineTest, DISABLED_BenchmarkLayerList) {
+
+	ImGuiStyle& style = ImGui::GetStyle();
+	LayerManager* layerMan = engine.layerMan;
+
+	// the menu with a 400px layer list, so most of the rows are out of view
+	auto drawMenu = [&]()
+	{
+		ImGui::SFML::SetCurrentWindow(engine.appConfig->_window);
+		ImGui::SFML::Update(engine.appConfig->_window, sf::milliseconds(16));
+		ImGui::SetNextWindowPos({ 0, 0 });
+		ImGui::SetNextWindowSize({ 500, 700 });
+		ImGui::Begin("layerlist_benchmark");
+		layerMan->DrawGUI(style, 400);
+		ImGui::End();
+		ImGui::EndFrame();
+	};
+
+	const int numFrames = 50;
+	for (int count : { 50, 300, 1000 })
+	{
+		while (layerMan->GetLayers().size() < count)
+			layerMan->AddLayer();
+
+		// every new row is drawn once to measure it
+		sf::Clock timer;
+		drawMenu();
+		float firstMs = timer.getElapsedTime().asMicroseconds() / 1000.f;
+
+		timer.restart();
+		for (int f = 0; f < numFrames; f++)
+			drawMenu();
+		float frameMs = timer.getElapsedTime().asMicroseconds() / 1000.f / numFrames;
+
+		std::cout << "Layer list: " << count << " layers, first frame " << firstMs << "ms, then " << frameMs << "ms per frame" << std::endl;
+	}
+
+	EXPECT_EQ(layerMan->GetLayers().size(), 1000);
+}
+
+// Offline phoneme evaluation, run with the benchmarks.
+// Put labelled clips in PhonemeClips/, named <label>_<anything>.wav where label is one of a, e, s, p, oo, silence.
+// Each clip is fed through the capture callback and analysis in FRAMES_PER_BUFFER chunks,
+// then scored for accuracy (fraction of buffers showing the label) and latency (time until the label first shows).
+static bool ReadWavClip(const std::string& path, std::vector<float>& samples, int& channels, int& sampleRate)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+
+	char riff[12];
+	file.read(riff, 12);
+	if (!file || std::string(riff, 4) != "RIFF" || std::string(riff + 8, 4) != "WAVE")
+		return false;
+
+	int format = 0;
+	int bits = 0;
+	while (file)
+	{
+		char chunkId[4];
+		uint32_t chunkSize = 0;
+		file.read(chunkId, 4);
+		file.read((char*)&chunkSize, 4);
+		if (!file)
+			break;
+
+		std::string id(chunkId, 4);
+		if (id == "fmt ")
+		{
+			std::vector<char> fmt(chunkSize);
+			file.read(fmt.data(), chunkSize);
+			format = *(uint16_t*)&fmt[0];
+			channels = *(uint16_t*)&fmt[2];
+			sampleRate = *(uint32_t*)&fmt[4];
+			bits = *(uint16_t*)&fmt[14];
+		}
+		else if (id == "data")
+		{
+			std::vector<char> data(chunkSize);
+			file.read(data.data(), chunkSize);
+
+			if (format == 1 && bits == 16)
+			{
+				for (size_t i = 0; i + 1 < data.size(); i += 2)
+					samples.push_back(*(int16_t*)&data[i] / 32768.f);
+			}
+			else if (format == 3 && bits == 32)
+			{
+				for (size_t i = 0; i + 3 < data.size(); i += 4)
+					samples.push_back(*(float*)&data[i]);
+			}
+			else
+				return false;
+
+			return channels > 0 && channels <= 2;
+		}
+		else
+			file.seekg(chunkSize + (chunkSize & 1), std::ios::cur);
+	}
+
+	return false;
+}
+
+struct PhonemeClip
+{
+	std::string name;
+	PhonemeMask label = PH_NONE;
+	std::vector<float> samples;
+	int channels = 1;
+	int sampleRate = SAMPLE_RATE;
+};
+
+static std::vector<PhonemeClip> LoadPhonemeClips()
+{
+	const std::map<std::string, PhonemeMask> labels = {
+		{ "a", PH_A }, { "e", PH_E }, { "s", PH_S }, { "p", PH_P }, { "oo", PH_W }, { "silence", PH_NONE }
+	};
+
+	std::vector<PhonemeClip> clips;
+	if (!fs::exists("PhonemeClips"))
+		return clips;
+
+	for (auto& entry : fs::directory_iterator("PhonemeClips"))
+	{
+		if (entry.path().extension() != ".wav")
+			continue;
+
+		PhonemeClip clip;
+		clip.name = entry.path().stem().string();
+		auto label = labels.find(clip.name.substr(0, clip.name.find('_')));
+		if (label == labels.end())
+			continue;
+
+		clip.label = label->second;
+		if (ReadWavClip(entry.path().string(), clip.samples, clip.channels, clip.sampleRate))
+			clips.push_back(clip);
+		else
+			ADD_FAILURE() << "Could not read " << clip.name;
+	}
+
+	return clips;
+}
+
+// Feeds buffers [firstBuffer, lastBuffer) of the clip through capture and analysis, calling onBuffer after each
+static void FeedPhonemeClip(MainEngine& engine, const PhonemeClip& clip, int firstBuffer, int lastBuffer, const std::function<void()>& onBuffer)
+{
+	auto audio = engine.audioConfig;
+	audio->_numChannels = clip.channels;
+	audio->_currentSampleRate = clip.sampleRate;
+	engine.appConfig->_fps = (float)clip.sampleRate / FRAMES_PER_BUFFER;
+
+	size_t bufferSamples = FRAMES_PER_BUFFER * clip.channels;
+	for (int b = firstBuffer; b < lastBuffer && (b + 1) * bufferSamples <= clip.samples.size(); b++)
+	{
+		recordCallback(&clip.samples[b * bufferSamples], nullptr, FRAMES_PER_BUFFER, nullptr, 0, nullptr);
+		engine.doAudioAnalysis();
+		onBuffer();
+	}
+}
+
+static void ResetPhonemeState(AudioConfig* audio)
+{
+	audio->_capturedFrames = 0;
+	audio->_phonemeVotes.Clear();
+	audio->phLastSwitched = 0;
+	audio->_prevPhoneme = PH_NONE;
+	audio->_frames.clear();
+}
+
+// Scores the second half of each clip, reporting accuracy and the latency until the label first shows
+static double EvaluatePhonemeClips(MainEngine& engine, const std::vector<PhonemeClip>& clips, bool secondHalfOnly)
+{
+	int totalBuffers = 0;
+	int totalCorrect = 0;
+
+	for (auto& clip : clips)
+	{
+		int numBuffers = clip.samples.size() / (FRAMES_PER_BUFFER * clip.channels);
+		int first = secondHalfOnly ? numBuffers / 2 : 0;
+
+		ResetPhonemeState(engine.audioConfig);
+
+		int buffers = 0;
+		int correct = 0;
+		double latency = -1;
+
+		FeedPhonemeClip(engine, clip, first, numBuffers, [&]() {
+			buffers++;
+			if (engine.audioConfig->_prevPhoneme == clip.label)
+			{
+				correct++;
+				if (latency < 0)
+					latency = buffers * (double)FRAMES_PER_BUFFER / clip.sampleRate;
+			}
+		});
+
+		std::cout << clip.name << ": accuracy " << (buffers ? 100.0 * correct / buffers : 0.0) << "%, latency "
+			<< (latency < 0 ? std::string("never") : std::to_string(latency * 1000) + "ms") << std::endl;
+
+		if (clip.label != PH_NONE)
+			EXPECT_GE(latency, 0) << clip.name << " never detected";
+
+		totalBuffers += buffers;
+		totalCorrect += correct;
+	}
+
+	double accuracy = totalBuffers > 0 ? (double)totalCorrect / totalBuffers : 0.0;
+	std::cout << "Overall phoneme accuracy: " << 100.0 * accuracy << "%" << std::endl;
+	return accuracy;
+}
+
+TEST_F(MainEngineTest, DISABLED_BenchmarkPhonemeClips) {
+
+	auto clips = LoadPhonemeClips();
+	if (clips.empty())
+	{
+		std::cout << "No clips in PhonemeClips, skipping phoneme evaluation" << std::endl;
+		return;
+	}
+
+	engine.StopAudioStream();
+	engine.audioConfig->_devIdx = -1;
+	engine.audioConfig->_spectralPhonemes = false;
+
+	EvaluatePhonemeClips(engine, clips, false);
+}
+
+TEST_F(MainEngineTest, DISABLED_BenchmarkSpectralPhonemeClips) {
+
+	auto clips = LoadPhonemeClips();
+	if (clips.empty())
+	{
+		std::cout << "No clips in PhonemeClips, skipping spectral phoneme evaluation" << std::endl;
+		return;
+	}
+
+	engine.StopAudioStream();
+	engine.audioConfig->_devIdx = -1;
+	engine.audioConfig->_spectralPhonemes = true;
+
+	auto& classifier = engine.audioConfig->_phonemeClassifier;
+	for (int c = 0; c < PhonemeClassifier::NumClasses; c++)
+		classifier.ClearCalibration(PhonemeClassifier::ClassPhoneme(c));
+
+	// calibrate on the first half of every clip, then score the second half
+	for (auto& clip : clips)
+	{
+		int numBuffers = clip.samples.size() / (FRAMES_PER_BUFFER * clip.channels);
+		ResetPhonemeState(engine.audioConfig);
+		classifier.StartCalibration(clip.label);
+		FeedPhonemeClip(engine, clip, 0, numBuffers / 2, [&]() { classifier.StartCalibration(clip.label); });
+		classifier.StopCalibration();
+	}
+
+	EvaluatePhonemeClips(engine, clips, true);
+}
+
+TEST_F(MainEngineTest, LatencyTestSwapsInAnImpulse) {
+
+	auto audio = engine.audioConfig;
+	AudioStreamFormat format;
+	format.channels = 2;
+	std::vector<float> input(FRAMES_PER_BUFFER * 2, 0.5f);
+
+	// the device's input is silenced for the test
+	audio->_latencyTest = true;
+	for (int b = 0; b < 4; b++)
+	{
+		recordCallback(input.data(), nullptr, FRAMES_PER_BUFFER, nullptr, 0, &format);
+		engine.doAudioAnalysis();
+	}
+	EXPECT_EQ(audio->_midHi, 0.f);
+	EXPECT_LT(audio->_impulseTime, 0);
+
+	audio->_impulseBlocks = 3;
+	for (int b = 0; b < 3; b++)
+	{
+		recordCallback(input.data(), nullptr, FRAMES_PER_BUFFER, nullptr, 0, &format);
+		engine.doAudioAnalysis();
+	}
+	EXPECT_GT(audio->_midHi, 0.f);
+	EXPECT_GT(audio->_impulseTime, 0);
+	EXPECT_EQ(audio->_impulseBlocks, 0);
+
+	// the whole loop: the engine arms an impulse once the layer is quiet, and its latency is
+	// taken at the first frame displayed with the layer talking
+	LayerManager::LayerInfo* layer = engine.layerMan->AddLayer();
+	ASSERT_NE(layer, nullptr);
+	layer->_talkThreshold = 0.05f;
+
+	auto& latency = engine.appConfig->_latency;
+	latency.Clear();
+	sf::Clock timeout;
+	while (latency.GetStats(LatencyTracker::SourceLoopback).count == 0 && timeout.getElapsedTime().asSeconds() < 10)
+	{
+		recordCallback(input.data(), nullptr, FRAMES_PER_BUFFER, nullptr, 0, &format);
+		engine.doAudioAnalysis();
+		engine.render();
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	auto stats = latency.GetStats(LatencyTracker::SourceLoopback);
+	ASSERT_GT(stats.count, 0);
+	EXPECT_GT(stats.meanMs, 0.f);
+	EXPECT_LE(stats.stageMeanMs[LatencyTracker::StageHandled], stats.stageMeanMs[LatencyTracker::StageDrawn]);
+	EXPECT_LE(stats.stageMeanMs[LatencyTracker::StageDrawn], stats.stageMeanMs[LatencyTracker::StageDisplayed]);
+
+	audio->_latencyTest = false;
+}